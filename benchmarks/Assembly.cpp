@@ -0,0 +1,278 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <overkit.hpp>
+
+#include <support/CommandArgs.hpp>
+#include <support/Constants.hpp>
+#include <support/Decomp.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+
+using support::command_args;
+using support::command_args_parser;
+
+namespace {
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumBoxes, int
+  &NumTrials);
+void AssemblyBenchmark(int N, int NumBoxes, int NumTrials);
+}
+
+int main(int argc, char **argv) {
+
+  MPI_Init(&argc, &argv);
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  try {
+    bool Help;
+    int N, NumBoxes, NumTrials;
+    GetCommandLineArguments(argc, argv, Help, N, NumBoxes, NumTrials);
+    if (!Help) {
+      AssemblyBenchmark(N, NumBoxes, NumTrials);
+    }
+  } catch (const std::exception &Exception) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Encountered error:\n%s\n", Exception.what()); std::fflush(stderr);
+    }
+  } catch (...) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Unknown error occurred.\n"); std::fflush(stderr);
+    }
+  }
+
+  MPI_Finalize();
+
+  return 0;
+
+}
+
+namespace {
+
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumBoxes, int
+  &NumTrials) {
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  command_args_parser CommandArgsParser(WorldRank == 0);
+  CommandArgsParser.SetHelpUsage("AssemblyBenchmark [<options> ...]");
+  CommandArgsParser.SetHelpDescription("Times assembly of a background grid containing a ring of "
+    "rotated boxes, with and without the synchronization points used for profiling.");
+  CommandArgsParser.AddOption<int>("size", 'N', "Characteristic size of grids [ Default: 161 ]");
+  CommandArgsParser.AddOption<int>("boxes", 'b', "Number of boxes [ Default: 8 ]");
+  CommandArgsParser.AddOption<int>("trials", 't', "Number of assemblies to time in each mode "
+    "[ Default: 5 ]");
+
+  command_args CommandArgs = CommandArgsParser.Parse({{argc}, argv});
+
+  Help = CommandArgs.GetOptionValue<bool>("help", false);
+  N = CommandArgs.GetOptionValue<int>("size", 161);
+  NumBoxes = CommandArgs.GetOptionValue<int>("boxes", 8);
+  NumTrials = CommandArgs.GetOptionValue<int>("trials", 5);
+
+}
+
+double TimeAssembly(const std::shared_ptr<ovk::context> &Context, int N, int NumBoxes) {
+
+  int NumWorldProcs, WorldRank;
+  MPI_Comm_size(MPI_COMM_WORLD, &NumWorldProcs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  constexpr double PI = support::PI;
+
+  int NumGrids = NumBoxes+1;
+
+  ovk::domain Domain = ovk::CreateDomain(Context, ovk::domain::params()
+    .SetDimension(2)
+    .SetComm(MPI_COMM_WORLD)
+  );
+
+  ovk::array<ovk::tuple<int>> GridSizes({NumGrids});
+  GridSizes(0) = {N,N,1};
+  for (int iBox = 0; iBox < NumBoxes; ++iBox) {
+    GridSizes(iBox+1) = {N/2,N/2,1};
+  }
+
+  ovk::array<long long> NumPointsPerGrid({NumGrids});
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    NumPointsPerGrid(iGrid) = (long long)(GridSizes(iGrid)(0))*(long long)(GridSizes(iGrid)(1));
+  }
+
+  ovk::array<int,2> GridProcRanges({{NumGrids,2}});
+  support::DecomposeDomain(NumPointsPerGrid, NumWorldProcs, GridProcRanges);
+
+  ovk::array<int> GridIDs({NumGrids});
+  ovk::array<ovk::optional<ovk::grid::params>> MaybeGridParams({NumGrids});
+  ovk::array<ovk::optional<ovk::geometry::params>> MaybeGeometryParams({NumGrids});
+  ovk::array<MPI_Comm> CartComms({NumGrids}, MPI_COMM_NULL);
+
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    GridIDs(iGrid) = iGrid+1;
+    bool IsLocal = WorldRank >= GridProcRanges(iGrid,0) && WorldRank < GridProcRanges(iGrid,1);
+    MPI_Comm GridComm;
+    MPI_Comm_split(MPI_COMM_WORLD, IsLocal ? 0 : MPI_UNDEFINED, WorldRank, &GridComm);
+    if (IsLocal) {
+      int NumGridProcs;
+      MPI_Comm_size(GridComm, &NumGridProcs);
+      ovk::tuple<int> CartDims = support::CreateCartesianDecompDims(NumGridProcs, 2, {0,0,1});
+      int CartPeriods[2] = {0,0};
+      MPI_Cart_create(GridComm, 2, CartDims.Data(), CartPeriods, 1, &CartComms(iGrid));
+      MPI_Comm_free(&GridComm);
+      ovk::range GlobalRange = {GridSizes(iGrid)};
+      ovk::range LocalRange = support::CartesianDecomp(2, GlobalRange, CartComms(iGrid));
+      MaybeGridParams(iGrid) = ovk::grid::params()
+        .SetName(iGrid == 0 ? "Background" : "Box" + std::to_string(iGrid))
+        .SetDimension(2)
+        .SetComm(CartComms(iGrid))
+        .SetGlobalRange(GlobalRange)
+        .SetLocalRange(LocalRange);
+      MaybeGeometryParams(iGrid) = ovk::geometry::params()
+        .SetType(iGrid == 0 ? ovk::geometry_type::UNIFORM : ovk::geometry_type::ORIENTED_UNIFORM);
+    }
+  }
+
+  Domain.CreateGrids(GridIDs, MaybeGridParams);
+
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    if (CartComms(iGrid) != MPI_COMM_NULL) {
+      MPI_Comm_free(&CartComms(iGrid));
+    }
+  }
+
+  constexpr int GEOMETRY_ID = 1;
+  constexpr int STATE_ID = 2;
+  constexpr int OVERLAP_ID = 3;
+  constexpr int CONNECTIVITY_ID = 4;
+
+  Domain.CreateComponent<ovk::geometry_component>(GEOMETRY_ID);
+  Domain.CreateComponent<ovk::state_component>(STATE_ID);
+  Domain.CreateComponent<ovk::overlap_component>(OVERLAP_ID);
+  Domain.CreateComponent<ovk::connectivity_component>(CONNECTIVITY_ID);
+
+  {
+
+    auto GeometryComponentHandle = Domain.EditComponent<ovk::geometry_component>(GEOMETRY_ID);
+    ovk::geometry_component &GeometryComponent = *GeometryComponentHandle;
+
+    auto StateComponentHandle = Domain.EditComponent<ovk::state_component>(STATE_ID);
+    ovk::state_component &StateComponent = *StateComponentHandle;
+
+    GeometryComponent.CreateGeometries(GridIDs, std::move(MaybeGeometryParams));
+    StateComponent.CreateStates(GridIDs);
+
+    for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+      int GridID = GridIDs(iGrid);
+      if (!Domain.GridIsLocal(GridID)) continue;
+      const ovk::grid &Grid = Domain.Grid(GridID);
+      const ovk::range &LocalRange = Grid.LocalRange();
+      const ovk::tuple<int> &Size = GridSizes(iGrid);
+      // Boxes of width 0.5 centered on a circle of radius 0.5, each rotated by its angle
+      double Angle = iGrid > 0 ? 2.*PI*double(iGrid-1)/double(NumBoxes) : 0.;
+      double Scale = iGrid > 0 ? 0.5 : 2.;
+      double CenterX = iGrid > 0 ? 0.5*std::cos(Angle) : 0.;
+      double CenterY = iGrid > 0 ? 0.5*std::sin(Angle) : 0.;
+      auto GeometryHandle = GeometryComponent.EditGeometry(GridID);
+      auto CoordsHandle = GeometryHandle->EditCoords();
+      ovk::array<ovk::distributed_field<double>> &Coords = *CoordsHandle;
+      for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+        for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+          double U = Scale*(double(i)/double(Size(0)-1)-0.5);
+          double V = Scale*(double(j)/double(Size(1)-1)-0.5);
+          Coords(0)(i,j,0) = CenterX + std::cos(Angle)*U - std::sin(Angle)*V;
+          Coords(1)(i,j,0) = CenterY + std::sin(Angle)*U + std::cos(Angle)*V;
+        }
+      }
+    }
+
+  }
+
+  ovk::assembler Assembler = ovk::CreateAssembler(Context);
+
+  Assembler.Bind(Domain, ovk::assembler::bindings()
+    .SetGeometryComponentID(GEOMETRY_ID)
+    .SetStateComponentID(STATE_ID)
+    .SetOverlapComponentID(OVERLAP_ID)
+    .SetConnectivityComponentID(CONNECTIVITY_ID)
+  );
+
+  {
+    auto OptionsHandle = Assembler.EditOptions();
+    ovk::assembler::options &Options = *OptionsHandle;
+    Options.SetOverlappable({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, true);
+    Options.SetInferBoundaries(ovk::ALL_GRIDS, true);
+    Options.SetOccludes({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, ovk::occludes::COARSE);
+    Options.SetEdgePadding({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, 2);
+    Options.SetEdgeSmoothing(ovk::ALL_GRIDS, 2);
+    Options.SetConnectionType({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, ovk::connection_type::LINEAR);
+    Options.SetFringeSize(ovk::ALL_GRIDS, 2);
+    Options.SetMinimizeOverlap({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, true);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  double StartTime = MPI_Wtime();
+
+  Assembler.Assemble();
+
+  double Elapsed = MPI_Wtime() - StartTime;
+
+  MPI_Allreduce(MPI_IN_PLACE, &Elapsed, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  return Elapsed;
+
+}
+
+void AssemblyBenchmark(int N, int NumBoxes, int NumTrials) {
+
+  int NumWorldProcs, WorldRank;
+  MPI_Comm_size(MPI_COMM_WORLD, &NumWorldProcs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  auto Context = std::make_shared<ovk::context>(ovk::CreateContext(ovk::context::params()
+    .SetComm(MPI_COMM_WORLD)
+    .SetStatusLoggingThreshold(0)
+  ));
+
+  if (WorldRank == 0) {
+    std::printf("Assembling %i boxes of size %i in a background grid of size %i on %i "
+      "processes (%i trials).\n", NumBoxes, N/2, N, NumWorldProcs, NumTrials);
+    std::fflush(stdout);
+  }
+
+  // Warm up
+  TimeAssembly(Context, N, NumBoxes);
+
+  for (int Sync = 0; Sync < 2; ++Sync) {
+    if (Sync) {
+      Context->EnableProfiling();
+    } else {
+      Context->DisableProfiling();
+    }
+    double MinTime = 0.;
+    double TotalTime = 0.;
+    for (int iTrial = 0; iTrial < NumTrials; ++iTrial) {
+      double Time = TimeAssembly(Context, N, NumBoxes);
+      MinTime = iTrial > 0 ? ovk::Min(MinTime, Time) : Time;
+      TotalTime += Time;
+    }
+    if (WorldRank == 0) {
+      std::printf("%-22s min: %10.6f s  avg: %10.6f s\n", Sync ? "With sync points:" :
+        "Without sync points:", MinTime, TotalTime/double(ovk::Max(NumTrials, 1)));
+      std::fflush(stdout);
+    }
+  }
+
+}
+
+}
@@ -0,0 +1,241 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <overkit.hpp>
+
+#include <ovk/core/GeometricPrimitiveOps.hpp>
+#include <ovk/core/GeometryOps.hpp>
+
+#include <support/CommandArgs.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+#include <cstdio>
+#include <exception>
+
+using support::command_args;
+using support::command_args_parser;
+
+namespace {
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumQueries, int
+  &NumTrials);
+void CellSearchBenchmark(int N, int NumQueries, int NumTrials);
+}
+
+int main(int argc, char **argv) {
+
+  MPI_Init(&argc, &argv);
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  try {
+    bool Help;
+    int N, NumQueries, NumTrials;
+    GetCommandLineArguments(argc, argv, Help, N, NumQueries, NumTrials);
+    if (!Help) {
+      CellSearchBenchmark(N, NumQueries, NumTrials);
+    }
+  } catch (const std::exception &Exception) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Encountered error:\n%s\n", Exception.what()); std::fflush(stderr);
+    }
+  } catch (...) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Unknown error occurred.\n"); std::fflush(stderr);
+    }
+  }
+
+  MPI_Finalize();
+
+  return 0;
+
+}
+
+namespace {
+
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumQueries, int
+  &NumTrials) {
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  command_args_parser CommandArgsParser(WorldRank == 0);
+  CommandArgsParser.SetHelpUsage("CellSearchBenchmark [<options> ...]");
+  CommandArgsParser.SetHelpDescription("Times the curvilinear inverse mapping of query points in "
+    "their candidate cells, one cell at a time and through the batched CoordsInCells, for several "
+    "candidate counts.");
+  CommandArgsParser.AddOption<int>("size", 'N', "Number of cells in each dimension "
+    "[ Default: 32 ]");
+  CommandArgsParser.AddOption<int>("queries", 'q', "Number of query points "
+    "[ Default: 20000 ]");
+  CommandArgsParser.AddOption<int>("trials", 't', "Number of searches to time in each mode "
+    "[ Default: 10 ]");
+
+  command_args CommandArgs = CommandArgsParser.Parse({{argc}, argv});
+
+  Help = CommandArgs.GetOptionValue<bool>("help", false);
+  N = CommandArgs.GetOptionValue<int>("size", 32);
+  NumQueries = CommandArgs.GetOptionValue<int>("queries", 20000);
+  NumTrials = CommandArgs.GetOptionValue<int>("trials", 10);
+
+}
+
+enum class search_mode {
+  SCALAR,
+  BATCHED
+};
+
+struct search_data {
+  ovk::field<double> XCoords, YCoords, ZCoords;
+  ovk::array<ovk::tuple<int>> QueryCells;
+  ovk::array<ovk::tuple<double>> QueryPoints;
+  double Sum;
+};
+
+// Candidates for each query are its own cell followed by its nearest neighbors, like the candidate
+// lists that pass the overlap accel's bounding box tests
+double TimeSearch(search_mode Mode, int NumCandidates, search_data &Data) {
+
+  using ovk::core::CoordsInCell;
+  using ovk::core::CoordsInCells;
+  using ovk::geometry_type;
+
+  ovk::elem<ovk::field_view<const double>,3> Coords = {Data.XCoords, Data.YCoords, Data.ZCoords};
+  ovk::array_view<const ovk::field_view<const double>> CoordsView(Coords.Data(), {{3}});
+
+  // Faces first, then edges, then corners
+  static const int Offsets[][3] = {
+    {0,0,0}, {-1,0,0}, {1,0,0}, {0,-1,0}, {0,1,0}, {0,0,-1}, {0,0,1},
+    {-1,-1,0}, {1,-1,0}, {-1,1,0}, {1,1,0}, {-1,0,-1}, {1,0,-1}, {-1,0,1}, {1,0,1},
+    {0,-1,-1}, {0,1,-1}, {0,-1,1}, {0,1,1},
+    {-1,-1,-1}, {1,-1,-1}, {-1,1,-1}, {1,1,-1}, {-1,-1,1}, {1,-1,1}, {-1,1,1}, {1,1,1}
+  };
+
+  int MaxCell = Data.XCoords.Extents().End(0)-2;
+
+  ovk::array<ovk::tuple<int>> Cells({NumCandidates});
+  ovk::array<ovk::optional<ovk::tuple<double>>> LocalCoords({NumCandidates});
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  double StartTime = MPI_Wtime();
+
+  double &Sum = Data.Sum;
+  Sum = 0.;
+
+  for (long long iQuery = 0; iQuery < Data.QueryCells.Count(); ++iQuery) {
+    const ovk::tuple<double> &PointCoords = Data.QueryPoints(iQuery);
+    for (int iCandidate = 0; iCandidate < NumCandidates; ++iCandidate) {
+      for (int iDim = 0; iDim < 3; ++iDim) {
+        Cells(iCandidate)(iDim) = ovk::Max(ovk::Min(Data.QueryCells(iQuery)(iDim) +
+          Offsets[iCandidate][iDim], MaxCell), 0);
+      }
+    }
+    if (Mode == search_mode::SCALAR) {
+      for (int iCandidate = 0; iCandidate < NumCandidates; ++iCandidate) {
+        LocalCoords(iCandidate) = CoordsInCell<geometry_type::CURVILINEAR,3>(CoordsView,
+          Cells(iCandidate), PointCoords);
+      }
+    } else {
+      CoordsInCells<geometry_type::CURVILINEAR,3>(CoordsView, Cells, PointCoords, LocalCoords);
+    }
+    for (int iCandidate = 0; iCandidate < NumCandidates; ++iCandidate) {
+      if (LocalCoords(iCandidate)) Sum += (*LocalCoords(iCandidate))(0);
+    }
+  }
+
+  double Elapsed = MPI_Wtime() - StartTime;
+
+  MPI_Allreduce(MPI_IN_PLACE, &Elapsed, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  return Elapsed;
+
+}
+
+void CellSearchBenchmark(int N, int NumQueries, int NumTrials) {
+
+  int NumWorldProcs, WorldRank;
+  MPI_Comm_size(MPI_COMM_WORLD, &NumWorldProcs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  constexpr int W = ovk::core::GEOMETRY_BATCH_WIDTH;
+
+  if (WorldRank == 0) {
+    std::printf("Searching %i query points on a curvilinear grid of %i^3 cells on %i processes (%i "
+      "trials, batch width %i, batching %s).\n", NumQueries, N, NumWorldProcs, NumTrials, W,
+      ovk::core::GEOMETRY_BATCH_ENABLED ? "enabled" : "disabled");
+    std::fflush(stdout);
+  }
+
+  search_data Data;
+
+  // Smoothly warped grid so that every cell needs the full cubic inverse
+  ovk::range NodeRange({N+1,N+1,N+1});
+  Data.XCoords.Resize(NodeRange);
+  Data.YCoords.Resize(NodeRange);
+  Data.ZCoords.Resize(NodeRange);
+  auto Warp = [N](double U, double V) -> double {
+    return 0.1*std::sin(6.*U/double(N))*std::cos(4.*V/double(N));
+  };
+  for (int k = NodeRange.Begin(2); k < NodeRange.End(2); ++k) {
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+        double U = double(i), V = double(j), T = double(k);
+        Data.XCoords(i,j,k) = U + Warp(V, T);
+        Data.YCoords(i,j,k) = V + Warp(T, U);
+        Data.ZCoords(i,j,k) = T + Warp(U, V);
+      }
+    }
+  }
+
+  // Query at the average of each cell's corners, cycling through the cells
+  Data.QueryCells.Resize({NumQueries});
+  Data.QueryPoints.Resize({NumQueries});
+  for (int iQuery = 0; iQuery < NumQueries; ++iQuery) {
+    int iCell = int((long long)(iQuery)*7919 % ((long long)(N)*N*N));
+    ovk::tuple<int> Cell = {iCell % N, (iCell/N) % N, iCell/(N*N)};
+    ovk::tuple<double> PointCoords = {0.,0.,0.};
+    for (int k = Cell(2); k <= Cell(2)+1; ++k) {
+      for (int j = Cell(1); j <= Cell(1)+1; ++j) {
+        for (int i = Cell(0); i <= Cell(0)+1; ++i) {
+          PointCoords(0) += 0.125*Data.XCoords(i,j,k);
+          PointCoords(1) += 0.125*Data.YCoords(i,j,k);
+          PointCoords(2) += 0.125*Data.ZCoords(i,j,k);
+        }
+      }
+    }
+    Data.QueryCells(iQuery) = Cell;
+    Data.QueryPoints(iQuery) = PointCoords;
+  }
+
+  const int CandidateCounts[] = {1, 2, W, ovk::Min(2*W, 27)};
+  const search_mode Modes[] = {search_mode::SCALAR, search_mode::BATCHED};
+  const char *ModeNames[] = {"scalar:", "CoordsInCells:"};
+
+  // Warm up
+  TimeSearch(search_mode::SCALAR, 1, Data);
+
+  for (int NumCandidates : CandidateCounts) {
+    for (int iMode = 0; iMode < 2; ++iMode) {
+      double MinTime = 0.;
+      double TotalTime = 0.;
+      for (int iTrial = 0; iTrial < NumTrials; ++iTrial) {
+        double Time = TimeSearch(Modes[iMode], NumCandidates, Data);
+        MinTime = iTrial > 0 ? ovk::Min(MinTime, Time) : Time;
+        TotalTime += Time;
+      }
+      if (WorldRank == 0) {
+        std::printf("%2i candidates  %-15s min: %10.6f s  avg: %10.6f s\n", NumCandidates,
+          ModeNames[iMode], MinTime, TotalTime/double(ovk::Max(NumTrials, 1)));
+        std::fflush(stdout);
+      }
+    }
+  }
+
+}
+
+}
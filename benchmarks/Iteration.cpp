@@ -0,0 +1,214 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <overkit.hpp>
+
+#include <ovk/core/ForEach.hpp>
+
+#include <support/CommandArgs.hpp>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <exception>
+
+using support::command_args;
+using support::command_args_parser;
+
+namespace {
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumTrials);
+void IterationBenchmark(int N, int NumTrials);
+}
+
+int main(int argc, char **argv) {
+
+  MPI_Init(&argc, &argv);
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  try {
+    bool Help;
+    int N, NumTrials;
+    GetCommandLineArguments(argc, argv, Help, N, NumTrials);
+    if (!Help) {
+      IterationBenchmark(N, NumTrials);
+    }
+  } catch (const std::exception &Exception) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Encountered error:\n%s\n", Exception.what()); std::fflush(stderr);
+    }
+  } catch (...) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Unknown error occurred.\n"); std::fflush(stderr);
+    }
+  }
+
+  MPI_Finalize();
+
+  return 0;
+
+}
+
+namespace {
+
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumTrials) {
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  command_args_parser CommandArgsParser(WorldRank == 0);
+  CommandArgsParser.SetHelpUsage("IterationBenchmark [<options> ...]");
+  CommandArgsParser.SetHelpDescription("Times loops over the interior of a 3D field with a halo, "
+    "indexing each point from its tuple and using ForEachInRange's running index.");
+  CommandArgsParser.AddOption<int>("size", 'N', "Number of interior points in each dimension "
+    "[ Default: 256 ]");
+  CommandArgsParser.AddOption<int>("trials", 't', "Number of loops to time in each mode "
+    "[ Default: 10 ]");
+
+  command_args CommandArgs = CommandArgsParser.Parse({{argc}, argv});
+
+  Help = CommandArgs.GetOptionValue<bool>("help", false);
+  N = CommandArgs.GetOptionValue<int>("size", 256);
+  NumTrials = CommandArgs.GetOptionValue<int>("trials", 10);
+
+}
+
+enum class iteration_mode {
+  TUPLE,
+  RUNNING_INDEX
+};
+
+enum class kernel {
+  MASKED_SUM,
+  COMBINE_MASKS
+};
+
+struct kernel_data {
+  ovk::range LocalRange;
+  ovk::field<bool> Mask1;
+  ovk::field<bool> Mask2;
+  ovk::field<double> Values;
+  ovk::field<bool> CombinedMask;
+  double Sum;
+};
+
+// Same shapes as the point loops in assembly: a masked reduction and a mask combination (stores
+// through bool data may alias anything, so the tuple version must reload the indexer every point)
+double TimeKernel(kernel Kernel, iteration_mode Mode, kernel_data &Data) {
+
+  const ovk::range &LocalRange = Data.LocalRange;
+  const ovk::field<bool> &Mask1 = Data.Mask1;
+  const ovk::field<bool> &Mask2 = Data.Mask2;
+  const ovk::field<double> &Values = Data.Values;
+  ovk::field<bool> &CombinedMask = Data.CombinedMask;
+  double &Sum = Data.Sum;
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  double StartTime = MPI_Wtime();
+
+  Sum = 0.;
+
+  if (Mode == iteration_mode::TUPLE) {
+    for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
+      for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+        for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+          ovk::tuple<int> Point = {i,j,k};
+          switch (Kernel) {
+          case kernel::MASKED_SUM:
+            if (Mask1(Point)) Sum += Values(Point);
+            break;
+          case kernel::COMBINE_MASKS:
+            CombinedMask(Point) = Mask1(Point) && Mask2(Point);
+            break;
+          }
+        }
+      }
+    }
+  } else {
+    switch (Kernel) {
+    case kernel::MASKED_SUM:
+      ovk::core::ForEachInRange(LocalRange, Mask1.Indexer(), [&](const ovk::tuple<int> &, long long
+        iPoint) {
+        if (Mask1[iPoint]) Sum += Values[iPoint];
+      });
+      break;
+    case kernel::COMBINE_MASKS:
+      ovk::core::ForEachInRange(LocalRange, Mask1.Indexer(), [&](const ovk::tuple<int> &, long long
+        iPoint) {
+        CombinedMask[iPoint] = Mask1[iPoint] && Mask2[iPoint];
+      });
+      break;
+    }
+  }
+
+  double Elapsed = MPI_Wtime() - StartTime;
+
+  MPI_Allreduce(MPI_IN_PLACE, &Elapsed, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  return Elapsed;
+
+}
+
+void IterationBenchmark(int N, int NumTrials) {
+
+  int NumWorldProcs, WorldRank;
+  MPI_Comm_size(MPI_COMM_WORLD, &NumWorldProcs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  if (WorldRank == 0) {
+    std::printf("Iterating over the interior of a field of size %i^3 on %i processes (%i "
+      "trials).\n", N, NumWorldProcs, NumTrials);
+    std::fflush(stdout);
+  }
+
+  // Interior plus a 2-point halo on each side, so rows of the interior aren't contiguous
+  ovk::range ExtendedRange({-2,-2,-2}, {N+2,N+2,N+2});
+
+  kernel_data Data;
+  Data.LocalRange = ovk::range({N,N,N});
+  Data.Mask1.Resize(ExtendedRange);
+  Data.Mask2.Resize(ExtendedRange);
+  Data.Values.Resize(ExtendedRange);
+  Data.CombinedMask.Resize(ExtendedRange);
+  for (int k = ExtendedRange.Begin(2); k < ExtendedRange.End(2); ++k) {
+    for (int j = ExtendedRange.Begin(1); j < ExtendedRange.End(1); ++j) {
+      for (int i = ExtendedRange.Begin(0); i < ExtendedRange.End(0); ++i) {
+        Data.Mask1(i,j,k) = (i+j+k) % 3 != 0;
+        Data.Mask2(i,j,k) = (i+j+k) % 5 != 0;
+        Data.Values(i,j,k) = double(i+j+k);
+      }
+    }
+  }
+
+  const kernel Kernels[] = {kernel::MASKED_SUM, kernel::COMBINE_MASKS};
+  const char *KernelNames[] = {"Masked sum", "Combine masks"};
+  const iteration_mode Modes[] = {iteration_mode::TUPLE, iteration_mode::RUNNING_INDEX};
+  const char *ModeNames[] = {"tuple indexing:", "ForEachInRange:"};
+
+  // Warm up
+  TimeKernel(kernel::MASKED_SUM, iteration_mode::TUPLE, Data);
+
+  for (int iKernel = 0; iKernel < 2; ++iKernel) {
+    for (int iMode = 0; iMode < 2; ++iMode) {
+      double MinTime = 0.;
+      double TotalTime = 0.;
+      for (int iTrial = 0; iTrial < NumTrials; ++iTrial) {
+        double Time = TimeKernel(Kernels[iKernel], Modes[iMode], Data);
+        MinTime = iTrial > 0 ? ovk::Min(MinTime, Time) : Time;
+        TotalTime += Time;
+      }
+      if (WorldRank == 0) {
+        std::printf("%-14s %-16s min: %10.6f s  avg: %10.6f s\n", KernelNames[iKernel],
+          ModeNames[iMode], MinTime, TotalTime/double(ovk::Max(NumTrials, 1)));
+        std::fflush(stdout);
+      }
+    }
+  }
+
+}
+
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <overkit.hpp>
+
+#include <support/CommandArgs.hpp>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <exception>
+
+using support::command_args;
+using support::command_args_parser;
+
+namespace {
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumTrials);
+void ResizeBenchmark(int N, int NumTrials);
+}
+
+int main(int argc, char **argv) {
+
+  MPI_Init(&argc, &argv);
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  try {
+    bool Help;
+    int N, NumTrials;
+    GetCommandLineArguments(argc, argv, Help, N, NumTrials);
+    if (!Help) {
+      ResizeBenchmark(N, NumTrials);
+    }
+  } catch (const std::exception &Exception) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Encountered error:\n%s\n", Exception.what()); std::fflush(stderr);
+    }
+  } catch (...) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (WorldRank == 0) {
+      std::fprintf(stderr, "Unknown error occurred.\n"); std::fflush(stderr);
+    }
+  }
+
+  MPI_Finalize();
+
+  return 0;
+
+}
+
+namespace {
+
+void GetCommandLineArguments(int argc, char **argv, bool &Help, int &N, int &NumTrials) {
+
+  int WorldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  command_args_parser CommandArgsParser(WorldRank == 0);
+  CommandArgsParser.SetHelpUsage("ResizeBenchmark [<options> ...]");
+  CommandArgsParser.SetHelpDescription("Times sizing a 3D field and then writing every value, "
+    "using value-initialized, default-initialized, and uninitialized resizes.");
+  CommandArgsParser.AddOption<int>("size", 'N', "Number of points in each dimension "
+    "[ Default: 256 ]");
+  CommandArgsParser.AddOption<int>("trials", 't', "Number of resizes to time in each mode "
+    "[ Default: 10 ]");
+
+  command_args CommandArgs = CommandArgsParser.Parse({{argc}, argv});
+
+  Help = CommandArgs.GetOptionValue<bool>("help", false);
+  N = CommandArgs.GetOptionValue<int>("size", 256);
+  NumTrials = CommandArgs.GetOptionValue<int>("trials", 10);
+
+}
+
+enum class resize_mode {
+  VALUE_INIT,
+  DEFAULT_INIT,
+  UNINITIALIZED
+};
+
+double TimeResize(resize_mode Mode, int N) {
+
+  ovk::range Range({N,N,N});
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  double StartTime = MPI_Wtime();
+
+  // Freshly constructed each time so that the allocation (and first touch of the pages) is
+  // included, as it would be for buffers that are sized once per exchange
+  ovk::field<double> Field;
+  switch (Mode) {
+  case resize_mode::VALUE_INIT:
+    Field.Resize(Range);
+    break;
+  case resize_mode::DEFAULT_INIT:
+    Field.ResizeDefaultInit(Range);
+    break;
+  case resize_mode::UNINITIALIZED:
+    Field.ResizeUninitialized(Range);
+    break;
+  }
+
+  for (int k = Range.Begin(2); k < Range.End(2); ++k) {
+    for (int j = Range.Begin(1); j < Range.End(1); ++j) {
+      for (int i = Range.Begin(0); i < Range.End(0); ++i) {
+        Field(i,j,k) = double(i+j+k);
+      }
+    }
+  }
+
+  double Elapsed = MPI_Wtime() - StartTime;
+
+  // Keep the writes from being optimized away
+  volatile double Sink = Field(N-1,N-1,N-1);
+  (void)Sink;
+
+  MPI_Allreduce(MPI_IN_PLACE, &Elapsed, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  return Elapsed;
+
+}
+
+void ResizeBenchmark(int N, int NumTrials) {
+
+  int NumWorldProcs, WorldRank;
+  MPI_Comm_size(MPI_COMM_WORLD, &NumWorldProcs);
+  MPI_Comm_rank(MPI_COMM_WORLD, &WorldRank);
+
+  if (WorldRank == 0) {
+    std::printf("Resizing and filling a field of size %i^3 on %i processes (%i trials).\n", N,
+      NumWorldProcs, NumTrials);
+    std::fflush(stdout);
+  }
+
+  const resize_mode Modes[] = {resize_mode::VALUE_INIT, resize_mode::DEFAULT_INIT,
+    resize_mode::UNINITIALIZED};
+  const char *ModeNames[] = {"Resize:", "ResizeDefaultInit:", "ResizeUninitialized:"};
+
+  // Warm up
+  TimeResize(resize_mode::VALUE_INIT, N);
+
+  for (int iMode = 0; iMode < 3; ++iMode) {
+    double MinTime = 0.;
+    double TotalTime = 0.;
+    for (int iTrial = 0; iTrial < NumTrials; ++iTrial) {
+      double Time = TimeResize(Modes[iMode], N);
+      MinTime = iTrial > 0 ? ovk::Min(MinTime, Time) : Time;
+      TotalTime += Time;
+    }
+    if (WorldRank == 0) {
+      std::printf("%-22s min: %10.6f s  avg: %10.6f s\n", ModeNames[iMode], MinTime,
+        TotalTime/double(ovk::Max(NumTrials, 1)));
+      std::fflush(stdout);
+    }
+  }
+
+}
+
+}
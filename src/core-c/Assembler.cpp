@@ -479,6 +479,69 @@ void ovkResetAssemblerOptionOverlapAccelResolutionAdjust(ovk_assembler_options *
 
 }
 
+void ovkGetAssemblerOptionOverlapQueryShippingThreshold(const ovk_assembler_options *Options, int
+  MGridID, double *OverlapQueryShippingThreshold) {
+
+  OVK_DEBUG_ASSERT(Options, "Invalid options pointer.");
+  OVK_DEBUG_ASSERT(OverlapQueryShippingThreshold, "Invalid overlap query shipping threshold "
+    "pointer.");
+
+  auto &OptionsCPP = *reinterpret_cast<const ovk::assembler::options *>(Options);
+  *OverlapQueryShippingThreshold = OptionsCPP.OverlapQueryShippingThreshold(MGridID);
+
+}
+
+void ovkSetAssemblerOptionOverlapQueryShippingThreshold(ovk_assembler_options *Options, int
+  MGridID, double OverlapQueryShippingThreshold) {
+
+  OVK_DEBUG_ASSERT(Options, "Invalid options pointer.");
+
+  auto &OptionsCPP = *reinterpret_cast<ovk::assembler::options *>(Options);
+  OptionsCPP.SetOverlapQueryShippingThreshold(MGridID, OverlapQueryShippingThreshold);
+
+}
+
+void ovkResetAssemblerOptionOverlapQueryShippingThreshold(ovk_assembler_options *Options, int
+  MGridID) {
+
+  OVK_DEBUG_ASSERT(Options, "Invalid options pointer.");
+
+  auto &OptionsCPP = *reinterpret_cast<ovk::assembler::options *>(Options);
+  OptionsCPP.ResetOverlapQueryShippingThreshold(MGridID);
+
+}
+
+void ovkGetAssemblerOptionOverlapSearchMaxLoadImbalance(const ovk_assembler_options *Options,
+  double *OverlapSearchMaxLoadImbalance) {
+
+  OVK_DEBUG_ASSERT(Options, "Invalid options pointer.");
+  OVK_DEBUG_ASSERT(OverlapSearchMaxLoadImbalance, "Invalid overlap search max load imbalance "
+    "pointer.");
+
+  auto &OptionsCPP = *reinterpret_cast<const ovk::assembler::options *>(Options);
+  *OverlapSearchMaxLoadImbalance = OptionsCPP.OverlapSearchMaxLoadImbalance();
+
+}
+
+void ovkSetAssemblerOptionOverlapSearchMaxLoadImbalance(ovk_assembler_options *Options, double
+  OverlapSearchMaxLoadImbalance) {
+
+  OVK_DEBUG_ASSERT(Options, "Invalid options pointer.");
+
+  auto &OptionsCPP = *reinterpret_cast<ovk::assembler::options *>(Options);
+  OptionsCPP.SetOverlapSearchMaxLoadImbalance(OverlapSearchMaxLoadImbalance);
+
+}
+
+void ovkResetAssemblerOptionOverlapSearchMaxLoadImbalance(ovk_assembler_options *Options) {
+
+  OVK_DEBUG_ASSERT(Options, "Invalid options pointer.");
+
+  auto &OptionsCPP = *reinterpret_cast<ovk::assembler::options *>(Options);
+  OptionsCPP.ResetOverlapSearchMaxLoadImbalance();
+
+}
+
 void ovkGetAssemblerOptionInferBoundaries(const ovk_assembler_options *Options, int GridID, bool
   *InferBoundaries) {
 
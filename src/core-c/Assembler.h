@@ -100,6 +100,19 @@ void ovkSetAssemblerOptionOverlapAccelResolutionAdjust(ovk_assembler_options *Op
 void ovkResetAssemblerOptionOverlapAccelResolutionAdjust(ovk_assembler_options *Options, int
   MGridID);
 
+void ovkGetAssemblerOptionOverlapQueryShippingThreshold(const ovk_assembler_options *Options, int
+  MGridID, double *OverlapQueryShippingThreshold);
+void ovkSetAssemblerOptionOverlapQueryShippingThreshold(ovk_assembler_options *Options, int
+  MGridID, double OverlapQueryShippingThreshold);
+void ovkResetAssemblerOptionOverlapQueryShippingThreshold(ovk_assembler_options *Options, int
+  MGridID);
+
+void ovkGetAssemblerOptionOverlapSearchMaxLoadImbalance(const ovk_assembler_options *Options,
+  double *OverlapSearchMaxLoadImbalance);
+void ovkSetAssemblerOptionOverlapSearchMaxLoadImbalance(ovk_assembler_options *Options, double
+  OverlapSearchMaxLoadImbalance);
+void ovkResetAssemblerOptionOverlapSearchMaxLoadImbalance(ovk_assembler_options *Options);
+
 void ovkGetAssemblerOptionInferBoundaries(const ovk_assembler_options *Options, int GridID, bool
   *InferBoundaries);
 void ovkSetAssemblerOptionInferBoundaries(ovk_assembler_options *Options, int GridID, bool
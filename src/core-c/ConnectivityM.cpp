@@ -133,6 +133,15 @@ int ovkGetConnectivityMMaxStencilSize(const ovk_connectivity_m *ConnectivityM) {
 
 }
 
+bool ovkGetConnectivityMCompact(const ovk_connectivity_m *ConnectivityM) {
+
+  OVK_DEBUG_ASSERT(ConnectivityM, "Invalid connectivity M pointer.");
+
+  auto &ConnectivityMCPP = *reinterpret_cast<const ovk::connectivity_m *>(ConnectivityM);
+  return ConnectivityMCPP.Compact();
+
+}
+
 void ovkResizeConnectivityM(ovk_connectivity_m *ConnectivityM, long long NumDonors, int
   MaxStencilSize) {
 
@@ -152,6 +161,10 @@ void ovkGetConnectivityMExtents(const ovk_connectivity_m *ConnectivityM, int Dim
   OVK_DEBUG_ASSERT(Ends, "Invalid ends pointer.");
 
   auto &ConnectivityMCPP = *reinterpret_cast<const ovk::connectivity_m *>(ConnectivityM);
+
+  OVK_DEBUG_ASSERT(!ConnectivityMCPP.Compact(), "Extents are not stored for compact "
+    "connectivity.");
+
   *Begins = ConnectivityMCPP.Extents().Data(0,Dimension,0);
   *Ends = ConnectivityMCPP.Extents().Data(1,Dimension,0);
 
@@ -260,6 +273,8 @@ void ovkGetConnectivityMInterpCoefs(const ovk_connectivity_m *ConnectivityM, int
   auto &ConnectivityMCPP = *reinterpret_cast<const ovk::connectivity_m *>(ConnectivityM);
 
   OVK_DEBUG_ASSERT(Point >= 0 && Point < ConnectivityMCPP.MaxStencilSize(), "Invalid point.");
+  OVK_DEBUG_ASSERT(ConnectivityMCPP.InterpCoefsStorage() == ovk::interp_coefs_storage::DOUBLE,
+    "Interp coefs are not stored in double precision.");
 
   *InterpCoefs = ConnectivityMCPP.InterpCoefs().Data(Dimension,Point,0);
 
@@ -317,6 +332,10 @@ void ovkGetConnectivityMDestinations(const ovk_connectivity_m *ConnectivityM, in
   OVK_DEBUG_ASSERT(Destinations, "Invalid destinations pointer.");
 
   auto &ConnectivityMCPP = *reinterpret_cast<const ovk::connectivity_m *>(ConnectivityM);
+
+  OVK_DEBUG_ASSERT(!ConnectivityMCPP.Compact(), "Destinations are not stored for compact "
+    "connectivity.");
+
   *Destinations = ConnectivityMCPP.Destinations().Data(Dimension,0);
 
 }
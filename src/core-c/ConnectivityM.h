@@ -35,6 +35,9 @@ void ovkGetConnectivityMCommRank(const ovk_connectivity_m *ConnectivityM, int *C
 
 long long ovkGetConnectivityMSize(const ovk_connectivity_m *ConnectivityM);
 int ovkGetConnectivityMMaxStencilSize(const ovk_connectivity_m *ConnectivityM);
+// Compact connectivity (created from C++) stores no extents, destinations, or double precision
+// interp coefs, so the corresponding accessors below must not be used on it
+bool ovkGetConnectivityMCompact(const ovk_connectivity_m *ConnectivityM);
 
 void ovkResizeConnectivityM(ovk_connectivity_m *ConnectivityM, long long NumDonors, int
   MaxStencilSize);
@@ -123,6 +123,15 @@ long long ovkGetConnectivityNSize(const ovk_connectivity_n *ConnectivityN) {
 
 }
 
+bool ovkGetConnectivityNCompact(const ovk_connectivity_n *ConnectivityN) {
+
+  OVK_DEBUG_ASSERT(ConnectivityN, "Invalid connectivity N pointer.");
+
+  auto &ConnectivityNCPP = *reinterpret_cast<const ovk::connectivity_n *>(ConnectivityN);
+  return ConnectivityNCPP.Compact();
+
+}
+
 void ovkResizeConnectivityN(ovk_connectivity_n *ConnectivityN, long long NumReceivers) {
 
   OVK_DEBUG_ASSERT(ConnectivityN, "Invalid connectivity N pointer.");
@@ -140,6 +149,10 @@ void ovkGetConnectivityNPoints(const ovk_connectivity_n *ConnectivityN, int Dime
   OVK_DEBUG_ASSERT(Points, "Invalid points pointer.");
 
   auto &ConnectivityNCPP = *reinterpret_cast<const ovk::connectivity_n *>(ConnectivityN);
+
+  OVK_DEBUG_ASSERT(!ConnectivityNCPP.Compact(), "Points are not stored for compact "
+    "connectivity.");
+
   *Points = ConnectivityNCPP.Points().Data(Dimension,0);
 
 }
@@ -189,6 +202,10 @@ void ovkGetConnectivityNSources(const ovk_connectivity_n *ConnectivityN, int Dim
   OVK_DEBUG_ASSERT(Sources, "Invalid sources pointer.");
 
   auto &ConnectivityNCPP = *reinterpret_cast<const ovk::connectivity_n *>(ConnectivityN);
+
+  OVK_DEBUG_ASSERT(!ConnectivityNCPP.Compact(), "Sources are not stored for compact "
+    "connectivity.");
+
   *Sources = ConnectivityNCPP.Sources().Data(Dimension,0);
 
 }
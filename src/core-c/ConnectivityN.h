@@ -34,6 +34,9 @@ void ovkGetConnectivityNCommSize(const ovk_connectivity_n *ConnectivityN, int *C
 void ovkGetConnectivityNCommRank(const ovk_connectivity_n *ConnectivityN, int *CommRank);
 
 long long ovkGetConnectivityNSize(const ovk_connectivity_n *ConnectivityN);
+// Compact connectivity (created from C++) stores no points or sources, so the corresponding
+// accessors below must not be used on it
+bool ovkGetConnectivityNCompact(const ovk_connectivity_n *ConnectivityN);
 
 void ovkResizeConnectivityN(ovk_connectivity_n *ConnectivityN, long long NumReceivers);
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_CORE_ALIGNED_ALLOCATOR_HPP_INCLUDED
+#define OVK_CORE_ALIGNED_ALLOCATOR_HPP_INCLUDED
+
+#include <ovk/core/Global.hpp>
+#include <ovk/core/Requires.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace ovk {
+namespace core {
+
+// Allocates storage starting on an Alignment_-byte boundary (OVK_ALIGNMENT by default, which is
+// chosen to match the cache line size), so that kernels can use aligned vector loads and threads
+// working on neighboring allocations don't share cache lines
+template <typename T, std::size_t Alignment_=OVK_ALIGNMENT> class aligned_allocator {
+
+  static_assert(Alignment_ > 0 && (Alignment_ & (Alignment_-1)) == 0, "Alignment must be a power "
+    "of 2.");
+  // Offset to the start of the underlying allocation is stored in a single byte
+  static_assert(Alignment_ <= 256, "Alignment must be no larger than 256 bytes.");
+
+public:
+
+  using value_type = T;
+  static constexpr std::size_t Alignment = Alignment_ > alignof(T) ? Alignment_ : alignof(T);
+
+  template <typename U> struct rebind {
+    using other = aligned_allocator<U, Alignment_>;
+  };
+
+  aligned_allocator() = default;
+
+  template <typename U> aligned_allocator(const aligned_allocator<U, Alignment_> &) noexcept {}
+
+  T *allocate(std::size_t NumValues) {
+    // Over-allocate and record how far the aligned pointer was shifted in the byte just before
+    // it; shift is always at least 1 so there is room for it
+    unsigned char *Raw = static_cast<unsigned char *>(::operator new(NumValues*sizeof(T) +
+      Alignment));
+    std::size_t Shift = Alignment - (reinterpret_cast<std::uintptr_t>(Raw) & (Alignment-1));
+    unsigned char *Aligned = Raw + Shift;
+    Aligned[-1] = static_cast<unsigned char>(Shift-1);
+    return reinterpret_cast<T *>(Aligned);
+  }
+
+  void deallocate(T *Pointer, std::size_t) noexcept {
+    unsigned char *Aligned = reinterpret_cast<unsigned char *>(Pointer);
+    ::operator delete(Aligned - (std::size_t(Aligned[-1])+1));
+  }
+
+  friend bool operator==(const aligned_allocator &, const aligned_allocator &) { return true; }
+  friend bool operator!=(const aligned_allocator &, const aligned_allocator &) { return false; }
+
+};
+
+template <typename T, std::size_t Alignment_> constexpr std::size_t aligned_allocator<T,
+  Alignment_>::Alignment;
+
+namespace aligned_allocator_internal {
+template <typename T> constexpr std::true_type HasAlignmentTest(decltype(T::Alignment) *) {
+  return {};
+}
+template <typename T> constexpr std::false_type HasAlignmentTest(...) { return {}; }
+}
+
+template <typename AllocatorType, OVK_FUNCTION_REQUIRES(decltype(aligned_allocator_internal::
+  HasAlignmentTest<AllocatorType>(nullptr))::value)> constexpr std::size_t AllocatorAlignment() {
+  return AllocatorType::Alignment;
+}
+template <typename AllocatorType, OVK_FUNCTION_REQUIRES(!decltype(aligned_allocator_internal::
+  HasAlignmentTest<AllocatorType>(nullptr))::value)> constexpr std::size_t AllocatorAlignment() {
+  return alignof(typename AllocatorType::value_type);
+}
+
+inline bool IsAligned(const void *Pointer, std::size_t Alignment) {
+  return (reinterpret_cast<std::uintptr_t>(Pointer) & std::uintptr_t(Alignment-1)) == 0;
+}
+
+}}
+
+#endif
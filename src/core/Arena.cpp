@@ -0,0 +1,86 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include "ovk/core/Arena.hpp"
+
+#include "ovk/core/Debug.hpp"
+#include "ovk/core/Global.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace ovk {
+namespace core {
+
+constexpr std::size_t arena::DEFAULT_BLOCK_SIZE;
+constexpr std::size_t arena::DEFAULT_MAX_RETAINED_SIZE;
+
+arena::arena(std::size_t InitialBlockSize, std::size_t MaxRetainedSize):
+  InitialBlockSize_(InitialBlockSize > 0 ? InitialBlockSize : DEFAULT_BLOCK_SIZE),
+  MaxRetainedSize_(MaxRetainedSize),
+  NextBlockSize_(InitialBlockSize_)
+{}
+
+void arena::Rewind(const marker &Marker) {
+
+  OVK_DEBUG_ASSERT(Marker.NumBlocks <= Blocks_.Count(), "Invalid arena marker.");
+  OVK_DEBUG_ASSERT(NumLiveAllocations_ == Marker.NumLiveAllocations, "Rewinding arena with live "
+    "allocations.");
+
+  for (int iBlock = Marker.NumBlocks; iBlock < Blocks_.Count(); ++iBlock) {
+    block &Block = Blocks_(iBlock);
+    if (Block.Size <= MaxRetainedSize_ && Block.Size > SpareBlock_.Size) {
+      SpareBlock_ = std::move(Block);
+    }
+  }
+  Blocks_.Resize({Marker.NumBlocks});
+
+  Offset_ = Marker.Offset;
+  NextBlockSize_ = Marker.NextBlockSize;
+  NumLiveAllocations_ = Marker.NumLiveAllocations;
+
+}
+
+std::size_t arena::Capacity() const {
+
+  std::size_t TotalSize = SpareBlock_.Size;
+  for (auto &Block : Blocks_) {
+    TotalSize += Block.Size;
+  }
+
+  return TotalSize;
+
+}
+
+void *arena::AllocateInNewBlock_(std::size_t NumBytes, std::size_t Alignment) {
+
+  OVK_DEBUG_ASSERT(Alignment > 0 && (Alignment & (Alignment-1)) == 0, "Invalid alignment.");
+
+  // Leave room to align within the new block; new[] only guarantees fundamental alignment
+  std::size_t MinBlockSize = NumBytes + Alignment;
+
+  std::size_t BlockSize = NextBlockSize_;
+  while (BlockSize < MinBlockSize) BlockSize *= 2;
+  NextBlockSize_ = 2*BlockSize;
+
+  block &Block = Blocks_.Append();
+  if (SpareBlock_.Size >= MinBlockSize) {
+    Block = std::move(SpareBlock_);
+    SpareBlock_ = block();
+  } else {
+    Block.Data.reset(new unsigned char[BlockSize]);
+    Block.Size = BlockSize;
+  }
+
+  std::uintptr_t BlockBegin = reinterpret_cast<std::uintptr_t>(Block.Data.get());
+  std::uintptr_t Begin = AlignUp_(BlockBegin, Alignment);
+  Offset_ = std::size_t(Begin - BlockBegin) + NumBytes;
+  ++NumLiveAllocations_;
+
+  return reinterpret_cast<void *>(Begin);
+
+}
+
+}}
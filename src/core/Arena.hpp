@@ -0,0 +1,183 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_CORE_ARENA_HPP_INCLUDED
+#define OVK_CORE_ARENA_HPP_INCLUDED
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Field.hpp>
+#include <ovk/core/Global.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace ovk {
+namespace core {
+
+// Monotonic allocator for short-lived temporaries. Allocations are carved sequentially out of
+// large blocks, and deallocating is a no-op; memory is reclaimed all at once by Release (or back
+// to a marker by Rewind), after which nothing allocated since may be used. Not thread safe
+class arena {
+
+public:
+
+  static constexpr std::size_t DEFAULT_BLOCK_SIZE = std::size_t(1) << 20;
+  static constexpr std::size_t DEFAULT_MAX_RETAINED_SIZE = std::size_t(1) << 24;
+
+  struct marker {
+    int NumBlocks;
+    std::size_t Offset;
+    std::size_t NextBlockSize;
+    long long NumLiveAllocations;
+  };
+
+  explicit arena(std::size_t InitialBlockSize=DEFAULT_BLOCK_SIZE, std::size_t MaxRetainedSize=
+    DEFAULT_MAX_RETAINED_SIZE);
+
+  arena(const arena &Other) = delete;
+  arena(arena &&Other) noexcept = default;
+
+  arena &operator=(const arena &Other) = delete;
+  arena &operator=(arena &&Other) noexcept = default;
+
+  void *Allocate(std::size_t NumBytes, std::size_t Alignment) {
+    if (!Blocks_.Empty()) {
+      block &Block = Blocks_(Blocks_.Count()-1);
+      std::uintptr_t BlockBegin = reinterpret_cast<std::uintptr_t>(Block.Data.get());
+      std::uintptr_t Begin = AlignUp_(BlockBegin + Offset_, Alignment);
+      if (Begin + NumBytes <= BlockBegin + Block.Size) {
+        Offset_ = std::size_t(Begin - BlockBegin) + NumBytes;
+        ++NumLiveAllocations_;
+        return reinterpret_cast<void *>(Begin);
+      }
+    }
+    return AllocateInNewBlock_(NumBytes, Alignment);
+  }
+
+  void Deallocate(void *, std::size_t) noexcept {
+    --NumLiveAllocations_;
+  }
+
+  marker Mark() const {
+    return {int(Blocks_.Count()), Offset_, NextBlockSize_, NumLiveAllocations_};
+  }
+
+  // Frees the blocks added since the marker and resets block growth to what it was then; the
+  // largest freed block is kept for reuse if it's no bigger than the retained size limit
+  void Rewind(const marker &Marker);
+
+  void Release() { Rewind({0, 0, InitialBlockSize_, 0}); }
+
+  std::size_t Capacity() const;
+
+  long long LiveAllocationCount() const { return NumLiveAllocations_; }
+
+private:
+
+  struct block {
+    std::unique_ptr<unsigned char[]> Data;
+    std::size_t Size = 0;
+  };
+
+  std::size_t InitialBlockSize_;
+  std::size_t MaxRetainedSize_;
+  array<block> Blocks_;
+  block SpareBlock_;
+  std::size_t NextBlockSize_;
+  std::size_t Offset_ = 0;
+  long long NumLiveAllocations_ = 0;
+
+  static std::uintptr_t AlignUp_(std::uintptr_t Address, std::size_t Alignment) {
+    return (Address + std::uintptr_t(Alignment-1)) & ~std::uintptr_t(Alignment-1);
+  }
+
+  void *AllocateInNewBlock_(std::size_t NumBytes, std::size_t Alignment);
+
+};
+
+// Rewinds the arena to where it was on construction; declare it ahead of the temporaries that
+// allocate from the arena so that they are destroyed first
+class arena_scope {
+
+public:
+
+  explicit arena_scope(arena &Arena):
+    Arena_(Arena),
+    Marker_(Arena.Mark())
+  {}
+
+  arena_scope(const arena_scope &Other) = delete;
+  arena_scope &operator=(const arena_scope &Other) = delete;
+
+  ~arena_scope() { Arena_.Rewind(Marker_); }
+
+private:
+
+  arena &Arena_;
+  arena::marker Marker_;
+
+};
+
+// Standard allocator interface to an arena; a default-constructed arena_allocator isn't attached
+// to an arena and falls back to std::allocator
+template <typename T> class arena_allocator {
+
+public:
+
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  arena_allocator() = default;
+
+  arena_allocator(arena &Arena) noexcept:
+    Arena_(&Arena)
+  {}
+
+  template <typename U> arena_allocator(const arena_allocator<U> &Other) noexcept:
+    Arena_(Other.Arena_)
+  {}
+
+  T *allocate(std::size_t NumValues) {
+    if (Arena_) {
+      return static_cast<T *>(Arena_->Allocate(NumValues*sizeof(T), alignof(T)));
+    } else {
+      return std::allocator<T>().allocate(NumValues);
+    }
+  }
+
+  void deallocate(T *Pointer, std::size_t NumValues) noexcept {
+    if (Arena_) {
+      Arena_->Deallocate(Pointer, NumValues*sizeof(T));
+    } else {
+      std::allocator<T>().deallocate(Pointer, NumValues);
+    }
+  }
+
+  core::arena *Arena() const { return Arena_; }
+
+  friend bool operator==(const arena_allocator &Left, const arena_allocator &Right) {
+    return Left.Arena_ == Right.Arena_;
+  }
+  friend bool operator!=(const arena_allocator &Left, const arena_allocator &Right) {
+    return Left.Arena_ != Right.Arena_;
+  }
+
+private:
+
+  core::arena *Arena_ = nullptr;
+
+  template <typename U> friend class arena_allocator;
+
+};
+
+template <typename T, int Rank=1, array_layout Layout=array_layout::ROW_MAJOR> using arena_array =
+  array<T, Rank, Layout, arena_allocator<T>>;
+template <typename T> using arena_field = field<T, arena_allocator<T>>;
+
+}}
+
+#endif
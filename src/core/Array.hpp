@@ -4,6 +4,7 @@
 #ifndef OVK_CORE_ARRAY_HPP_INCLUDED
 #define OVK_CORE_ARRAY_HPP_INCLUDED
 
+#include <ovk/core/AlignedAllocator.hpp>
 #include <ovk/core/ArrayTraits.hpp>
 #include <ovk/core/ArrayView.hpp>
 // Can't include Debug.hpp because it depends on this header
@@ -29,21 +30,23 @@ namespace ovk {
 
 namespace array_internal {
 
-template <typename T, int Rank, array_layout Layout, typename TupleElementTypeSequence>
-  class array_base_1;
+template <typename T, int Rank, array_layout Layout, typename AllocatorType, typename
+  TupleElementTypeSequence> class array_base_1;
 
-template <typename T, int Rank, array_layout Layout, typename... TupleElementTypes>
-  class array_base_1<T, Rank, Layout, core::type_sequence<TupleElementTypes...>> {
+template <typename T, int Rank, array_layout Layout, typename AllocatorType, typename...
+  TupleElementTypes> class array_base_1<T, Rank, Layout, AllocatorType, core::type_sequence<
+  TupleElementTypes...>> {
 
 public:
 
   using value_type = T;
+  using allocator_type = AllocatorType;
 
 protected:
 
   using view_type = array_view<value_type,Rank,Layout>;
 
-  core::vector<value_type> Values_;
+  core::vector<value_type, allocator_type> Values_;
   view_type View_;
 
 public:
@@ -60,16 +63,32 @@ public:
     View_(Values_.Data(), MakeEmptyInterval<index_type,Rank>())
   {}
 
+  explicit array_base_1(const allocator_type &Allocator):
+    Values_(Allocator),
+    View_(Values_.Data(), MakeEmptyInterval<index_type,Rank>())
+  {}
+
   array_base_1(const interval<index_type,Rank> &Extents):
     Values_(Extents.Count()),
     View_(Values_.Data(), Extents)
   {}
 
+  array_base_1(const interval<index_type,Rank> &Extents, const allocator_type &Allocator):
+    Values_(Extents.Count(), Allocator),
+    View_(Values_.Data(), Extents)
+  {}
+
   array_base_1(const interval<index_type,Rank> &Extents, const value_type &Value):
     Values_(Extents.Count(), Value),
     View_(Values_.Data(), Extents)
   {}
 
+  array_base_1(const interval<index_type,Rank> &Extents, const value_type &Value, const
+    allocator_type &Allocator):
+    Values_(Extents.Count(), Value, Allocator),
+    View_(Values_.Data(), Extents)
+  {}
+
   array_base_1(const interval<index_type,Rank> &Extents, std::initializer_list<value_type>
     ValuesList):
     Values_(ValuesList),
@@ -190,7 +209,7 @@ public:
     index_type NumValues = Extents.Count();
     if (NewIndexer != View_.Indexer()) {
       index_type NumValuesOld = View_.Count();
-      core::vector<value_type> OldValues(NumValuesOld);
+      core::vector<value_type, allocator_type> OldValues(NumValuesOld, Values_.Allocator());
       for (index_type i = 0; i < NumValuesOld; ++i) {
         swap(Values_[i], OldValues[i]);
       }
@@ -215,7 +234,8 @@ public:
     index_type NumValues = Extents.Count();
     if (NewIndexer != View_.Indexer()) {
       index_type NumValuesOld = View_.Count();
-      core::vector<value_type> OldValues(NumValuesOld, Value);
+      core::vector<value_type, allocator_type> OldValues(NumValuesOld, Value,
+        Values_.Allocator());
       for (index_type i = 0; i < NumValuesOld; ++i) {
         swap(Values_[i], OldValues[i]);
       }
@@ -234,6 +254,45 @@ public:
     return *this;
   }
 
+  // Same as Resize, except that new values are default-initialized instead of value-initialized
+  // (i.e., they are left indeterminate for trivial types)
+  array_base_1 &ResizeDefaultInit(const interval_type &Extents) {
+    using std::swap;
+    indexer_type NewIndexer(Extents);
+    index_type NumValues = Extents.Count();
+    if (NewIndexer != View_.Indexer()) {
+      index_type NumValuesOld = View_.Count();
+      core::vector<value_type, allocator_type> OldValues(Values_.Allocator());
+      OldValues.ResizeDefaultInit(NumValuesOld);
+      for (index_type i = 0; i < NumValuesOld; ++i) {
+        swap(Values_[i], OldValues[i]);
+      }
+      view_type OldView(OldValues.Data(), View_.Extents());
+      Values_.ResizeDefaultInit(NumValues);
+      View_ = view_type(Values_.Data(), Extents);
+      core::ForEach<Layout>(OldView.Extents(), [&](const tuple_type &Tuple) {
+        if (Extents.Contains(Tuple)) {
+          View_(Tuple) = std::move(OldView(Tuple));
+        }
+      });
+    } else {
+      Values_.ResizeDefaultInit(NumValues);
+      View_ = view_type(Values_.Data(), Extents);
+    }
+    return *this;
+  }
+
+  // Discards the current values instead of preserving them, and leaves the new ones
+  // uninitialized; for when every value is about to be overwritten anyway
+  array_base_1 &ResizeUninitialized(const interval_type &Extents) {
+    static_assert(std::is_trivially_default_constructible<value_type>::value, "Array value type "
+      "must be trivially default-constructible in order to resize uninitialized.");
+    Values_.Clear();
+    Values_.ResizeDefaultInit(Extents.Count());
+    View_ = view_type(Values_.Data(), Extents);
+    return *this;
+  }
+
   array_base_1 &Clear() {
     Values_.Clear();
     View_ = view_type();
@@ -256,16 +315,17 @@ public:
 
 };
 
-template <typename T, int Rank, array_layout Layout, typename=void> class array_base_2;
+template <typename T, int Rank, array_layout Layout, typename AllocatorType, typename=void> class
+  array_base_2;
 
-template <typename T, int Rank, array_layout Layout> class array_base_2<T, Rank, Layout,
- OVK_SPECIALIZATION_REQUIRES(Rank==1)> : public array_base_1<T, Rank, Layout,
-  core::repeated_type_sequence_of_size<long long, Rank>> {
+template <typename T, int Rank, array_layout Layout, typename AllocatorType> class array_base_2<T,
+  Rank, Layout, AllocatorType, OVK_SPECIALIZATION_REQUIRES(Rank==1)> : public array_base_1<T, Rank,
+  Layout, AllocatorType, core::repeated_type_sequence_of_size<long long, Rank>> {
 
 private:
 
-  using parent_type = array_base_1<T, Rank, Layout, core::repeated_type_sequence_of_size<
-    long long, Rank>>;
+  using parent_type = array_base_1<T, Rank, Layout, AllocatorType, core::
+    repeated_type_sequence_of_size<long long, Rank>>;
 
 protected:
 
@@ -283,6 +343,8 @@ public:
   using parent_type::Assign;
   using parent_type::Reserve;
   using parent_type::Resize;
+  using parent_type::ResizeDefaultInit;
+  using parent_type::ResizeUninitialized;
   using parent_type::Clear;
   using parent_type::operator();
   using parent_type::Data;
@@ -364,14 +426,14 @@ public:
 
 };
 
-template <typename T, int Rank, array_layout Layout> class array_base_2<T, Rank, Layout,
- OVK_SPECIALIZATION_REQUIRES(Rank>1)> : public array_base_1<T, Rank, Layout,
-  core::repeated_type_sequence_of_size<long long, Rank>> {
+template <typename T, int Rank, array_layout Layout, typename AllocatorType> class array_base_2<T,
+  Rank, Layout, AllocatorType, OVK_SPECIALIZATION_REQUIRES(Rank>1)> : public array_base_1<T, Rank,
+  Layout, AllocatorType, core::repeated_type_sequence_of_size<long long, Rank>> {
 
 private:
 
-  using parent_type = array_base_1<T, Rank, Layout, core::repeated_type_sequence_of_size<
-    long long, Rank>>;
+  using parent_type = array_base_1<T, Rank, Layout, AllocatorType, core::
+    repeated_type_sequence_of_size<long long, Rank>>;
 
 protected:
 
@@ -389,6 +451,8 @@ public:
   using parent_type::Assign;
   using parent_type::Reserve;
   using parent_type::Resize;
+  using parent_type::ResizeDefaultInit;
+  using parent_type::ResizeUninitialized;
   using parent_type::Clear;
   using parent_type::operator();
   using parent_type::Data;
@@ -418,12 +482,13 @@ public:
 
 }
 
-template <typename T, int Rank_=1, array_layout Layout_=array_layout::ROW_MAJOR> class array :
-  protected array_internal::array_base_2<T, Rank_, Layout_> {
+template <typename T, int Rank_=1, array_layout Layout_=array_layout::ROW_MAJOR, typename
+  Allocator_=std::allocator<T>> class array : protected array_internal::array_base_2<T, Rank_,
+  Layout_, Allocator_> {
 
 private:
 
-  using parent_type = array_internal::array_base_2<T, Rank_, Layout_>;
+  using parent_type = array_internal::array_base_2<T, Rank_, Layout_, Allocator_>;
 
   using parent_type::Values_;
   using parent_type::View_;
@@ -433,6 +498,8 @@ public:
   using value_type = T;
   static constexpr int Rank = Rank_;
   static constexpr array_layout Layout = Layout_;
+  // Guaranteed alignment in bytes of Data() (when non-empty)
+  static constexpr std::size_t Alignment = core::AllocatorAlignment<Allocator_>();
   using index_type = long long;
   using tuple_element_type = long long;
   using tuple_type = elem<tuple_element_type,Rank>;
@@ -440,6 +507,7 @@ public:
   using indexer_type = indexer<index_type, tuple_element_type, Rank, Layout>;
   using view_type = array_view<value_type, Rank, Layout>;
   using const_view_type = array_view<const value_type, Rank, Layout>;
+  using allocator_type = Allocator_;
   using iterator = typename parent_type::iterator;
   using const_iterator = typename parent_type::const_iterator;
 
@@ -451,14 +519,26 @@ public:
 
   array() = default;
 
+  explicit array(const allocator_type &Allocator):
+    parent_type(Allocator)
+  {}
+
   explicit array(const interval_type &Extents):
     parent_type(Extents)
   {}
 
+  array(const interval_type &Extents, const allocator_type &Allocator):
+    parent_type(Extents, Allocator)
+  {}
+
   array(const interval_type &Extents, const value_type &Value):
     parent_type(Extents, Value)
   {}
 
+  array(const interval_type &Extents, const value_type &Value, const allocator_type &Allocator):
+    parent_type(Extents, Value, Allocator)
+  {}
+
   array(const interval_type &Extents, std::initializer_list<value_type> ValuesList):
     parent_type(Extents, ValuesList)
   {}
@@ -620,6 +700,16 @@ public:
     return *this;
   }
 
+  array &ResizeDefaultInit(const interval_type &Extents) {
+    parent_type::ResizeDefaultInit(Extents);
+    return *this;
+  }
+
+  array &ResizeUninitialized(const interval_type &Extents) {
+    parent_type::ResizeUninitialized(Extents);
+    return *this;
+  }
+
   array &Clear() {
     parent_type::Clear();
     return *this;
@@ -674,6 +764,8 @@ public:
 
   index_type Capacity() const { return index_type(Values_.Capacity()); }
 
+  allocator_type Allocator() const { return Values_.Allocator(); }
+
   const indexer_type &Indexer() const { return View_.Indexer(); }
 
   // Want to use iterator directly here instead of constructing intermediate elem type
@@ -707,8 +799,8 @@ public:
     return View_(Array);
   }
 
-  const value_type &operator[](int iValue) const { return View_[iValue]; }
-  value_type &operator[](int iValue) { return View_[iValue]; }
+  const value_type &operator[](index_type iValue) const { return View_[iValue]; }
+  value_type &operator[](index_type iValue) { return View_[iValue]; }
 
   OVK_FORCE_INLINE const value_type *Data() const { return View_.Data(); }
   OVK_FORCE_INLINE value_type *Data() { return View_.Data(); }
@@ -763,41 +855,54 @@ private:
 
 };
 
-template <typename T, int Rank_, array_layout Layout_> struct array_traits<array<T, Rank_, Layout_>>
-  {
+template <typename T, int Rank_, array_layout Layout_, typename Allocator_> constexpr std::size_t
+  array<T, Rank_, Layout_, Allocator_>::Alignment;
+
+template <typename T, int Rank_, array_layout Layout_, typename Allocator> struct array_traits<
+  array<T, Rank_, Layout_, Allocator>> {
+  using array_type = array<T, Rank_, Layout_, Allocator>;
   using value_type = T;
   static constexpr int Rank = Rank_;
   static constexpr array_layout Layout = Layout_;
-  template <int iDim> static long long ExtentBegin(const array<T, Rank, Layout> &Array) {
+  template <int iDim> static long long ExtentBegin(const array_type &Array) {
     return Array.Extents().Begin(iDim);
   }
-  template <int iDim> static long long ExtentEnd(const array<T, Rank, Layout> &Array) {
+  template <int iDim> static long long ExtentEnd(const array_type &Array) {
     return Array.Extents().End(iDim);
   }
-  static const T *Data(const array<T, Rank, Layout> &Array) { return Array.Data(); }
-  static T *Data(array<T, Rank, Layout> &Array) { return Array.Data(); }
+  static const T *Data(const array_type &Array) { return Array.Data(); }
+  static T *Data(array_type &Array) { return Array.Data(); }
 };
 
-template <typename T, int Rank=1> using array_r = array<T, Rank, array_layout::ROW_MAJOR>;
-template <typename T, int Rank=1> using array_c = array<T, Rank, array_layout::COLUMN_MAJOR>;
+template <typename T, int Rank=1, typename Allocator=std::allocator<T>> using array_r = array<T,
+  Rank, array_layout::ROW_MAJOR, Allocator>;
+template <typename T, int Rank=1, typename Allocator=std::allocator<T>> using array_c = array<T,
+  Rank, array_layout::COLUMN_MAJOR, Allocator>;
+template <typename T, int Rank=1, typename Allocator=std::allocator<T>> using array_t = array<T,
+  Rank, array_layout::TILED, Allocator>;
+
+namespace core {
+template <typename T, int Rank=1, array_layout Layout=array_layout::ROW_MAJOR> using aligned_array
+  = array<T, Rank, Layout, aligned_allocator<T>>;
+}
 
-template <typename T, int Rank, array_layout Layout> typename array<T, Rank, Layout>::iterator
-  begin(array<T, Rank, Layout> &Array) {
+template <typename T, int Rank, array_layout Layout, typename Allocator> typename array<T, Rank,
+  Layout, Allocator>::iterator begin(array<T, Rank, Layout, Allocator> &Array) {
   return Array.Begin();
 }
 
-template <typename T, int Rank, array_layout Layout> typename array<T, Rank, Layout>::const_iterator
-  begin(const array<T, Rank, Layout> &Array) {
+template <typename T, int Rank, array_layout Layout, typename Allocator> typename array<T, Rank,
+  Layout, Allocator>::const_iterator begin(const array<T, Rank, Layout, Allocator> &Array) {
   return Array.Begin();
 }
 
-template <typename T, int Rank, array_layout Layout> typename array<T, Rank, Layout>::iterator
-  end(array<T, Rank, Layout> &Array) {
+template <typename T, int Rank, array_layout Layout, typename Allocator> typename array<T, Rank,
+  Layout, Allocator>::iterator end(array<T, Rank, Layout, Allocator> &Array) {
   return Array.End();
 }
 
-template <typename T, int Rank, array_layout Layout> typename array<T, Rank, Layout>::const_iterator
-  end(const array<T, Rank, Layout> &Array) {
+template <typename T, int Rank, array_layout Layout, typename Allocator> typename array<T, Rank,
+  Layout, Allocator>::const_iterator end(const array<T, Rank, Layout, Allocator> &Array) {
   return Array.End();
 }
 
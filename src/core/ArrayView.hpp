@@ -330,7 +330,9 @@ public:
     return Ptr_[Indexer_.ToIndex(Array)];
   }
 
-  constexpr OVK_FORCE_INLINE value_type &operator[](int iValue) const { return Ptr_[iValue]; }
+  constexpr OVK_FORCE_INLINE value_type &operator[](index_type iValue) const {
+    return Ptr_[iValue];
+  }
 
   constexpr OVK_FORCE_INLINE value_type *Data() const { return Ptr_; }
 
@@ -372,6 +374,8 @@ template <typename T, int Rank=1> using array_view_r = array_view<T, Rank,
   array_layout::ROW_MAJOR>;
 template <typename T, int Rank=1> using array_view_c = array_view<T, Rank,
   array_layout::COLUMN_MAJOR>;
+template <typename T, int Rank=1> using array_view_t = array_view<T, Rank,
+  array_layout::TILED>;
 
 template <typename T, int Rank, array_layout Layout> constexpr OVK_FORCE_INLINE typename
   array_view<T, Rank, Layout>::iterator begin(const array_view<T, Rank, Layout> &View) {
@@ -272,27 +272,10 @@ void assembler::OnOptionsEndEdit_() {
     Options_.ResetMinimizeOverlap(SelfPair);
   }
 
-  // TODO: Make this more fine-grained
-
-  const set<int> &GridIDs = Domain.GridIDs();
-  elem_set<int,2> GridIDPairs;
-
-  for (int MGridID : GridIDs) {
-    for (int NGridID : GridIDs) {
-      if (MGridID != NGridID) {
-        GridIDPairs.Insert({MGridID,NGridID});
-      }
-    }
-  }
-
-  AssemblyManifest_.DetectOverlap = GridIDPairs;
-  AssemblyManifest_.InferBoundaries = GridIDs;
-  AssemblyManifest_.CutBoundaryHoles = GridIDPairs;
-  AssemblyManifest_.ComputeOcclusion = GridIDPairs;
-  AssemblyManifest_.ApplyPadding = GridIDPairs;
-  AssemblyManifest_.ApplySmoothing = GridIDs;
-  AssemblyManifest_.MinimizeOverlap = GridIDPairs;
-  AssemblyManifest_.GenerateConnectivity = GridIDPairs;
+  // Fragment bounds and accels depend on overlap tolerances and accel options
+  assembly_data &AssemblyData = *AssemblyData_;
+  AssemblyData.OverlapCache.Clear();
+  AssemblyData.FragmentHashCurrent = false;
 
   CachedOptions_ = options();
 
@@ -313,7 +296,7 @@ void assembler::OnGridEvent_(int GridID, grid_event_flags Flags, bool LastInSequ
 
   if (Destroy) {
     UpdateManifest_.RemoveGridsFromOptions.Insert(GridID);
-    UpdateManifest_.RemoveAssemblyManifestEntries.Insert(GridID);
+    UpdateManifest_.RemoveGridsFromAssemblyData.Insert(GridID);
   }
 
   if (LastInSequence) {
@@ -346,85 +329,23 @@ void assembler::OnComponentEvent_(int ComponentID, component_event_flags Flags)
 
 void assembler::OnGeometryEvent_(int GridID, geometry_event_flags Flags, bool LastInSequence) {
 
-  // TODO: Make this more fine-grained
-
-  const domain &Domain = *Domain_;
-
-  const set<int> &GridIDs = Domain.GridIDs();
-  elem_set<int,2> GridIDPairs;
-
-  for (int MGridID : GridIDs) {
-    for (int NGridID : GridIDs) {
-      if (MGridID != NGridID) {
-        GridIDPairs.Insert({MGridID,NGridID});
-      }
-    }
-  }
-
-  AssemblyManifest_.DetectOverlap = GridIDPairs;
-  AssemblyManifest_.InferBoundaries = GridIDs;
-  AssemblyManifest_.CutBoundaryHoles = GridIDPairs;
-  AssemblyManifest_.ComputeOcclusion = GridIDPairs;
-  AssemblyManifest_.ApplyPadding = GridIDPairs;
-  AssemblyManifest_.ApplySmoothing = GridIDs;
-  AssemblyManifest_.MinimizeOverlap = GridIDPairs;
-  AssemblyManifest_.GenerateConnectivity = GridIDPairs;
+  // Cached fragments and accels are built from the grid's coordinates
+  assembly_data &AssemblyData = *AssemblyData_;
+  AssemblyData.OverlapCache.Erase(GridID);
+  AssemblyData.FragmentHashCurrent = false;
 
 }
 
 void assembler::OnStateEvent_(int GridID, state_event_flags Flags, bool LastInSequence) {
 
-  // TODO: Make this more fine-grained
-
-  const domain &Domain = *Domain_;
-
-  const set<int> &GridIDs = Domain.GridIDs();
-  elem_set<int,2> GridIDPairs;
-
-  for (int MGridID : GridIDs) {
-    for (int NGridID : GridIDs) {
-      if (MGridID != NGridID) {
-        GridIDPairs.Insert({MGridID,NGridID});
-      }
-    }
-  }
-
-  AssemblyManifest_.DetectOverlap = GridIDPairs;
-  AssemblyManifest_.InferBoundaries = GridIDs;
-  AssemblyManifest_.CutBoundaryHoles = GridIDPairs;
-  AssemblyManifest_.ComputeOcclusion = GridIDPairs;
-  AssemblyManifest_.ApplyPadding = GridIDPairs;
-  AssemblyManifest_.ApplySmoothing = GridIDs;
-  AssemblyManifest_.MinimizeOverlap = GridIDPairs;
-  AssemblyManifest_.GenerateConnectivity = GridIDPairs;
+  // Nothing to do
 
 }
 
 void assembler::OnOverlapEvent_(const elem<int,2> &OverlapID, overlap_event_flags Flags, bool
   LastInSequence) {
 
-  // TODO: Make this more fine-grained
-
-  const domain &Domain = *Domain_;
-
-  const set<int> &GridIDs = Domain.GridIDs();
-  elem_set<int,2> GridIDPairs;
-
-  for (int MGridID : GridIDs) {
-    for (int NGridID : GridIDs) {
-      if (MGridID != NGridID) {
-        GridIDPairs.Insert({MGridID,NGridID});
-      }
-    }
-  }
-
-  AssemblyManifest_.InferBoundaries = GridIDs;
-  AssemblyManifest_.CutBoundaryHoles = GridIDPairs;
-  AssemblyManifest_.ComputeOcclusion = GridIDPairs;
-  AssemblyManifest_.ApplyPadding = GridIDPairs;
-  AssemblyManifest_.ApplySmoothing = GridIDs;
-  AssemblyManifest_.MinimizeOverlap = GridIDPairs;
-  AssemblyManifest_.GenerateConnectivity = GridIDPairs;
+  // Nothing to do
 
 }
 
@@ -445,11 +366,11 @@ void assembler::Update_() {
 
   AddGridsToOptions_();
   RemoveGridsFromOptions_();
-  RemoveAssemblyManifestEntries_();
+  RemoveGridsFromAssemblyData_();
 
   UpdateManifest_.AddGridsToOptions.Clear();
   UpdateManifest_.RemoveGridsFromOptions.Clear();
-  UpdateManifest_.RemoveAssemblyManifestEntries.Clear();
+  UpdateManifest_.RemoveGridsFromAssemblyData.Clear();
 
   Level1.Reset();
   Logger.LogStatus(Domain.Comm().Rank() == 0, "Done updating assembler %s.", *Name_);
@@ -473,29 +394,17 @@ void assembler::RemoveGridsFromOptions_() {
 }
 
 
-void assembler::RemoveAssemblyManifestEntries_() {
+void assembler::RemoveGridsFromAssemblyData_() {
 
-  if (UpdateManifest_.RemoveAssemblyManifestEntries.Empty()) return;
+  if (UpdateManifest_.RemoveGridsFromAssemblyData.Empty()) return;
 
   auto MatchesGridToRemove = [&](int GridID) -> bool {
-    return UpdateManifest_.RemoveAssemblyManifestEntries.Contains(GridID);
-  };
-
-  auto MatchesGridToRemovePair = [&](const elem<int,2> &IDPair) -> bool {
-    int MGridID = IDPair(0);
-    int NGridID = IDPair(1);
-    return UpdateManifest_.RemoveAssemblyManifestEntries.Contains(MGridID) ||
-      UpdateManifest_.RemoveAssemblyManifestEntries.Contains(NGridID);
+    return UpdateManifest_.RemoveGridsFromAssemblyData.Contains(GridID);
   };
 
-  AssemblyManifest_.DetectOverlap.EraseIf(MatchesGridToRemovePair);
-  AssemblyManifest_.InferBoundaries.EraseIf(MatchesGridToRemove);
-  AssemblyManifest_.CutBoundaryHoles.EraseIf(MatchesGridToRemovePair);
-  AssemblyManifest_.ComputeOcclusion.EraseIf(MatchesGridToRemovePair);
-  AssemblyManifest_.ApplyPadding.EraseIf(MatchesGridToRemovePair);
-  AssemblyManifest_.ApplySmoothing.EraseIf(MatchesGridToRemove);
-  AssemblyManifest_.MinimizeOverlap.EraseIf(MatchesGridToRemovePair);
-  AssemblyManifest_.GenerateConnectivity.EraseIf(MatchesGridToRemovePair);
+  assembly_data &AssemblyData = *AssemblyData_;
+  AssemblyData.OverlapCache.EraseIf(MatchesGridToRemove);
+  AssemblyData.FragmentHashCurrent = false;
 
 }
 
@@ -4,6 +4,7 @@
 #ifndef OVK_CORE_ASSEMBLER_HPP_INCLUDED
 #define OVK_CORE_ASSEMBLER_HPP_INCLUDED
 
+#include <ovk/core/Arena.hpp>
 #include <ovk/core/Array.hpp>
 #include <ovk/core/ArrayView.hpp>
 #include <ovk/core/Assembler.h>
@@ -24,11 +25,13 @@
 #include <ovk/core/GeometryComponent.hpp>
 #include <ovk/core/Global.hpp>
 #include <ovk/core/Grid.hpp>
+#include <ovk/core/HashMap.hpp>
 #include <ovk/core/HashableRegionTraits.hpp>
 #include <ovk/core/Interval.hpp>
 #include <ovk/core/Map.hpp>
 #include <ovk/core/MPISerializableTraits.hpp>
 #include <ovk/core/Optional.hpp>
+#include <ovk/core/OverlapAccel.hpp>
 #include <ovk/core/OverlapComponent.hpp>
 #include <ovk/core/Partition.hpp>
 #include <ovk/core/RecvMap.hpp>
@@ -426,6 +429,12 @@ public:
     double OverlapAccelResolutionAdjust(int MGridID) const;
     options &SetOverlapAccelResolutionAdjust(int MGridID, double OverlapAccelResolutionAdjust);
     options &ResetOverlapAccelResolutionAdjust(int MGridID);
+    double OverlapQueryShippingThreshold(int MGridID) const;
+    options &SetOverlapQueryShippingThreshold(int MGridID, double OverlapQueryShippingThreshold);
+    options &ResetOverlapQueryShippingThreshold(int MGridID);
+    double OverlapSearchMaxLoadImbalance() const { return OverlapSearchMaxLoadImbalance_; }
+    options &SetOverlapSearchMaxLoadImbalance(double OverlapSearchMaxLoadImbalance);
+    options &ResetOverlapSearchMaxLoadImbalance();
     bool InferBoundaries(int GridID) const;
     options &SetInferBoundaries(int GridID, bool InferBoundaries);
     options &ResetInferBoundaries(int GridID);
@@ -454,29 +463,57 @@ public:
     options &SetDisjointConnections(const elem<int,2> &GridIDPair, bool DisjointConnections);
     options &ResetDisjointConnections(const elem<int,2> &GridIDPair);
   private:
+    // Values set with ALL_GRIDS are stored once instead of being expanded for every grid (or
+    // grid pair); for pair options, the most recently set of the matching all-pairs, per-M-grid,
+    // per-N-grid, and per-pair values applies. As with expanded values, ALL_GRIDS only covers the
+    // grids that exist when it is set (AddGrids pins new grids to the default). Values are hashed
+    // since options are looked up repeatedly during assembly
+    template <typename T> struct grid_option {
+      optional<T> AllGridsValue;
+      hash_map<int,T> Values;
+    };
+    template <typename T> struct grid_pair_option {
+      struct entry {
+        T Value;
+        long long Order;
+      };
+      optional<T> AllPairsValue;
+      hash_map<int,entry> MGridValues;
+      hash_map<int,entry> NGridValues;
+      hash_map<elem<int,2>,entry> PairValues;
+      long long NextOrder = 0;
+    };
     set<int> GridIDs_;
-    elem_map<int,2,bool> Overlappable_;
-    elem_map<int,2,double> OverlapTolerance_;
-    map<int,double> OverlapAccelDepthAdjust_;
-    map<int,double> OverlapAccelResolutionAdjust_;
-    map<int,bool> InferBoundaries_;
-    elem_map<int,2,bool> CutBoundaryHoles_;
-    elem_map<int,2,occludes> Occludes_;
-    elem_map<int,2,int> EdgePadding_;
-    map<int,int> EdgeSmoothing_;
-    elem_map<int,2,connection_type> ConnectionType_;
-    map<int,int> FringeSize_;
-    elem_map<int,2,bool> MinimizeOverlap_;
-    elem_map<int,2,bool> DisjointConnections_;
+    grid_pair_option<bool> Overlappable_;
+    grid_pair_option<double> OverlapTolerance_;
+    grid_option<double> OverlapAccelDepthAdjust_;
+    grid_option<double> OverlapAccelResolutionAdjust_;
+    grid_option<double> OverlapQueryShippingThreshold_;
+    double OverlapSearchMaxLoadImbalance_ = 1.25;
+    grid_option<bool> InferBoundaries_;
+    grid_pair_option<bool> CutBoundaryHoles_;
+    grid_pair_option<occludes> Occludes_;
+    grid_pair_option<int> EdgePadding_;
+    grid_option<int> EdgeSmoothing_;
+    grid_pair_option<connection_type> ConnectionType_;
+    grid_option<int> FringeSize_;
+    grid_pair_option<bool> MinimizeOverlap_;
+    grid_pair_option<bool> DisjointConnections_;
     options() = default;
     void AddGrids(const set<int> &GridIDs);
     void RemoveGrids(const set<int> &GridIDs);
-    template <typename T> T GetOption_(const map<int,T> &Option, int GridID, T DefaultValue) const;
-    template <typename T> T GetOption_(const elem_map<int,2,T> &Option, const elem<int,2>
+    template <typename T> T GetOption_(const grid_option<T> &Option, int GridID, T DefaultValue)
+      const;
+    template <typename T> T GetOption_(const grid_pair_option<T> &Option, const elem<int,2>
       &GridIDPair, T DefaultValue) const;
-    template <typename T> void SetOption_(map<int,T> &Option, int GridID, T Value, T DefaultValue);
-    template <typename T> void SetOption_(elem_map<int,2,T> &Option, const elem<int,2> &GridIDPair,
-      T Value, T DefaulValue);
+    template <typename T> void SetOption_(grid_option<T> &Option, int GridID, T Value, T
+      DefaultValue);
+    template <typename T> void SetOption_(grid_pair_option<T> &Option, const elem<int,2>
+      &GridIDPair, T Value, T DefaulValue);
+    template <typename T> T MaxOptionValueForMGrid_(const grid_pair_option<T> &Option, int MGridID,
+      T DefaultValue) const;
+    // Upper bound on OverlapTolerance({MGridID,NGridID}) over all N grids
+    double MaxOverlapTolerance_(int MGridID) const;
     void PrintOptions_();
     friend class assembler;
   };
@@ -516,18 +553,7 @@ private:
   struct update_manifest {
     set<int> AddGridsToOptions;
     set<int> RemoveGridsFromOptions;
-    set<int> RemoveAssemblyManifestEntries;
-  };
-
-  struct assembly_manifest {
-    elem_set<int,2> DetectOverlap;
-    set<int> InferBoundaries;
-    elem_set<int,2> CutBoundaryHoles;
-    elem_set<int,2> ComputeOcclusion;
-    elem_set<int,2> ApplyPadding;
-    set<int> ApplySmoothing;
-    elem_set<int,2> MinimizeOverlap;
-    elem_set<int,2> GenerateConnectivity;
+    set<int> RemoveGridsFromAssemblyData;
   };
 
   floating_ref_generator FloatingRefGenerator_;
@@ -558,8 +584,6 @@ private:
 
   update_manifest UpdateManifest_;
 
-  assembly_manifest AssemblyManifest_;
-
   struct local_grid_aux_data {
     core::partition_pool PartitionPool;
     distributed_field<bool> ActiveMask;
@@ -577,6 +601,22 @@ private:
   using fragment_hash_region_data = core::distributed_region_data<fragment>;
   using fragment_hash_retrieved_bins = core::distributed_region_hash_retrieved_bins<fragment>;
 
+  struct fragment_data {
+    range CellRange;
+    array<field<double>> Coords;
+    field<bool> CellActiveMask;
+    optional<core::overlap_accel> OverlapAccel;
+  };
+
+  // Fragments (and the search data/accels for the ones searched on this rank) only depend on a
+  // grid's coordinates and active cells, so they are kept between assemblies until either changes;
+  // search data for fragments that weren't needed in the latest assembly is dropped
+  struct local_grid_overlap_cache {
+    field<bool> CellActiveMask;
+    array<fragment> Fragments;
+    map<int,fragment_data> FragmentData;
+  };
+
   struct local_overlap_m_aux_data {
     core::collect_map CollectMap;
     core::send_map SendMap;
@@ -590,17 +630,23 @@ private:
   };
 
   struct assembly_data {
+    // Duplicate of the domain comm shared by all point-to-point exchanges during assembly
+    comm Comm;
+    // Backs stage-local temporaries; released at the end of each assembly
+    core::arena Arena;
     map<int,local_grid_aux_data> LocalGridAuxData;
     fragment_hash FragmentHash;
+    bool FragmentHashCurrent = false;
+    map<int,local_grid_overlap_cache> OverlapCache;
     elem_map<int,2,local_overlap_m_aux_data> LocalOverlapMAuxData;
     elem_map<int,2,local_overlap_n_aux_data> LocalOverlapNAuxData;
     elem_map<int,2,distributed_field<bool>> ProjectedBoundaryMasks;
     map<int,distributed_field<bool>> OuterFringeMasks;
-    elem_map<int,2,distributed_field<bool>> PairwiseOcclusionMasks;
+    elem_map<int,2,array<bool>> PairwiseOcclusionMasks;
     map<int,distributed_field<bool>> OcclusionMasks;
     map<int,distributed_field<bool>> OverlapMinimizationMasks;
     map<int,distributed_field<bool>> InnerFringeMasks;
-    assembly_data(int NumDims, comm_view Comm);
+    assembly_data(int NumDims, comm_view DomainComm);
   };
 
   optional<assembly_data> AssemblyData_;
@@ -623,7 +669,7 @@ private:
 
   void AddGridsToOptions_();
   void RemoveGridsFromOptions_();
-  void RemoveAssemblyManifestEntries_();
+  void RemoveGridsFromAssemblyData_();
 
   void InitializeAssembly_();
   void ValidateOptions_();
@@ -645,6 +691,7 @@ private:
   static constexpr int OVERLAP_SEARCH_TIME = core::profiler::ASSEMBLER_OVERLAP_SEARCH_TIME;
   static constexpr int OVERLAP_SEARCH_BUILD_ACCEL_TIME = core::profiler::ASSEMBLER_OVERLAP_SEARCH_BUILD_ACCEL_TIME;
   static constexpr int OVERLAP_SEARCH_QUERY_ACCEL_TIME = core::profiler::ASSEMBLER_OVERLAP_SEARCH_QUERY_ACCEL_TIME;
+  static constexpr int OVERLAP_SEARCH_SHIP_QUERIES_TIME = core::profiler::ASSEMBLER_OVERLAP_SEARCH_SHIP_QUERIES_TIME;
   static constexpr int OVERLAP_SYNC_TIME = core::profiler::ASSEMBLER_OVERLAP_SYNC_TIME;
   static constexpr int OVERLAP_CREATE_TIME = core::profiler::ASSEMBLER_OVERLAP_CREATE_TIME;
   static constexpr int OVERLAP_FILL_TIME = core::profiler::ASSEMBLER_OVERLAP_FILL_TIME;
@@ -683,6 +730,9 @@ private:
   static constexpr int CONNECTIVITY_CREATE_TIME = core::profiler::ASSEMBLER_CONNECTIVITY_CREATE_TIME;
   static constexpr int CONNECTIVITY_FILL_TIME = core::profiler::ASSEMBLER_CONNECTIVITY_FILL_TIME;
 
+  static constexpr int OVERLAP_SEARCH_IMBALANCE_BEFORE_STAT = core::profiler::ASSEMBLER_OVERLAP_SEARCH_IMBALANCE_BEFORE_STAT;
+  static constexpr int OVERLAP_SEARCH_IMBALANCE_AFTER_STAT = core::profiler::ASSEMBLER_OVERLAP_SEARCH_IMBALANCE_AFTER_STAT;
+
 };
 
 assembler CreateAssembler(std::shared_ptr<context> Context, assembler::params Params={});
@@ -3,6 +3,7 @@
 
 #include "ovk/core/Assembler.hpp"
 
+#include "ovk/core/Arena.hpp"
 #include "ovk/core/Array.hpp"
 #include "ovk/core/ArrayOps.hpp"
 #include "ovk/core/ArrayView.hpp"
@@ -29,11 +30,13 @@
 #include "ovk/core/Field.hpp"
 #include "ovk/core/FieldOps.hpp"
 #include "ovk/core/FloatingRef.hpp"
+#include "ovk/core/ForEach.hpp"
 #include "ovk/core/Geometry.hpp"
 #include "ovk/core/GeometryComponent.hpp"
 #include "ovk/core/GeometryManipulator.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Grid.hpp"
+#include "ovk/core/HashSet.hpp"
 #include "ovk/core/Indexer.hpp"
 #include "ovk/core/Interval.hpp"
 #include "ovk/core/Logger.hpp"
@@ -46,6 +49,7 @@
 #include "ovk/core/Partition.hpp"
 #include "ovk/core/Range.hpp"
 #include "ovk/core/Recv.hpp"
+#include "ovk/core/RegionHash.hpp"
 #include "ovk/core/RecvMap.hpp"
 #include "ovk/core/ScalarOps.hpp"
 #include "ovk/core/Send.hpp"
@@ -58,6 +62,7 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <memory>
@@ -77,6 +82,41 @@ void GenerateDomainBoundaryMask(const grid &Grid, const distributed_field<state_
 void GenerateInternalBoundaryMask(const grid &Grid, const distributed_field<state_flags> &Flags,
   distributed_field<bool> &InternalBoundaryMask);
 
+// Gather per-grid (or per-grid-pair) counts onto the domain root so that status messages can be
+// written in order without a barrier per grid; counts are assumed to be already summed over the
+// grid's communicator (only the grid root's value is used) and are only returned on the root
+map<int,long long> GatherGridCountsOnRoot(const domain &Domain, const map<int,long long>
+  &CountForLocalGrid);
+elem_map<int,2,long long> GatherGridPairCountsOnRoot(const domain &Domain, const elem_set<int,2>
+  &GridPairIDs, const elem_map<int,2,long long> &CountForLocalNGridPair);
+
+// Pairwise masks store one value per overlap N point, in the same order as the overlap's points
+long long CountPairwiseMask(const grid &NGrid, array_view<const bool> PairwiseMask);
+void AccumulatePairwiseMask(const overlap_n &OverlapN, array_view<const bool> PairwiseMask,
+  distributed_field<bool> &Mask);
+
+// Flags packed one per bit, so that flags set on different ranks can be combined with a single
+// MPI_BOR reduction
+class packed_flags {
+
+public:
+
+  explicit packed_flags(long long NumFlags):
+    Bytes_({(NumFlags+7)/8}, 0)
+  {}
+
+  void Set(long long iFlag) { Bytes_(iFlag/8) |= (unsigned char)(1 << (iFlag % 8)); }
+  bool operator()(long long iFlag) const { return (Bytes_(iFlag/8) >> (iFlag % 8)) & 1; }
+
+  int ByteCount() const { return int(Bytes_.Count()); }
+  unsigned char *Data() { return Bytes_.Data(); }
+
+private:
+
+  array<unsigned char> Bytes_;
+
+};
+
 }
 
 void assembler::Assemble() {
@@ -84,9 +124,10 @@ void assembler::Assemble() {
   const domain &Domain = *Domain_;
   core::logger &Logger = Context_->core_Logger();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Beginning assembly on assembler %s...", *Name_);
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Beginning assembly on assembler %s...", *Name_);
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent();
 
   InitializeAssembly_();
@@ -98,24 +139,21 @@ void assembler::Assemble() {
   MinimizeOverlap_();
   GenerateConnectivityData_();
 
-  AssemblyManifest_.DetectOverlap.Clear();
-  AssemblyManifest_.InferBoundaries.Clear();
-  AssemblyManifest_.CutBoundaryHoles.Clear();
-  AssemblyManifest_.ComputeOcclusion.Clear();
-  AssemblyManifest_.ApplyPadding.Clear();
-  AssemblyManifest_.ApplySmoothing.Clear();
-  AssemblyManifest_.MinimizeOverlap.Clear();
-  AssemblyManifest_.GenerateConnectivity.Clear();
-
-  MPI_Barrier(Domain.Comm());
+  // Stages rewind the arena as they finish; this also drops blocks past the retained size limit
+  // and resets block growth for the next assembly
+  AssemblyData_->Arena.Release();
 
   Level1.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Completed assembly on assembler %s.", *Name_);
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Completed assembly on assembler %s.", *Name_);
+  }
 
 }
 
-assembler::assembly_data::assembly_data(int NumDims, comm_view Comm):
-  FragmentHash(NumDims, Comm)
+assembler::assembly_data::assembly_data(int NumDims, comm_view DomainComm):
+  Comm(DuplicateComm(DomainComm)),
+  FragmentHash(NumDims, DomainComm)
 {}
 
 void assembler::InitializeAssembly_() {
@@ -282,29 +320,21 @@ struct subdivide {
   }
   template <typename T> box ComputeBounds_(const T &Manipulator, const range &CellRange) const {
     box Bounds = MakeEmptyBox(NumDims_);
-    for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
-      for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
-        for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
-          tuple<int> Cell = {i,j,k};
-          if (!CellActiveMask_(Cell)) continue;
-          box CellBounds = Manipulator.CellBounds(Coords_, Cell);
-          Bounds = UnionBoxes(Bounds, CellBounds);
-        }
-      }
-    }
+    core::ForEachInRange(CellRange, CellActiveMask_.Indexer(), [&](const tuple<int> &Cell,
+      long long iCell) {
+      if (!CellActiveMask_[iCell]) return;
+      box CellBounds = Manipulator.CellBounds(Coords_, Cell);
+      Bounds = UnionBoxes(Bounds, CellBounds);
+    });
     return Bounds;
   }
   double ComputeOccupiedVolume_(const range &CellRange) const {
     double OccupiedVolume = 0.;
-    for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
-      for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
-        for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
-          tuple<int> Cell = {i,j,k};
-          if (!CellActiveMask_(Cell)) continue;
-          OccupiedVolume += CellVolumes_(Cell);
-        }
-      }
-    }
+    core::ForEachInRange(CellRange, CellActiveMask_.Indexer(), [&](const tuple<int> &,
+      long long iCell) {
+      if (!CellActiveMask_[iCell]) return;
+      OccupiedVolume += CellVolumes_[iCell];
+    });
     return OccupiedVolume;
   }
   template <typename T> array<range> Subdivide_(const T &Manipulator, double BaseVolume, const range
@@ -342,14 +372,10 @@ struct subdivide {
       }
     } else {
       long long NumActiveCells = 0;
-      for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
-        for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
-          for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
-            tuple<int> Cell = {i,j,k};
-            if (CellActiveMask_(Cell)) ++NumActiveCells;
-          }
-        }
-      }
+      core::ForEachInRange(CellRange, CellActiveMask_.Indexer(), [&](const tuple<int> &,
+        long long iCell) {
+        if (CellActiveMask_[iCell]) ++NumActiveCells;
+      });
       if (NumActiveCells > 0) {
         SubdivisionRanges.Append(CellRange);
       }
@@ -662,19 +688,23 @@ struct generate_overlap_data {
     field_view<const double>> MGridCoords, const std::string &NGridName, const core::overlap_accel
     &OverlapAccel, double OverlapTolerance, OverlapDataType &OverlapData, core::logger &Logger) {
     long long NumQueryPoints = OverlapData.Points.Count();
+    // Temporarily stored coordinates of query points in OverlapData coords array
+    array<tuple<double>> PointCoords({NumQueryPoints});
     for (long long iQueryPoint = 0; iQueryPoint < NumQueryPoints; ++iQueryPoint) {
-      // Temporarily stored coordinates of query points in OverlapData coords array
-      tuple<double> PointCoords = {
+      PointCoords(iQueryPoint) = {
         OverlapData.Coords(0,iQueryPoint),
         OverlapData.Coords(1,iQueryPoint),
         OverlapData.Coords(2,iQueryPoint)
       };
-      optional<tuple<int>> MaybeCell;
-      optional<tuple<double>> MaybeCellCoords;
-      OverlapAccel.FindCell(PointCoords, OverlapTolerance, MaybeCell, MaybeCellCoords);
-      if (MaybeCell) {
-        const tuple<int> &Cell = *MaybeCell;
-        const tuple<double> &CellCoords = *MaybeCellCoords;
+    }
+    array<double> Tolerances({NumQueryPoints}, OverlapTolerance);
+    array<optional<tuple<int>>> MaybeCells({NumQueryPoints});
+    array<optional<tuple<double>>> MaybeCellCoords({NumQueryPoints});
+    OverlapAccel.FindCells(PointCoords, Tolerances, MaybeCells, MaybeCellCoords);
+    for (long long iQueryPoint = 0; iQueryPoint < NumQueryPoints; ++iQueryPoint) {
+      if (MaybeCells(iQueryPoint)) {
+        const tuple<int> &Cell = *MaybeCells(iQueryPoint);
+        const tuple<double> &CellCoords = *MaybeCellCoords(iQueryPoint);
         OverlapData.Cells(iQueryPoint) = MGridCellGlobalIndexer.ToIndex(Cell);
         OverlapData.Coords(0,iQueryPoint) = CellCoords(0);
         OverlapData.Coords(1,iQueryPoint) = CellCoords(1);
@@ -692,9 +722,10 @@ void assembler::DetectOverlap_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Detecting overlap between grids...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Detecting overlap between grids...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent();
 
   Profiler.StartSync(OVERLAP_TIME, Domain.Comm());
@@ -703,17 +734,60 @@ void assembler::DetectOverlap_() {
   auto &GeometryComponent = Domain.Component<geometry_component>(GeometryComponentID_);
   assembly_data &AssemblyData = *AssemblyData_;
 
+  // Point-to-point messages go on the assembler's comm with a tag per exchange, so that messages
+  // from different exchanges can't match with each other or with other traffic on the domain comm
+  comm_view Comm = AssemblyData.Comm;
+  constexpr int FRAGMENT_IDS_TAG = 0;
+  constexpr int FRAGMENT_RANGES_TAG = 1;
+  constexpr int NUM_QUERY_POINTS_SHIPPED_TAG = 2;
+  constexpr int SHIPPED_QUERIES_TAG = 3;
+  constexpr int SHIPPED_RESULT_CELLS_TAG = 4;
+  constexpr int SHIPPED_RESULT_COORDS_TAG = 5;
+  constexpr int M_GRID_RANGES_TAG = 6;
+  constexpr int NUM_OVERLAPPING_TAG = 7;
+
   Logger.LogStatus(Domain.Comm().Rank() == 0, "Creating grid fragments...");
   auto Level2 = Logger.IncreaseStatusLevelAndIndent();
 
   Profiler.StartSync(OVERLAP_FRAGMENT_TIME, Domain.Comm());
 
-  map<int,array<range>> SubdivisionRangesForLocalGrid;
-  int NumLocalSubdivisions = 0;
+  map<int,double> MaxOverlapTolerances;
+
+  for (int MGridID : Domain.GridIDs()) {
+    MaxOverlapTolerances.Insert(MGridID, Options_.MaxOverlapTolerance_(MGridID));
+  }
+
+  auto &OverlapCache = AssemblyData.OverlapCache;
+
+  OverlapCache.EraseIf([&](int GridID) -> bool {
+    return !Domain.GridIsLocal(GridID);
+  });
+
+  // Reuse fragments from the previous assembly for grids whose coordinates and active cells
+  // haven't changed (coordinate edits drop the grid's entry)
+  set<int> GridsToFragment;
+  for (int GridID : Domain.LocalGridIDs()) {
+    const local_grid_aux_data &GridAuxData = AssemblyData.LocalGridAuxData(GridID);
+    const distributed_field<bool> &CellActiveMask = GridAuxData.CellActiveMask;
+    bool Current = false;
+    auto CacheIter = OverlapCache.Find(GridID);
+    if (CacheIter != OverlapCache.End()) {
+      const local_grid_overlap_cache &Cache = CacheIter->Value();
+      Current = Cache.CellActiveMask.Count() == CellActiveMask.Count();
+      for (long long l = 0; Current && l < CellActiveMask.Count(); ++l) {
+        Current = Cache.CellActiveMask[l] == CellActiveMask[l];
+      }
+    }
+    if (!Current) {
+      local_grid_overlap_cache &Cache = OverlapCache.Insert(GridID);
+      Cache.CellActiveMask = CellActiveMask.Values();
+      GridsToFragment.Insert(GridID);
+    }
+  }
 
   // Subdivide partitions to avoid transferring excessive amounts of grid data and help eliminate
   // empty space in bounding boxes
-  for (int GridID : Domain.LocalGridIDs()) {
+  for (int GridID : GridsToFragment) {
     const grid &Grid = Domain.Grid(GridID);
     const range &CellLocalRange = Grid.CellLocalRange();
     const local_grid_aux_data &GridAuxData = AssemblyData.LocalGridAuxData(GridID);
@@ -723,40 +797,145 @@ void assembler::DetectOverlap_() {
     double MaxUnoccupiedVolume = 0.25;
     int MinCells = 1 << 10;
     int MaxCells = 1 << 14;
-    array<range> &SubdivisionRanges = SubdivisionRangesForLocalGrid.Insert(GridID);
-    SubdivisionRanges = GeometryManipulator.Apply(subdivide(NumDims, Geometry.Coords(),
-      CellActiveMask, Geometry.CellVolumes(), MinCells, MaxCells, MaxUnoccupiedVolume),
-      CellLocalRange);
-    NumLocalSubdivisions += int(SubdivisionRanges.Count());
+    array<range> SubdivisionRanges = GeometryManipulator.Apply(subdivide(NumDims,
+      Geometry.Coords(), CellActiveMask, Geometry.CellVolumes(), MinCells, MaxCells,
+      MaxUnoccupiedVolume), CellLocalRange);
+    int NumFragments = int(SubdivisionRanges.Count());
+    array_view<const range> FragmentRanges(SubdivisionRanges.Data(), {1,NumFragments+1});
+    array<fragment> &Fragments = OverlapCache(GridID).Fragments;
+    Fragments.Resize({NumFragments});
+    GeometryManipulator.Apply(generate_fragments(), GridID, Grid.Cart(), Grid.CellCart(),
+      Geometry.Coords(), CellActiveMask, MaxOverlapTolerances(GridID), FragmentRanges,
+      array_view<fragment>(Fragments.Data(), {1,NumFragments+1}));
   }
 
-  map<int,double> MaxOverlapTolerances;
+  map<int,array_view<fragment>> FragmentsForLocalGrid;
 
-  for (int MGridID : Domain.GridIDs()) {
-    double &MaxOverlapTolerance = MaxOverlapTolerances.Insert(MGridID, 0.);
-    for (int NGridID : Domain.GridIDs()) {
-      MaxOverlapTolerance = Max(MaxOverlapTolerance, Options_.OverlapTolerance({MGridID,NGridID}));
-    }
+  for (int GridID : Domain.LocalGridIDs()) {
+    array<fragment> &Fragments = OverlapCache(GridID).Fragments;
+    int NumFragments = int(Fragments.Count());
+    FragmentsForLocalGrid.Insert(GridID, array_view<fragment>(Fragments.Data(),
+      {1,NumFragments+1}));
   }
 
-  array<fragment> LocalFragments({NumLocalSubdivisions});
-  map<int,array_view<fragment>> FragmentsForLocalGrid;
+  // Narrow down the set of grid pairs that can possibly overlap by comparing the bounding box of
+  // each M grid's fragments with the bounding box of each N grid's active points; everything
+  // after this only needs to consider these candidate pairs rather than all pairs of grids
+  const set<int> &GridIDs = Domain.GridIDs();
+  int NumGrids = GridIDs.Count();
+
+  // Stores lower corners and negated upper corners so both can be reduced with a single MPI_MIN
+  array<double,3> GridBoundsValues({{NumGrids,2,2*MAX_DIMS}}, std::numeric_limits<double>::max());
+
+  auto ExtendGridBounds = [&GridBoundsValues](int iGrid, int iSide, const box &Box) {
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      double &BeginValue = GridBoundsValues(iGrid,iSide,iDim);
+      double &NegEndValue = GridBoundsValues(iGrid,iSide,MAX_DIMS+iDim);
+      BeginValue = Min(BeginValue, Box.Begin(iDim));
+      NegEndValue = Min(NegEndValue, -Box.End(iDim));
+    }
+  };
 
-  int iNextFragment = 0;
   for (int GridID : Domain.LocalGridIDs()) {
+    int iGrid = int(GridIDs.Find(GridID) - GridIDs.Begin());
+    for (auto &Fragment : FragmentsForLocalGrid(GridID)) {
+      ExtendGridBounds(iGrid, 0, core::hashable_region_traits<fragment>::ComputeExtents(NumDims,
+        Fragment));
+    }
     const grid &Grid = Domain.Grid(GridID);
+    const range &LocalRange = Grid.LocalRange();
     const local_grid_aux_data &GridAuxData = AssemblyData.LocalGridAuxData(GridID);
-    const distributed_field<bool> &CellActiveMask = GridAuxData.CellActiveMask;
+    const distributed_field<bool> &ActiveMask = GridAuxData.ActiveMask;
     const geometry &Geometry = GeometryComponent.Geometry(GridID);
-    core::geometry_manipulator GeometryManipulator(Geometry.Type(), NumDims);
-    const array<range> &SubdivisionRanges = SubdivisionRangesForLocalGrid(GridID);
-    int NumFragments = int(SubdivisionRanges.Count());
-    array_view<const range> FragmentRanges(SubdivisionRanges.Data(), {1,NumFragments+1});
-    array_view<fragment> &Fragments = FragmentsForLocalGrid.Insert(GridID);
-    Fragments = {LocalFragments.Data(iNextFragment), {1,NumFragments+1}};
-    GeometryManipulator.Apply(generate_fragments(), GridID, Grid.Cart(), Grid.CellCart(),
-      Geometry.Coords(), CellActiveMask, MaxOverlapTolerances(GridID), FragmentRanges, Fragments);
-    iNextFragment += NumFragments;
+    auto &Coords = Geometry.Coords();
+    box PointBounds = MakeEmptyBox(NumDims);
+    core::ForEachInRange(LocalRange, ActiveMask.Values().Indexer(), [&](const tuple<int> &,
+      long long iPoint) {
+      if (!ActiveMask[iPoint]) return;
+      PointBounds = ExtendBox(PointBounds, {
+        Coords(0)[iPoint],
+        Coords(1)[iPoint],
+        Coords(2)[iPoint]
+      });
+    });
+    if (!PointBounds.Empty()) {
+      ExtendGridBounds(iGrid, 1, PointBounds);
+    }
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, GridBoundsValues.Data(), int(GridBoundsValues.Count()), MPI_DOUBLE,
+    MPI_MIN, Domain.Comm());
+
+  auto GetGridBounds = [&GridBoundsValues](int iGrid, int iSide) -> box {
+    box Bounds;
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Bounds.Begin(iDim) = GridBoundsValues(iGrid,iSide,iDim);
+      Bounds.End(iDim) = -GridBoundsValues(iGrid,iSide,MAX_DIMS+iDim);
+    }
+    return Bounds;
+  };
+
+  array<int> NGridIDsWithPoints;
+  array<box> NGridPointBounds;
+  NGridIDsWithPoints.Reserve(NumGrids);
+  NGridPointBounds.Reserve(NumGrids);
+
+  int iGrid = 0;
+  for (int NGridID : GridIDs) {
+    box PointBounds = GetGridBounds(iGrid, 1);
+    if (!PointBounds.Empty()) {
+      NGridIDsWithPoints.Append(NGridID);
+      NGridPointBounds.Append(PointBounds);
+    }
+    ++iGrid;
+  }
+
+  array<elem<int,2>> CandidatePairs;
+
+  if (NGridPointBounds.Count() > 0) {
+    int NumBinsPerDim = Max(int(std::ceil(std::pow(double(NGridPointBounds.Count()),
+      1./double(NumDims)))), 1);
+    core::region_hash<box> NGridHash(NumDims, MakeUniformTuple<int>(NumDims, NumBinsPerDim, 1),
+      NGridPointBounds);
+    const box &HashExtents = NGridHash.Extents();
+    field_indexer BinIndexer(NGridHash.BinRange());
+    iGrid = 0;
+    for (int MGridID : GridIDs) {
+      box MGridBounds = GetGridBounds(iGrid, 0);
+      ++iGrid;
+      if (!BoxesOverlap(MGridBounds, HashExtents)) continue;
+      tuple<int> LowerBin = BinIndexer.ToTuple(NGridHash.MapToBin(ClampToBox(HashExtents,
+        MGridBounds.Begin())));
+      tuple<int> UpperBin = BinIndexer.ToTuple(NGridHash.MapToBin(ClampToBox(HashExtents,
+        MGridBounds.End())));
+      for (int k = LowerBin(2); k <= UpperBin(2); ++k) {
+        for (int j = LowerBin(1); j <= UpperBin(1); ++j) {
+          for (int i = LowerBin(0); i <= UpperBin(0); ++i) {
+            long long iBin = BinIndexer.ToIndex(i,j,k);
+            for (long long iRegion : NGridHash.RetrieveBin(iBin)) {
+              int NGridID = NGridIDsWithPoints(iRegion);
+              if (NGridID == MGridID) continue;
+              if (!Options_.Overlappable({MGridID,NGridID})) continue;
+              if (BoxesOverlap(MGridBounds, NGridPointBounds(iRegion))) {
+                CandidatePairs.Append({MGridID,NGridID});
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Regions can span multiple bins; sorting first makes the insertions below cheap appends
+  std::sort(CandidatePairs.Begin(), CandidatePairs.End(), elem_less<int,2>());
+  elem_set<int,2> OverlapCandidates(CandidatePairs.Begin(), CandidatePairs.End());
+
+  map<int,array<int>> CandidateMGridIDsForNGrid;
+  for (int NGridID : GridIDs) {
+    CandidateMGridIDsForNGrid.Insert(NGridID);
+  }
+  for (auto &GridIDPair : OverlapCandidates) {
+    CandidateMGridIDsForNGrid(GridIDPair(1)).Append(GridIDPair(0));
   }
 
   Profiler.Stop(OVERLAP_FRAGMENT_TIME);
@@ -772,8 +951,27 @@ void assembler::DetectOverlap_() {
   Profiler.StartSync(OVERLAP_HASH_TIME, Domain.Comm());
   Profiler.Start(OVERLAP_HASH_CREATE_TIME);
 
+  // Hash only needs to be regenerated if some grid's fragments changed
+  bool FragmentHashCurrent = AssemblyData.FragmentHashCurrent && GridsToFragment.Empty();
+  MPI_Allreduce(MPI_IN_PLACE, &FragmentHashCurrent, 1, MPI_C_BOOL, MPI_LAND, Domain.Comm());
+
   fragment_hash &FragmentHash = AssemblyData.FragmentHash;
-  FragmentHash = fragment_hash(NumDims, Domain.Comm(), LocalFragments);
+
+  if (!FragmentHashCurrent) {
+    long long NumLocalFragments = 0;
+    for (auto &Entry : FragmentsForLocalGrid) {
+      NumLocalFragments += Entry.Value().Count();
+    }
+    array<fragment> LocalFragments;
+    LocalFragments.Reserve(NumLocalFragments);
+    for (auto &Entry : FragmentsForLocalGrid) {
+      for (auto &Fragment : Entry.Value()) {
+        LocalFragments.Append(Fragment);
+      }
+    }
+    FragmentHash = fragment_hash(NumDims, Domain.Comm(), LocalFragments);
+    AssemblyData.FragmentHashCurrent = true;
+  }
 
   Profiler.Stop(OVERLAP_HASH_CREATE_TIME);
 
@@ -788,7 +986,7 @@ void assembler::DetectOverlap_() {
   Profiler.Start(OVERLAP_HASH_MAP_TO_BINS_TIME);
 
   map<int,field<elem<int,2>>> LocalPointOverlappingBinIDs;
-  elem_set<int,2> UniqueOverlappingBinIDs;
+  hash_set<elem<int,2>> UniqueOverlappingBinIDs;
 
   for (int GridID : Domain.LocalGridIDs()) {
     const grid &Grid = Domain.Grid(GridID);
@@ -799,6 +997,8 @@ void assembler::DetectOverlap_() {
     auto &Coords = Geometry.Coords();
     field<elem<int,2>> &BinIDs = LocalPointOverlappingBinIDs.Insert(GridID);
     BinIDs.Resize(LocalRange, elem<int,2>(-1,-1));
+    // Points on grids that can't be overlapped don't need to look at any fragments
+    if (CandidateMGridIDsForNGrid(GridID).Empty()) continue;
     for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
       for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
         for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
@@ -863,6 +1063,7 @@ void assembler::DetectOverlap_() {
           tuple<int> Point = {i,j,k};
           if (!ActiveMask(Point)) continue;
           const elem<int,2> &BinID = BinIDs(Point);
+          if (BinID(0) < 0) continue;
           int BinRank = BinID(0);
           int iBin = BinID(1);
           const fragment_hash_retrieved_bins &Bins = RetrievedBins(BinRank);
@@ -909,72 +1110,8 @@ void assembler::DetectOverlap_() {
     }
   }
 
-  set<int> RemoteMRanks;
-
-  for (auto &NEntry : OverlappingMGridIDsAndRanksForLocalNGrid) {
-    auto &MGridIDsAndRanks = NEntry.Value();
-    for (auto &MEntry : MGridIDsAndRanks) {
-      const set<int> &MGridRanks = MEntry.Value();
-      for (int Rank : MGridRanks) {
-        if (Rank != Domain.Comm().Rank()) {
-          RemoteMRanks.Insert(Rank);
-        }
-      }
-    }
-  }
-
-  array<int> RemoteNRanks = core::DynamicHandshake(Domain.Comm(), RemoteMRanks);
-
-  array<MPI_Request> MPIRequests;
-  MPIRequests.Reserve(RemoteMRanks.Count() + RemoteNRanks.Count());
-
-  map<int,int> NumGridIDPairsFromRank;
-  NumGridIDPairsFromRank.Reserve(RemoteNRanks.Count());
-
-  for (int Rank : RemoteNRanks) {
-    int &NumPairs = NumGridIDPairsFromRank.Insert(Rank, 0);
-    MPI_Irecv(&NumPairs, 1, MPI_INT, Rank, 0, Domain.Comm(), &MPIRequests.Append());
-  }
-
-  map<int,int> NumGridIDPairsToRank;
-  NumGridIDPairsToRank.Reserve(RemoteMRanks.Count());
-
-  for (auto &NEntry : OverlappingMGridIDsAndRanksForLocalNGrid) {
-    auto &MGridIDsAndRanks = NEntry.Value();
-    for (auto &MEntry : MGridIDsAndRanks) {
-      const set<int> &MGridRanks = MEntry.Value();
-      for (int Rank : MGridRanks) {
-        ++NumGridIDPairsToRank.Fetch(Rank, 0);
-      }
-    }
-  }
-
-  for (int Rank : RemoteMRanks) {
-    int &NumPairs = NumGridIDPairsToRank(Rank);
-    MPI_Isend(&NumPairs, 1, MPI_INT, Rank, 0, Domain.Comm(), &MPIRequests.Append());
-  }
-
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
-
-  map<int,array<int>> GridIDPairRecvData;
-  GridIDPairRecvData.Reserve(RemoteNRanks.Count());
-
-  for (int Rank : RemoteNRanks) {
-    int NumPairs = NumGridIDPairsFromRank(Rank);
-    array<int> &Pairs = GridIDPairRecvData.Insert(Rank);
-    Pairs.Resize({2*NumPairs});
-    MPI_Irecv(Pairs.Data(), 2*NumPairs, MPI_INT, Rank, 0, Domain.Comm(), &MPIRequests.Append());
-  }
-
-  map<int,array<int>> GridIDPairSendData;
-  GridIDPairSendData.Reserve(RemoteMRanks.Count());
-
-  for (int Rank : RemoteMRanks) {
-    int NumPairs = NumGridIDPairsToRank(Rank);
-    array<int> &Pairs = GridIDPairSendData.Insert(Rank);
-    Pairs.Reserve(2*NumPairs);
-  }
+  // Tell the owners of the M grid fragments which grid pairs they'll be involved in
+  map<int,array<elem<int,2>>> GridIDPairsToRank;
 
   for (auto &NEntry : OverlappingMGridIDsAndRanksForLocalNGrid) {
     int NGridID = NEntry.Key();
@@ -984,22 +1121,14 @@ void assembler::DetectOverlap_() {
       const set<int> &MGridRanks = MEntry.Value();
       for (int Rank : MGridRanks) {
         if (Rank != Domain.Comm().Rank()) {
-          array<int> &Pairs = GridIDPairSendData(Rank);
-          Pairs.Append(MGridID);
-          Pairs.Append(NGridID);
+          GridIDPairsToRank.Fetch(Rank).Append({MGridID,NGridID});
         }
       }
     }
   }
 
-  for (int Rank : RemoteMRanks) {
-    int NumPairs = NumGridIDPairsToRank(Rank);
-    array<int> &Pairs = GridIDPairSendData(Rank);
-    MPI_Isend(Pairs.Data(), 2*NumPairs, MPI_INT, Rank, 0, Domain.Comm(), &MPIRequests.Append());
-  }
-
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
+  map<int,array<elem<int,2>>> GridIDPairsFromRank = core::SparseExchange(Domain.Comm(),
+    GridIDPairsToRank);
 
   map<int,map<int,set<int>>> OverlappingNGridIDsAndRanksForLocalMGrid;
 
@@ -1021,12 +1150,11 @@ void assembler::DetectOverlap_() {
     }
   }
 
-  for (int Rank : RemoteNRanks) {
-    int NumPairs = NumGridIDPairsFromRank(Rank);
-    array<int> &Pairs = GridIDPairRecvData(Rank);
-    for (int iPair = 0; iPair < NumPairs; ++iPair) {
-      int MGridID = Pairs(2*iPair);
-      int NGridID = Pairs(2*iPair+1);
+  for (auto &Entry : GridIDPairsFromRank) {
+    int Rank = Entry.Key();
+    for (auto &GridIDPair : Entry.Value()) {
+      int MGridID = GridIDPair(0);
+      int NGridID = GridIDPair(1);
       OverlappingNGridIDsAndRanksForLocalMGrid(MGridID).Fetch(NGridID).Insert(Rank);
     }
   }
@@ -1044,7 +1172,7 @@ void assembler::DetectOverlap_() {
 
   Profiler.StartSync(OVERLAP_SEARCH_TIME, Domain.Comm());
 
-  elem_set<int,2> MGridSends;
+  array<elem<int,2>> MGridSendPairs;
 
   for (int MGridID : Domain.LocalGridIDs()) {
     auto &NGridIDsAndRanks = OverlappingNGridIDsAndRanksForLocalMGrid(MGridID);
@@ -1052,13 +1180,16 @@ void assembler::DetectOverlap_() {
       const set<int> &NGridRanks = NEntry.Value();
       for (int Rank : NGridRanks) {
         if (Rank != Domain.Comm().Rank()) {
-          MGridSends.Insert({MGridID,Rank});
+          MGridSendPairs.Append({MGridID,Rank});
         }
       }
     }
   }
 
-  elem_set<int,2> MGridRecvs;
+  elem_set<int,2> MGridSends(MGridSendPairs.Begin(), MGridSendPairs.End());
+  MGridSendPairs.Clear();
+
+  array<elem<int,2>> MGridRecvPairs;
 
   for (int NGridID : Domain.LocalGridIDs()) {
     auto &MGridIDsAndRanks = OverlappingMGridIDsAndRanksForLocalNGrid(NGridID);
@@ -1067,24 +1198,26 @@ void assembler::DetectOverlap_() {
       const set<int> &MGridRanks = MEntry.Value();
       for (int Rank : MGridRanks) {
         if (Rank != Domain.Comm().Rank()) {
-          MGridRecvs.Insert({MGridID,Rank});
+          MGridRecvPairs.Append({MGridID,Rank});
         }
       }
     }
   }
 
-  elem_map<int,2,int> NumMGridFragmentsSending;
-  NumMGridFragmentsSending.Reserve(MGridSends.Count());
+  elem_set<int,2> MGridRecvs(MGridRecvPairs.Begin(), MGridRecvPairs.End());
+  MGridRecvPairs.Clear();
 
-  elem_map<int,2,int> NumMGridFragmentsReceiving;
-  NumMGridFragmentsReceiving.Reserve(MGridRecvs.Count());
+  // Fragment IDs are sent as (MGridID,FragmentID) pairs so that all of the requests for a given
+  // rank go in a single message
+  core::message_aggregator<elem<int,2>> FragmentIDMessages(Comm, FRAGMENT_IDS_TAG);
 
-  MPIRequests.Reserve(MGridSends.Count() + MGridRecvs.Count());
+  elem_map<int,2,array<int>> MGridFragmentsSending;
+  MGridFragmentsSending.Reserve(MGridSends.Count());
 
   for (auto &MGridIDAndRankPair : MGridSends) {
     int Rank = MGridIDAndRankPair(1);
-    int &NumSending = NumMGridFragmentsSending.Insert(MGridIDAndRankPair, 0);
-    MPI_Irecv(&NumSending, 1, MPI_INT, Rank, 0, Domain.Comm(), &MPIRequests.Append());
+    MGridFragmentsSending.Insert(MGridIDAndRankPair);
+    FragmentIDMessages.AddSource(Rank);
   }
 
   elem_map<int,2,set<int>> MGridFragmentsReceiving;
@@ -1106,40 +1239,29 @@ void assembler::DetectOverlap_() {
   }
 
   for (auto &MGridIDAndRankPair : MGridRecvs) {
+    int MGridID = MGridIDAndRankPair(0);
     int Rank = MGridIDAndRankPair(1);
-    const int &NumReceiving = NumMGridFragmentsReceiving.Insert(MGridIDAndRankPair,
-      MGridFragmentsReceiving(MGridIDAndRankPair).Count());
-    MPI_Isend(&NumReceiving, 1, MPI_INT, Rank, 0, Domain.Comm(), &MPIRequests.Append());
+    FragmentIDMessages.AddDestination(Rank);
+    for (int FragmentID : MGridFragmentsReceiving(MGridIDAndRankPair)) {
+      FragmentIDMessages.Append(Rank, {MGridID,FragmentID});
+    }
   }
 
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
-
-  elem_map<int,2,array<int>> MGridFragmentsSending;
-  MGridFragmentsSending.Reserve(MGridSends.Count());
-
-  MPIRequests.Reserve(MGridSends.Count() + MGridRecvs.Count());
+  FragmentIDMessages.Exchange();
 
+  set<int> MGridSendRanks;
   for (auto &MGridIDAndRankPair : MGridSends) {
-    int Rank = MGridIDAndRankPair(1);
-    int NumSending = NumMGridFragmentsSending(MGridIDAndRankPair);
-    array<int> &FragmentIDs = MGridFragmentsSending.Insert(MGridIDAndRankPair);
-    FragmentIDs.Resize({NumSending});
-    MPI_Irecv(FragmentIDs.Data(), NumSending, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
+    MGridSendRanks.Insert(MGridIDAndRankPair(1));
   }
 
-  for (auto &MGridIDAndRankPair : MGridRecvs) {
-    int Rank = MGridIDAndRankPair(1);
-    int NumReceiving = NumMGridFragmentsReceiving(MGridIDAndRankPair);
-    const set<int> &FragmentIDs = MGridFragmentsReceiving(MGridIDAndRankPair);
-    MPI_Isend(FragmentIDs.Data(), NumReceiving, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
+  for (int Rank : MGridSendRanks) {
+    for (auto &MGridIDAndFragmentID : FragmentIDMessages.Received(Rank)) {
+      int MGridID = MGridIDAndFragmentID(0);
+      int FragmentID = MGridIDAndFragmentID(1);
+      MGridFragmentsSending({MGridID,Rank}).Append(FragmentID);
+    }
   }
 
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
-
   int NumFragmentSends = 0;
   for (auto &MGridAndRankEntry : MGridFragmentsSending) {
     const array<int> &FragmentIDs = MGridAndRankEntry.Value();
@@ -1152,17 +1274,17 @@ void assembler::DetectOverlap_() {
     NumFragmentRecvs += FragmentIDs.Count();
   }
 
-  elem_set<int,3> FragmentSends;
-  elem_set<int,3> FragmentRecvs;
-  FragmentSends.Reserve(NumFragmentSends);
-  FragmentRecvs.Reserve(NumFragmentRecvs);
+  array<elem<int,3>> FragmentSendTriples;
+  array<elem<int,3>> FragmentRecvTriples;
+  FragmentSendTriples.Reserve(NumFragmentSends);
+  FragmentRecvTriples.Reserve(NumFragmentRecvs);
 
   for (auto &MGridAndRankEntry : MGridFragmentsSending) {
     int MGridID = MGridAndRankEntry.Key()(0);
     int Rank = MGridAndRankEntry.Key()(1);
     const array<int> &FragmentIDs = MGridAndRankEntry.Value();
     for (int FragmentID : FragmentIDs) {
-      FragmentSends.Insert({MGridID,Rank,FragmentID});
+      FragmentSendTriples.Append({MGridID,Rank,FragmentID});
     }
   }
 
@@ -1171,11 +1293,16 @@ void assembler::DetectOverlap_() {
     int Rank = MGridAndRankEntry.Key()(1);
     const set<int> &FragmentIDs = MGridAndRankEntry.Value();
     for (int FragmentID : FragmentIDs) {
-      FragmentRecvs.Insert({MGridID,Rank,FragmentID});
+      FragmentRecvTriples.Append({MGridID,Rank,FragmentID});
     }
   }
 
-  elem_set<int,2> FragmentLocals;
+  elem_set<int,3> FragmentSends(FragmentSendTriples.Begin(), FragmentSendTriples.End());
+  elem_set<int,3> FragmentRecvs(FragmentRecvTriples.Begin(), FragmentRecvTriples.End());
+  FragmentSendTriples.Clear();
+  FragmentRecvTriples.Clear();
+
+  array<elem<int,2>> FragmentLocalPairs;
 
   for (int NGridID : Domain.LocalGridIDs()) {
     auto &FragmentsFromMGridAndRank = OverlappingFragmentsForLocalNGrid(NGridID);
@@ -1185,36 +1312,36 @@ void assembler::DetectOverlap_() {
         int MGridID = MGridAndRankEntry.Key()(0);
         const set<int> &FragmentIDs = MGridAndRankEntry.Value();
         for (int FragmentID : FragmentIDs) {
-          FragmentLocals.Insert({MGridID,FragmentID});
+          FragmentLocalPairs.Append({MGridID,FragmentID});
         }
       }
     }
   }
 
-  struct fragment_data {
-    range CellRange;
-    array<field<double>> Coords;
-    field<bool> CellActiveMask;
-  };
-
-  map<int,map<int,fragment_data>> FragmentDataForLocalGrid;
+  elem_set<int,2> FragmentLocals(FragmentLocalPairs.Begin(), FragmentLocalPairs.End());
+  FragmentLocalPairs.Clear();
 
-  for (int MGridID : Domain.LocalGridIDs()) {
-    FragmentDataForLocalGrid.Insert(MGridID);
+  elem_set<int,2> UsedFragments = FragmentLocals;
+  for (auto &Entry : FragmentSends) {
+    UsedFragments.Insert({Entry(0),Entry(2)});
   }
 
-  for (auto &Entry : FragmentSends) {
-    int MGridID = Entry(0);
-    int FragmentID = Entry(2);
-    FragmentDataForLocalGrid(MGridID).Fetch(FragmentID);
+  // Data for fragments that were needed in the previous assembly is kept in the cache (along with
+  // any accels that were built from it); data for fragments that are no longer needed is dropped
+  for (int MGridID : Domain.LocalGridIDs()) {
+    OverlapCache(MGridID).FragmentData.EraseIf([&](int FragmentID) -> bool {
+      return !UsedFragments.Contains({MGridID,FragmentID});
+    });
   }
 
-  for (auto &Entry : FragmentLocals) {
+  for (auto &Entry : UsedFragments) {
     int MGridID = Entry(0);
     int FragmentID = Entry(1);
-    FragmentDataForLocalGrid(MGridID).Fetch(FragmentID);
+    OverlapCache(MGridID).FragmentData.Fetch(FragmentID);
   }
 
+  UsedFragments.Clear();
+
   auto GenerateFragmentDataRanges = [](const cart &Cart, const cart &CellCart, const range
     &CellRange, range &CoordsRange, range &CellActiveMaskRange) {
     CellActiveMaskRange = core::ExtendLocalRange(CellCart, CellRange, 1);
@@ -1227,10 +1354,11 @@ void assembler::DetectOverlap_() {
     const distributed_field<bool> &CellActiveMask = GridAuxData.CellActiveMask;
     const geometry &Geometry = GeometryComponent.Geometry(MGridID);
     const array<distributed_field<double>> &Coords = Geometry.Coords();
-    auto &FragmentData = FragmentDataForLocalGrid(MGridID);
+    auto &FragmentData = OverlapCache(MGridID).FragmentData;
     for (auto &FragmentEntry : FragmentData) {
       int FragmentID = FragmentEntry.Key();
       fragment_data &Data = FragmentEntry.Value();
+      if (Data.Coords.Count() > 0) continue;
       const fragment &Fragment = FragmentsForLocalGrid(MGridID)(FragmentID);
       Data.CellRange = Fragment.CellRange;
       range CoordsRange, CellActiveMaskRange;
@@ -1238,7 +1366,7 @@ void assembler::DetectOverlap_() {
         CellActiveMaskRange);
       Data.Coords.Resize({MAX_DIMS});
       for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        Data.Coords(iDim).Resize(CoordsRange);
+        Data.Coords(iDim).ResizeUninitialized(CoordsRange);
         for (int k = CoordsRange.Begin(2); k < CoordsRange.End(2); ++k) {
           for (int j = CoordsRange.Begin(1); j < CoordsRange.End(1); ++j) {
             for (int i = CoordsRange.Begin(0); i < CoordsRange.End(0); ++i) {
@@ -1251,7 +1379,7 @@ void assembler::DetectOverlap_() {
           }
         }
       }
-      Data.CellActiveMask.Resize(CellActiveMaskRange);
+      Data.CellActiveMask.ResizeUninitialized(CellActiveMaskRange);
       for (int k = CellActiveMaskRange.Begin(2); k < CellActiveMaskRange.End(2); ++k) {
         for (int j = CellActiveMaskRange.Begin(1); j < CellActiveMaskRange.End(1); ++j) {
           for (int i = CellActiveMaskRange.Begin(0); i < CellActiveMaskRange.End(0); ++i) {
@@ -1262,33 +1390,37 @@ void assembler::DetectOverlap_() {
     }
   }
 
-  elem_map<int,3,range> RemoteFragmentRanges;
-  RemoteFragmentRanges.Reserve(FragmentRecvs.Count());
-
-  MPIRequests.Reserve(2*(FragmentSends.Count()+FragmentRecvs.Count()));
+  // Ranges for each rank are sent and received in the same (MGridID,FragmentID) order, so they
+  // can be matched up without sending the IDs
+  core::message_aggregator<range> FragmentRangeMessages(Comm, FRAGMENT_RANGES_TAG);
 
   for (auto &Entry : FragmentRecvs) {
     int Rank = Entry(1);
-    range &CellRange = RemoteFragmentRanges.Insert(Entry);
-    MPI_Irecv(CellRange.Begin().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Irecv(CellRange.End().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
+    FragmentRangeMessages.AddSource(Rank);
   }
 
   for (auto &Entry : FragmentSends) {
     int MGridID = Entry(0);
     int Rank = Entry(1);
     int FragmentID = Entry(2);
-    const range &CellRange = FragmentsForLocalGrid(MGridID)(FragmentID).CellRange;
-    MPI_Isend(CellRange.Begin().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Isend(CellRange.End().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
+    FragmentRangeMessages.Append(Rank, FragmentsForLocalGrid(MGridID)(FragmentID).CellRange);
   }
 
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
+  FragmentRangeMessages.Exchange();
+
+  elem_map<int,3,range> RemoteFragmentRanges;
+  RemoteFragmentRanges.Reserve(FragmentRecvs.Count());
+
+  map<int,int> NextFragmentRangeFromRank;
+
+  for (auto &Entry : FragmentRecvs) {
+    int Rank = Entry(1);
+    int &iRange = NextFragmentRangeFromRank.Fetch(Rank, 0);
+    RemoteFragmentRanges.Insert(Entry, FragmentRangeMessages.Received(Rank)(iRange));
+    ++iRange;
+  }
+
+  array<MPI_Request> MPIRequests;
 
   map<int,elem_map<int,2,map<int,long long>>> NumFragmentQueryPointsForLocalNGrid;
 
@@ -1308,6 +1440,7 @@ void assembler::DetectOverlap_() {
           tuple<int> Point = {i,j,k};
           if (!ActiveMask(Point)) continue;
           const elem<int,2> &BinID = BinIDs(Point);
+          if (BinID(0) < 0) continue;
           int BinRank = BinID(0);
           int iBin = BinID(1);
           const fragment_hash_retrieved_bins &Bins = RetrievedBins(BinRank);
@@ -1380,6 +1513,7 @@ void assembler::DetectOverlap_() {
           tuple<int> Point = {i,j,k};
           if (!ActiveMask(Point)) continue;
           const elem<int,2> &BinID = BinIDs(Point);
+          if (BinID(0) < 0) continue;
           int BinRank = BinID(0);
           int iBin = BinID(1);
           const fragment_hash_retrieved_bins &Bins = RetrievedBins(BinRank);
@@ -1419,6 +1553,413 @@ void assembler::DetectOverlap_() {
     }
   }
 
+  auto CountFragmentQueryPoints = [&](int MGridID, int Rank, int FragmentID) -> long long {
+    long long NumQueryPoints = 0;
+    for (int NGridID : Domain.LocalGridIDs()) {
+      auto &FragmentOverlapDataForMGridAndRank = FragmentOverlapDataForLocalNGrid(NGridID);
+      auto MGridAndRankIter = FragmentOverlapDataForMGridAndRank.Find({MGridID,Rank});
+      if (MGridAndRankIter == FragmentOverlapDataForMGridAndRank.End()) continue;
+      auto &FragmentOverlapData = MGridAndRankIter->Value();
+      auto FragmentIter = FragmentOverlapData.Find(FragmentID);
+      if (FragmentIter == FragmentOverlapData.End()) continue;
+      const fragment_overlap_data &OverlapData = FragmentIter->Value();
+      NumQueryPoints += OverlapData.Points.Count();
+    }
+    return NumQueryPoints;
+  };
+
+  auto CreateFragmentOverlapAccel = [&](int MGridID, const fragment_data &Data, long long
+    NumQueryPoints) -> core::overlap_accel {
+    geometry_type GeometryType = GeometryComponent.GeometryInfo(MGridID).Type();
+    double DepthAdjust = Options_.OverlapAccelDepthAdjust(MGridID);
+    double ResolutionAdjust = Options_.OverlapAccelResolutionAdjust(MGridID);
+    double MaxOverlapTolerance = MaxOverlapTolerances(MGridID);
+    long long NumCellsLeaf = (long long)(Max(std::pow(2., 12.-DepthAdjust), 1.));
+    double MaxNodeUnoccupiedVolume = std::pow(2., -2.-DepthAdjust);
+    double MaxNodeCellVolumeVariation = 0.5;
+    long long NumFragmentCells = Data.CellRange.Count();
+    double BinScale = 1./Min(std::pow(double(NumQueryPoints)/double(NumFragmentCells),
+      1./double(NumDims)), 1.) * std::pow(2., -1.-ResolutionAdjust);
+    elem<field_view<const double>,MAX_DIMS> MGridCoords = {
+      Data.Coords(0),
+      Data.Coords(1),
+      Data.Coords(2)
+    };
+    return core::overlap_accel(GeometryType, NumDims, Data.CellRange, MGridCoords,
+      Data.CellActiveMask, MaxOverlapTolerance, NumCellsLeaf, MaxNodeUnoccupiedVolume,
+      MaxNodeCellVolumeVariation, BinScale);
+  };
+
+  // When only a few points need to be searched in a large remote fragment, it's cheaper to send the
+  // points to the fragment's owner and have it send back the results than it is to transfer the
+  // fragment. Query points are sent as (transformed coords, overlap tolerance) records; results
+  // come back as a global cell index and local cell coordinates per point
+  Profiler.Start(OVERLAP_SEARCH_SHIP_QUERIES_TIME);
+
+  constexpr int QUERY_RECORD_SIZE = MAX_DIMS+1;
+
+  array<long long> NumQueryPointsShippedForRecv({FragmentRecvs.Count()}, 0);
+  array<long long> NumQueryPointsShippedForSend({FragmentSends.Count()}, 0);
+
+  for (int iRecv = 0; iRecv < FragmentRecvs.Count(); ++iRecv) {
+    auto &Entry = RemoteFragmentRanges[iRecv];
+    int MGridID = Entry.Key()(0);
+    int Rank = Entry.Key()(1);
+    int FragmentID = Entry.Key()(2);
+    const grid_info &MGridInfo = Domain.GridInfo(MGridID);
+    range CoordsRange, CellActiveMaskRange;
+    GenerateFragmentDataRanges(MGridInfo.Cart(), MGridInfo.CellCart(), Entry.Value(), CoordsRange,
+      CellActiveMaskRange);
+    long long FragmentSize = MAX_DIMS*CoordsRange.Count()*sizeof(double) +
+      CellActiveMaskRange.Count()*sizeof(bool);
+    long long NumQueryPoints = CountFragmentQueryPoints(MGridID, Rank, FragmentID);
+    long long QuerySize = NumQueryPoints*((QUERY_RECORD_SIZE+MAX_DIMS)*sizeof(double) +
+      sizeof(long long));
+    double Threshold = Options_.OverlapQueryShippingThreshold(MGridID);
+    if (double(FragmentSize) > Threshold*double(QuerySize)) {
+      NumQueryPointsShippedForRecv(iRecv) = NumQueryPoints;
+    }
+  }
+
+  core::message_aggregator<long long> NumQueryPointsShippedMessages(Comm,
+    NUM_QUERY_POINTS_SHIPPED_TAG);
+
+  for (int iSend = 0; iSend < FragmentSends.Count(); ++iSend) {
+    int Rank = FragmentSends[iSend](1);
+    NumQueryPointsShippedMessages.AddSource(Rank);
+  }
+
+  for (int iRecv = 0; iRecv < FragmentRecvs.Count(); ++iRecv) {
+    int Rank = FragmentRecvs[iRecv](1);
+    NumQueryPointsShippedMessages.Append(Rank, NumQueryPointsShippedForRecv(iRecv));
+  }
+
+  NumQueryPointsShippedMessages.Exchange();
+
+  map<int,int> NextNumQueryPointsShippedFromRank;
+
+  for (int iSend = 0; iSend < FragmentSends.Count(); ++iSend) {
+    int Rank = FragmentSends[iSend](1);
+    int &iRecord = NextNumQueryPointsShippedFromRank.Fetch(Rank, 0);
+    NumQueryPointsShippedForSend(iSend) = NumQueryPointsShippedMessages.Received(Rank)(iRecord);
+    ++iRecord;
+  }
+
+  // Search work is determined by where the query points are, so ranks owning points in heavily
+  // overlapped regions can end up doing many times the average amount of work. Even things out by
+  // sending batches of query points from overloaded ranks to the owners of the corresponding
+  // fragments when those are underloaded (the owners already have the fragment data, so only the
+  // points and results need to be transferred)
+  {
+    double MaxLoadImbalance = Options_.OverlapSearchMaxLoadImbalance();
+
+    long long Load = 0;
+    for (int iRecv = 0; iRecv < FragmentRecvs.Count(); ++iRecv) {
+      if (NumQueryPointsShippedForRecv(iRecv) == 0) {
+        const elem<int,3> &RecvInfo = FragmentRecvs[iRecv];
+        Load += CountFragmentQueryPoints(RecvInfo(0), RecvInfo(1), RecvInfo(2));
+      }
+    }
+    for (auto &Entry : FragmentLocals) {
+      Load += CountFragmentQueryPoints(Entry(0), Domain.Comm().Rank(), Entry(1));
+    }
+    for (long long NumQueryPoints : NumQueryPointsShippedForSend) {
+      Load += NumQueryPoints;
+    }
+
+    array<long long> Loads({Domain.Comm().Size()});
+    MPI_Allgather(&Load, 1, MPI_LONG_LONG, Loads.Data(), 1, MPI_LONG_LONG, Domain.Comm());
+
+    long long TotalLoad = 0;
+    long long MaxLoad = 0;
+    for (long long RankLoad : Loads) {
+      TotalLoad += RankLoad;
+      MaxLoad = Max(MaxLoad, RankLoad);
+    }
+    double AvgLoad = double(TotalLoad)/double(Domain.Comm().Size());
+    double ImbalanceBefore = AvgLoad > 0. ? double(MaxLoad)/AvgLoad : 1.;
+
+    if (ImbalanceBefore > MaxLoadImbalance) {
+
+      // Candidates are (N rank, M grid ID, M rank, fragment ID, number of query points)
+      constexpr int CANDIDATE_SIZE = 5;
+
+      array<long long,2> LocalCandidates({{0,CANDIDATE_SIZE}});
+      if (double(Load) > MaxLoadImbalance*AvgLoad) {
+        LocalCandidates.Resize({{FragmentRecvs.Count(),CANDIDATE_SIZE}});
+        int NumLocalCandidates = 0;
+        for (int iRecv = 0; iRecv < FragmentRecvs.Count(); ++iRecv) {
+          if (NumQueryPointsShippedForRecv(iRecv) == 0) {
+            const elem<int,3> &RecvInfo = FragmentRecvs[iRecv];
+            LocalCandidates(NumLocalCandidates,0) = Domain.Comm().Rank();
+            LocalCandidates(NumLocalCandidates,1) = RecvInfo(0);
+            LocalCandidates(NumLocalCandidates,2) = RecvInfo(1);
+            LocalCandidates(NumLocalCandidates,3) = RecvInfo(2);
+            LocalCandidates(NumLocalCandidates,4) = CountFragmentQueryPoints(RecvInfo(0),
+              RecvInfo(1), RecvInfo(2));
+            ++NumLocalCandidates;
+          }
+        }
+        LocalCandidates.Resize({{NumLocalCandidates,CANDIDATE_SIZE}});
+      }
+
+      int NumLocalCandidateValues = int(LocalCandidates.Count());
+      array<int> NumCandidateValues({Domain.Comm().Size()});
+      MPI_Allgather(&NumLocalCandidateValues, 1, MPI_INT, NumCandidateValues.Data(), 1, MPI_INT,
+        Domain.Comm());
+
+      array<int> CandidateValueOffsets({Domain.Comm().Size()});
+      int NumCandidates = 0;
+      for (int Rank = 0; Rank < Domain.Comm().Size(); ++Rank) {
+        CandidateValueOffsets(Rank) = CANDIDATE_SIZE*NumCandidates;
+        NumCandidates += NumCandidateValues(Rank)/CANDIDATE_SIZE;
+      }
+
+      array<long long,2> Candidates({{NumCandidates,CANDIDATE_SIZE}});
+      MPI_Allgatherv(LocalCandidates.Data(), NumLocalCandidateValues, MPI_LONG_LONG,
+        Candidates.Data(), NumCandidateValues.Data(), CandidateValueOffsets.Data(), MPI_LONG_LONG,
+        Domain.Comm());
+
+      // Every rank makes the same decisions, so no further communication is needed to agree on
+      // which batches move
+      array<int> CandidateOrder({NumCandidates});
+      for (int iCandidate = 0; iCandidate < NumCandidates; ++iCandidate) {
+        CandidateOrder(iCandidate) = iCandidate;
+      }
+      std::stable_sort(CandidateOrder.Begin(), CandidateOrder.End(), [&](int iLeft, int iRight)
+        -> bool {
+        return Candidates(iLeft,4) > Candidates(iRight,4);
+      });
+
+      for (int iCandidate : CandidateOrder) {
+        int NRank = int(Candidates(iCandidate,0));
+        int MGridID = int(Candidates(iCandidate,1));
+        int MRank = int(Candidates(iCandidate,2));
+        int FragmentID = int(Candidates(iCandidate,3));
+        long long NumQueryPoints = Candidates(iCandidate,4);
+        if (double(Loads(NRank)) <= AvgLoad) continue;
+        if (double(Loads(MRank)+NumQueryPoints) > AvgLoad) continue;
+        Loads(NRank) -= NumQueryPoints;
+        Loads(MRank) += NumQueryPoints;
+        // Candidates come from the N rank's recvs, which match the M rank's sends
+        if (NRank == Domain.Comm().Rank()) {
+          auto Iter = FragmentRecvs.Find({MGridID,MRank,FragmentID});
+          OVK_DEBUG_ASSERT(Iter != FragmentRecvs.End(), "Fragment recv not found.");
+          NumQueryPointsShippedForRecv(int(Iter - FragmentRecvs.Begin())) = NumQueryPoints;
+        } else if (MRank == Domain.Comm().Rank()) {
+          auto Iter = FragmentSends.Find({MGridID,NRank,FragmentID});
+          OVK_DEBUG_ASSERT(Iter != FragmentSends.End(), "Fragment send not found.");
+          NumQueryPointsShippedForSend(int(Iter - FragmentSends.Begin())) = NumQueryPoints;
+        }
+      }
+
+    }
+
+    MaxLoad = 0;
+    for (long long RankLoad : Loads) {
+      MaxLoad = Max(MaxLoad, RankLoad);
+    }
+    double ImbalanceAfter = AvgLoad > 0. ? double(MaxLoad)/AvgLoad : 1.;
+
+    Profiler.Record(OVERLAP_SEARCH_IMBALANCE_BEFORE_STAT, ImbalanceBefore);
+    Profiler.Record(OVERLAP_SEARCH_IMBALANCE_AFTER_STAT, ImbalanceAfter);
+  }
+
+  map<int,array<double,2>> ShippedQueryRecvData;
+  map<int,array<long long>> ShippedResultCellsSendData;
+  map<int,array<double,2>> ShippedResultCoordsSendData;
+
+  array<MPI_Request> ShippedQueryMPIRequests;
+  ShippedQueryMPIRequests.Reserve(FragmentSends.Count());
+
+  for (int iSend = 0; iSend < FragmentSends.Count(); ++iSend) {
+    long long NumQueryPoints = NumQueryPointsShippedForSend(iSend);
+    if (NumQueryPoints == 0) continue;
+    int Rank = FragmentSends[iSend](1);
+    array<double,2> &Queries = ShippedQueryRecvData.Insert(iSend);
+    Queries.Resize({{NumQueryPoints,QUERY_RECORD_SIZE}});
+    MPI_Irecv(Queries.Data(), int(Queries.Count()), MPI_DOUBLE, Rank, SHIPPED_QUERIES_TAG,
+      Comm, &ShippedQueryMPIRequests.Append());
+  }
+
+  map<int,array<double,2>> ShippedQuerySendData;
+  map<int,array<long long>> ShippedResultCellsRecvData;
+  map<int,array<double,2>> ShippedResultCoordsRecvData;
+
+  MPIRequests.Reserve(3*FragmentRecvs.Count());
+
+  for (int iRecv = 0; iRecv < FragmentRecvs.Count(); ++iRecv) {
+    long long NumQueryPoints = NumQueryPointsShippedForRecv(iRecv);
+    if (NumQueryPoints == 0) continue;
+    const elem<int,3> &RecvInfo = FragmentRecvs[iRecv];
+    int MGridID = RecvInfo(0);
+    int Rank = RecvInfo(1);
+    int FragmentID = RecvInfo(2);
+    array<double,2> &Queries = ShippedQuerySendData.Insert(iRecv);
+    Queries.Resize({{NumQueryPoints,QUERY_RECORD_SIZE}});
+    long long iQuery = 0;
+    for (int NGridID : Domain.LocalGridIDs()) {
+      auto &FragmentOverlapDataForMGridAndRank = FragmentOverlapDataForLocalNGrid(NGridID);
+      auto MGridAndRankIter = FragmentOverlapDataForMGridAndRank.Find({MGridID,Rank});
+      if (MGridAndRankIter == FragmentOverlapDataForMGridAndRank.End()) continue;
+      auto &FragmentOverlapData = MGridAndRankIter->Value();
+      auto FragmentIter = FragmentOverlapData.Find(FragmentID);
+      if (FragmentIter == FragmentOverlapData.End()) continue;
+      const fragment_overlap_data &OverlapData = FragmentIter->Value();
+      double OverlapTolerance = Options_.OverlapTolerance({MGridID,NGridID});
+      for (long long iQueryPoint = 0; iQueryPoint < OverlapData.Points.Count(); ++iQueryPoint) {
+        for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+          Queries(iQuery,iDim) = OverlapData.Coords(iDim,iQueryPoint);
+        }
+        Queries(iQuery,MAX_DIMS) = OverlapTolerance;
+        ++iQuery;
+      }
+    }
+    MPI_Isend(Queries.Data(), int(Queries.Count()), MPI_DOUBLE, Rank, SHIPPED_QUERIES_TAG,
+      Comm, &MPIRequests.Append());
+    array<long long> &ResultCells = ShippedResultCellsRecvData.Insert(iRecv);
+    ResultCells.Resize({NumQueryPoints});
+    MPI_Irecv(ResultCells.Data(), int(NumQueryPoints), MPI_LONG_LONG, Rank,
+      SHIPPED_RESULT_CELLS_TAG, Comm, &MPIRequests.Append());
+    array<double,2> &ResultCoords = ShippedResultCoordsRecvData.Insert(iRecv);
+    ResultCoords.Resize({{NumQueryPoints,MAX_DIMS}});
+    MPI_Irecv(ResultCoords.Data(), int(ResultCoords.Count()), MPI_DOUBLE, Rank,
+      SHIPPED_RESULT_COORDS_TAG, Comm, &MPIRequests.Append());
+  }
+
+  MPI_Waitall(ShippedQueryMPIRequests.Count(), ShippedQueryMPIRequests.Data(),
+    MPI_STATUSES_IGNORE);
+  ShippedQueryMPIRequests.Clear();
+
+  // Answer all of the requests for a given fragment using the same accel
+  elem_map<int,2,array<int>> ShippedQuerySendsForFragment;
+
+  for (auto &Entry : ShippedQueryRecvData) {
+    int iSend = Entry.Key();
+    const elem<int,3> &SendInfo = FragmentSends[iSend];
+    ShippedQuerySendsForFragment.Fetch({SendInfo(0),SendInfo(2)}).Append(iSend);
+  }
+
+  MPIRequests.Reserve(MPIRequests.Count() + 2*ShippedQueryRecvData.Count());
+
+  for (auto &FragmentEntry : ShippedQuerySendsForFragment) {
+    int MGridID = FragmentEntry.Key()(0);
+    int FragmentID = FragmentEntry.Key()(1);
+    const array<int> &SendIndices = FragmentEntry.Value();
+    fragment_data &Data = OverlapCache(MGridID).FragmentData(FragmentID);
+    field_indexer MGridCellGlobalIndexer(Domain.GridInfo(MGridID).CellGlobalRange());
+    long long NumQueryPoints = 0;
+    for (int iSend : SendIndices) {
+      NumQueryPoints += NumQueryPointsShippedForSend(iSend);
+    }
+    Profiler.Start(OVERLAP_SEARCH_BUILD_ACCEL_TIME);
+    if (!Data.OverlapAccel) {
+      Data.OverlapAccel = CreateFragmentOverlapAccel(MGridID, Data, NumQueryPoints);
+    }
+    Profiler.Stop(OVERLAP_SEARCH_BUILD_ACCEL_TIME);
+    const core::overlap_accel &OverlapAccel = *Data.OverlapAccel;
+    Profiler.Start(OVERLAP_SEARCH_QUERY_ACCEL_TIME);
+    for (int iSend : SendIndices) {
+      int Rank = FragmentSends[iSend](1);
+      long long NumSendQueryPoints = NumQueryPointsShippedForSend(iSend);
+      const array<double,2> &Queries = ShippedQueryRecvData(iSend);
+      array<long long> &ResultCells = ShippedResultCellsSendData.Insert(iSend);
+      ResultCells.Resize({NumSendQueryPoints}, NO_CELL);
+      array<double,2> &ResultCoords = ShippedResultCoordsSendData.Insert(iSend);
+      ResultCoords.Resize({{NumSendQueryPoints,MAX_DIMS}}, 0.);
+      array<tuple<double>> PointCoords({NumSendQueryPoints});
+      array<double> OverlapTolerances({NumSendQueryPoints});
+      for (long long iQuery = 0; iQuery < NumSendQueryPoints; ++iQuery) {
+        PointCoords(iQuery) = {
+          Queries(iQuery,0),
+          Queries(iQuery,1),
+          Queries(iQuery,2)
+        };
+        OverlapTolerances(iQuery) = Queries(iQuery,MAX_DIMS);
+      }
+      array<optional<tuple<int>>> MaybeCells({NumSendQueryPoints});
+      array<optional<tuple<double>>> MaybeCellCoords({NumSendQueryPoints});
+      OverlapAccel.FindCells(PointCoords, OverlapTolerances, MaybeCells, MaybeCellCoords);
+      for (long long iQuery = 0; iQuery < NumSendQueryPoints; ++iQuery) {
+        if (MaybeCells(iQuery)) {
+          ResultCells(iQuery) = MGridCellGlobalIndexer.ToIndex(*MaybeCells(iQuery));
+          for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+            ResultCoords(iQuery,iDim) = (*MaybeCellCoords(iQuery))(iDim);
+          }
+        }
+      }
+      MPI_Isend(ResultCells.Data(), int(NumSendQueryPoints), MPI_LONG_LONG, Rank,
+        SHIPPED_RESULT_CELLS_TAG, Comm, &MPIRequests.Append());
+      MPI_Isend(ResultCoords.Data(), int(ResultCoords.Count()), MPI_DOUBLE, Rank,
+        SHIPPED_RESULT_COORDS_TAG, Comm, &MPIRequests.Append());
+    }
+    Profiler.Stop(OVERLAP_SEARCH_QUERY_ACCEL_TIME);
+  }
+
+  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
+  MPIRequests.Clear();
+
+  for (auto &Entry : ShippedResultCellsRecvData) {
+    int iRecv = Entry.Key();
+    const array<long long> &ResultCells = Entry.Value();
+    const array<double,2> &ResultCoords = ShippedResultCoordsRecvData(iRecv);
+    const elem<int,3> &RecvInfo = FragmentRecvs[iRecv];
+    int MGridID = RecvInfo(0);
+    int Rank = RecvInfo(1);
+    int FragmentID = RecvInfo(2);
+    long long iQuery = 0;
+    for (int NGridID : Domain.LocalGridIDs()) {
+      auto &FragmentOverlapDataForMGridAndRank = FragmentOverlapDataForLocalNGrid(NGridID);
+      auto MGridAndRankIter = FragmentOverlapDataForMGridAndRank.Find({MGridID,Rank});
+      if (MGridAndRankIter == FragmentOverlapDataForMGridAndRank.End()) continue;
+      auto &FragmentOverlapData = MGridAndRankIter->Value();
+      auto FragmentIter = FragmentOverlapData.Find(FragmentID);
+      if (FragmentIter == FragmentOverlapData.End()) continue;
+      fragment_overlap_data &OverlapData = FragmentIter->Value();
+      for (long long iQueryPoint = 0; iQueryPoint < OverlapData.Points.Count(); ++iQueryPoint) {
+        long long iCell = ResultCells(iQuery);
+        if (iCell != NO_CELL) {
+          OverlapData.Cells(iQueryPoint) = iCell;
+          for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+            OverlapData.Coords(iDim,iQueryPoint) = ResultCoords(iQuery,iDim);
+          }
+        }
+        ++iQuery;
+      }
+    }
+  }
+
+  ShippedQueryRecvData.Clear();
+  ShippedQuerySendData.Clear();
+  ShippedResultCellsSendData.Clear();
+  ShippedResultCoordsSendData.Clear();
+  ShippedResultCellsRecvData.Clear();
+  ShippedResultCoordsRecvData.Clear();
+
+  // Remaining fragments are transferred below
+  {
+    elem_set<int,3> TransferredFragmentSends;
+    for (int iSend = 0; iSend < FragmentSends.Count(); ++iSend) {
+      if (NumQueryPointsShippedForSend(iSend) == 0) {
+        TransferredFragmentSends.Insert(FragmentSends[iSend]);
+      }
+    }
+    FragmentSends = std::move(TransferredFragmentSends);
+    elem_set<int,3> TransferredFragmentRecvs;
+    elem_map<int,3,range> TransferredRemoteFragmentRanges;
+    for (int iRecv = 0; iRecv < FragmentRecvs.Count(); ++iRecv) {
+      if (NumQueryPointsShippedForRecv(iRecv) == 0) {
+        TransferredFragmentRecvs.Insert(FragmentRecvs[iRecv]);
+        TransferredRemoteFragmentRanges.Insert(FragmentRecvs[iRecv],
+          RemoteFragmentRanges[iRecv].Value());
+      }
+    }
+    FragmentRecvs = std::move(TransferredFragmentRecvs);
+    RemoteFragmentRanges = std::move(TransferredRemoteFragmentRanges);
+  }
+
+  Profiler.Stop(OVERLAP_SEARCH_SHIP_QUERIES_TIME);
+
   array<MPI_Request> SignalMPISendRequests({FragmentRecvs.Count()}, MPI_REQUEST_NULL);
   array<MPI_Request> SignalMPIRecvRequests({FragmentSends.Count()}, MPI_REQUEST_NULL);
   array<bool> SignalDummySendData({FragmentRecvs.Count()}, false);
@@ -1461,11 +2002,11 @@ void assembler::DetectOverlap_() {
       CellActiveMaskRange);
     Data.Coords.Resize({MAX_DIMS});
     for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-      Data.Coords(iDim).Resize(CoordsRange);
+      Data.Coords(iDim).ResizeUninitialized(CoordsRange);
       MPI_Irecv(Data.Coords(iDim).Data(), Data.Coords(iDim).Count(), MPI_DOUBLE, Rank, 0,
         Domain.Comm(), TransferMPIRecvRequests.Data(iTransfer,iDim));
     }
-    Data.CellActiveMask.Resize(CellActiveMaskRange);
+    Data.CellActiveMask.ResizeUninitialized(CellActiveMaskRange);
     MPI_Irecv(Data.CellActiveMask.Data(), Data.CellActiveMask.Count(), MPI_C_BOOL, Rank, 0,
       Domain.Comm(), TransferMPIRecvRequests.Data(iTransfer,3));
     MPI_Isend(SignalDummySendData.Data(iNextRecv), 1, MPI_C_BOOL, Rank, 1, Domain.Comm(),
@@ -1491,7 +2032,7 @@ void assembler::DetectOverlap_() {
           int MGridID = SendInfo(0);
           int Rank = SendInfo(1);
           int FragmentID = SendInfo(2);
-          const fragment_data &Data = FragmentDataForLocalGrid(MGridID)(FragmentID);
+          const fragment_data &Data = OverlapCache(MGridID).FragmentData(FragmentID);
           for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
             MPI_Isend(Data.Coords(iDim).Data(), Data.Coords(iDim).Count(), MPI_DOUBLE, Rank, 0,
               Domain.Comm(), TransferMPISendRequests.Data(iSend,iDim));
@@ -1538,7 +2079,7 @@ void assembler::DetectOverlap_() {
       int MGridID;
       int Rank;
       int FragmentID;
-      const fragment_data *DataPtr;
+      fragment_data *DataPtr;
       if (iTransfer < MAX_SIMULTANEOUS_TRANSFERS) {
         int iRecv = TransferredFragmentRecvIndices(iTransfer);
         auto &Entry = FragmentRecvs[iRecv];
@@ -1550,42 +2091,24 @@ void assembler::DetectOverlap_() {
         MGridID = FragmentLocals[iNextLocal](0);
         Rank = Domain.Comm().Rank();
         FragmentID = FragmentLocals[iNextLocal](1);
-        DataPtr = &FragmentDataForLocalGrid(MGridID)(FragmentID);
+        DataPtr = &OverlapCache(MGridID).FragmentData(FragmentID);
       }
-      const fragment_data &Data = *DataPtr;
+      fragment_data &Data = *DataPtr;
       const grid_info &MGridInfo = Domain.GridInfo(MGridID);
       field_indexer MGridCellGlobalIndexer(MGridInfo.CellGlobalRange());
       geometry_type GeometryType = GeometryComponent.GeometryInfo(MGridID).Type();
-      double DepthAdjust = Options_.OverlapAccelDepthAdjust(MGridID);
-      double ResolutionAdjust = Options_.OverlapAccelResolutionAdjust(MGridID);
-      double MaxOverlapTolerance = MaxOverlapTolerances(MGridID);
-      long long NumCellsLeaf = (long long)(Max(std::pow(2., 12.-DepthAdjust), 1.));
-      double MaxNodeUnoccupiedVolume = std::pow(2., -2.-DepthAdjust);
-      double MaxNodeCellVolumeVariation = 0.5;
-      long long NumFragmentCells = Data.CellRange.Count();
-      long long NumQueryPoints = 0;
-      for (int NGridID : Domain.LocalGridIDs()) {
-        auto &FragmentOverlapDataForMGridAndRank = FragmentOverlapDataForLocalNGrid(NGridID);
-        auto MGridAndRankIter = FragmentOverlapDataForMGridAndRank.Find({MGridID,Rank});
-        if (MGridAndRankIter == FragmentOverlapDataForMGridAndRank.End()) continue;
-        auto &FragmentOverlapData = MGridAndRankIter->Value();
-        auto FragmentIter = FragmentOverlapData.Find(FragmentID);
-        if (FragmentIter == FragmentOverlapData.End()) continue;
-        const fragment_overlap_data &OverlapData = FragmentIter->Value();
-        NumQueryPoints += OverlapData.Points.Count();
-      }
-      double BinScale = 1./Min(std::pow(double(NumQueryPoints)/double(NumFragmentCells),
-        1./double(NumDims)), 1.) * std::pow(2., -1.-ResolutionAdjust);
+      long long NumQueryPoints = CountFragmentQueryPoints(MGridID, Rank, FragmentID);
       elem<field_view<const double>,MAX_DIMS> MGridCoords = {
         Data.Coords(0),
         Data.Coords(1),
         Data.Coords(2)
       };
       Profiler.Start(OVERLAP_SEARCH_BUILD_ACCEL_TIME);
-      core::overlap_accel OverlapAccel(GeometryType, NumDims, Data.CellRange, MGridCoords,
-        Data.CellActiveMask, MaxOverlapTolerance, NumCellsLeaf, MaxNodeUnoccupiedVolume,
-        MaxNodeCellVolumeVariation, BinScale);
+      if (!Data.OverlapAccel) {
+        Data.OverlapAccel = CreateFragmentOverlapAccel(MGridID, Data, NumQueryPoints);
+      }
       Profiler.Stop(OVERLAP_SEARCH_BUILD_ACCEL_TIME);
+      const core::overlap_accel &OverlapAccel = *Data.OverlapAccel;
       Profiler.Start(OVERLAP_SEARCH_QUERY_ACCEL_TIME);
       core::geometry_manipulator GeometryManipulator(GeometryType, NumDims);
       for (int NGridID : Domain.LocalGridIDs()) {
@@ -1616,15 +2139,16 @@ void assembler::DetectOverlap_() {
         const grid_info &MGridInfo = Domain.GridInfo(MGridID);
         fragment_data &Data = TransferredFragmentData(iTransfer);
         Data.CellRange = Entry.Value();
+        Data.OverlapAccel.Reset();
         range CoordsRange, CellActiveMaskRange;
         GenerateFragmentDataRanges(MGridInfo.Cart(), MGridInfo.CellCart(), Data.CellRange,
           CoordsRange, CellActiveMaskRange);
         for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-          Data.Coords(iDim).Resize(CoordsRange);
+          Data.Coords(iDim).ResizeUninitialized(CoordsRange);
           MPI_Irecv(Data.Coords(iDim).Data(), Data.Coords(iDim).Count(), MPI_DOUBLE, Rank, 0,
             Domain.Comm(), TransferMPIRecvRequests.Data(iTransfer,iDim));
         }
-        Data.CellActiveMask.Resize(CellActiveMaskRange);
+        Data.CellActiveMask.ResizeUninitialized(CellActiveMaskRange);
         MPI_Irecv(Data.CellActiveMask.Data(), Data.CellActiveMask.Count(), MPI_C_BOOL, Rank, 0,
           Domain.Comm(), TransferMPIRecvRequests.Data(iTransfer,3));
         MPI_Isend(SignalDummySendData.Data(iNextRecv), 1, MPI_C_BOOL, Rank, 1, Domain.Comm(),
@@ -1646,7 +2170,9 @@ void assembler::DetectOverlap_() {
 
   TransferredFragmentData.Clear();
 
-  Logger.SyncIndicator(Domain.Comm());
+  if (Logger.LoggingStatus()) {
+    Logger.SyncIndicator(Domain.Comm());
+  }
 
   struct overlap_data {
     long long NumOverlapping;
@@ -1741,8 +2267,9 @@ void assembler::DetectOverlap_() {
     field_indexer LocalIndexer(LocalRange);
     auto &MGridIDsAndRanks = OverlappingMGridIDsAndRanksForLocalNGrid(NGridID);
     auto &FragmentOverlapDataForMGridAndRank = FragmentOverlapDataForLocalNGrid(NGridID);
-    field<bool> OverlapMask(LocalRange);
-    field<long long> NumOverlappingBefore(LocalRange);
+    core::arena_scope MaskArenaScope(AssemblyData.Arena);
+    core::arena_field<bool> OverlapMask(LocalRange, AssemblyData.Arena);
+    core::arena_field<long long> NumOverlappingBefore(LocalRange, AssemblyData.Arena);
     for (auto &MEntry : MGridIDsAndRanks) {
       int MGridID = MEntry.Key();
       set<int> &MGridRanks = MEntry.Value();
@@ -1773,7 +2300,8 @@ void assembler::DetectOverlap_() {
       if (NumOverlapping == 0) continue;
       overlap_data &AggregatedOverlapData = OverlapDataForGridPair.Insert({MGridID,NGridID},
         NumOverlapping);
-      array<bool> Filled({NumOverlapping}, false);
+      core::arena_scope FilledArenaScope(AssemblyData.Arena);
+      core::arena_array<bool> Filled({NumOverlapping}, false, AssemblyData.Arena);
       OverlapMask.Fill(false);
       for (int Rank : MGridRanks) {
         auto &FragmentOverlapData = FragmentOverlapDataForMGridAndRank({MGridID,Rank});
@@ -1847,44 +2375,36 @@ void assembler::DetectOverlap_() {
     Ranges.CellCoverRange = MakeCellCoverRange(MGrid.Cart(), MGrid.CellLocalRange());
   }
 
-  MGridRanges.Reserve(MGridRanges.Count()+MGridRecvs.Count());
-
-  MPIRequests.Reserve(4*(MGridSends.Count()+MGridRecvs.Count()));
+  // Ranges for each rank are sent and received in the same MGridID order
+  core::message_aggregator<m_grid_ranges> MGridRangesMessages(Comm, M_GRID_RANGES_TAG);
 
   for (auto &MGridIDAndRankPair : MGridRecvs) {
     int Rank = MGridIDAndRankPair(1);
-    m_grid_ranges &Ranges = MGridRanges.Insert(MGridIDAndRankPair);
-    MPI_Irecv(Ranges.CellLocalRange.Begin().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Irecv(Ranges.CellLocalRange.End().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Irecv(Ranges.CellCoverRange.Begin().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Irecv(Ranges.CellCoverRange.End().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
+    MGridRangesMessages.AddSource(Rank);
   }
 
   for (auto &MGridIDAndRankPair : MGridSends) {
     int MGridID = MGridIDAndRankPair(0);
     int Rank = MGridIDAndRankPair(1);
-    const m_grid_ranges &Ranges = MGridRanges({MGridID,Domain.Comm().Rank()});
-    MPI_Isend(Ranges.CellLocalRange.Begin().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Isend(Ranges.CellLocalRange.End().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Isend(Ranges.CellCoverRange.Begin().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
-    MPI_Isend(Ranges.CellCoverRange.End().Data(), MAX_DIMS, MPI_INT, Rank, 0, Domain.Comm(),
-      &MPIRequests.Append());
+    MGridRangesMessages.Append(Rank, MGridRanges({MGridID,Domain.Comm().Rank()}));
   }
 
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
+  MGridRangesMessages.Exchange();
+
+  MGridRanges.Reserve(MGridRanges.Count()+MGridRecvs.Count());
+
+  map<int,int> NextMGridRangesFromRank;
+
+  for (auto &MGridIDAndRankPair : MGridRecvs) {
+    int Rank = MGridIDAndRankPair(1);
+    int &iRecord = NextMGridRangesFromRank.Fetch(Rank, 0);
+    MGridRanges.Insert(MGridIDAndRankPair, MGridRangesMessages.Received(Rank)(iRecord));
+    ++iRecord;
+  }
 
   map<int,elem_map<int,2,long long>> NumOverlappingFromMGridAndRankForLocalNGrid;
   map<int,elem_map<int,2,long long>> NumOverlappingFromNGridAndRankForLocalMGrid;
 
-  int NumSends = 0;
   for (int NGridID : Domain.LocalGridIDs()) {
     auto &NumFromMGridAndRank = NumOverlappingFromMGridAndRankForLocalNGrid.Insert(NGridID);
     auto &MGridIDsAndRanks = OverlappingMGridIDsAndRanksForLocalNGrid(NGridID);
@@ -1893,12 +2413,10 @@ void assembler::DetectOverlap_() {
       const set<int> &MGridRanks = MEntry.Value();
       for (int Rank : MGridRanks) {
         NumFromMGridAndRank.Insert({MGridID,Rank}, 0);
-        ++NumSends;
       }
     }
   }
 
-  int NumRecvs = 0;
   for (int MGridID : Domain.LocalGridIDs()) {
     auto &NumFromNGridAndRank = NumOverlappingFromNGridAndRankForLocalMGrid.Insert(MGridID);
     auto &NGridIDsAndRanks = OverlappingNGridIDsAndRanksForLocalMGrid(MGridID);
@@ -1907,23 +2425,25 @@ void assembler::DetectOverlap_() {
       const set<int> &NGridRanks = NEntry.Value();
       for (int Rank : NGridRanks) {
         NumFromNGridAndRank.Insert({NGridID,Rank}, 0);
-        ++NumRecvs;
       }
     }
   }
 
-  MPIRequests.Reserve(NumSends + NumRecvs);
+  struct num_overlapping_record {
+    int MGridID;
+    int NGridID;
+    long long NumOverlapping;
+  };
+
+  core::message_aggregator<num_overlapping_record> NumOverlappingMessages(Comm,
+    NUM_OVERLAPPING_TAG);
 
   for (int MGridID : Domain.LocalGridIDs()) {
     auto &NGridIDsAndRanks = OverlappingNGridIDsAndRanksForLocalMGrid(MGridID);
-    auto &NumFromNGridAndRank = NumOverlappingFromNGridAndRankForLocalMGrid(MGridID);
     for (auto &NEntry : NGridIDsAndRanks) {
-      int NGridID = NEntry.Key();
-      set<int> &NGridRanks = NEntry.Value();
+      const set<int> &NGridRanks = NEntry.Value();
       for (int Rank : NGridRanks) {
-        long long &NumOverlapping = NumFromNGridAndRank({NGridID,Rank});
-        MPI_Irecv(&NumOverlapping, 1, MPI_LONG_LONG, Rank, MGridID, Domain.Comm(),
-          &MPIRequests.Append());
+        NumOverlappingMessages.AddSource(Rank);
       }
     }
   }
@@ -1955,14 +2475,30 @@ void assembler::DetectOverlap_() {
             }
           }
         }
-        MPI_Isend(&NumOverlapping, 1, MPI_LONG_LONG, Rank, MGridID, Domain.Comm(),
-          &MPIRequests.Append());
+        NumOverlappingMessages.Append(Rank, {MGridID,NGridID,NumOverlapping});
       }
     }
   }
 
-  MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
-  MPIRequests.Clear();
+  NumOverlappingMessages.Exchange();
+
+  set<int> NumOverlappingSourceRanks;
+  for (int MGridID : Domain.LocalGridIDs()) {
+    auto &NGridIDsAndRanks = OverlappingNGridIDsAndRanksForLocalMGrid(MGridID);
+    for (auto &NEntry : NGridIDsAndRanks) {
+      const set<int> &NGridRanks = NEntry.Value();
+      for (int Rank : NGridRanks) {
+        NumOverlappingSourceRanks.Insert(Rank);
+      }
+    }
+  }
+
+  for (int Rank : NumOverlappingSourceRanks) {
+    for (auto &Record : NumOverlappingMessages.Received(Rank)) {
+      NumOverlappingFromNGridAndRankForLocalMGrid(Record.MGridID)({Record.NGridID,Rank}) =
+        Record.NumOverlapping;
+    }
+  }
 
   for (int NGridID : Domain.LocalGridIDs()) {
     auto &MGridIDsAndRanks = OverlappingMGridIDsAndRanksForLocalNGrid(NGridID);
@@ -2003,39 +2539,49 @@ void assembler::DetectOverlap_() {
   Profiler.Stop(OVERLAP_SEARCH_TIME);
 
   if (Logger.LoggingStatus()) {
-    MPI_Barrier(Domain.Comm());
-    elem_map<int,2,long long> NumOverlappedByMGridForLocalNGrid;
+    map<int,array<long long>> NumOverlappedForLocalNGrid;
+    array<MPI_Request> ReduceRequests;
+    ReduceRequests.Reserve(Domain.LocalGridIDs().Count());
     for (int NGridID : Domain.LocalGridIDs()) {
       const grid &NGrid = Domain.Grid(NGridID);
       auto &MGridIDsAndRanks = OverlappingMGridIDsAndRanksForLocalNGrid(NGridID);
-      for (int MGridID : Domain.GridIDs()) {
-        elem<int,2> OverlapID = {MGridID,NGridID};
-        if (!Options_.Overlappable(OverlapID)) continue;
-        long long &NumOverlapped = NumOverlappedByMGridForLocalNGrid.Insert(OverlapID, 0);
+      const array<int> &CandidateMGridIDs = CandidateMGridIDsForNGrid(NGridID);
+      int NumCandidates = CandidateMGridIDs.Count();
+      array<long long> &NumOverlapped = NumOverlappedForLocalNGrid.Insert(NGridID,
+        array<long long>({NumCandidates}, 0));
+      for (int iCandidate = 0; iCandidate < NumCandidates; ++iCandidate) {
+        int MGridID = CandidateMGridIDs(iCandidate);
         if (MGridIDsAndRanks.Contains(MGridID)) {
-          auto Iter = OverlapDataForGridPair.Find(OverlapID);
+          auto Iter = OverlapDataForGridPair.Find({MGridID,NGridID});
           if (Iter != OverlapDataForGridPair.End()) {
             const overlap_data &OverlapData = Iter->Value();
-            NumOverlapped = OverlapData.NumOverlapping;
+            NumOverlapped(iCandidate) = OverlapData.NumOverlapping;
           }
         }
-        MPI_Allreduce(MPI_IN_PLACE, &NumOverlapped, 1, MPI_LONG_LONG, MPI_SUM, NGrid.Comm());
       }
+      core::StartAllreduce(NumOverlapped.Data(), NumCandidates, MPI_LONG_LONG, MPI_SUM,
+        NGrid.Comm(), ReduceRequests.Append());
     }
-    for (int MGridID : Domain.GridIDs()) {
-      for (int NGridID : Domain.GridIDs()) {
-        elem<int,2> OverlapID = {MGridID,NGridID};
-        if (Options_.Overlappable(OverlapID) && Domain.GridIsLocal(NGridID)) {
-          const grid &NGrid = Domain.Grid(NGridID);
-          long long NumOverlapped = NumOverlappedByMGridForLocalNGrid(OverlapID);
-          if (NumOverlapped > 0) {
-            const grid_info &MGridInfo = Domain.GridInfo(MGridID);
-            std::string NumOverlappedString = core::FormatNumber(NumOverlapped, "points", "point");
-            Logger.LogStatus(NGrid.Comm().Rank() == 0, "Detected %s overlapped by grid %s on grid "
-              "%s.", NumOverlappedString, MGridInfo.Name(), NGrid.Name());
-          }
-        }
-        MPI_Barrier(Domain.Comm());
+    MPI_Waitall(ReduceRequests.Count(), ReduceRequests.Data(), MPI_STATUSES_IGNORE);
+    elem_map<int,2,long long> NumOverlappedByMGridForLocalNGrid;
+    for (int NGridID : Domain.LocalGridIDs()) {
+      const array<int> &CandidateMGridIDs = CandidateMGridIDsForNGrid(NGridID);
+      const array<long long> &NumOverlapped = NumOverlappedForLocalNGrid(NGridID);
+      for (int iCandidate = 0; iCandidate < CandidateMGridIDs.Count(); ++iCandidate) {
+        int MGridID = CandidateMGridIDs(iCandidate);
+        NumOverlappedByMGridForLocalNGrid.Insert({MGridID,NGridID}, NumOverlapped(iCandidate));
+      }
+    }
+    elem_map<int,2,long long> NumOverlappedForGridPair = GatherGridPairCountsOnRoot(Domain,
+      OverlapCandidates, NumOverlappedByMGridForLocalNGrid);
+    for (auto &Entry : NumOverlappedForGridPair) {
+      long long NumOverlapped = Entry.Value();
+      if (NumOverlapped > 0) {
+        const grid_info &MGridInfo = Domain.GridInfo(Entry.Key(0));
+        const grid_info &NGridInfo = Domain.GridInfo(Entry.Key(1));
+        std::string NumOverlappedString = core::FormatNumber(NumOverlapped, "points", "point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "Detected %s overlapped by grid %s on grid "
+          "%s.", NumOverlappedString, MGridInfo.Name(), NGridInfo.Name());
       }
     }
   }
@@ -2050,70 +2596,28 @@ void assembler::DetectOverlap_() {
 
   Profiler.StartSync(OVERLAP_SYNC_TIME, Domain.Comm());
 
-  elem_set<int,2> OverlappingGridIDs;
+  // Candidate pairs are known on all ranks, so the set of overlapping pairs can be found with a
+  // single bitwise or of per-candidate flags over the domain. It is non-blocking so that it can
+  // complete while the overlap M data exchange (which doesn't depend on it) is being started
+
+  packed_flags OverlapsForCandidate(OverlapCandidates.Count());
 
   for (int NGridID : Domain.LocalGridIDs()) {
-    const grid &NGrid = Domain.Grid(NGridID);
     auto &MGridIDsAndRanks = OverlappingMGridIDsAndRanksForLocalNGrid(NGridID);
     for (auto &MEntry : MGridIDsAndRanks) {
       int MGridID = MEntry.Key();
-      OverlappingGridIDs.Insert({MGridID,NGridID});
-    }
-    for (int MGridID : Domain.GridIDs()) {
-      elem<int,2> OverlapID = {MGridID,NGridID};
-      if (Options_.Overlappable(OverlapID)) {
-        int Overlaps = OverlappingGridIDs.Contains(OverlapID);
-        if (NGrid.Comm().Rank() > 0) {
-          MPI_Reduce(&Overlaps, nullptr, 1, MPI_INT, MPI_MAX, 0, NGrid.Comm());
-        } else {
-          MPI_Reduce(MPI_IN_PLACE, &Overlaps, 1, MPI_INT, MPI_MAX, 0, NGrid.Comm());
-          if (Overlaps) {
-            OverlappingGridIDs.Insert(OverlapID);
-          }
-        }
-      }
+      long long iCandidate = OverlapCandidates.Find({MGridID,NGridID}) -
+        OverlapCandidates.Begin();
+      OverlapsForCandidate.Set(iCandidate);
     }
   }
 
-  for (int NGridID : Domain.GridIDs()) {
-    bool IsNGridRoot = false;
-    int NGridRootRank;
-    if (Domain.GridIsLocal(NGridID)) {
-      const grid &NGrid = Domain.Grid(NGridID);
-      IsNGridRoot = NGrid.Comm().Rank() == 0;
-      if (IsNGridRoot) {
-        NGridRootRank = Domain.Comm().Rank();
-      }
-    }
-    core::BroadcastAnySource(&NGridRootRank, 1, MPI_INT, IsNGridRoot, Domain.Comm());
-    for (int MGridID : Domain.GridIDs()) {
-      elem<int,2> OverlapID = {MGridID,NGridID};
-      if (Options_.Overlappable(OverlapID)) {
-        int Overlaps;
-        if (IsNGridRoot) Overlaps = OverlappingGridIDs.Contains(OverlapID);
-        MPI_Bcast(&Overlaps, 1, MPI_INT, NGridRootRank, Domain.Comm());
-        if (Overlaps) {
-          OverlappingGridIDs.Insert(OverlapID);
-        }
-      }
-    }
-  }
+  MPI_Request SyncRequest;
+  core::StartAllreduce(OverlapsForCandidate.Data(), OverlapsForCandidate.ByteCount(),
+    MPI_UNSIGNED_CHAR, MPI_BOR, Domain.Comm(), SyncRequest);
 
   Profiler.Stop(OVERLAP_SYNC_TIME);
-  Profiler.StartSync(OVERLAP_CREATE_TIME, Domain.Comm());
-
-  auto OverlapComponentEditHandle = Domain.EditComponent<overlap_component>(OverlapComponentID_);
-  overlap_component &OverlapComponent = *OverlapComponentEditHandle;
-
-  auto Suppress = Logger.IncreaseStatusLevel(100);
-
-  OverlapComponent.ClearOverlaps();
-  OverlapComponent.CreateOverlaps(OverlappingGridIDs);
-
-  Suppress.Reset();
-
-  Profiler.Stop(OVERLAP_CREATE_TIME);
-  Profiler.StartSync(OVERLAP_FILL_TIME, Domain.Comm());
+  Profiler.Start(OVERLAP_FILL_TIME);
 
   struct overlap_m_data {
     long long NumOverlapping;
@@ -2166,12 +2670,12 @@ void assembler::DetectOverlap_() {
     }
   }
 
-  NumSends = 0;
+  int NumSends = 0;
   for (int NGridID : Domain.LocalGridIDs()) {
     NumSends += OverlapMSendDataForLocalNGrid(NGridID).Count();
   }
 
-  NumRecvs = 0;
+  int NumRecvs = 0;
   for (int MGridID : Domain.LocalGridIDs()) {
     NumRecvs += OverlapMRecvDataForLocalMGrid(MGridID).Count();
   }
@@ -2286,6 +2790,35 @@ void assembler::DetectOverlap_() {
     }
   }
 
+  Profiler.Stop(OVERLAP_FILL_TIME);
+  Profiler.Start(OVERLAP_SYNC_TIME);
+
+  MPI_Wait(&SyncRequest, MPI_STATUS_IGNORE);
+
+  elem_set<int,2> OverlappingGridIDs;
+
+  for (long long iCandidate = 0; iCandidate < OverlapCandidates.Count(); ++iCandidate) {
+    if (OverlapsForCandidate(iCandidate)) {
+      OverlappingGridIDs.Insert(OverlapCandidates[iCandidate]);
+    }
+  }
+
+  Profiler.Stop(OVERLAP_SYNC_TIME);
+  Profiler.StartSync(OVERLAP_CREATE_TIME, Domain.Comm());
+
+  auto OverlapComponentEditHandle = Domain.EditComponent<overlap_component>(OverlapComponentID_);
+  overlap_component &OverlapComponent = *OverlapComponentEditHandle;
+
+  auto Suppress = Logger.IncreaseStatusLevel(100);
+
+  OverlapComponent.ClearOverlaps();
+  OverlapComponent.CreateOverlaps(OverlappingGridIDs);
+
+  Suppress.Reset();
+
+  Profiler.Stop(OVERLAP_CREATE_TIME);
+  Profiler.StartSync(OVERLAP_FILL_TIME, Domain.Comm());
+
   MPI_Waitall(MPIRequests.Count(), MPIRequests.Data(), MPI_STATUSES_IGNORE);
   MPIRequests.Clear();
 
@@ -2596,13 +3129,15 @@ void assembler::DetectOverlap_() {
     array<double,3> InterpCoefs;
     core::collect Collect;
     core::send Send;
-    array<double> SendBuffer;
+    core::arena_array<double> SendBuffer;
   };
 
   struct exchange_n {
     core::recv Recv;
   };
 
+  core::arena::marker ExchangeArenaMarker = AssemblyData.Arena.Mark();
+
   elem_map<int,2,exchange_m> ExchangeMs;
   elem_map<int,2,exchange_n> ExchangeNs;
 
@@ -2613,7 +3148,7 @@ void assembler::DetectOverlap_() {
     const local_overlap_m_aux_data &OverlapMAuxData = AssemblyData.LocalOverlapMAuxData(OverlapID);
     exchange_m &ExchangeM = ExchangeMs.Insert(OverlapID);
     array<double,3> &InterpCoefs = ExchangeM.InterpCoefs;
-    InterpCoefs.Resize({{MAX_DIMS,2,OverlapM.Size()}});
+    InterpCoefs.ResizeUninitialized({{MAX_DIMS,2,OverlapM.Size()}});
     for (long long iOverlapping = 0; iOverlapping < OverlapM.Size(); ++iOverlapping) {
       for (int iDim = 0; iDim < NumDims; ++iDim) {
         elem<double,2> Coefs = core::LagrangeInterpLinear(OverlapM.Coords()(iDim,iOverlapping));
@@ -2625,13 +3160,14 @@ void assembler::DetectOverlap_() {
         InterpCoefs(iDim,1,iOverlapping) = 0.;
       }
     }
-    auto InterpCoefsRef = ExchangeM.FloatingRefGenerator.Generate(InterpCoefs);
+    floating_ref<const array<double,3>> InterpCoefsRef = ExchangeM.FloatingRefGenerator.Generate(
+      InterpCoefs);
     ExchangeM.Collect = core::CreateCollectInterp(Context_, MGrid.Comm(), MGrid.Cart(),
       MGrid.LocalRange(), OverlapMAuxData.CollectMap, data_type::DOUBLE, 1, MGrid.ExtendedRange(),
       array_layout::COLUMN_MAJOR, InterpCoefsRef);
     ExchangeM.Send = core::CreateSend(Context_, Domain.Comm(), OverlapMAuxData.SendMap,
       data_type::DOUBLE, 1, 0);
-    ExchangeM.SendBuffer.Resize({OverlapM.Size()});
+    ExchangeM.SendBuffer = core::arena_array<double>({OverlapM.Size()}, AssemblyData.Arena);
   }
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
@@ -2674,6 +3210,7 @@ void assembler::DetectOverlap_() {
 
   ExchangeMs.Clear();
   ExchangeNs.Clear();
+  AssemblyData.Arena.Rewind(ExchangeArenaMarker);
 
   Profiler.Stop(OVERLAP_CREATE_AUX_TIME);
   Profiler.Stop(OVERLAP_TIME);
@@ -2684,10 +3221,11 @@ void assembler::DetectOverlap_() {
     Logger.LogStatus(Domain.Comm().Rank() == 0, "Done creating auxiliary overlap data.");
   }
 
-  MPI_Barrier(Domain.Comm());
-
   Level1.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done detecting overlap between grids.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done detecting overlap between grids.");
+  }
 
 }
 
@@ -2697,9 +3235,10 @@ void assembler::InferBoundaries_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Inferring non-overlapping boundaries...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Inferring non-overlapping boundaries...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent(2);
 
   Profiler.StartSync(INFER_BOUNDARIES_TIME, Domain.Comm());
@@ -2767,26 +3306,24 @@ void assembler::InferBoundaries_() {
       }
       NumInferredForGrid.Insert(GridID, core::CountDistributedMask(InferredBoundaryMask));
     }
-    for (int GridID : Domain.GridIDs()) {
-      if (Domain.GridIsLocal(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumInferred = NumInferredForGrid(GridID);
-        if (NumInferred > 0) {
-          std::string NumInferredString = core::FormatNumber(NumInferred, "points", "point");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s marked as boundaries on grid %s.",
-            NumInferredString, Grid.Name());
-        }
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumInferredForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumInferred = Entry.Value();
+      if (NumInferred > 0) {
+        std::string NumInferredString = core::FormatNumber(NumInferred, "points", "point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s marked as boundaries on grid %s.",
+          NumInferredString, GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
   Profiler.Stop(INFER_BOUNDARIES_TIME);
 
-  MPI_Barrier(Domain.Comm());
-
   Level1.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done inferring non-overlapping boundaries.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done inferring non-overlapping boundaries.");
+  }
 
 }
 
@@ -2796,9 +3333,10 @@ void assembler::CutBoundaryHoles_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Cutting boundary holes...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Cutting boundary holes...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent();
 
   Profiler.StartSync(CUT_BOUNDARY_HOLES_TIME, Domain.Comm());
@@ -2847,15 +3385,17 @@ void assembler::CutBoundaryHoles_() {
   struct reverse_exchange_m {
     core::recv_map RecvMap;
     core::recv Recv;
-    array<bool> RecvBuffer;
+    core::arena_array<bool> RecvBuffer;
   };
 
   struct reverse_exchange_n {
     core::send_map SendMap;
     core::send Send;
-    array<bool> SendBuffer;
+    core::arena_array<bool> SendBuffer;
   };
 
+  core::arena::marker ProjectArenaMarker = AssemblyData.Arena.Mark();
+
   elem_map<int,2,reverse_exchange_m> ReverseExchangeMs;
   elem_map<int,2,reverse_exchange_n> ReverseExchangeNs;
 
@@ -2866,7 +3406,7 @@ void assembler::CutBoundaryHoles_() {
     ExchangeM.RecvMap = core::recv_map(OverlapM.DestinationRanks());
     ExchangeM.Recv = core::CreateRecv(Context_, Domain.Comm(), ExchangeM.RecvMap, data_type::BOOL,
       1, 0);
-    ExchangeM.RecvBuffer.Resize({OverlapM.Size()});
+    ExchangeM.RecvBuffer = core::arena_array<bool>({OverlapM.Size()}, AssemblyData.Arena);
   }
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
@@ -2876,7 +3416,7 @@ void assembler::CutBoundaryHoles_() {
     ExchangeN.SendMap = core::send_map(OverlapN.SourceRanks());
     ExchangeN.Send = core::CreateSend(Context_, Domain.Comm(), ExchangeN.SendMap, data_type::BOOL,
       1, 0);
-    ExchangeN.SendBuffer.Resize({OverlapN.Size()});
+    ExchangeN.SendBuffer = core::arena_array<bool>({OverlapN.Size()}, AssemblyData.Arena);
   }
 
   Profiler.Stop(CUT_BOUNDARY_HOLES_PROJECT_CREATE_EXCHANGE_TIME);
@@ -2908,7 +3448,7 @@ void assembler::CutBoundaryHoles_() {
       OverlapEdgeMask);
     reverse_exchange_n &ExchangeN = ReverseExchangeNs(OverlapID);
     core::send &Send = ExchangeN.Send;
-    array<bool> &SendBuffer = ExchangeN.SendBuffer;
+    core::arena_array<bool> &SendBuffer = ExchangeN.SendBuffer;
     for (long long iOverlapped = 0; iOverlapped < OverlapN.Size(); ++iOverlapped) {
       tuple<int> Point = {
         Points(0,iOverlapped),
@@ -2941,7 +3481,7 @@ void assembler::CutBoundaryHoles_() {
     const overlap_m &OverlapM = OverlapComponent.OverlapM(OverlapID);
     const array<int,2> &Cells = OverlapM.Cells();
     reverse_exchange_m &ExchangeM = ReverseExchangeMs(OverlapID);
-    const array<bool> &RecvBuffer = ExchangeM.RecvBuffer;
+    const core::arena_array<bool> &RecvBuffer = ExchangeM.RecvBuffer;
     distributed_field<bool> CellCoverMask(MGrid.SharedPartition(), false);
     for (long long iOverlapping = 0; iOverlapping < OverlapM.Size(); ++iOverlapping) {
       tuple<int> Cell = {
@@ -3037,7 +3577,7 @@ void assembler::CutBoundaryHoles_() {
     const array<int,2> &Points = OverlapN.Points();
     reverse_exchange_n &ExchangeN = ReverseExchangeNs(OverlapID);
     core::send &Send = ExchangeN.Send;
-    array<bool> &SendBuffer = ExchangeN.SendBuffer;
+    core::arena_array<bool> &SendBuffer = ExchangeN.SendBuffer;
     for (long long iOverlapped = 0; iOverlapped < OverlapN.Size(); ++iOverlapped) {
       tuple<int> Point = {
         Points(0,iOverlapped),
@@ -3066,7 +3606,7 @@ void assembler::CutBoundaryHoles_() {
     const overlap_m &OverlapM = OverlapComponent.OverlapM(OverlapID);
     const array<int,2> &Cells = OverlapM.Cells();
     reverse_exchange_m &ExchangeM = ReverseExchangeMs(OverlapID);
-    const array<bool> &RecvBuffer = ExchangeM.RecvBuffer;
+    const core::arena_array<bool> &RecvBuffer = ExchangeM.RecvBuffer;
     distributed_field<bool> CellCoverMask(MGrid.SharedPartition(), false);
     for (long long iOverlapping = 0; iOverlapping < OverlapM.Size(); ++iOverlapping) {
       tuple<int> Cell = {
@@ -3111,6 +3651,7 @@ void assembler::CutBoundaryHoles_() {
 
   ReverseExchangeMs.Clear();
   ReverseExchangeNs.Clear();
+  AssemblyData.Arena.Rewind(ProjectArenaMarker);
 
   elem_map<int,2,distributed_field<bool>> &ProjectedBoundaryMasks = AssemblyData
     .ProjectedBoundaryMasks;
@@ -3238,18 +3779,14 @@ void assembler::CutBoundaryHoles_() {
   Profiler.Stop(CUT_BOUNDARY_HOLES_DETECT_EXTERIOR_TIME);
 
   if (Logger.LoggingStatus()) {
-    MPI_Barrier(Domain.Comm());
-    for (int GridID : Domain.GridIDs()) {
-      if (LocalCutNGridIDs.Contains(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumRemoved = NumRemovedForGrid(GridID);
-        if (NumRemoved > 0) {
-          std::string NumRemovedString = core::FormatNumber(NumRemoved, "points", "point");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s removed from grid %s.", NumRemovedString,
-            Grid.Name());
-        }
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumRemovedForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumRemoved = Entry.Value();
+      if (NumRemoved > 0) {
+        std::string NumRemovedString = core::FormatNumber(NumRemoved, "points", "point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s removed from grid %s.", NumRemovedString,
+          GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
@@ -3310,15 +3847,18 @@ void assembler::CutBoundaryHoles_() {
   struct exchange_m {
     core::collect Collect;
     core::send Send;
-    array<bool> SendBuffer;
+    core::arena_array<bool> SendBuffer;
   };
 
   struct exchange_n {
     core::recv Recv;
-    array<bool> RecvBuffer;
+    core::arena_array<bool> RecvBuffer;
     core::disperse Disperse;
   };
 
+  // Exchange buffers are released at the end of the stage
+  core::arena_scope ExchangeArenaScope(AssemblyData.Arena);
+
   elem_map<int,2,exchange_m> ExchangeMs;
   elem_map<int,2,exchange_n> ExchangeNs;
 
@@ -3333,7 +3873,7 @@ void assembler::CutBoundaryHoles_() {
       array_layout::COLUMN_MAJOR);
     ExchangeM.Send = core::CreateSend(Context_, Domain.Comm(), OverlapMAuxData.SendMap,
       data_type::BOOL, 1, 0);
-    ExchangeM.SendBuffer.Resize({OverlapM.Size()});
+    ExchangeM.SendBuffer = core::arena_array<bool>({OverlapM.Size()}, AssemblyData.Arena);
   }
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
@@ -3344,7 +3884,7 @@ void assembler::CutBoundaryHoles_() {
     exchange_n &ExchangeN = ExchangeNs.Insert(OverlapID);
     ExchangeN.Recv = core::CreateRecv(Context_, Domain.Comm(), OverlapNAuxData.RecvMap,
       data_type::BOOL, 1, 0);
-    ExchangeN.RecvBuffer.Resize({OverlapN.Size()});
+    ExchangeN.RecvBuffer = core::arena_array<bool>({OverlapN.Size()}, AssemblyData.Arena);
     ExchangeN.Disperse = core::CreateDisperseOverwrite(Context_, OverlapNAuxData.DisperseMap,
       data_type::BOOL, 1, NGrid.ExtendedRange(), array_layout::COLUMN_MAJOR);
   }
@@ -3391,10 +3931,11 @@ void assembler::CutBoundaryHoles_() {
   Profiler.Stop(CUT_BOUNDARY_HOLES_UPDATE_AUX_TIME);
   Profiler.Stop(CUT_BOUNDARY_HOLES_TIME);
 
-  MPI_Barrier(Domain.Comm());
-
   Level2.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done updating auxiliary grid/overlap data.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done updating auxiliary grid/overlap data.");
+  }
   Level1.Reset();
   Logger.LogStatus(Domain.Comm().Rank() == 0, "Done cutting boundary holes.");
 
@@ -3406,9 +3947,10 @@ void assembler::LocateOuterFringe_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Locating outer fringe points...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Locating outer fringe points...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent(2);
 
   Profiler.StartSync(LOCATE_OUTER_FRINGE_TIME, Domain.Comm());
@@ -3457,14 +3999,10 @@ void assembler::LocateOuterFringe_() {
     }
     core::DilateMask(CoverMask, Options_.FringeSize(GridID), core::mask_bc::FALSE);
     distributed_field<bool> &OuterFringeMask = OuterFringeMasks(GridID);
-    for (int k = ExtendedRange.Begin(2); k < ExtendedRange.End(2); ++k) {
-      for (int j = ExtendedRange.Begin(1); j < ExtendedRange.End(1); ++j) {
-        for (int i = ExtendedRange.Begin(0); i < ExtendedRange.End(0); ++i) {
-          tuple<int> Point = {i,j,k};
-          OuterFringeMask(Point) = ActiveMask(Point) && CoverMask(Point);
-        }
-      }
-    }
+    core::ForEachInRange(ExtendedRange, OuterFringeMask.Values().Indexer(), [&](const tuple<int>
+      &Point, long long iPoint) {
+      OuterFringeMask[iPoint] = ActiveMask[iPoint] && CoverMask(Point);
+    });
   }
 
   map<int,long long> NumOuterFringeForGrid;
@@ -3497,25 +4035,23 @@ void assembler::LocateOuterFringe_() {
   Profiler.Stop(LOCATE_OUTER_FRINGE_TIME);
 
   if (Logger.LoggingStatus()) {
-    for (int GridID : Domain.GridIDs()) {
-      if (Domain.GridIsLocal(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumOuterFringe = NumOuterFringeForGrid(GridID);
-        if (NumOuterFringe > 0) {
-          std::string NumOuterFringeString = core::FormatNumber(NumOuterFringe,
-            "outer fringe points", "outer fringe point");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s on grid %s.", NumOuterFringeString,
-            Grid.Name());
-        }
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumOuterFringeForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumOuterFringe = Entry.Value();
+      if (NumOuterFringe > 0) {
+        std::string NumOuterFringeString = core::FormatNumber(NumOuterFringe,
+          "outer fringe points", "outer fringe point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s on grid %s.", NumOuterFringeString,
+          GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
-  MPI_Barrier(Domain.Comm());
-
   Level1.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done locating outer fringe points.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done locating outer fringe points.");
+  }
 
 }
 
@@ -3525,9 +4061,10 @@ void assembler::DetectOccluded_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Detecting occluded points...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Detecting occluded points...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent();
 
   Profiler.StartSync(OCCLUSION_TIME, Domain.Comm());
@@ -3546,50 +4083,39 @@ void assembler::DetectOccluded_() {
 
   Profiler.StartSync(OCCLUSION_PAIRWISE_TIME, Domain.Comm());
 
-  elem_map<int,2,distributed_field<bool>> &PairwiseOcclusionMasks = AssemblyData
-    .PairwiseOcclusionMasks;
+  // Only overlapped points can be occluded, so pairwise occlusion is stored compactly (one value
+  // per overlap N point) and only accumulated into full grid masks where needed
+  elem_map<int,2,array<bool>> &PairwiseOcclusionMasks = AssemblyData.PairwiseOcclusionMasks;
 
   constexpr double TOLERANCE = 1.e-10;
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
     int NGridID = OverlapID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    const range &LocalRange = NGrid.LocalRange();
     const geometry &Geometry = GeometryComponent.Geometry(NGridID);
     const distributed_field<double> &Volumes = Geometry.Volumes();
     const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
-    const field<bool> &BaseOverlapMask = OverlapN.Mask();
+    const array<int,2> &Points = OverlapN.Points();
     const local_overlap_n_aux_data &OverlapNAuxData = AssemblyData.LocalOverlapNAuxData(OverlapID);
     const distributed_field<bool> &OverlapMask = OverlapNAuxData.OverlapMask;
     const array<double> &OverlapVolumes = OverlapNAuxData.Volumes;
-    distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks.Insert(OverlapID);
-    switch (Options_.Occludes(OverlapID)) {
-    case occludes::COARSE: {
-      PairwiseOcclusionMask.Assign(NGrid.SharedPartition(), false);
-      long long iOverlapping = 0;
-      for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-        for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-          for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-            tuple<int> Point = {i,j,k};
-            if (BaseOverlapMask(Point)) {
-              PairwiseOcclusionMask(Point) = OverlapMask(Point) && Volumes(Point) > (1.+TOLERANCE) *
-                OverlapVolumes(iOverlapping);
-              ++iOverlapping;
-            }
-          }
-        }
+    array<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks.Insert(OverlapID,
+      array<bool>({OverlapN.Size()}, false));
+    occludes Occludes = Options_.Occludes(OverlapID);
+    OVK_DEBUG_ASSERT(Occludes == occludes::COARSE || Occludes == occludes::ALL || Occludes ==
+      occludes::NONE, "Unhandled enum value.");
+    if (Occludes == occludes::NONE) continue;
+    for (long long iOverlapping = 0; iOverlapping < OverlapN.Size(); ++iOverlapping) {
+      tuple<int> Point = {
+        Points(0,iOverlapping),
+        Points(1,iOverlapping),
+        Points(2,iOverlapping)
+      };
+      if (Occludes == occludes::COARSE) {
+        PairwiseOcclusionMask(iOverlapping) = OverlapMask(Point) && Volumes(Point) > (1.+
+          TOLERANCE) * OverlapVolumes(iOverlapping);
+      } else {
+        PairwiseOcclusionMask(iOverlapping) = OverlapMask(Point);
       }
-      PairwiseOcclusionMask.Exchange();
-      break;
-    }
-    case occludes::ALL:
-      PairwiseOcclusionMask.Assign(OverlapMask);
-      break;
-    case occludes::NONE:
-      break;
-    default:
-      OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
-      break;
     }
   }
 
@@ -3598,15 +4124,17 @@ void assembler::DetectOccluded_() {
   struct exchange_m {
     core::collect Collect;
     core::send Send;
-    array<bool> SendBuffer;
+    core::arena_array<bool> SendBuffer;
   };
 
   struct exchange_n {
     core::recv Recv;
-    array<bool> RecvBuffer;
-    core::disperse Disperse;
+    core::arena_array<bool> RecvBuffer;
   };
 
+  // Exchange buffers are released at the end of the stage
+  core::arena_scope ExchangeArenaScope(AssemblyData.Arena);
+
   elem_map<int,2,exchange_m> ExchangeMs;
   elem_map<int,2,exchange_n> ExchangeNs;
 
@@ -3626,20 +4154,16 @@ void assembler::DetectOccluded_() {
       array_layout::COLUMN_MAJOR);
     ExchangeM.Send = core::CreateSend(Context_, Domain.Comm(), OverlapMAuxData.SendMap,
       data_type::BOOL, 1, 0);
-    ExchangeM.SendBuffer.Resize({OverlapM.Size()});
+    ExchangeM.SendBuffer = core::arena_array<bool>({OverlapM.Size()}, AssemblyData.Arena);
   }
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
-    int NGridID = OverlapID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
     const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
     const local_overlap_n_aux_data &OverlapNAuxData = AssemblyData.LocalOverlapNAuxData(OverlapID);
     exchange_n &ExchangeN = ExchangeNs.Insert(OverlapID);
     ExchangeN.Recv = core::CreateRecv(Context_, Domain.Comm(), OverlapNAuxData.RecvMap,
       data_type::BOOL, 1, 0);
-    ExchangeN.RecvBuffer.Resize({OverlapN.Size()});
-    ExchangeN.Disperse = core::CreateDisperseOverwrite(Context_, OverlapNAuxData.DisperseMap,
-      data_type::BOOL, 1, NGrid.ExtendedRange(), array_layout::COLUMN_MAJOR);
+    ExchangeN.RecvBuffer = core::arena_array<bool>({OverlapN.Size()}, AssemblyData.Arena);
   }
 
   array<request> Requests;
@@ -3662,10 +4186,16 @@ void assembler::DetectOccluded_() {
     int NGridID = OverlapID(1);
     if (!MutuallyOccludes(MGridID, NGridID)) continue;
     if (NGridID < MGridID) continue;
+    const grid &MGrid = Domain.Grid(MGridID);
+    const overlap_n &ReverseOverlapN = OverlapComponent.OverlapN({NGridID,MGridID});
     exchange_m &ExchangeM = ExchangeMs(OverlapID);
     core::collect &Collect = ExchangeM.Collect;
     core::send &Send = ExchangeM.Send;
-    const bool *PairwiseOcclusionMaskData = PairwiseOcclusionMasks({NGridID,MGridID}).Data();
+    distributed_field<bool> PairwiseOcclusionMask(MGrid.SharedPartition(), false);
+    AccumulatePairwiseMask(ReverseOverlapN, PairwiseOcclusionMasks({NGridID,MGridID}),
+      PairwiseOcclusionMask);
+    PairwiseOcclusionMask.Exchange();
+    const bool *PairwiseOcclusionMaskData = PairwiseOcclusionMask.Data();
     bool *SendBufferData = ExchangeM.SendBuffer.Data();
     Collect.Collect(&PairwiseOcclusionMaskData, &SendBufferData);
     request &Request = Requests.Append();
@@ -3681,12 +4211,7 @@ void assembler::DetectOccluded_() {
     if (!MutuallyOccludes(MGridID, NGridID)) continue;
     if (NGridID < MGridID) continue;
     exchange_n &ExchangeN = ExchangeNs(OverlapID);
-    core::disperse &Disperse = ExchangeN.Disperse;
-    distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
-    const bool *RecvBufferData = ExchangeN.RecvBuffer.Data();
-    bool *PairwiseOcclusionMaskData = PairwiseOcclusionMask.Data();
-    Disperse.Disperse(&RecvBufferData, &PairwiseOcclusionMaskData);
-    PairwiseOcclusionMask.Exchange();
+    PairwiseOcclusionMasks(OverlapID) = ExchangeN.RecvBuffer;
   }
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
@@ -3706,10 +4231,16 @@ void assembler::DetectOccluded_() {
     int NGridID = OverlapID(1);
     if (!MutuallyOccludes(MGridID, NGridID)) continue;
     if (NGridID > MGridID) continue;
+    const grid &MGrid = Domain.Grid(MGridID);
+    const overlap_n &ReverseOverlapN = OverlapComponent.OverlapN({NGridID,MGridID});
     exchange_m &ExchangeM = ExchangeMs(OverlapID);
     core::collect &Collect = ExchangeM.Collect;
     core::send &Send = ExchangeM.Send;
-    const bool *PairwiseOcclusionMaskData = PairwiseOcclusionMasks({NGridID,MGridID}).Data();
+    distributed_field<bool> PairwiseOcclusionMask(MGrid.SharedPartition(), false);
+    AccumulatePairwiseMask(ReverseOverlapN, PairwiseOcclusionMasks({NGridID,MGridID}),
+      PairwiseOcclusionMask);
+    PairwiseOcclusionMask.Exchange();
+    const bool *PairwiseOcclusionMaskData = PairwiseOcclusionMask.Data();
     bool *SendBufferData = ExchangeM.SendBuffer.Data();
     Collect.Collect(&PairwiseOcclusionMaskData, &SendBufferData);
     request &Request = Requests.Append();
@@ -3725,12 +4256,7 @@ void assembler::DetectOccluded_() {
     if (!MutuallyOccludes(MGridID, NGridID)) continue;
     if (NGridID > MGridID) continue;
     exchange_n &ExchangeN = ExchangeNs(OverlapID);
-    core::disperse &Disperse = ExchangeN.Disperse;
-    distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
-    const bool *RecvBufferData = ExchangeN.RecvBuffer.Data();
-    bool *PairwiseOcclusionMaskData = PairwiseOcclusionMask.Data();
-    Disperse.Disperse(&RecvBufferData, &PairwiseOcclusionMaskData);
-    PairwiseOcclusionMask.Exchange();
+    PairwiseOcclusionMasks(OverlapID) = ExchangeN.RecvBuffer;
   }
 
   Profiler.Stop(OCCLUSION_PAIRWISE_TIME);
@@ -3739,24 +4265,22 @@ void assembler::DetectOccluded_() {
     elem_map<int,2,long long> NumOccludedForGridPair;
     for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
       if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
+      const grid &NGrid = Domain.Grid(OverlapID(1));
       long long &NumOccluded = NumOccludedForGridPair.Insert(OverlapID);
-      NumOccluded = core::CountDistributedMask(PairwiseOcclusionMasks(OverlapID));
+      NumOccluded = CountPairwiseMask(NGrid, PairwiseOcclusionMasks(OverlapID));
     }
-    MPI_Barrier(Domain.Comm());
-    for (auto &OverlapID : OverlapComponent.OverlapIDs()) {
-      int MGridID = OverlapID(0);
-      int NGridID = OverlapID(1);
-      if (Options_.Occludes(OverlapID) != occludes::NONE && Domain.GridIsLocal(NGridID)) {
-        const grid &NGrid = Domain.Grid(NGridID);
-        long long NumOccluded = NumOccludedForGridPair(OverlapID);
-        if (NumOccluded > 0) {
-          const grid_info &MGridInfo = Domain.GridInfo(MGridID);
-          std::string NumOccludedString = core::FormatNumber(NumOccluded, "points", "point");
-          Logger.LogStatus(NGrid.Comm().Rank() == 0, "%s occluded by grid %s on grid %s.",
-            NumOccludedString, MGridInfo.Name(), NGrid.Name());
-        }
+    for (auto &Entry : GatherGridPairCountsOnRoot(Domain, OverlapComponent.OverlapIDs(),
+      NumOccludedForGridPair)) {
+      const elem<int,2> &OverlapID = Entry.Key();
+      if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
+      long long NumOccluded = Entry.Value();
+      if (NumOccluded > 0) {
+        const grid_info &MGridInfo = Domain.GridInfo(OverlapID(0));
+        const grid_info &NGridInfo = Domain.GridInfo(OverlapID(1));
+        std::string NumOccludedString = core::FormatNumber(NumOccluded, "points", "point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s occluded by grid %s on grid %s.",
+          NumOccludedString, MGridInfo.Name(), NGridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
@@ -3787,13 +4311,14 @@ void assembler::DetectOccluded_() {
       DisallowMask[l] = (Flags[l] & state_flags::OUTER_FRINGE) != state_flags::NONE;
     }
     if (Options_.Occludes({NGridID,MGridID}) != occludes::NONE) {
-      const distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks({NGridID,
-        MGridID});
       // Not sure if the "|| !ActiveMask[l]" should be applied unconditionally? Below is how it is
       // in serial Overkit
       for (long long l = 0; l < NumExtended; ++l) {
-        DisallowMask[l] = DisallowMask[l] || PairwiseOcclusionMask[l] || !ActiveMask[l];
+        DisallowMask[l] = DisallowMask[l] || !ActiveMask[l];
       }
+      AccumulatePairwiseMask(OverlapComponent.OverlapN({NGridID,MGridID}), PairwiseOcclusionMasks(
+        {NGridID,MGridID}), DisallowMask);
+      DisallowMask.Exchange();
     }
     core::DilateMask(DisallowMask, Options_.EdgePadding(OverlapID), core::mask_bc::MIRROR);
   }
@@ -3826,7 +4351,7 @@ void assembler::DetectOccluded_() {
 
   DisallowMasks.Clear();
 
-  elem_map<int,2,distributed_field<bool>> PaddingMasks;
+  elem_map<int,2,array<bool>> PaddingMasks;
   map<int,distributed_field<bool>> BaseOcclusionMasks;
   map<int,distributed_field<bool>> &OcclusionMasks = AssemblyData.OcclusionMasks;
 
@@ -3839,36 +4364,29 @@ void assembler::DetectOccluded_() {
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
     if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
     int NGridID = OverlapID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    long long NumExtended = NGrid.ExtendedRange().Count();
-    exchange_n &ExchangeN = ExchangeNs(OverlapID);
-    core::disperse &Disperse = ExchangeN.Disperse;
-    distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
-    const bool *RecvBufferData = ExchangeN.RecvBuffer.Data();
-    distributed_field<bool> AllowMask(NGrid.SharedPartition());
-    bool *AllowMaskData = AllowMask.Data();
-    Disperse.Disperse(&RecvBufferData, &AllowMaskData);
-    AllowMask.Exchange();
-    distributed_field<bool> &PaddingMask = PaddingMasks.Insert(OverlapID, NGrid.SharedPartition());
-    for (long long l = 0; l < NumExtended; ++l) {
-      PaddingMask[l] = !AllowMask[l] && PairwiseOcclusionMask[l];
-    }
-    distributed_field<bool> &BaseOcclusionMask = BaseOcclusionMasks(NGridID);
-    distributed_field<bool> &OcclusionMask = OcclusionMasks(NGridID);
-    for (long long l = 0; l < NumExtended; ++l) {
-      BaseOcclusionMask[l] = BaseOcclusionMask[l] || PairwiseOcclusionMask[l];
-    }
-    for (long long l = 0; l < NumExtended; ++l) {
-      OcclusionMask[l] = OcclusionMask[l] || (PairwiseOcclusionMask[l] && !PaddingMask[l]);
+    const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
+    const core::arena_array<bool> &AllowMask = ExchangeNs(OverlapID).RecvBuffer;
+    const array<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
+    array<bool> &PaddingMask = PaddingMasks.Insert(OverlapID, array<bool>({OverlapN.Size()}));
+    core::arena_scope PaddedArenaScope(AssemblyData.Arena);
+    core::arena_array<bool> PaddedOcclusionMask({OverlapN.Size()}, AssemblyData.Arena);
+    for (long long iOverlapping = 0; iOverlapping < OverlapN.Size(); ++iOverlapping) {
+      PaddingMask(iOverlapping) = !AllowMask(iOverlapping) && PairwiseOcclusionMask(iOverlapping);
+      PaddedOcclusionMask(iOverlapping) = PairwiseOcclusionMask(iOverlapping) && !PaddingMask(
+        iOverlapping);
     }
+    AccumulatePairwiseMask(OverlapN, PairwiseOcclusionMask, BaseOcclusionMasks(NGridID));
+    AccumulatePairwiseMask(OverlapN, PaddedOcclusionMask, OcclusionMasks(NGridID));
   }
 
   for (int GridID : Domain.LocalGridIDs()) {
     if (Options_.EdgeSmoothing(GridID) == 0) continue;
     const grid &Grid = Domain.Grid(GridID);
     long long NumExtended = Grid.ExtendedRange().Count();
-    const distributed_field<bool> &BaseOcclusionMask = BaseOcclusionMasks(GridID);
+    distributed_field<bool> &BaseOcclusionMask = BaseOcclusionMasks(GridID);
     distributed_field<bool> &OcclusionMask = OcclusionMasks(GridID);
+    BaseOcclusionMask.Exchange();
+    OcclusionMask.Exchange();
     core::DilateMask(OcclusionMask, Options_.EdgeSmoothing(GridID), core::mask_bc::MIRROR);
     core::ErodeMask(OcclusionMask, Options_.EdgeSmoothing(GridID), core::mask_bc::MIRROR);
     for (long long l = 0; l < NumExtended; ++l) {
@@ -3881,16 +4399,20 @@ void assembler::DetectOccluded_() {
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
     if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
     int NGridID = OverlapID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    long long NumExtended = NGrid.ExtendedRange().Count();
-    distributed_field<bool> &PaddingMask = PaddingMasks(OverlapID);
-    distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
+    const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
+    const array<int,2> &Points = OverlapN.Points();
+    array<bool> &PaddingMask = PaddingMasks(OverlapID);
+    array<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
     const distributed_field<bool> &OcclusionMask = OcclusionMasks(NGridID);
-    for (long long l = 0; l < NumExtended; ++l) {
-      PaddingMask[l] = PaddingMask[l] && !OcclusionMask[l];
-    }
-    for (long long l = 0; l < NumExtended; ++l) {
-      PairwiseOcclusionMask[l] = PairwiseOcclusionMask[l] && !PaddingMask[l];
+    for (long long iOverlapping = 0; iOverlapping < OverlapN.Size(); ++iOverlapping) {
+      tuple<int> Point = {
+        Points(0,iOverlapping),
+        Points(1,iOverlapping),
+        Points(2,iOverlapping)
+      };
+      PaddingMask(iOverlapping) = PaddingMask(iOverlapping) && !OcclusionMask(Point);
+      PairwiseOcclusionMask(iOverlapping) = PairwiseOcclusionMask(iOverlapping) && !PaddingMask(
+        iOverlapping);
     }
   }
 
@@ -3900,25 +4422,22 @@ void assembler::DetectOccluded_() {
     elem_map<int,2,long long> NumPaddedForGridPair;
     for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
       if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
+      const grid &NGrid = Domain.Grid(OverlapID(1));
       long long &NumPadded = NumPaddedForGridPair.Insert(OverlapID);
-      NumPadded = core::CountDistributedMask(PaddingMasks(OverlapID));
+      NumPadded = CountPairwiseMask(NGrid, PaddingMasks(OverlapID));
     }
-    MPI_Barrier(Domain.Comm());
-    for (auto &OverlapID : OverlapComponent.OverlapIDs()) {
+    for (auto &Entry : GatherGridPairCountsOnRoot(Domain, OverlapComponent.OverlapIDs(),
+      NumPaddedForGridPair)) {
+      const elem<int,2> &OverlapID = Entry.Key();
       if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
-      int MGridID = OverlapID(0);
-      int NGridID = OverlapID(1);
-      if (Domain.GridIsLocal(NGridID)) {
-        const grid &NGrid = Domain.Grid(NGridID);
-        long long NumPadded = NumPaddedForGridPair(OverlapID);
-        if (NumPadded > 0) {
-          const grid_info &MGridInfo = Domain.GridInfo(MGridID);
-          std::string NumPaddedString = core::FormatNumber(NumPadded, "points", "point");
-          Logger.LogStatus(NGrid.Comm().Rank() == 0, "%s marked as not occluded by grid %s on grid "
-            "%s.", NumPaddedString, MGridInfo.Name(), NGrid.Name());
-        }
+      long long NumPadded = Entry.Value();
+      if (NumPadded > 0) {
+        const grid_info &MGridInfo = Domain.GridInfo(OverlapID(0));
+        const grid_info &NGridInfo = Domain.GridInfo(OverlapID(1));
+        std::string NumPaddedString = core::FormatNumber(NumPadded, "points", "point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s marked as not occluded by grid %s on grid "
+          "%s.", NumPaddedString, MGridInfo.Name(), NGridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
@@ -3942,13 +4461,12 @@ void assembler::DetectOccluded_() {
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
     if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
     int NGridID = OverlapID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    long long NumExtended = NGrid.ExtendedRange().Count();
-    distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
-    distributed_field<bool> &OcclusionMask = OcclusionMasks(NGridID);
-    for (long long l = 0; l < NumExtended; ++l) {
-      OcclusionMask[l] = OcclusionMask[l] || PairwiseOcclusionMask[l];
-    }
+    const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
+    AccumulatePairwiseMask(OverlapN, PairwiseOcclusionMasks(OverlapID), OcclusionMasks(NGridID));
+  }
+
+  for (int GridID : Domain.LocalGridIDs()) {
+    OcclusionMasks(GridID).Exchange();
   }
 
   map<int,long long> NumOccludedForGrid;
@@ -3981,26 +4499,23 @@ void assembler::DetectOccluded_() {
   Profiler.Stop(OCCLUSION_TIME);
 
   if (Logger.LoggingStatus()) {
-    MPI_Barrier(Domain.Comm());
-    for (int GridID : Domain.GridIDs()) {
-      if (Domain.GridIsLocal(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumOccluded = NumOccludedForGrid(GridID);
-        if (NumOccluded > 0) {
-          std::string NumOccludedString = core::FormatNumber(NumOccluded, "occluded points",
-            "occluded point");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s on grid %s.", NumOccludedString,
-            Grid.Name());
-        }
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumOccludedForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumOccluded = Entry.Value();
+      if (NumOccluded > 0) {
+        std::string NumOccludedString = core::FormatNumber(NumOccluded, "occluded points",
+          "occluded point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s on grid %s.", NumOccludedString,
+          GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
-  MPI_Barrier(Domain.Comm());
-
   Level2.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done accumulating occlusion.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done accumulating occlusion.");
+  }
   Level1.Reset();
   Logger.LogStatus(Domain.Comm().Rank() == 0, "Done detecting occluded points.");
 
@@ -4012,9 +4527,10 @@ void assembler::MinimizeOverlap_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Minimizing overlap...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Minimizing overlap...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent(2);
 
   Profiler.StartSync(MINIMIZE_OVERLAP_TIME, Domain.Comm());
@@ -4026,7 +4542,7 @@ void assembler::MinimizeOverlap_() {
 
   auto &OverlapComponent = Domain.Component<overlap_component>(OverlapComponentID_);
 
-  const elem_map<int,2,distributed_field<bool>> &PairwiseOcclusionMasks = AssemblyData
+  const elem_map<int,2,array<bool>> &PairwiseOcclusionMasks = AssemblyData
     .PairwiseOcclusionMasks;
   const map<int,distributed_field<bool>> &OcclusionMasks = AssemblyData.OcclusionMasks;
 
@@ -4044,13 +4560,13 @@ void assembler::MinimizeOverlap_() {
     if (Options_.Occludes(OverlapID) == occludes::NONE) continue;
     if (!Options_.MinimizeOverlap(OverlapID)) continue;
     int NGridID = OverlapID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    long long NumExtended = NGrid.ExtendedRange().Count();
-    const distributed_field<bool> &PairwiseOcclusionMask = PairwiseOcclusionMasks(OverlapID);
-    distributed_field<bool> &OverlapMinimizationMask = OverlapMinimizationMasks(NGridID);
-    for (long long l = 0; l < NumExtended; ++l) {
-      OverlapMinimizationMask[l] = OverlapMinimizationMask[l] || PairwiseOcclusionMask[l];
-    }
+    const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
+    AccumulatePairwiseMask(OverlapN, PairwiseOcclusionMasks(OverlapID), OverlapMinimizationMasks(
+      NGridID));
+  }
+
+  for (int GridID : Domain.LocalGridIDs()) {
+    OverlapMinimizationMasks(GridID).Exchange();
   }
 
   for (int GridID : Domain.LocalGridIDs()) {
@@ -4148,15 +4664,18 @@ void assembler::MinimizeOverlap_() {
   struct exchange_m {
     core::collect Collect;
     core::send Send;
-    array<bool> SendBuffer;
+    core::arena_array<bool> SendBuffer;
   };
 
   struct exchange_n {
     core::recv Recv;
-    array<bool> RecvBuffer;
+    core::arena_array<bool> RecvBuffer;
     core::disperse Disperse;
   };
 
+  // Exchange buffers are released at the end of the stage
+  core::arena_scope ExchangeArenaScope(AssemblyData.Arena);
+
   elem_map<int,2,exchange_m> ExchangeMs;
   elem_map<int,2,exchange_n> ExchangeNs;
 
@@ -4171,7 +4690,7 @@ void assembler::MinimizeOverlap_() {
       array_layout::COLUMN_MAJOR);
     ExchangeM.Send = core::CreateSend(Context_, Domain.Comm(), OverlapMAuxData.SendMap,
       data_type::BOOL, 1, 0);
-    ExchangeM.SendBuffer.Resize({OverlapM.Size()});
+    ExchangeM.SendBuffer = core::arena_array<bool>({OverlapM.Size()}, AssemblyData.Arena);
   }
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
@@ -4182,7 +4701,7 @@ void assembler::MinimizeOverlap_() {
     exchange_n &ExchangeN = ExchangeNs.Insert(OverlapID);
     ExchangeN.Recv = core::CreateRecv(Context_, Domain.Comm(), OverlapNAuxData.RecvMap,
       data_type::BOOL, 1, 0);
-    ExchangeN.RecvBuffer.Resize({OverlapN.Size()});
+    ExchangeN.RecvBuffer = core::arena_array<bool>({OverlapN.Size()}, AssemblyData.Arena);
     ExchangeN.Disperse = core::CreateDisperseOverwrite(Context_, OverlapNAuxData.DisperseMap,
       data_type::BOOL, 1, NGrid.ExtendedRange(), array_layout::COLUMN_MAJOR);
   }
@@ -4229,25 +4748,22 @@ void assembler::MinimizeOverlap_() {
   Profiler.Stop(MINIMIZE_OVERLAP_TIME);
 
   if (Logger.LoggingStatus()) {
-    MPI_Barrier(Domain.Comm());
-    for (int GridID : Domain.GridIDs()) {
-      if (Domain.GridIsLocal(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumRemoved = NumRemovedForGrid(GridID);
-        if (NumRemoved > 0) {
-          std::string NumRemovedString = core::FormatNumber(NumRemoved, "points", "point");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s removed from grid %s.", NumRemovedString,
-            Grid.Name());
-        }
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumRemovedForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumRemoved = Entry.Value();
+      if (NumRemoved > 0) {
+        std::string NumRemovedString = core::FormatNumber(NumRemoved, "points", "point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s removed from grid %s.", NumRemovedString,
+          GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
-  MPI_Barrier(Domain.Comm());
-
   Level1.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done minimizing overlap.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done minimizing overlap.");
+  }
 
 }
 
@@ -4257,15 +4773,16 @@ void assembler::GenerateConnectivityData_() {
   core::logger &Logger = Context_->core_Logger();
   core::profiler &Profiler = Context_->core_Profiler();
 
-  MPI_Barrier(Domain.Comm());
-
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Generating connectivity data...");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Generating connectivity data...");
+  }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent();
 
   Profiler.StartSync(CONNECTIVITY_TIME, Domain.Comm());
 
   int NumDims = Domain.Dimension();
-  const assembly_data &AssemblyData = *AssemblyData_;
+  assembly_data &AssemblyData = *AssemblyData_;
 
   const map<int,local_grid_aux_data> &LocalGridAuxData = AssemblyData.LocalGridAuxData;
   const elem_map<int,2,local_overlap_m_aux_data> &LocalOverlapMAuxData = AssemblyData
@@ -4313,19 +4830,15 @@ void assembler::GenerateConnectivityData_() {
   Profiler.Stop(CONNECTIVITY_LOCATE_RECEIVERS_TIME);
 
   if (Logger.LoggingStatus()) {
-    MPI_Barrier(Domain.Comm());
-    for (int GridID : Domain.GridIDs()) {
-      if (Domain.GridIsLocal(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumReceivers = NumReceiversForGrid(GridID);
-        if (NumReceivers > 0) {
-          std::string NumReceiversString = core::FormatNumber(NumReceivers, "receiver points",
-            "receiver point");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s on grid %s.", NumReceiversString,
-            Grid.Name());
-        }
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumReceiversForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumReceivers = Entry.Value();
+      if (NumReceivers > 0) {
+        std::string NumReceiversString = core::FormatNumber(NumReceivers, "receiver points",
+          "receiver point");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s on grid %s.", NumReceiversString,
+          GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
@@ -4380,13 +4893,15 @@ void assembler::GenerateConnectivityData_() {
   struct exchange_m {
     core::collect Collect;
     core::send Send;
-    array<int> SendBuffer;
+    core::arena_array<int> SendBuffer;
   };
 
   struct exchange_n {
     core::recv Recv;
   };
 
+  core::arena::marker DistanceArenaMarker = AssemblyData.Arena.Mark();
+
   elem_map<int,2,exchange_m> ExchangeMs;
   elem_map<int,2,exchange_n> ExchangeNs;
 
@@ -4401,7 +4916,7 @@ void assembler::GenerateConnectivityData_() {
       array_layout::COLUMN_MAJOR);
     ExchangeM.Send = core::CreateSend(Context_, Domain.Comm(), OverlapMAuxData.SendMap,
       data_type::INT, 1, 0);
-    ExchangeM.SendBuffer.Resize({OverlapM.Size()});
+    ExchangeM.SendBuffer = core::arena_array<int>({OverlapM.Size()}, AssemblyData.Arena);
   }
 
   elem_map<int,2,array<int>> OverlapReceiverDistances;
@@ -4449,6 +4964,7 @@ void assembler::GenerateConnectivityData_() {
 
   ExchangeMs.Clear();
   ExchangeNs.Clear();
+  AssemblyData.Arena.Rewind(DistanceArenaMarker);
 
   Profiler.Stop(CONNECTIVITY_DONOR_EDGE_DISTANCE_EXCHANGE_TIME);
   Profiler.Stop(CONNECTIVITY_DONOR_EDGE_DISTANCE_TIME);
@@ -4574,7 +5090,9 @@ void assembler::GenerateConnectivityData_() {
     NumOrphans = core::CountDistributedMask(OrphanMask);
   }
 
-  Logger.SyncIndicator(Domain.Comm());
+  if (Logger.LoggingStatus()) {
+    Logger.SyncIndicator(Domain.Comm());
+  }
 
   auto Suppress = Logger.IncreaseStatusLevel(100);
 
@@ -4602,24 +5120,22 @@ void assembler::GenerateConnectivityData_() {
   Profiler.Stop(CONNECTIVITY_CHOOSE_DONORS_TIME);
 
   if (Logger.LoggingStatus()) {
-    MPI_Barrier(Domain.Comm());
-    for (int GridID : Domain.GridIDs()) {
-      if (Domain.GridIsLocal(GridID)) {
-        const grid &Grid = Domain.Grid(GridID);
-        long long NumReceivers = NumReceiversForGrid(GridID);
-        long long NumOrphans = NumOrphansForGrid(GridID);
-        if (NumReceivers > 0) {
-          std::string NumOrphansString = core::FormatNumber(NumOrphans, "orphans", "orphan");
-          Logger.LogStatus(Grid.Comm().Rank() == 0, "%s on grid %s.", NumOrphansString,
-            Grid.Name());
-        }
+    map<int,long long> NumReceiversForAllGrids = GatherGridCountsOnRoot(Domain,
+      NumReceiversForGrid);
+    for (auto &Entry : GatherGridCountsOnRoot(Domain, NumOrphansForGrid)) {
+      const grid_info &GridInfo = Domain.GridInfo(Entry.Key());
+      long long NumReceivers = NumReceiversForAllGrids(Entry.Key());
+      long long NumOrphans = Entry.Value();
+      if (NumReceivers > 0) {
+        std::string NumOrphansString = core::FormatNumber(NumOrphans, "orphans", "orphan");
+        Logger.LogStatus(Domain.Comm().Rank() == 0, "%s on grid %s.", NumOrphansString,
+          GridInfo.Name());
       }
-      MPI_Barrier(Domain.Comm());
     }
   }
 
   Level2.Reset();
-  if (Logger.LoggingDebug()) {
+  if (Logger.LoggingStatus()) {
     MPI_Barrier(Domain.Comm());
     Logger.LogStatus(Domain.Comm().Rank() == 0, "Done choosing donors.");
     Logger.LogStatus(Domain.Comm().Rank() == 0, "Creating and filling connectivity data "
@@ -4640,9 +5156,11 @@ void assembler::GenerateConnectivityData_() {
   struct reverse_exchange_n {
     core::send_map SendMap;
     core::send Send;
-    array<bool> SendBuffer;
+    core::arena_array<bool> SendBuffer;
   };
 
+  core::arena::marker SyncArenaMarker = AssemblyData.Arena.Mark();
+
   elem_map<int,2,reverse_exchange_m> ReverseExchangeMs;
   elem_map<int,2,reverse_exchange_n> ReverseExchangeNs;
 
@@ -4666,7 +5184,7 @@ void assembler::GenerateConnectivityData_() {
     ExchangeN.SendMap = core::send_map(OverlapN.SourceRanks());
     ExchangeN.Send = core::CreateSend(Context_, Domain.Comm(), ExchangeN.SendMap, data_type::BOOL,
       1, 0);
-    ExchangeN.SendBuffer.Resize({OverlapN.Size()});
+    ExchangeN.SendBuffer = core::arena_array<bool>({OverlapN.Size()}, AssemblyData.Arena);
   }
 
   Profiler.Stop(CONNECTIVITY_SYNC_CREATE_EXCHANGE_TIME);
@@ -4693,7 +5211,7 @@ void assembler::GenerateConnectivityData_() {
     const array<int,2> &Points = OverlapN.Points();
     reverse_exchange_n &ExchangeN = ReverseExchangeNs(OverlapID);
     core::send &Send = ExchangeN.Send;
-    array<bool> &SendBuffer = ExchangeN.SendBuffer;
+    core::arena_array<bool> &SendBuffer = ExchangeN.SendBuffer;
     for (long long iOverlapped = 0; iOverlapped < OverlapN.Size(); ++iOverlapped) {
       tuple<int> Point = {
         Points(0,iOverlapped),
@@ -4712,18 +5230,20 @@ void assembler::GenerateConnectivityData_() {
 
   ReverseExchangeMs.Clear();
   ReverseExchangeNs.Clear();
+  AssemblyData.Arena.Rewind(SyncArenaMarker);
 
   Profiler.Stop(CONNECTIVITY_SYNC_EXCHANGE_TIME);
   Profiler.StartSync(CONNECTIVITY_SYNC_FINALIZE_TIME, Domain.Comm());
 
   elem_map<int,2,long long> NumLocalDonorsForGridPair;
 
-  elem_set<int,2> ConnectedGridIDs;
+  // Only overlapping pairs can be connected, and the set of overlaps is known on all ranks, so
+  // the set of connected pairs can be found with a single bitwise or over the domain
+  const elem_set<int,2> &OverlapIDs = OverlapComponent.OverlapIDs();
+  packed_flags ConnectedForOverlap(OverlapIDs.Count());
 
   for (auto &OverlapID : OverlapComponent.LocalOverlapMIDs()) {
     if (Options_.ConnectionType(OverlapID) == connection_type::NONE) continue;
-    int MGridID = OverlapID(0);
-    const grid &MGrid = Domain.Grid(MGridID);
     const overlap_m &OverlapM = OverlapComponent.OverlapM(OverlapID);
     const array<bool> &Donates = OverlappingCellDonates(OverlapID);
     long long &NumLocalDonors = NumLocalDonorsForGridPair.Insert(OverlapID, 0);
@@ -4732,38 +5252,19 @@ void assembler::GenerateConnectivityData_() {
         ++NumLocalDonors;
       }
     }
-    if (MGrid.Comm().Rank() > 0) {
-      MPI_Reduce(&NumLocalDonors, nullptr, 1, MPI_LONG_LONG, MPI_MAX, 0, MGrid.Comm());
-    } else {
-      long long MaxLocalDonors = NumLocalDonors;
-      MPI_Reduce(MPI_IN_PLACE, &MaxLocalDonors, 1, MPI_LONG_LONG, MPI_MAX, 0, MGrid.Comm());
-      if (MaxLocalDonors > 0) {
-        ConnectedGridIDs.Insert(OverlapID);
-      }
+    if (NumLocalDonors > 0) {
+      ConnectedForOverlap.Set(OverlapIDs.Find(OverlapID) - OverlapIDs.Begin());
     }
   }
 
-  for (int MGridID : Domain.GridIDs()) {
-    bool IsMGridRoot = false;
-    int MGridRootRank;
-    if (Domain.GridIsLocal(MGridID)) {
-      const grid &MGrid = Domain.Grid(MGridID);
-      IsMGridRoot = MGrid.Comm().Rank() == 0;
-      if (IsMGridRoot) {
-        MGridRootRank = Domain.Comm().Rank();
-      }
-    }
-    core::BroadcastAnySource(&MGridRootRank, 1, MPI_INT, IsMGridRoot, Domain.Comm());
-    for (int NGridID : Domain.GridIDs()) {
-      elem<int,2> OverlapID = {MGridID,NGridID};
-      if (Options_.ConnectionType(OverlapID) != connection_type::NONE) {
-        int Connected;
-        if (IsMGridRoot) Connected = ConnectedGridIDs.Contains(OverlapID);
-        MPI_Bcast(&Connected, 1, MPI_INT, MGridRootRank, Domain.Comm());
-        if (Connected) {
-          ConnectedGridIDs.Insert(OverlapID);
-        }
-      }
+  MPI_Allreduce(MPI_IN_PLACE, ConnectedForOverlap.Data(), ConnectedForOverlap.ByteCount(),
+    MPI_UNSIGNED_CHAR, MPI_BOR, Domain.Comm());
+
+  elem_set<int,2> ConnectedGridIDs;
+
+  for (long long iOverlap = 0; iOverlap < OverlapIDs.Count(); ++iOverlap) {
+    if (ConnectedForOverlap(iOverlap)) {
+      ConnectedGridIDs.Insert(OverlapIDs[iOverlap]);
     }
   }
 
@@ -5229,11 +5730,12 @@ void assembler::GenerateConnectivityData_() {
   Profiler.Stop(CONNECTIVITY_FILL_TIME);
   Profiler.Stop(CONNECTIVITY_TIME);
 
-  MPI_Barrier(Domain.Comm());
-
   Level2.Reset();
-  Logger.LogStatus(Domain.Comm().Rank() == 0, "Done creating and filling connectivity data "
-    "structures.");
+  if (Logger.LoggingStatus()) {
+    MPI_Barrier(Domain.Comm());
+    Logger.LogStatus(Domain.Comm().Rank() == 0, "Done creating and filling connectivity data "
+      "structures.");
+  }
   Level1.Reset();
   Logger.LogStatus(Domain.Comm().Rank() == 0, "Done generating connectivity data.");
 
@@ -5246,7 +5748,7 @@ void GenerateActiveMask(const grid &Grid, const distributed_field<state_flags> &
 
   long long NumExtended = Grid.ExtendedRange().Count();
 
-  ActiveMask.Assign(Grid.SharedPartition());
+  ActiveMask.AssignUninitialized(Grid.SharedPartition());
 
   for (long long l = 0; l < NumExtended; ++l) {
     ActiveMask[l] = (Flags[l] & state_flags::ACTIVE) != state_flags::NONE;
@@ -5262,32 +5764,28 @@ void GenerateCellActiveMask(const grid &Grid, const distributed_field<state_flag
 
   CellActiveMask.Assign(Grid.SharedCellPartition());
 
-  for (int k = CellLocalRange.Begin(2); k < CellLocalRange.End(2); ++k) {
-    for (int j = CellLocalRange.Begin(1); j < CellLocalRange.End(1); ++j) {
-      for (int i = CellLocalRange.Begin(0); i < CellLocalRange.End(0); ++i) {
-        tuple<int> Cell = {i,j,k};
-        CellActiveMask(Cell) = true;
-        range NeighborRange;
-        for (int iDim = 0; iDim < NumDims; ++iDim) {
-          NeighborRange.Begin(iDim) = Cell(iDim);
-          NeighborRange.End(iDim) = Cell(iDim)+2;
-        }
-        for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
-          NeighborRange.Begin(iDim) = 0;
-          NeighborRange.End(iDim) = 1;
-        }
-        for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
-          for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
-            for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
-              tuple<int> Point = {m,n,o};
-              CellActiveMask(Cell) = CellActiveMask(Cell) && (Flags(Point) & state_flags::ACTIVE)
-                != state_flags::NONE;
-            }
-          }
+  core::ForEachInRange(CellLocalRange, CellActiveMask.Values().Indexer(), [&](const tuple<int>
+    &Cell, long long iCell) {
+    CellActiveMask[iCell] = true;
+    range NeighborRange;
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      NeighborRange.Begin(iDim) = Cell(iDim);
+      NeighborRange.End(iDim) = Cell(iDim)+2;
+    }
+    for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
+      NeighborRange.Begin(iDim) = 0;
+      NeighborRange.End(iDim) = 1;
+    }
+    for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
+      for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
+        for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
+          tuple<int> Point = {m,n,o};
+          CellActiveMask[iCell] = CellActiveMask[iCell] && (Flags(Point) & state_flags::ACTIVE)
+            != state_flags::NONE;
         }
       }
     }
-  }
+  });
 
   CellActiveMask.Exchange();
 
@@ -5298,7 +5796,7 @@ void GenerateDomainBoundaryMask(const grid &Grid, const distributed_field<state_
 
   long long NumExtended = Grid.ExtendedRange().Count();
 
-  DomainBoundaryMask.Assign(Grid.SharedPartition());
+  DomainBoundaryMask.AssignUninitialized(Grid.SharedPartition());
 
   auto MatchesAll = [](state_flags Flags, state_flags Mask) -> bool {
     return (Flags & Mask) == Mask;
@@ -5316,7 +5814,7 @@ void GenerateInternalBoundaryMask(const grid &Grid, const distributed_field<stat
 
   long long NumExtended = Grid.ExtendedRange().Count();
 
-  InternalBoundaryMask.Assign(Grid.SharedPartition());
+  InternalBoundaryMask.AssignUninitialized(Grid.SharedPartition());
 
   auto MatchesAll = [](state_flags Flags, state_flags Mask) -> bool {
     return (Flags & Mask) == Mask;
@@ -5329,6 +5827,102 @@ void GenerateInternalBoundaryMask(const grid &Grid, const distributed_field<stat
 
 }
 
+map<int,long long> GatherGridCountsOnRoot(const domain &Domain, const map<int,long long>
+  &CountForLocalGrid) {
+
+  const set<int> &GridIDs = Domain.GridIDs();
+
+  array<long long> Counts({GridIDs.Count()}, 0);
+
+  for (auto &Entry : CountForLocalGrid) {
+    int GridID = Entry.Key();
+    const grid &Grid = Domain.Grid(GridID);
+    if (Grid.Comm().Rank() == 0) {
+      Counts(GridIDs.Find(GridID) - GridIDs.Begin()) = Entry.Value();
+    }
+  }
+
+  map<int,long long> CountForGrid;
+
+  if (Domain.Comm().Rank() == 0) {
+    MPI_Reduce(MPI_IN_PLACE, Counts.Data(), Counts.Count(), MPI_LONG_LONG, MPI_SUM, 0,
+      Domain.Comm());
+    for (int iGrid = 0; iGrid < GridIDs.Count(); ++iGrid) {
+      CountForGrid.Insert(GridIDs[iGrid], Counts(iGrid));
+    }
+  } else {
+    MPI_Reduce(Counts.Data(), nullptr, Counts.Count(), MPI_LONG_LONG, MPI_SUM, 0, Domain.Comm());
+  }
+
+  return CountForGrid;
+
+}
+
+elem_map<int,2,long long> GatherGridPairCountsOnRoot(const domain &Domain, const elem_set<int,2>
+  &GridPairIDs, const elem_map<int,2,long long> &CountForLocalNGridPair) {
+
+  array<long long> Counts({GridPairIDs.Count()}, 0);
+
+  for (auto &Entry : CountForLocalNGridPair) {
+    const elem<int,2> &GridPairID = Entry.Key();
+    const grid &NGrid = Domain.Grid(GridPairID(1));
+    if (NGrid.Comm().Rank() == 0) {
+      auto Iter = GridPairIDs.Find(GridPairID);
+      OVK_DEBUG_ASSERT(Iter != GridPairIDs.End(), "Grid pair (%i,%i) is not in the set of pairs "
+        "being counted.", GridPairID(0), GridPairID(1));
+      if (Iter == GridPairIDs.End()) continue;
+      Counts(Iter - GridPairIDs.Begin()) = Entry.Value();
+    }
+  }
+
+  elem_map<int,2,long long> CountForGridPair;
+
+  if (Domain.Comm().Rank() == 0) {
+    MPI_Reduce(MPI_IN_PLACE, Counts.Data(), Counts.Count(), MPI_LONG_LONG, MPI_SUM, 0,
+      Domain.Comm());
+    for (int iPair = 0; iPair < GridPairIDs.Count(); ++iPair) {
+      CountForGridPair.Insert(GridPairIDs[iPair], Counts(iPair));
+    }
+  } else {
+    MPI_Reduce(Counts.Data(), nullptr, Counts.Count(), MPI_LONG_LONG, MPI_SUM, 0, Domain.Comm());
+  }
+
+  return CountForGridPair;
+
+}
+
+long long CountPairwiseMask(const grid &NGrid, array_view<const bool> PairwiseMask) {
+
+  long long Count = 0;
+
+  for (bool Value : PairwiseMask) {
+    Count += (long long)(Value);
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, &Count, 1, MPI_LONG_LONG, MPI_SUM, NGrid.Comm());
+
+  return Count;
+
+}
+
+void AccumulatePairwiseMask(const overlap_n &OverlapN, array_view<const bool> PairwiseMask,
+  distributed_field<bool> &Mask) {
+
+  const array<int,2> &Points = OverlapN.Points();
+
+  for (long long iOverlapping = 0; iOverlapping < OverlapN.Size(); ++iOverlapping) {
+    if (PairwiseMask(iOverlapping)) {
+      tuple<int> Point = {
+        Points(0,iOverlapping),
+        Points(1,iOverlapping),
+        Points(2,iOverlapping)
+      };
+      Mask(Point) = true;
+    }
+  }
+
+}
+
 }
 
 }
@@ -8,16 +8,131 @@
 #include "ovk/core/ElemMap.hpp"
 #include "ovk/core/ElemSet.hpp"
 #include "ovk/core/Global.hpp"
+#include "ovk/core/HashMap.hpp"
 #include "ovk/core/Map.hpp"
+#include "ovk/core/Optional.hpp"
 #include "ovk/core/Set.hpp"
 
 #include <cstdio>
 #include <string>
+#include <utility>
 
 namespace ovk {
 
+namespace {
+
+// Values set with ALL_GRIDS only apply to grids that existed at the time, so new grids are pinned
+// to the default
+template <typename OptionType, typename T> void AddGridsToGridOption(OptionType &Option, const
+  set<int> &GridIDs, T DefaultValue) {
+  if (!Option.AllGridsValue) return;
+  for (int GridID : GridIDs) {
+    Option.Values.Insert(GridID, DefaultValue);
+  }
+}
+
+template <typename OptionType, typename T> void AddGridsToGridPairOption(OptionType &Option, const
+  set<int> &GridIDs, T DefaultValue) {
+  using entry = typename OptionType::entry;
+  if (!Option.AllPairsValue && Option.MGridValues.Empty() && Option.NGridValues.Empty()) return;
+  for (int GridID : GridIDs) {
+    Option.MGridValues.Insert(GridID, entry{DefaultValue, Option.NextOrder++});
+    Option.NGridValues.Insert(GridID, entry{DefaultValue, Option.NextOrder++});
+  }
+}
+
+template <typename OptionType, typename F> void RemoveGridsFromGridOption(OptionType &Option, F
+  MatchesGridToRemove) {
+  Option.Values.EraseIf(MatchesGridToRemove);
+}
+
+template <typename OptionType, typename F, typename G> void RemoveGridsFromGridPairOption(
+  OptionType &Option, F MatchesGridToRemove, G MatchesGridToRemovePair) {
+  Option.MGridValues.EraseIf(MatchesGridToRemove);
+  Option.NGridValues.EraseIf(MatchesGridToRemove);
+  Option.PairValues.EraseIf(MatchesGridToRemovePair);
+}
+
+template <typename OptionType, typename F> void PrintGridOption(const char *Name, const
+  OptionType &Option, F FormatValue) {
+  if (Option.AllGridsValue) {
+    std::printf("%s(*) = %s\n", Name, FormatValue(*Option.AllGridsValue).c_str());
+  }
+  // Sorted by grid ID for readability
+  map<int,typename decltype(Option.Values)::value_type> Values;
+  for (auto &Entry : Option.Values) {
+    Values.Insert(Entry.Key(), Entry.Value());
+  }
+  for (auto &Entry : Values) {
+    std::printf("%s(%i) = %s\n", Name, Entry.Key(), FormatValue(Entry.Value()).c_str());
+  }
+}
+
+template <typename OptionType, typename F> void PrintGridPairOption(const char *Name, const
+  OptionType &Option, F FormatValue) {
+  if (Option.AllPairsValue) {
+    std::printf("%s(*,*) = %s\n", Name, FormatValue(*Option.AllPairsValue).c_str());
+  }
+  // Sorted by grid IDs for readability
+  using entry = typename OptionType::entry;
+  map<int,entry> MGridValues, NGridValues;
+  elem_map<int,2,entry> PairValues;
+  for (auto &Entry : Option.MGridValues) {
+    MGridValues.Insert(Entry.Key(), Entry.Value());
+  }
+  for (auto &Entry : Option.NGridValues) {
+    NGridValues.Insert(Entry.Key(), Entry.Value());
+  }
+  for (auto &Entry : Option.PairValues) {
+    PairValues.Insert(Entry.Key(), Entry.Value());
+  }
+  for (auto &Entry : MGridValues) {
+    std::printf("%s(%i,*) = %s [%lli]\n", Name, Entry.Key(), FormatValue(Entry.Value().Value).
+      c_str(), Entry.Value().Order);
+  }
+  for (auto &Entry : NGridValues) {
+    std::printf("%s(*,%i) = %s [%lli]\n", Name, Entry.Key(), FormatValue(Entry.Value().Value).
+      c_str(), Entry.Value().Order);
+  }
+  for (auto &Entry : PairValues) {
+    std::printf("%s(%i,%i) = %s [%lli]\n", Name, Entry.Key()(0), Entry.Key()(1), FormatValue(
+      Entry.Value().Value).c_str(), Entry.Value().Order);
+  }
+}
+
+std::string FormatBool(bool Value) {
+  return Value ? "T" : "F";
+}
+
+std::string FormatInt(int Value) {
+  return std::to_string(Value);
+}
+
+std::string FormatDouble(double Value) {
+  char Buffer[32];
+  std::snprintf(Buffer, 32, "%16.8f", Value);
+  return Buffer;
+}
+
+}
+
 void assembler::options::AddGrids(const set<int> &GridIDs) {
 
+  AddGridsToGridPairOption(Overlappable_, GridIDs, false);
+  AddGridsToGridPairOption(OverlapTolerance_, GridIDs, 1.e-12);
+  AddGridsToGridOption(OverlapAccelDepthAdjust_, GridIDs, 0.);
+  AddGridsToGridOption(OverlapAccelResolutionAdjust_, GridIDs, 0.);
+  AddGridsToGridOption(OverlapQueryShippingThreshold_, GridIDs, 4.);
+  AddGridsToGridOption(InferBoundaries_, GridIDs, false);
+  AddGridsToGridPairOption(CutBoundaryHoles_, GridIDs, false);
+  AddGridsToGridPairOption(Occludes_, GridIDs, occludes::NONE);
+  AddGridsToGridPairOption(EdgePadding_, GridIDs, 0);
+  AddGridsToGridOption(EdgeSmoothing_, GridIDs, 0);
+  AddGridsToGridPairOption(ConnectionType_, GridIDs, connection_type::NONE);
+  AddGridsToGridOption(FringeSize_, GridIDs, 0);
+  AddGridsToGridPairOption(MinimizeOverlap_, GridIDs, false);
+  AddGridsToGridPairOption(DisjointConnections_, GridIDs, true);
+
   for (int GridID : GridIDs) {
     GridIDs_.Insert(GridID);
   }
@@ -36,19 +151,21 @@ void assembler::options::RemoveGrids(const set<int> &GridIDs) {
     return GridIDs.Contains(MGridID) || GridIDs.Contains(NGridID);
   };
 
-  Overlappable_.EraseIf(MatchesGridToRemovePair);
-  OverlapTolerance_.EraseIf(MatchesGridToRemovePair);
-  OverlapAccelDepthAdjust_.EraseIf(MatchesGridToRemove);
-  OverlapAccelResolutionAdjust_.EraseIf(MatchesGridToRemove);
-  InferBoundaries_.EraseIf(MatchesGridToRemove);
-  CutBoundaryHoles_.EraseIf(MatchesGridToRemovePair);
-  Occludes_.EraseIf(MatchesGridToRemovePair);
-  EdgePadding_.EraseIf(MatchesGridToRemovePair);
-  EdgeSmoothing_.EraseIf(MatchesGridToRemove);
-  ConnectionType_.EraseIf(MatchesGridToRemovePair);
-  FringeSize_.EraseIf(MatchesGridToRemove);
-  MinimizeOverlap_.EraseIf(MatchesGridToRemovePair);
-  DisjointConnections_.EraseIf(MatchesGridToRemovePair);
+  RemoveGridsFromGridPairOption(Overlappable_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridPairOption(OverlapTolerance_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridOption(OverlapAccelDepthAdjust_, MatchesGridToRemove);
+  RemoveGridsFromGridOption(OverlapAccelResolutionAdjust_, MatchesGridToRemove);
+  RemoveGridsFromGridOption(OverlapQueryShippingThreshold_, MatchesGridToRemove);
+  RemoveGridsFromGridOption(InferBoundaries_, MatchesGridToRemove);
+  RemoveGridsFromGridPairOption(CutBoundaryHoles_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridPairOption(Occludes_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridPairOption(EdgePadding_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridOption(EdgeSmoothing_, MatchesGridToRemove);
+  RemoveGridsFromGridPairOption(ConnectionType_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridOption(FringeSize_, MatchesGridToRemove);
+  RemoveGridsFromGridPairOption(MinimizeOverlap_, MatchesGridToRemove, MatchesGridToRemovePair);
+  RemoveGridsFromGridPairOption(DisjointConnections_, MatchesGridToRemove,
+    MatchesGridToRemovePair);
 
   GridIDs_.EraseIf(MatchesGridToRemove);
 
@@ -148,6 +265,52 @@ assembler::options &assembler::options::ResetOverlapAccelResolutionAdjust(int MG
 
 }
 
+double assembler::options::OverlapQueryShippingThreshold(int MGridID) const {
+
+  return GetOption_(OverlapQueryShippingThreshold_, MGridID, 4.);
+
+}
+
+assembler::options &assembler::options::SetOverlapQueryShippingThreshold(int MGridID, double
+  OverlapQueryShippingThreshold) {
+
+  OVK_DEBUG_ASSERT(OverlapQueryShippingThreshold >= 0., "Invalid overlap query shipping threshold "
+    "value.");
+
+  SetOption_(OverlapQueryShippingThreshold_, MGridID, OverlapQueryShippingThreshold, 4.);
+
+  return *this;
+
+}
+
+assembler::options &assembler::options::ResetOverlapQueryShippingThreshold(int MGridID) {
+
+  SetOption_(OverlapQueryShippingThreshold_, MGridID, 4., 4.);
+
+  return *this;
+
+}
+
+assembler::options &assembler::options::SetOverlapSearchMaxLoadImbalance(double
+  OverlapSearchMaxLoadImbalance) {
+
+  OVK_DEBUG_ASSERT(OverlapSearchMaxLoadImbalance >= 1., "Invalid overlap search max load "
+    "imbalance value.");
+
+  OverlapSearchMaxLoadImbalance_ = OverlapSearchMaxLoadImbalance;
+
+  return *this;
+
+}
+
+assembler::options &assembler::options::ResetOverlapSearchMaxLoadImbalance() {
+
+  OverlapSearchMaxLoadImbalance_ = 1.25;
+
+  return *this;
+
+}
+
 bool assembler::options::InferBoundaries(int GridID) const {
 
   return GetOption_(InferBoundaries_, GridID, false);
@@ -364,36 +527,9 @@ assembler::options &assembler::options::ResetDisjointConnections(const elem<int,
 
 void assembler::options::PrintOptions_() {
 
-  for (auto &Entry : Overlappable_) {
-    std::printf("Overlappable(%i,%i) = %c\n", Entry.Key()(0), Entry.Key()(1), Entry.Value() ? 'T' :
-      'F');
-  }
-
-  for (auto &Entry : OverlapTolerance_) {
-    std::printf("OverlapTolerance(%i,%i) = %16.8f\n", Entry.Key()(0), Entry.Key()(1),
-      Entry.Value());
-  }
-
-  for (auto &Entry : OverlapAccelDepthAdjust_) {
-    std::printf("OverlapAccelDepthAdjust(%i) = %16.8f\n", Entry.Key(), Entry.Value());
-  }
-
-  for (auto &Entry : OverlapAccelResolutionAdjust_) {
-    std::printf("OverlapAccelResolutionAdjust(%i) = %16.8f\n", Entry.Key(), Entry.Value());
-  }
-
-  for (auto &Entry : InferBoundaries_) {
-    std::printf("InferBoundaries(%i) = %c\n", Entry.Key(), Entry.Value() ? 'T' : 'F');
-  }
-
-  for (auto &Entry : CutBoundaryHoles_) {
-    std::printf("CutBoundaryHoles(%i,%i) = %c\n", Entry.Key()(0), Entry.Key()(1), Entry.Value() ?
-      'T' : 'F');
-  }
-
-  for (auto &Entry : Occludes_) {
+  auto FormatOccludes = [](occludes Value) -> std::string {
     std::string OccludesString;
-    switch (Entry.Value()) {
+    switch (Value) {
     case occludes::NONE:
       OccludesString = "NONE";
       break;
@@ -407,20 +543,12 @@ void assembler::options::PrintOptions_() {
       OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
       break;
     }
-    std::printf("Occludes(%i,%i) = %s\n", Entry.Key()(0), Entry.Key()(1), OccludesString.c_str());
-  }
-
-  for (auto &Entry : EdgePadding_) {
-    std::printf("EdgePadding(%i,%i) = %i\n", Entry.Key()(0), Entry.Key()(1), Entry.Value());
-  }
-
-  for (auto &Entry : EdgeSmoothing_) {
-    std::printf("EdgeSmoothing(%i) = %i\n", Entry.Key(), Entry.Value());
-  }
+    return OccludesString;
+  };
 
-  for (auto &Entry : ConnectionType_) {
+  auto FormatConnectionType = [](connection_type Value) -> std::string {
     std::string ConnectionTypeString;
-    switch (Entry.Value()) {
+    switch (Value) {
     case connection_type::NONE:
       ConnectionTypeString = "NONE";
       break;
@@ -437,36 +565,38 @@ void assembler::options::PrintOptions_() {
       OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
       break;
     }
-    std::printf("ConnectionType(%i,%i) = %s\n", Entry.Key()(0), Entry.Key()(1),
-      ConnectionTypeString.c_str());
-  }
-
-  for (auto &Entry : FringeSize_) {
-    std::printf("FringeSize(%i) = %i\n", Entry.Key(), Entry.Value());
-  }
+    return ConnectionTypeString;
+  };
 
-  for (auto &Entry : MinimizeOverlap_) {
-    std::printf("MinimizeOverlap(%i,%i) = %c\n", Entry.Key()(0), Entry.Key()(1), Entry.Value() ?
-      'T' : 'F');
-  }
-
-  for (auto &Entry : DisjointConnections_) {
-    std::printf("DisjointConnections(%i,%i) = %c\n", Entry.Key()(0), Entry.Key()(1), Entry.Value() ?
-      'T' : 'F');
-  }
+  PrintGridPairOption("Overlappable", Overlappable_, FormatBool);
+  PrintGridPairOption("OverlapTolerance", OverlapTolerance_, FormatDouble);
+  PrintGridOption("OverlapAccelDepthAdjust", OverlapAccelDepthAdjust_, FormatDouble);
+  PrintGridOption("OverlapAccelResolutionAdjust", OverlapAccelResolutionAdjust_, FormatDouble);
+  PrintGridOption("OverlapQueryShippingThreshold", OverlapQueryShippingThreshold_, FormatDouble);
+  std::printf("OverlapSearchMaxLoadImbalance = %s\n", FormatDouble(
+    OverlapSearchMaxLoadImbalance_).c_str());
+  PrintGridOption("InferBoundaries", InferBoundaries_, FormatBool);
+  PrintGridPairOption("CutBoundaryHoles", CutBoundaryHoles_, FormatBool);
+  PrintGridPairOption("Occludes", Occludes_, FormatOccludes);
+  PrintGridPairOption("EdgePadding", EdgePadding_, FormatInt);
+  PrintGridOption("EdgeSmoothing", EdgeSmoothing_, FormatInt);
+  PrintGridPairOption("ConnectionType", ConnectionType_, FormatConnectionType);
+  PrintGridOption("FringeSize", FringeSize_, FormatInt);
+  PrintGridPairOption("MinimizeOverlap", MinimizeOverlap_, FormatBool);
+  PrintGridPairOption("DisjointConnections", DisjointConnections_, FormatBool);
 
 }
 
-template <typename T> T assembler::options::GetOption_(const map<int,T> &Option, int GridID, T
-  DefaultValue) const {
+template <typename T> T assembler::options::GetOption_(const grid_option<T> &Option, int GridID,
+  T DefaultValue) const {
 
   OVK_DEBUG_ASSERT(GridID >= 0, "Invalid grid ID.");
   OVK_DEBUG_ASSERT(GridIDs_.Contains(GridID), "Invalid grid ID.");
 
-  T Value = DefaultValue;
+  T Value = Option.AllGridsValue ? *Option.AllGridsValue : DefaultValue;
 
-  auto Iter = Option.Find(GridID);
-  if (Iter != Option.End()) {
+  auto Iter = Option.Values.Find(GridID);
+  if (Iter != Option.Values.End()) {
     Value = Iter->Value();
   }
 
@@ -474,53 +604,72 @@ template <typename T> T assembler::options::GetOption_(const map<int,T> &Option,
 
 }
 
-template <typename T> T assembler::options::GetOption_(const elem_map<int,2,T> &Option, const
+template <typename T> T assembler::options::GetOption_(const grid_pair_option<T> &Option, const
   elem<int,2> &GridIDPair, T DefaultValue) const {
 
-  if (OVK_DEBUG) {
-    int MGridID = GridIDPair(0);
-    int NGridID = GridIDPair(1);
-    OVK_DEBUG_ASSERT(MGridID >= 0, "Invalid M grid ID.");
-    OVK_DEBUG_ASSERT(NGridID >= 0, "Invalid N grid ID.");
-    OVK_DEBUG_ASSERT(GridIDs_.Contains(MGridID), "Invalid M grid ID.");
-    OVK_DEBUG_ASSERT(GridIDs_.Contains(NGridID), "Invalid N grid ID.");
+  int MGridID = GridIDPair(0);
+  int NGridID = GridIDPair(1);
+
+  OVK_DEBUG_ASSERT(MGridID >= 0, "Invalid M grid ID.");
+  OVK_DEBUG_ASSERT(NGridID >= 0, "Invalid N grid ID.");
+  OVK_DEBUG_ASSERT(GridIDs_.Contains(MGridID), "Invalid M grid ID.");
+  OVK_DEBUG_ASSERT(GridIDs_.Contains(NGridID), "Invalid N grid ID.");
+
+  using entry = typename grid_pair_option<T>::entry;
+
+  T Value = Option.AllPairsValue ? *Option.AllPairsValue : DefaultValue;
+  long long Order = -1;
+
+  auto ApplyEntry = [&](const entry &Entry) {
+    if (Entry.Order > Order) {
+      Value = Entry.Value;
+      Order = Entry.Order;
+    }
+  };
+
+  auto MIter = Option.MGridValues.Find(MGridID);
+  if (MIter != Option.MGridValues.End()) {
+    ApplyEntry(MIter->Value());
   }
 
-  T Value = DefaultValue;
+  auto NIter = Option.NGridValues.Find(NGridID);
+  if (NIter != Option.NGridValues.End()) {
+    ApplyEntry(NIter->Value());
+  }
 
-  auto Iter = Option.Find(GridIDPair);
-  if (Iter != Option.End()) {
-    Value = Iter->Value();
+  auto PairIter = Option.PairValues.Find(GridIDPair);
+  if (PairIter != Option.PairValues.End()) {
+    ApplyEntry(PairIter->Value());
   }
 
   return Value;
 
 }
 
-template <typename T> void assembler::options::SetOption_(map<int,T> &Option, int GridID, T Value,
-  T DefaultValue) {
+template <typename T> void assembler::options::SetOption_(grid_option<T> &Option, int GridID, T
+  Value, T DefaultValue) {
 
   OVK_DEBUG_ASSERT(GridID == ALL_GRIDS || GridIDs_.Contains(GridID), "Invalid grid ID.");
 
-  if (Value != DefaultValue) {
-    if (GridID == ALL_GRIDS) {
-      for (int ID : GridIDs_) {
-        Option.Insert(ID, Value);
-      }
+  if (GridID == ALL_GRIDS) {
+    Option.Values.Clear();
+    if (Value != DefaultValue) {
+      Option.AllGridsValue = Value;
     } else {
-      Option.Insert(GridID, Value);
+      Option.AllGridsValue.Reset();
     }
   } else {
-    if (GridID == ALL_GRIDS) {
-      Option.Clear();
+    T BaseValue = Option.AllGridsValue ? *Option.AllGridsValue : DefaultValue;
+    if (Value != BaseValue) {
+      Option.Values.Insert(GridID, Value);
     } else {
-      Option.Erase(GridID);
+      Option.Values.Erase(GridID);
     }
   }
 
 }
 
-template <typename T> void assembler::options::SetOption_(elem_map<int,2,T> &Option, const
+template <typename T> void assembler::options::SetOption_(grid_pair_option<T> &Option, const
   elem<int,2> &GridIDPair, T Value, T DefaultValue) {
 
   int MGridID = GridIDPair(0);
@@ -529,40 +678,62 @@ template <typename T> void assembler::options::SetOption_(elem_map<int,2,T> &Opt
   OVK_DEBUG_ASSERT(MGridID == ALL_GRIDS || GridIDs_.Contains(MGridID), "Invalid M grid ID.");
   OVK_DEBUG_ASSERT(NGridID == ALL_GRIDS || GridIDs_.Contains(NGridID), "Invalid N grid ID.");
 
-  if (Value != DefaultValue) {
-    if (MGridID == ALL_GRIDS && NGridID == ALL_GRIDS) {
-      for (int MID : GridIDs_) {
-        for (int NID : GridIDs_) {
-          Option.Insert({MID,NID}, Value);
-        }
-      }
-    } else if (MGridID == ALL_GRIDS) {
-      for (int MID : GridIDs_) {
-        Option.Insert({MID,NGridID}, Value);
-      }
-    } else if (NGridID == ALL_GRIDS) {
-      for (int NID : GridIDs_) {
-        Option.Insert({MGridID,NID}, Value);
-      }
+  using entry = typename grid_pair_option<T>::entry;
+
+  if (MGridID == ALL_GRIDS && NGridID == ALL_GRIDS) {
+    Option.MGridValues.Clear();
+    Option.NGridValues.Clear();
+    Option.PairValues.Clear();
+    if (Value != DefaultValue) {
+      Option.AllPairsValue = Value;
     } else {
-      Option.Insert(GridIDPair, Value);
+      Option.AllPairsValue.Reset();
     }
+  } else if (MGridID == ALL_GRIDS) {
+    Option.NGridValues.Insert(NGridID, entry{Value, Option.NextOrder++});
+  } else if (NGridID == ALL_GRIDS) {
+    Option.MGridValues.Insert(MGridID, entry{Value, Option.NextOrder++});
   } else {
-    if (MGridID == ALL_GRIDS && NGridID == ALL_GRIDS) {
-      Option.Clear();
-    } else if (MGridID == ALL_GRIDS) {
-      for (int MID : GridIDs_) {
-        Option.Erase({MID,NGridID});
-      }
-    } else if (NGridID == ALL_GRIDS) {
-      for (int NID : GridIDs_) {
-        Option.Erase({MGridID,NID});
-      }
+    // Don't store pair values that match what the pair would get anyway
+    bool Shadowed = Option.MGridValues.Contains(MGridID) || Option.NGridValues.Contains(NGridID);
+    T BaseValue = Option.AllPairsValue ? *Option.AllPairsValue : DefaultValue;
+    if (Shadowed || Value != BaseValue) {
+      Option.PairValues.Insert(GridIDPair, entry{Value, Option.NextOrder++});
     } else {
-      Option.Erase(GridIDPair);
+      Option.PairValues.Erase(GridIDPair);
     }
   }
 
 }
 
+template <typename T> T assembler::options::MaxOptionValueForMGrid_(const grid_pair_option<T>
+  &Option, int MGridID, T DefaultValue) const {
+
+  T MaxValue = Option.AllPairsValue ? *Option.AllPairsValue : DefaultValue;
+
+  auto MIter = Option.MGridValues.Find(MGridID);
+  if (MIter != Option.MGridValues.End()) {
+    MaxValue = Max(MaxValue, MIter->Value().Value);
+  }
+
+  for (auto &Entry : Option.NGridValues) {
+    MaxValue = Max(MaxValue, Entry.Value().Value);
+  }
+
+  for (auto &Entry : Option.PairValues) {
+    if (Entry.Key(0) == MGridID) {
+      MaxValue = Max(MaxValue, Entry.Value().Value);
+    }
+  }
+
+  return MaxValue;
+
+}
+
+double assembler::options::MaxOverlapTolerance_(int MGridID) const {
+
+  return MaxOptionValueForMGrid_(OverlapTolerance_, MGridID, 1.e-12);
+
+}
+
 }
@@ -13,6 +13,7 @@
 #include <ovk/core/Debug.hpp>
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/InterpCoefs.hpp>
 #include <ovk/core/Profiler.hpp>
 #include <ovk/core/Range.hpp>
 #include <ovk/core/TypeTraits.hpp>
@@ -84,6 +85,9 @@ collect CreateCollectNoneRow(std::shared_ptr<context> &&Context, comm_view Comm,
 collect CreateCollectNoneCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
   range &FieldValuesRange);
+collect CreateCollectNoneTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange);
 }
 inline collect CreateCollectNone(std::shared_ptr<context> Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
@@ -98,6 +102,10 @@ inline collect CreateCollectNone(std::shared_ptr<context> Context, comm_view Com
     Collect = collect_internal::CreateCollectNoneCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange);
     break;
+  case array_layout::TILED:
+    Collect = collect_internal::CreateCollectNoneTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -112,6 +120,9 @@ collect CreateCollectAnyRow(std::shared_ptr<context> &&Context, comm_view Comm,
 collect CreateCollectAnyCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
   range &FieldValuesRange);
+collect CreateCollectAnyTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange);
 }
 inline collect CreateCollectAny(std::shared_ptr<context> Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
@@ -126,6 +137,10 @@ inline collect CreateCollectAny(std::shared_ptr<context> Context, comm_view Comm
     Collect = collect_internal::CreateCollectAnyCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange);
     break;
+  case array_layout::TILED:
+    Collect = collect_internal::CreateCollectAnyTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -140,6 +155,9 @@ collect CreateCollectNotAllRow(std::shared_ptr<context> &&Context, comm_view Com
 collect CreateCollectNotAllCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
   range &FieldValuesRange);
+collect CreateCollectNotAllTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart
+  &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count,
+  const range &FieldValuesRange);
 }
 inline collect CreateCollectNotAll(std::shared_ptr<context> Context, comm_view Comm, const cart
   &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count,
@@ -154,6 +172,10 @@ inline collect CreateCollectNotAll(std::shared_ptr<context> Context, comm_view C
     Collect = collect_internal::CreateCollectNotAllCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange);
     break;
+  case array_layout::TILED:
+    Collect = collect_internal::CreateCollectNotAllTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -168,6 +190,9 @@ collect CreateCollectAllRow(std::shared_ptr<context> &&Context, comm_view Comm,
 collect CreateCollectAllCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
   range &FieldValuesRange);
+collect CreateCollectAllTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange);
 }
 inline collect CreateCollectAll(std::shared_ptr<context> Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
@@ -182,6 +207,10 @@ inline collect CreateCollectAll(std::shared_ptr<context> Context, comm_view Comm
     Collect = collect_internal::CreateCollectAllCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange);
     break;
+  case array_layout::TILED:
+    Collect = collect_internal::CreateCollectAllTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -196,6 +225,9 @@ collect CreateCollectMinRow(std::shared_ptr<context> &&Context, comm_view Comm,
 collect CreateCollectMinCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
   range &FieldValuesRange);
+collect CreateCollectMinTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange);
 }
 inline collect CreateCollectMin(std::shared_ptr<context> Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
@@ -210,6 +242,10 @@ inline collect CreateCollectMin(std::shared_ptr<context> Context, comm_view Comm
     Collect = collect_internal::CreateCollectMinCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange);
     break;
+  case array_layout::TILED:
+    Collect = collect_internal::CreateCollectMinTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -224,6 +260,9 @@ collect CreateCollectMaxRow(std::shared_ptr<context> &&Context, comm_view Comm,
 collect CreateCollectMaxCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
   range &FieldValuesRange);
+collect CreateCollectMaxTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange);
 }
 inline collect CreateCollectMax(std::shared_ptr<context> Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
@@ -238,6 +277,10 @@ inline collect CreateCollectMax(std::shared_ptr<context> Context, comm_view Comm
     Collect = collect_internal::CreateCollectMaxCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange);
     break;
+  case array_layout::TILED:
+    Collect = collect_internal::CreateCollectMaxTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -248,15 +291,17 @@ inline collect CreateCollectMax(std::shared_ptr<context> Context, comm_view Comm
 namespace collect_internal {
 collect CreateCollectInterpRow(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
-  range &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs);
+  range &FieldValuesRange, interp_coefs_ref InterpCoefs);
 collect CreateCollectInterpCol(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
-  range &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs);
+  range &FieldValuesRange, interp_coefs_ref InterpCoefs);
+collect CreateCollectInterpTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart
+  &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count,
+  const range &FieldValuesRange, interp_coefs_ref InterpCoefs);
 }
 inline collect CreateCollectInterp(std::shared_ptr<context> Context, comm_view Comm, const cart
   &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count,
-  const range &FieldValuesRange, array_layout FieldValuesLayout, floating_ref<const array<double,3>>
-  InterpCoefs) {
+  const range &FieldValuesRange, array_layout FieldValuesLayout, interp_coefs_ref InterpCoefs) {
   switch (FieldValuesLayout) {
   case array_layout::ROW_MAJOR:
     return collect_internal::CreateCollectInterpRow(std::move(Context), Comm, Cart, LocalRange,
@@ -266,6 +311,10 @@ inline collect CreateCollectInterp(std::shared_ptr<context> Context, comm_view C
     return collect_internal::CreateCollectInterpCol(std::move(Context), Comm, Cart, LocalRange,
       CollectMap, ValueType, Count, FieldValuesRange, InterpCoefs);
     break;
+  case array_layout::TILED:
+    return collect_internal::CreateCollectInterpTiled(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, ValueType, Count, FieldValuesRange, InterpCoefs);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -277,15 +326,18 @@ inline collect CreateCollectInterp(std::shared_ptr<context> Context, comm_view C
 namespace collect_internal {
 collect CreateCollectInterpThreadedRow(std::shared_ptr<context> &&Context, comm_view Comm, const
   cart &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int
-  Count, const range &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs);
+  Count, const range &FieldValuesRange, interp_coefs_ref InterpCoefs);
 collect CreateCollectInterpThreadedCol(std::shared_ptr<context> &&Context, comm_view Comm, const
   cart &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int
-  Count, const range &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs);
+  Count, const range &FieldValuesRange, interp_coefs_ref InterpCoefs);
+collect CreateCollectInterpThreadedTiled(std::shared_ptr<context> &&Context, comm_view Comm, const
+  cart &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int
+  Count, const range &FieldValuesRange, interp_coefs_ref InterpCoefs);
 }
 inline collect CreateCollectInterpThreaded(std::shared_ptr<context> Context, comm_view Comm, const
   cart &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int
-  Count, const range &FieldValuesRange, array_layout FieldValuesLayout, floating_ref<const
-  array<double,3>> InterpCoefs) {
+  Count, const range &FieldValuesRange, array_layout FieldValuesLayout, interp_coefs_ref
+  InterpCoefs) {
   switch (FieldValuesLayout) {
   case array_layout::ROW_MAJOR:
     return collect_internal::CreateCollectInterpThreadedRow(std::move(Context), Comm, Cart,
@@ -295,6 +347,10 @@ inline collect CreateCollectInterpThreaded(std::shared_ptr<context> Context, com
     return collect_internal::CreateCollectInterpThreadedCol(std::move(Context), Comm, Cart,
       LocalRange, CollectMap, ValueType, Count, FieldValuesRange, InterpCoefs);
     break;
+  case array_layout::TILED:
+    return collect_internal::CreateCollectInterpThreadedTiled(std::move(Context), Comm, Cart,
+      LocalRange, CollectMap, ValueType, Count, FieldValuesRange, InterpCoefs);
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
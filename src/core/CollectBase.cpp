@@ -9,6 +9,7 @@
 #include "ovk/core/CollectMap.hpp"
 #include "ovk/core/Comm.hpp"
 #include "ovk/core/Context.hpp"
+#include "ovk/core/ForEach.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Indexer.hpp"
 #include "ovk/core/Profiler.hpp"
@@ -53,16 +54,7 @@ template <array_layout Layout> collect_base<Layout>::collect_base(std::shared_pt
 
 template <array_layout Layout> range collect_base<Layout>::GetCellRange_(long long iCell) const {
 
-  const array_view<const int,3> &CellExtents = CollectMap_->CellExtents();
-
-  range CellRange;
-
-  for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-    CellRange.Begin(iDim) = CellExtents(0,iDim,iCell);
-    CellRange.End(iDim) = CellExtents(1,iDim,iCell);
-  }
-
-  return CellRange;
+  return CollectMap_->GetCellRange(iCell);
 
 }
 
@@ -75,15 +67,12 @@ template <array_layout Layout> void collect_base<Layout>::GetLocalCellInfo_(cons
   if (AwayFromEdge) {
     range LocalCellRange = IntersectRanges(LocalRange_, CellRange);
     int iLocalVertex = 0;
-    for (int k = LocalCellRange.Begin(2); k < LocalCellRange.End(2); ++k) {
-      for (int j = LocalCellRange.Begin(1); j < LocalCellRange.End(1); ++j) {
-        for (int i = LocalCellRange.Begin(0); i < LocalCellRange.End(0); ++i) {
-          LocalVertexCellIndices(iLocalVertex) = CellIndexer.ToIndex(i,j,k);
-          LocalVertexFieldValuesIndices(iLocalVertex) = FieldValuesIndexer_.ToIndex(i,j,k);
-          ++iLocalVertex;
-        }
-      }
-    }
+    ForEachInRange(LocalCellRange, FieldValuesIndexer_, [&](const tuple<int> &Vertex, long long
+      iFieldValue) {
+      LocalVertexCellIndices(iLocalVertex) = CellIndexer.ToIndex(Vertex);
+      LocalVertexFieldValuesIndices(iLocalVertex) = iFieldValue;
+      ++iLocalVertex;
+    });
     NumLocalVertices = iLocalVertex;
   } else {
     int iLocalVertex = 0;
@@ -107,6 +96,7 @@ template <array_layout Layout> void collect_base<Layout>::GetLocalCellInfo_(cons
 
 template class collect_base<array_layout::ROW_MAJOR>;
 template class collect_base<array_layout::COLUMN_MAJOR>;
+template class collect_base<array_layout::TILED>;
 
 template <typename T, array_layout Layout> collect_base_for_type<T, Layout>::collect_base_for_type(
   std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart, const range &LocalRange,
@@ -120,13 +110,13 @@ template <typename T, array_layout Layout> collect_base_for_type<T, Layout>::col
 
   SendBuffers_.Resize({Sends.Count()});
   for (int iSend = 0; iSend < Sends.Count(); ++iSend) {
-    SendBuffers_(iSend).Resize({{Count_,Sends(iSend).NumPoints}});
+    SendBuffers_(iSend).ResizeUninitialized({{Count_,Sends(iSend).NumPoints}});
   }
 
   if (!std::is_same<value_type, mpi_value_type>::value) {
     RecvBuffers_.Resize({Recvs.Count()});
     for (int iRecv = 0; iRecv < Recvs.Count(); ++iRecv) {
-      RecvBuffers_(iRecv).Resize({{Count_,Recvs(iRecv).NumPoints}});
+      RecvBuffers_(iRecv).ResizeUninitialized({{Count_,Recvs(iRecv).NumPoints}});
     }
   }
 
@@ -142,7 +132,7 @@ template <typename T, array_layout Layout> void collect_base_for_type<T, Layout>
 
   RemoteValues.Resize({Recvs.Count()});
   for (int iRecv = 0; iRecv < Recvs.Count(); ++iRecv) {
-    RemoteValues(iRecv).Resize({{Count_,Recvs(iRecv).NumPoints}});
+    RemoteValues(iRecv).ResizeUninitialized({{Count_,Recvs(iRecv).NumPoints}});
   }
 
 }
@@ -279,23 +269,33 @@ template <typename T, array_layout Layout> void collect_base_for_type<T, Layout>
 
 template class collect_base_for_type<bool, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<bool, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<bool, array_layout::TILED>;
 template class collect_base_for_type<byte, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<byte, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<byte, array_layout::TILED>;
 template class collect_base_for_type<int, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<int, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<int, array_layout::TILED>;
 template class collect_base_for_type<long, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<long, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<long, array_layout::TILED>;
 template class collect_base_for_type<long long, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<long long, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<long long, array_layout::TILED>;
 template class collect_base_for_type<unsigned int, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<unsigned int, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<unsigned int, array_layout::TILED>;
 template class collect_base_for_type<unsigned long, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<unsigned long, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<unsigned long, array_layout::TILED>;
 template class collect_base_for_type<unsigned long long, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<unsigned long long, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<unsigned long long, array_layout::TILED>;
 template class collect_base_for_type<float, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<float, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<float, array_layout::TILED>;
 template class collect_base_for_type<double, array_layout::ROW_MAJOR>;
 template class collect_base_for_type<double, array_layout::COLUMN_MAJOR>;
+template class collect_base_for_type<double, array_layout::TILED>;
 
 }}}
@@ -75,6 +75,7 @@ protected:
 
 extern template class collect_base<array_layout::ROW_MAJOR>;
 extern template class collect_base<array_layout::COLUMN_MAJOR>;
+extern template class collect_base<array_layout::TILED>;
 
 template <typename T, array_layout Layout> class collect_base_for_type : public collect_base<
   Layout> {
@@ -127,31 +128,41 @@ private:
   using parent_type::LocalVertexCellIndices_;
   using parent_type::LocalVertexFieldValuesIndices_;
 
-  array<array<mpi_value_type,2>> SendBuffers_;
-  array<array<mpi_value_type,2>> RecvBuffers_;
+  array<core::aligned_array<mpi_value_type,2>> SendBuffers_;
+  array<core::aligned_array<mpi_value_type,2>> RecvBuffers_;
 
 };
 
 extern template class collect_base_for_type<bool, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<bool, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<bool, array_layout::TILED>;
 extern template class collect_base_for_type<byte, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<byte, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<byte, array_layout::TILED>;
 extern template class collect_base_for_type<int, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<int, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<int, array_layout::TILED>;
 extern template class collect_base_for_type<long, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<long, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<long, array_layout::TILED>;
 extern template class collect_base_for_type<long long, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<long long, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<long long, array_layout::TILED>;
 extern template class collect_base_for_type<unsigned int, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<unsigned int, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<unsigned int, array_layout::TILED>;
 extern template class collect_base_for_type<unsigned long, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<unsigned long, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<unsigned long, array_layout::TILED>;
 extern template class collect_base_for_type<unsigned long long, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<unsigned long long, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<unsigned long long, array_layout::TILED>;
 extern template class collect_base_for_type<float, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<float, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<float, array_layout::TILED>;
 extern template class collect_base_for_type<double, array_layout::ROW_MAJOR>;
 extern template class collect_base_for_type<double, array_layout::COLUMN_MAJOR>;
+extern template class collect_base_for_type<double, array_layout::TILED>;
 
 }}}
 
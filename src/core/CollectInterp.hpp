@@ -12,6 +12,7 @@
 #include <ovk/core/Context.hpp>
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/InterpCoefs.hpp>
 #include <ovk/core/Profiler.hpp>
 #include <ovk/core/Range.hpp>
 
@@ -44,15 +45,16 @@ public:
 
   collect_interp(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart, const range
     &LocalRange, const collect_map &CollectMap, int Count, const range &FieldValuesRange,
-    floating_ref<const array<double,3>> InterpCoefs):
+    interp_coefs_ref InterpCoefs):
     parent_type(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count, FieldValuesRange),
-    InterpCoefs_(InterpCoefs)
+    InterpCoefs_(std::move(InterpCoefs))
   {
 
     parent_type::AllocateRemoteValues_(RemoteValues_);
 
-    VertexValues_.Resize({{Count_,CollectMap_->MaxVertices()}});
+    VertexValues_.ResizeUninitialized({{Count_,CollectMap_->MaxVertices()}});
     VertexCoefs_.Resize({CollectMap_->MaxVertices()});
+    CellCoefs_.Resize({{MAX_DIMS,InterpCoefs_.MaxStencilSize()}});
 
   }
 
@@ -66,8 +68,6 @@ public:
 
     profiler &Profiler = Context_->core_Profiler();
 
-    const array<double,3> &InterpCoefs = *InterpCoefs_;
-
     parent_type::SetBufferViews_(FieldValuesVoid, PackedValuesVoid);
     parent_type::RetrieveRemoteValues_(FieldValues_, RemoteValues_);
 
@@ -82,14 +82,16 @@ public:
       parent_type::AssembleVertexValues_(FieldValues_, RemoteValues_, iCell, CellRange, CellIndexer,
         VertexValues_);
 
+      InterpCoefs_.Get(iCell, CellCoefs_);
+
       for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
         for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
           for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
             int iVertex = CellIndexer.ToIndex(i,j,k);
             VertexCoefs_(iVertex) =
-              InterpCoefs(0,i-CellRange.Begin(0),iCell) *
-              InterpCoefs(1,j-CellRange.Begin(1),iCell) *
-              InterpCoefs(2,k-CellRange.Begin(2),iCell);
+              CellCoefs_(0,i-CellRange.Begin(0)) *
+              CellCoefs_(1,j-CellRange.Begin(1)) *
+              CellCoefs_(2,k-CellRange.Begin(2));
           }
         }
       }
@@ -109,9 +111,10 @@ public:
 
 private:
 
-  floating_ref<const array<double,3>> InterpCoefs_;
+  interp_coefs_ref InterpCoefs_;
   array<array<value_type,2>> RemoteValues_;
   array<value_type,2> VertexValues_;
+  array<double,2> CellCoefs_;
   array<double> VertexCoefs_;
 
 };
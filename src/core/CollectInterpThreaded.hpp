@@ -14,6 +14,7 @@
 #include <ovk/core/Context.hpp>
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/InterpCoefs.hpp>
 #include <ovk/core/Profiler.hpp>
 #include <ovk/core/Range.hpp>
 
@@ -47,25 +48,27 @@ public:
 
   collect_interp_threaded(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
     const range &LocalRange, const collect_map &CollectMap, int Count, const range
-    &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs):
+    &FieldValuesRange, interp_coefs_ref InterpCoefs):
     collect_interp_threaded(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
-      FieldValuesRange, InterpCoefs, GetThreadCount_())
+      FieldValuesRange, std::move(InterpCoefs), GetThreadCount_())
   {}
 
   collect_interp_threaded(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
     const range &LocalRange, const collect_map &CollectMap, int Count, const range
-    &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs, int NumThreads):
+    &FieldValuesRange, interp_coefs_ref InterpCoefs, int NumThreads):
     parent_type(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count, FieldValuesRange,
       NumThreads),
-    InterpCoefs_(InterpCoefs)
+    InterpCoefs_(std::move(InterpCoefs))
   {
 
     parent_type::AllocateRemoteValues_(RemoteValues_);
 
     VertexValues_.Resize({NumThreads});
+    CellCoefs_.Resize({NumThreads});
     VertexCoefs_.Resize({NumThreads});
     for (int iThread = 0; iThread < NumThreads; ++iThread) {
-      VertexValues_(iThread).Resize({{Count_,CollectMap_->MaxVertices()}});
+      VertexValues_(iThread).ResizeUninitialized({{Count_,CollectMap_->MaxVertices()}});
+      CellCoefs_(iThread).Resize({{MAX_DIMS,InterpCoefs_.MaxStencilSize()}});
       VertexCoefs_(iThread).Resize({CollectMap_->MaxVertices()});
     }
 
@@ -81,8 +84,6 @@ public:
 
     profiler &Profiler = Context_->core_Profiler();
 
-    const array<double,3> &InterpCoefs = *InterpCoefs_;
-
     parent_type::SetBufferViews_(FieldValuesVoid, PackedValuesVoid);
     parent_type::RetrieveRemoteValues_(FieldValues_, RemoteValues_);
 
@@ -96,6 +97,7 @@ public:
       int iThread = omp_get_thread_num();
 
       array<value_type,2> &VertexValues = VertexValues_(iThread);
+      array<double,2> &CellCoefs = CellCoefs_(iThread);
       array<double> &VertexCoefs = VertexCoefs_(iThread);
 
       #pragma omp for
@@ -108,14 +110,16 @@ public:
         parent_type::AssembleVertexValues_(FieldValues_, RemoteValues_, iCell, CellRange,
           CellIndexer, VertexValues, iThread);
 
+        InterpCoefs_.Get(iCell, CellCoefs);
+
         for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
           for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
             for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
               int iVertex = CellIndexer.ToIndex(i,j,k);
               VertexCoefs(iVertex) =
-                InterpCoefs(0,i-CellRange.Begin(0),iCell) *
-                InterpCoefs(1,j-CellRange.Begin(1),iCell) *
-                InterpCoefs(2,k-CellRange.Begin(2),iCell);
+                CellCoefs(0,i-CellRange.Begin(0)) *
+                CellCoefs(1,j-CellRange.Begin(1)) *
+                CellCoefs(2,k-CellRange.Begin(2));
             }
           }
         }
@@ -137,9 +141,10 @@ public:
 
 private:
 
-  floating_ref<const array<double,3>> InterpCoefs_;
+  interp_coefs_ref InterpCoefs_;
   array<array<value_type,2>> RemoteValues_;
   array<array<value_type,2>> VertexValues_;
+  array<array<double,2>> CellCoefs_;
   array<array<double>> VertexCoefs_;
 
   static int GetThreadCount_() {
@@ -42,9 +42,28 @@ collect_map::collect_map(const partition &Partition, array<int,3> CellExtents):
 
 }
 
+collect_map::collect_map(const partition &Partition, array<long long> CellLowerCorners, int
+  CellSize):
+  Compact_(true),
+  CellLowerCorners_(std::move(CellLowerCorners)),
+  GlobalIndexer_(Partition.Cart().Range()),
+  NumDims_(Partition.Cart().Dimension()),
+  CellSize_(CellSize)
+{
+
+  MaxVertices_ = 1;
+  for (int iDim = 0; iDim < NumDims_; ++iDim) {
+    MaxVertices_ *= CellSize_;
+  }
+
+  CreateSendData_(Partition);
+  CreateRecvData_(Partition);
+
+}
+
 void collect_map::CreateSendData_(const partition &Partition) {
 
-  long long NumCells = CellExtents_.Size(2);
+  long long NumCells = Count();
 
   if (NumCells > 0) {
 
@@ -61,11 +80,7 @@ void collect_map::CreateSendData_(const partition &Partition) {
     }
 
     for (long long iCell = 0; iCell < NumCells; ++iCell) {
-      range CellRange;
-      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        CellRange.Begin(iDim) = CellExtents_(0,iDim,iCell);
-        CellRange.End(iDim) = CellExtents_(1,iDim,iCell);
-      }
+      range CellRange = GetCellRange(iCell);
       bool AwayFromEdge = GlobalRange.Includes(CellRange);
       for (int iNeighbor = 0; iNeighbor < NumNeighbors; ++iNeighbor) {
         const partition::neighbor_info &Neighbor = Neighbors[iNeighbor].Value();
@@ -134,11 +149,7 @@ void collect_map::CreateSendData_(const partition &Partition) {
     }
 
     for (long long iCell = 0; iCell < NumCells; ++iCell) {
-      range CellRange;
-      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        CellRange.Begin(iDim) = CellExtents_(0,iDim,iCell);
-        CellRange.End(iDim) = CellExtents_(1,iDim,iCell);
-      }
+      range CellRange = GetCellRange(iCell);
       bool AwayFromEdge = GlobalRange.Includes(CellRange);
       for (int iSend = 0; iSend < NumSends; ++iSend) {
         int iNeighbor = SendIndexToNeighbor(iSend);
@@ -222,7 +233,7 @@ void collect_map::CreateSendData_(const partition &Partition) {
 
 void collect_map::CreateRecvData_(const partition &Partition) {
 
-  long long NumCells = CellExtents_.Size(2);
+  long long NumCells = Count();
 
   if (NumCells > 0) {
 
@@ -239,11 +250,7 @@ void collect_map::CreateRecvData_(const partition &Partition) {
     }
 
     for (long long iCell = 0; iCell < NumCells; ++iCell) {
-      range CellRange;
-      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        CellRange.Begin(iDim) = CellExtents_(0,iDim,iCell);
-        CellRange.End(iDim) = CellExtents_(1,iDim,iCell);
-      }
+      range CellRange = GetCellRange(iCell);
       bool AwayFromEdge = GlobalRange.Includes(CellRange);
       for (int iNeighbor = 0; iNeighbor < NumNeighbors; ++iNeighbor) {
         const partition::neighbor_info &Neighbor = Neighbors[iNeighbor].Value();
@@ -294,11 +301,7 @@ void collect_map::CreateRecvData_(const partition &Partition) {
     }
 
     for (long long iCell = 0; iCell < NumCells; ++iCell) {
-      range CellRange;
-      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        CellRange.Begin(iDim) = CellExtents_(0,iDim,iCell);
-        CellRange.End(iDim) = CellExtents_(1,iDim,iCell);
-      }
+      range CellRange = GetCellRange(iCell);
       bool AwayFromEdge = GlobalRange.Includes(CellRange);
       for (int iRecv = 0; iRecv < NumRecvs; ++iRecv) {
         int iNeighbor = RecvIndexToNeighbor(iRecv);
@@ -348,11 +351,7 @@ void collect_map::CreateRecvData_(const partition &Partition) {
 
     long long TotalRemoteVertices = 0;
     for (long long iCell = 0; iCell < NumCells; ++iCell) {
-      range CellRange;
-      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        CellRange.Begin(iDim) = CellExtents_(0,iDim,iCell);
-        CellRange.End(iDim) = CellExtents_(1,iDim,iCell);
-      }
+      range CellRange = GetCellRange(iCell);
       bool AwayFromEdge = GlobalRange.Includes(CellRange);
       int NumRemoteVertices;
       if (AwayFromEdge) {
@@ -410,11 +409,7 @@ void collect_map::CreateRecvData_(const partition &Partition) {
         CellRecvs(iVertex) = -1;
         CellRecvBufferIndices(iVertex) = -1;
       }
-      range CellRange;
-      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-        CellRange.Begin(iDim) = CellExtents_(0,iDim,iCell);
-        CellRange.End(iDim) = CellExtents_(1,iDim,iCell);
-      }
+      range CellRange = GetCellRange(iCell);
       range_indexer_c<int> CellIndexer(CellRange);
       bool AwayFromEdge = GlobalRange.Includes(CellRange);
       for (int iRecv = 0; iRecv < Recvs_.Count(); ++iRecv) {
@@ -8,7 +8,10 @@
 #include <ovk/core/Comm.hpp>
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/Indexer.hpp>
 #include <ovk/core/Partition.hpp>
+#include <ovk/core/Range.hpp>
+#include <ovk/core/Tuple.hpp>
 
 #include <mpi.h>
 
@@ -32,15 +35,33 @@ public:
 
   collect_map() = default;
   collect_map(const partition &Partition, array<int,3> CellExtents);
+  // Compact form; cells are identified by the linear index of their lower corner in the global
+  // range and all have CellSize points in each dimension
+  collect_map(const partition &Partition, array<long long> CellLowerCorners, int CellSize);
 
   floating_ref<const collect_map> GetFloatingRef() const {
     return FloatingRefGenerator_.Generate(*this);
   }
   floating_ref<collect_map> GetFloatingRef() { return FloatingRefGenerator_.Generate(*this); }
 
-  long long Count() const { return CellExtents_.Size(2); }
-
-  const array<int,3> &CellExtents() const { return CellExtents_; }
+  long long Count() const { return Compact_ ? CellLowerCorners_.Count() : CellExtents_.Size(2); }
+
+  range GetCellRange(long long iCell) const {
+    range Range;
+    if (Compact_) {
+      tuple<int> LowerCorner = GlobalIndexer_.ToTuple(CellLowerCorners_(iCell));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Range.Begin(iDim) = LowerCorner(iDim);
+        Range.End(iDim) = LowerCorner(iDim) + (iDim < NumDims_ ? CellSize_ : 1);
+      }
+    } else {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Range.Begin(iDim) = CellExtents_(0,iDim,iCell);
+        Range.End(iDim) = CellExtents_(1,iDim,iCell);
+      }
+    }
+    return Range;
+  }
 
   int MaxVertices() const { return MaxVertices_; }
 
@@ -58,7 +79,12 @@ private:
 
   floating_ref_generator FloatingRefGenerator_;
 
+  bool Compact_ = false;
   array<int,3> CellExtents_;
+  array<long long> CellLowerCorners_;
+  range_indexer_c<long long> GlobalIndexer_;
+  int NumDims_ = MAX_DIMS;
+  int CellSize_ = 0;
   int MaxVertices_ = 0;
   array<send> Sends_;
   array<recv> Recvs_;
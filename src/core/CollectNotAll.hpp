@@ -48,7 +48,7 @@ public:
 
     parent_type::AllocateRemoteValues_(RemoteValues_);
 
-    VertexValues_.Resize({{Count_,CollectMap_->MaxVertices()}});
+    VertexValues_.ResizeUninitialized({{Count_,CollectMap_->MaxVertices()}});
 
   }
 
@@ -19,6 +19,7 @@
 #include "ovk/core/Debug.hpp"
 #include "ovk/core/FloatingRef.hpp"
 #include "ovk/core/Global.hpp"
+#include "ovk/core/InterpCoefs.hpp"
 #include "ovk/core/Range.hpp"
 
 #include <mpi.h>
@@ -382,7 +383,7 @@ template <typename T> using collect_interp_row = collect_interp<T, array_layout:
 
 collect CreateCollectInterpRow(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
   const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
-  range &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs) {
+  range &FieldValuesRange, interp_coefs_ref InterpCoefs) {
 
   collect Collect;
 
@@ -410,7 +411,7 @@ template <typename T> using collect_interp_threaded_row = collect_interp_threade
 
 collect CreateCollectInterpThreadedRow(std::shared_ptr<context> &&Context, comm_view Comm, const
   cart &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int
-  Count, const range &FieldValuesRange, floating_ref<const array<double,3>> InterpCoefs) {
+  Count, const range &FieldValuesRange, interp_coefs_ref InterpCoefs) {
 
   collect Collect;
 
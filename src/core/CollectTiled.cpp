@@ -0,0 +1,437 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include "ovk/core/Collect.hpp"
+
+#include "ovk/core/CollectAll.hpp"
+#include "ovk/core/CollectAny.hpp"
+#include "ovk/core/CollectInterp.hpp"
+#include "ovk/core/CollectInterpThreaded.hpp"
+#include "ovk/core/CollectMax.hpp"
+#include "ovk/core/CollectMin.hpp"
+#include "ovk/core/CollectNone.hpp"
+#include "ovk/core/CollectNotAll.hpp"
+
+#include "ovk/core/Cart.hpp"
+#include "ovk/core/Comm.hpp"
+#include "ovk/core/Context.hpp"
+#include "ovk/core/DataType.hpp"
+#include "ovk/core/Debug.hpp"
+#include "ovk/core/FloatingRef.hpp"
+#include "ovk/core/Global.hpp"
+#include "ovk/core/InterpCoefs.hpp"
+#include "ovk/core/Range.hpp"
+
+#include <mpi.h>
+
+#include <memory>
+#include <utility>
+
+namespace ovk {
+namespace core {
+namespace collect_internal {
+
+template <typename T> using collect_none_tiled = collect_none<T, array_layout::TILED>;
+
+collect CreateCollectNoneTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::BOOL:
+    Collect = collect_none_tiled<bool>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::BYTE:
+    Collect = collect_none_tiled<byte>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::INT:
+    Collect = collect_none_tiled<int>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG:
+    Collect = collect_none_tiled<long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::LONG_LONG:
+    Collect = collect_none_tiled<long long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_INT:
+    Collect = collect_none_tiled<unsigned int>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG:
+    Collect = collect_none_tiled<unsigned long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG_LONG:
+    Collect = collect_none_tiled<unsigned long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::FLOAT:
+    Collect = collect_none_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_none_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+template <typename T> using collect_any_tiled = collect_any<T, array_layout::TILED>;
+
+collect CreateCollectAnyTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::BOOL:
+    Collect = collect_any_tiled<bool>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::BYTE:
+    Collect = collect_any_tiled<byte>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::INT:
+    Collect = collect_any_tiled<int>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG:
+    Collect = collect_any_tiled<long>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG_LONG:
+    Collect = collect_any_tiled<long long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_INT:
+    Collect = collect_any_tiled<unsigned int>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG:
+    Collect = collect_any_tiled<unsigned long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG_LONG:
+    Collect = collect_any_tiled<unsigned long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::FLOAT:
+    Collect = collect_any_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_any_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+template <typename T> using collect_not_all_tiled = collect_not_all<T, array_layout::TILED>;
+
+collect CreateCollectNotAllTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart
+  &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count,
+  const range &FieldValuesRange) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::BOOL:
+    Collect = collect_not_all_tiled<bool>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::BYTE:
+    Collect = collect_not_all_tiled<byte>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::INT:
+    Collect = collect_not_all_tiled<int>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::LONG:
+    Collect = collect_not_all_tiled<long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::LONG_LONG:
+    Collect = collect_not_all_tiled<long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_INT:
+    Collect = collect_not_all_tiled<unsigned int>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG:
+    Collect = collect_not_all_tiled<unsigned long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG_LONG:
+    Collect = collect_not_all_tiled<unsigned long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::FLOAT:
+    Collect = collect_not_all_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_not_all_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+template <typename T> using collect_all_tiled = collect_all<T, array_layout::TILED>;
+
+collect CreateCollectAllTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::BOOL:
+    Collect = collect_all_tiled<bool>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::BYTE:
+    Collect = collect_all_tiled<byte>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::INT:
+    Collect = collect_all_tiled<int>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG:
+    Collect = collect_all_tiled<long>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG_LONG:
+    Collect = collect_all_tiled<long long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_INT:
+    Collect = collect_all_tiled<unsigned int>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG:
+    Collect = collect_all_tiled<unsigned long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG_LONG:
+    Collect = collect_all_tiled<unsigned long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::FLOAT:
+    Collect = collect_all_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_all_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+template <typename T> using collect_min_tiled = collect_min<T, array_layout::TILED>;
+
+collect CreateCollectMinTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::BOOL:
+    Collect = collect_min_tiled<bool>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::BYTE:
+    Collect = collect_min_tiled<byte>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::INT:
+    Collect = collect_min_tiled<int>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG:
+    Collect = collect_min_tiled<long>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG_LONG:
+    Collect = collect_min_tiled<long long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_INT:
+    Collect = collect_min_tiled<unsigned int>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG:
+    Collect = collect_min_tiled<unsigned long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG_LONG:
+    Collect = collect_min_tiled<unsigned long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::FLOAT:
+    Collect = collect_min_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_min_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+template <typename T> using collect_max_tiled = collect_max<T, array_layout::TILED>;
+
+collect CreateCollectMaxTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart &Cart,
+  const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count, const
+  range &FieldValuesRange) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::BOOL:
+    Collect = collect_max_tiled<bool>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::BYTE:
+    Collect = collect_max_tiled<byte>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::INT:
+    Collect = collect_max_tiled<int>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG:
+    Collect = collect_max_tiled<long>(std::move(Context), Comm, Cart, LocalRange, CollectMap, Count,
+      FieldValuesRange);
+    break;
+  case data_type::LONG_LONG:
+    Collect = collect_max_tiled<long long>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_INT:
+    Collect = collect_max_tiled<unsigned int>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG:
+    Collect = collect_max_tiled<unsigned long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::UNSIGNED_LONG_LONG:
+    Collect = collect_max_tiled<unsigned long long>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange);
+    break;
+  case data_type::FLOAT:
+    Collect = collect_max_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_max_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+template <typename T> using collect_interp_tiled = collect_interp<T, array_layout::TILED>;
+
+collect CreateCollectInterpTiled(std::shared_ptr<context> &&Context, comm_view Comm, const cart
+  &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int Count,
+  const range &FieldValuesRange, interp_coefs_ref InterpCoefs) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::FLOAT:
+    Collect = collect_interp_tiled<float>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange, InterpCoefs);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_interp_tiled<double>(std::move(Context), Comm, Cart, LocalRange, CollectMap,
+      Count, FieldValuesRange, InterpCoefs);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Invalid data type for interpolation collect operation.");
+    break;
+  }
+
+  return Collect;
+
+}
+
+#ifdef OVK_HAVE_OPENMP
+template <typename T> using collect_interp_threaded_tiled = collect_interp_threaded<T,
+  array_layout::TILED>;
+
+collect CreateCollectInterpThreadedTiled(std::shared_ptr<context> &&Context, comm_view Comm, const
+  cart &Cart, const range &LocalRange, const collect_map &CollectMap, data_type ValueType, int
+  Count, const range &FieldValuesRange, interp_coefs_ref InterpCoefs) {
+
+  collect Collect;
+
+  switch (ValueType) {
+  case data_type::FLOAT:
+    Collect = collect_interp_threaded_tiled<float>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange, InterpCoefs);
+    break;
+  case data_type::DOUBLE:
+    Collect = collect_interp_threaded_tiled<double>(std::move(Context), Comm, Cart, LocalRange,
+      CollectMap, Count, FieldValuesRange, InterpCoefs);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Invalid data type for interpolation collect operation.");
+    break;
+  }
+
+  return Collect;
+
+}
+#endif
+
+}}}
@@ -6,12 +6,15 @@
 #include "ovk/core/Array.hpp"
 #include "ovk/core/ArrayView.hpp"
 #include "ovk/core/Comm.hpp"
+#include "ovk/core/Debug.hpp"
 #include "ovk/core/Global.hpp"
+#include "ovk/core/Map.hpp"
 #include "ovk/core/Profiler.hpp"
 #include "ovk/core/Set.hpp"
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <string>
 
 namespace ovk {
@@ -69,131 +72,228 @@ void BroadcastStringAnySource(std::string &String, bool IsSource, comm_view Comm
 
 }
 
-// Notes about crappy alternative to Ibarrier:
-// * StartSignal sends two messages to the root with different tags (note that the second
-//   send is synchronous).
-// * In CheckSignal, the root receives the first set of sends, and after they're all done
-//   it receives the second set (the barrier is then 'done' when the synchronous sends are
-//   matched with receives). The other ranks just test on the two send requests.
-// This *seems* like it would be faster than having the root send messages back to each rank
-// after the first set of receives, but in reality I have no idea. It would also be better
-// to use some kind of tree-like communication instead of sending everything to the root,
-// but who has time for that?
+void BroadcastStringsAnySource(array_view<std::string> Strings, array_view<const bool> IsSource,
+  comm_view Comm) {
 
-signal::signal(comm_view Comm):
-  Comm_(DuplicateComm(Comm))
-{}
+  int NumStrings = Strings.Count();
 
-void signal::Start() {
+  // Non-source ranks contribute zeros, so reducing with max/bitwise or reproduces the source's data
+  array<int> StringLengths({NumStrings}, 0);
+  for (int iString = 0; iString < NumStrings; ++iString) {
+    if (IsSource(iString)) StringLengths(iString) = Strings(iString).length();
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, StringLengths.Data(), NumStrings, MPI_INT, MPI_MAX, Comm);
+
+  int TotalLength = 0;
+  for (int iString = 0; iString < NumStrings; ++iString) {
+    TotalLength += StringLengths(iString);
+  }
+
+  array<unsigned char> StringChars({TotalLength}, 0);
+
+  int Offset = 0;
+  for (int iString = 0; iString < NumStrings; ++iString) {
+    if (IsSource(iString)) {
+      const std::string &String = Strings(iString);
+      std::copy(String.begin(), String.end(), StringChars.Data()+Offset);
+    }
+    Offset += StringLengths(iString);
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE, StringChars.Data(), TotalLength, MPI_UNSIGNED_CHAR, MPI_BOR, Comm);
+
+  Offset = 0;
+  for (int iString = 0; iString < NumStrings; ++iString) {
+    const unsigned char *Chars = StringChars.Data()+Offset;
+    Strings(iString).assign(Chars, Chars+StringLengths(iString));
+    Offset += StringLengths(iString);
+  }
+
+}
+
+array<comm> DuplicateComms(array_view<const comm_view> Comms) {
+
+  int NumComms = Comms.Count();
+
+  array<MPI_Comm> DuplicatedCommsRaw({NumComms}, MPI_COMM_NULL);
 
 #ifdef OVK_HAVE_MPI_IBARRIER
-  MPI_Ibarrier(Comm_, &Request_);
+  array<MPI_Request> Requests({NumComms});
+  for (int iComm = 0; iComm < NumComms; ++iComm) {
+    MPI_Comm_idup(Comms(iComm).Get(), &DuplicatedCommsRaw(iComm), &Requests(iComm));
+  }
+  MPI_Waitall(NumComms, Requests.Data(), MPI_STATUSES_IGNORE);
 #else
-  if (Comm_.Rank() > 0) {
-    MPI_Isend(SendBuffer_, 1, MPI_UNSIGNED_CHAR, 0, 0, Comm_, Requests_);
-    MPI_Issend(SendBuffer_+1, 1, MPI_UNSIGNED_CHAR, 0, 1, Comm_, Requests_+1);
+  for (int iComm = 0; iComm < NumComms; ++iComm) {
+    MPI_Comm_dup(Comms(iComm).Get(), &DuplicatedCommsRaw(iComm));
   }
 #endif
 
+  array<comm> DuplicatedComms;
+  DuplicatedComms.Reserve(NumComms);
+  for (int iComm = 0; iComm < NumComms; ++iComm) {
+    DuplicatedComms.Append(comm(DuplicatedCommsRaw(iComm)));
+  }
+
+  return DuplicatedComms;
+
 }
 
-bool signal::Check() {
+void StartAllreduce(void *Data, int Count, MPI_Datatype DataType, MPI_Op Op, comm_view Comm,
+  MPI_Request &Request) {
+
+#ifdef OVK_HAVE_MPI_IBARRIER
+  MPI_Iallreduce(MPI_IN_PLACE, Data, Count, DataType, Op, Comm, &Request);
+#else
+  MPI_Allreduce(MPI_IN_PLACE, Data, Count, DataType, Op, Comm);
+  Request = MPI_REQUEST_NULL;
+#endif
 
-  bool Done;
+}
 
+// Notes about the tree alternative to Ibarrier:
+// * Ranks are arranged in a binomial tree rooted at rank 0; the parent of rank r is r with its
+//   lowest set bit cleared, and its children are r+1, r+2, r+4, ... up to (but not including)
+//   r plus its lowest set bit (or up to the comm size for the root).
+// * Start posts receives for the "up" messages from the children. Once those have all arrived,
+//   a non-root rank sends an "up" message to its parent and waits for a "down" message in return;
+//   the root instead knows immediately that every rank has started.
+// * The "down" messages are then forwarded to the children, and the signal is done once they have
+//   been sent. Each rank therefore sends and receives O(log P) messages rather than having the
+//   root receive messages from every other rank.
+
+namespace {
+constexpr int SIGNAL_UP_TAG = 0;
+constexpr int SIGNAL_DOWN_TAG = 1;
+}
+
+signal::signal(comm_view Comm):
 #ifdef OVK_HAVE_MPI_IBARRIER
-  int DoneInt;
-  MPI_Test(&Request_, &DoneInt, MPI_STATUS_IGNORE);
-  Done = bool(DoneInt);
+  signal(Comm, signal_algorithm::IBARRIER)
 #else
-  if (Comm_.Rank() > 0) {
-    int DoneInt;
-    MPI_Testall(2, Requests_, &DoneInt, MPI_STATUSES_IGNORE);
-    Done = bool(DoneInt);
-  } else {
-    Done = false;
-    while (NumCompleted_ < Comm_.Size()-1) {
-      int IncomingMessage;
-      MPI_Status Status;
-      MPI_Iprobe(MPI_ANY_SOURCE, 0, Comm_, &IncomingMessage, &Status);
-      if (!IncomingMessage) break;
-      MPI_Recv(RecvBuffer_, 1, MPI_UNSIGNED_CHAR, Status.MPI_SOURCE, 0, Comm_, MPI_STATUS_IGNORE);
-      ++NumCompleted_;
-    }
-    if (NumCompleted_ == Comm_.Size()-1) {
-      int OtherRank;
-      for (OtherRank = 1; OtherRank < Comm_.Size(); ++OtherRank) {
-        MPI_Recv(RecvBuffer_, 1, MPI_UNSIGNED_CHAR, OtherRank, 1, Comm_, MPI_STATUS_IGNORE);
-      }
-      Done = true;
+  signal(Comm, signal_algorithm::TREE)
+#endif
+{}
+
+signal::signal(comm_view Comm, signal_algorithm Algorithm):
+  Comm_(DuplicateComm(Comm)),
+  Algorithm_(Algorithm)
+{
+
+#ifndef OVK_HAVE_MPI_IBARRIER
+  OVK_DEBUG_ASSERT(Algorithm_ != signal_algorithm::IBARRIER, "MPI_Ibarrier is not supported.");
+  Algorithm_ = signal_algorithm::TREE;
+#endif
+
+  if (Algorithm_ == signal_algorithm::TREE) {
+    int Rank = Comm_.Rank();
+    int Size = Comm_.Size();
+    int LowestBit = Rank > 0 ? Rank & -Rank : Size;
+    if (Rank > 0) ParentRank_ = Rank - LowestBit;
+    for (int Offset = 1; Offset < LowestBit && Rank+Offset < Size; Offset *= 2) {
+      ChildRanks_.Append(Rank+Offset);
     }
+    int NumChildren = ChildRanks_.Count();
+    RecvBuffers_.Resize({NumChildren+1}, 0);
+    ChildRequests_.Resize({NumChildren}, MPI_REQUEST_NULL);
   }
-  if (Done) {
-    Requests_[0] = MPI_REQUEST_NULL;
-    Requests_[1] = MPI_REQUEST_NULL;
-    NumCompleted_ = 0;
+
+}
+
+void signal::Start() {
+
+#ifdef OVK_HAVE_MPI_IBARRIER
+  if (Algorithm_ == signal_algorithm::IBARRIER) {
+    MPI_Ibarrier(Comm_, &Request_);
+    return;
   }
 #endif
 
-  return Done;
+  OVK_DEBUG_ASSERT(TreeStage_ == tree_stage::IDLE, "Signal has already been started.");
+
+  for (int iChild = 0; iChild < ChildRanks_.Count(); ++iChild) {
+    MPI_Irecv(RecvBuffers_.Data()+iChild, 1, MPI_UNSIGNED_CHAR, ChildRanks_(iChild),
+      SIGNAL_UP_TAG, Comm_, ChildRequests_.Data()+iChild);
+  }
+
+  TreeStage_ = tree_stage::WAITING_FOR_CHILDREN;
 
 }
 
-array<int> DynamicHandshake(comm_view Comm_, array_view<const int> Ranks) {
+bool signal::Check() {
 
-  // Duplicate comm to avoid matching with any sends/recvs before and after
-  comm Comm = DuplicateComm(Comm_);
+#ifdef OVK_HAVE_MPI_IBARRIER
+  if (Algorithm_ == signal_algorithm::IBARRIER) {
+    int DoneInt;
+    MPI_Test(&Request_, &DoneInt, MPI_STATUS_IGNORE);
+    return bool(DoneInt);
+  }
+#endif
+
+  return CheckTree_();
 
-  byte SendData = 0;
-  byte RecvData;
+}
 
-  int Rank = Comm.Rank();
+bool signal::CheckTree_() {
 
-  set<int> MatchedRanksSet;
+  int NumChildren = ChildRanks_.Count();
 
-  for (int OtherRank : Ranks) {
-    if (OtherRank == Rank) {
-      MatchedRanksSet.Insert(Rank);
+  if (TreeStage_ == tree_stage::WAITING_FOR_CHILDREN) {
+    int DoneInt;
+    MPI_Testall(NumChildren, ChildRequests_.Data(), &DoneInt, MPI_STATUSES_IGNORE);
+    if (!DoneInt) return false;
+    if (ParentRank_ >= 0) {
+      MPI_Isend(SendBuffer_, 1, MPI_UNSIGNED_CHAR, ParentRank_, SIGNAL_UP_TAG, Comm_,
+        ParentRequests_);
+      MPI_Irecv(RecvBuffers_.Data()+NumChildren, 1, MPI_UNSIGNED_CHAR, ParentRank_,
+        SIGNAL_DOWN_TAG, Comm_, ParentRequests_+1);
+      TreeStage_ = tree_stage::WAITING_FOR_PARENT;
+    } else {
+      SendToChildren_();
     }
   }
 
-  array<MPI_Request> SendRequests;
-  SendRequests.Reserve(Ranks.Count());
-  for (int OtherRank : Ranks) {
-    if (OtherRank != Rank) {
-      MPI_Issend(&SendData, 1, MPI_UNSIGNED_CHAR, OtherRank, 0, Comm, &SendRequests.Append());
-    }
+  if (TreeStage_ == tree_stage::WAITING_FOR_PARENT) {
+    int DoneInt;
+    MPI_Testall(2, ParentRequests_, &DoneInt, MPI_STATUSES_IGNORE);
+    if (!DoneInt) return false;
+    SendToChildren_();
   }
 
-  signal AllSendsDoneSignal(Comm);
+  if (TreeStage_ == tree_stage::SENDING_TO_CHILDREN) {
+    int DoneInt;
+    MPI_Testall(NumChildren, ChildRequests_.Data(), &DoneInt, MPI_STATUSES_IGNORE);
+    if (!DoneInt) return false;
+    TreeStage_ = tree_stage::IDLE;
+    return true;
+  }
 
-  array<MPI_Request> RecvRequests;
+  return false;
 
-  bool Done = false;
-  int SendsDone = false;
-  while (!Done) {
-    while (true) {
-      int IncomingMessage;
-      MPI_Status Status;
-      MPI_Iprobe(MPI_ANY_SOURCE, 0, Comm, &IncomingMessage, &Status);
-      if (!IncomingMessage) break;
-      int MatchedRank = Status.MPI_SOURCE;
-      MPI_Irecv(&RecvData, 1, MPI_UNSIGNED_CHAR, MatchedRank, 0, Comm, &RecvRequests.Append());
-      MatchedRanksSet.Insert(MatchedRank);
-    }
-    if (SendsDone) {
-      Done = AllSendsDoneSignal.Check();
-    } else {
-      MPI_Testall(SendRequests.Count(), SendRequests.Data(), &SendsDone, MPI_STATUSES_IGNORE);
-      if (SendsDone) {
-        AllSendsDoneSignal.Start();
-      }
-    }
+}
+
+void signal::SendToChildren_() {
+
+  for (int iChild = 0; iChild < ChildRanks_.Count(); ++iChild) {
+    MPI_Isend(SendBuffer_, 1, MPI_UNSIGNED_CHAR, ChildRanks_(iChild), SIGNAL_DOWN_TAG, Comm_,
+      ChildRequests_.Data()+iChild);
+  }
+
+  TreeStage_ = tree_stage::SENDING_TO_CHILDREN;
+
+}
+
+array<int> DynamicHandshake(comm_view Comm, array_view<const int> Ranks) {
+
+  map<int,array<byte>> SendData;
+  for (int Rank : Ranks) {
+    SendData.Insert(Rank);
   }
 
-  MPI_Waitall(RecvRequests.Count(), RecvRequests.Data(), MPI_STATUSES_IGNORE);
+  map<int,array<byte>> RecvData = SparseExchange(Comm, SendData);
 
-  return {MatchedRanksSet};
+  return {RecvData.Keys()};
 
 }
 
@@ -7,14 +7,19 @@
 #include <ovk/core/Array.hpp>
 #include <ovk/core/ArrayView.hpp>
 #include <ovk/core/Comm.hpp>
+#include <ovk/core/DataTypeOps.hpp>
+#include <ovk/core/Debug.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/Map.hpp>
 #include <ovk/core/Requires.hpp>
 #include <ovk/core/ScopeGuard.hpp>
 #include <ovk/core/TypeTraits.hpp>
 
 #include <mpi.h>
 
+#include <limits>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 namespace ovk {
@@ -27,35 +32,111 @@ void BroadcastAnySource(void *Data, int Count, MPI_Datatype DataType, bool IsSou
   Comm);
 void BroadcastStringAnySource(std::string &String, bool IsSource, comm_view Comm);
 
-// Wrapper around MPI_Ibarrier (or crappy alternative if MPI_Ibarrier is not supported) 
-// representing a global flag that gets set only after all processes call a function
-// (StartSignal) to set it
+// Batched version of BroadcastStringAnySource; each string is sent by the one rank that has
+// IsSource set for it, using a fixed number of collectives regardless of the number of strings
+void BroadcastStringsAnySource(array_view<std::string> Strings, array_view<const bool> IsSource,
+  comm_view Comm);
+
+// Duplicates several (possibly overlapping) communicators together; if non-blocking collectives are
+// supported, the duplications are all started at once with MPI_Comm_idup instead of waiting on each
+// one in turn. Communicators shared between ranks must appear in the same relative order on each
+array<comm> DuplicateComms(array_view<const comm_view> Comms);
+
+// In-place MPI_Iallreduce; if non-blocking collectives are not supported, this does the blocking
+// operation instead and sets Request to MPI_REQUEST_NULL
+void StartAllreduce(void *Data, int Count, MPI_Datatype DataType, MPI_Op Op, comm_view Comm,
+  MPI_Request &Request);
+
+// Algorithms for implementing signal; IBARRIER is only available if MPI_Ibarrier is supported
+enum class signal_algorithm {
+  IBARRIER,
+  TREE
+};
+
+// Wrapper around MPI_Ibarrier (or a binomial tree of point-to-point messages if MPI_Ibarrier is
+// not supported) representing a global flag that gets set only after all processes call a
+// function (Start) to set it. Can be reused after Check returns true
 class signal {
 
 public:
 
   signal(comm_view Comm);
+  signal(comm_view Comm, signal_algorithm Algorithm);
 
   void Start();
   bool Check();
 
 private:
 
+  enum class tree_stage {
+    IDLE,
+    WAITING_FOR_CHILDREN,
+    WAITING_FOR_PARENT,
+    SENDING_TO_CHILDREN
+  };
+
   comm Comm_;
+  signal_algorithm Algorithm_;
 #ifdef OVK_HAVE_MPI_IBARRIER
   MPI_Request Request_ = MPI_REQUEST_NULL;
-#else
-  byte SendBuffer_[2] = {0, 0};
-  byte RecvBuffer_[1] = {0};
-  MPI_Request Requests_[2] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
-  int NumCompleted_ = 0;
 #endif
+  int ParentRank_ = -1;
+  array<int> ChildRanks_;
+  tree_stage TreeStage_ = tree_stage::IDLE;
+  byte SendBuffer_[1] = {0};
+  array<byte> RecvBuffers_;
+  array<MPI_Request> ChildRequests_;
+  MPI_Request ParentRequests_[2] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+
+  bool CheckTree_();
+  void SendToChildren_();
 
 };
 
 // Given known list of ranks on one end of communication, generate list of ranks on other end
 array<int> DynamicHandshake(comm_view Comm, array_view<const int> Ranks);
 
+// Sends a variable-sized array of records to each of an arbitrary set of ranks in a single round,
+// without the receivers needing to know in advance who will send to them or how much. Uses
+// synchronous sends completed by a signal (the NBX algorithm). Returns the received arrays keyed
+// by source rank; a rank that sent an empty array still gets an entry
+template <typename T> map<int,array<T>> SparseExchange(comm_view Comm, const map<int,array<T>>
+  &SendData);
+
+// Coalesces small fixed-size records bound for the same rank so that an exchange sends at most
+// one message to each peer. Receivers only need to know which ranks send to them, not how many
+// records they send (counts are obtained by probing). Each destination added on the sending side
+// must be added as a source on the receiving side and vice versa, even if no records are sent.
+// Messages are sent on the given comm and tag, which should not be used by any other messages that
+// could be in flight at the same time; Exchange is meant to be called once per aggregator.
+template <typename T> class message_aggregator {
+
+public:
+
+  static_assert(std::is_trivially_copyable<T>::value, "Aggregated record type must be trivially "
+    "copyable.");
+
+  message_aggregator(comm_view Comm, int Tag);
+
+  void AddDestination(int Rank);
+  void AddSource(int Rank);
+
+  T &Append(int Rank);
+  void Append(int Rank, const T &Record);
+
+  void Exchange();
+
+  array_view<const T> Received(int Rank) const;
+
+private:
+
+  comm_view Comm_;
+  int Tag_;
+  map<int,array<T>> SendRecords_;
+  map<int,array<T>> RecvRecords_;
+
+};
+
 // Run a section of code sequentially over each rank
 template <typename F, OVK_FUNCDECL_REQUIRES(IsCallableWith<F &&>())> auto Serialize(comm_view Comm,
   F &&Func) -> decltype(std::forward<F>(Func)());
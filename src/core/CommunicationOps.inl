@@ -21,4 +21,133 @@ template <typename F, OVK_FUNCDEF_REQUIRES(IsCallableWith<F &&>())> auto Seriali
 
 }
 
+template <typename T> map<int,array<T>> SparseExchange(comm_view Comm_, const map<int,array<T>>
+  &SendData) {
+
+  static_assert(std::is_trivially_copyable<T>::value, "Exchanged record type must be trivially "
+    "copyable.");
+
+  // Duplicate comm to avoid matching with any sends/recvs before and after
+  comm Comm = DuplicateComm(Comm_);
+
+  // Counting in records rather than bytes keeps large payloads within int range
+  auto RecordMPIType = CreateMPIContiguousType(int(sizeof(T)), MPI_BYTE);
+  MPI_Type_commit(&RecordMPIType.Get());
+
+  array<MPI_Request> SendRequests;
+  SendRequests.Reserve(SendData.Count());
+  for (auto &Entry : SendData) {
+    int Rank = Entry.Key();
+    const array<T> &Values = Entry.Value();
+    OVK_DEBUG_ASSERT(Values.Count() <= std::numeric_limits<int>::max(), "Send count too large.");
+    MPI_Issend(Values.Data(), int(Values.Count()), RecordMPIType, Rank, 0, Comm,
+      &SendRequests.Append());
+  }
+
+  signal AllSendsDoneSignal(Comm);
+
+  map<int,array<T>> RecvData;
+
+  bool Done = false;
+  int SendsDone = false;
+  while (!Done) {
+    while (true) {
+      int IncomingMessage;
+      MPI_Status Status;
+      MPI_Iprobe(MPI_ANY_SOURCE, 0, Comm, &IncomingMessage, &Status);
+      if (!IncomingMessage) break;
+      int Rank = Status.MPI_SOURCE;
+      int NumValues;
+      MPI_Get_count(&Status, RecordMPIType, &NumValues);
+      array<T> &Values = RecvData.Insert(Rank);
+      Values.Resize({NumValues});
+      MPI_Recv(Values.Data(), NumValues, RecordMPIType, Rank, 0, Comm, MPI_STATUS_IGNORE);
+    }
+    if (SendsDone) {
+      Done = AllSendsDoneSignal.Check();
+    } else {
+      MPI_Testall(SendRequests.Count(), SendRequests.Data(), &SendsDone, MPI_STATUSES_IGNORE);
+      if (SendsDone) {
+        AllSendsDoneSignal.Start();
+      }
+    }
+  }
+
+  return RecvData;
+
+}
+
+template <typename T> message_aggregator<T>::message_aggregator(comm_view Comm, int Tag):
+  Comm_(Comm),
+  Tag_(Tag)
+{}
+
+template <typename T> void message_aggregator<T>::AddDestination(int Rank) {
+
+  SendRecords_.Fetch(Rank);
+
+}
+
+template <typename T> void message_aggregator<T>::AddSource(int Rank) {
+
+  RecvRecords_.Fetch(Rank);
+
+}
+
+template <typename T> T &message_aggregator<T>::Append(int Rank) {
+
+  return SendRecords_.Fetch(Rank).Append();
+
+}
+
+template <typename T> void message_aggregator<T>::Append(int Rank, const T &Record) {
+
+  SendRecords_.Fetch(Rank).Append(Record);
+
+}
+
+template <typename T> void message_aggregator<T>::Exchange() {
+
+  // Counting in records rather than bytes keeps large payloads within int range
+  auto RecordMPIType = CreateMPIContiguousType(int(sizeof(T)), MPI_BYTE);
+  MPI_Type_commit(&RecordMPIType.Get());
+
+  array<MPI_Request> Requests;
+  Requests.Reserve(SendRecords_.Count() + RecvRecords_.Count());
+
+  for (auto &Entry : SendRecords_) {
+    int Rank = Entry.Key();
+    array<T> &Records = Entry.Value();
+    OVK_DEBUG_ASSERT(Records.Count() <= std::numeric_limits<int>::max(), "Send count too large.");
+    MPI_Isend(Records.Data(), int(Records.Count()), RecordMPIType, Rank, Tag_, Comm_,
+      &Requests.Append());
+  }
+
+  // Receive in whatever order messages arrive instead of waiting on each source in turn
+  for (int iRecv = 0; iRecv < RecvRecords_.Count(); ++iRecv) {
+    MPI_Message Message;
+    MPI_Status Status;
+    MPI_Mprobe(MPI_ANY_SOURCE, Tag_, Comm_, &Message, &Status);
+    int Rank = Status.MPI_SOURCE;
+    OVK_DEBUG_ASSERT(RecvRecords_.Contains(Rank), "Received records from unexpected rank %i.",
+      Rank);
+    array<T> &Records = RecvRecords_(Rank);
+    int NumRecords;
+    MPI_Get_count(&Status, RecordMPIType, &NumRecords);
+    Records.Resize({NumRecords});
+    MPI_Imrecv(Records.Data(), NumRecords, RecordMPIType, &Message, &Requests.Append());
+  }
+
+  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
+
+  SendRecords_.Clear();
+
+}
+
+template <typename T> array_view<const T> message_aggregator<T>::Received(int Rank) const {
+
+  return RecvRecords_(Rank);
+
+}
+
 }}
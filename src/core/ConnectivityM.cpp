@@ -8,11 +8,16 @@
 #include "ovk/core/Context.hpp"
 #include "ovk/core/Debug.hpp"
 #include "ovk/core/Editor.hpp"
+#include "ovk/core/Elem.hpp"
 #include "ovk/core/Event.hpp"
 #include "ovk/core/FloatingRef.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Grid.hpp"
+#include "ovk/core/Indexer.hpp"
 #include "ovk/core/Logger.hpp"
+#include "ovk/core/Math.hpp"
+#include "ovk/core/Range.hpp"
+#include "ovk/core/Tuple.hpp"
 
 #include <mpi.h>
 
@@ -52,6 +57,10 @@ connectivity_m::connectivity_m(std::shared_ptr<context> &&Context, const grid &G
   NumDims_(Grid_->Dimension()),
   NumDonors_(0),
   MaxStencilSize_(1),
+  Compact_(false),
+  InterpCoefsStorage_(interp_coefs_storage::DOUBLE),
+  GlobalIndexer_(Grid_->GlobalRange()),
+  DestinationGlobalIndexer_(DestinationGridInfo_.GlobalRange()),
   Extents_({{2,MAX_DIMS,0}}),
   Coords_({{MAX_DIMS,0}}),
   InterpCoefs_({{MAX_DIMS,0,0}}),
@@ -113,6 +122,14 @@ void connectivity_m::Resize(long long NumDonors, int MaxStencilSize) {
   NumDonors_ = NumDonors;
   MaxStencilSize_ = MaxStencilSize;
 
+  Compact_ = false;
+  InterpCoefsStorage_ = interp_coefs_storage::DOUBLE;
+
+  // Assign instead of clearing so the memory is released
+  LowerCorners_ = array<long long>();
+  FloatInterpCoefs_ = array<float,3>();
+  DestinationIndices_ = array<long long>();
+
   Extents_.Resize({{2,MAX_DIMS,NumDonors}});
   Coords_.Resize({{MAX_DIMS,NumDonors}});
   InterpCoefs_.Resize({{MAX_DIMS,MaxStencilSize,NumDonors}});
@@ -164,6 +181,115 @@ void connectivity_m::Resize(long long NumDonors, int MaxStencilSize) {
 
 }
 
+void connectivity_m::ResizeCompact(long long NumDonors, int StencilSize, interp_coefs_storage
+  InterpCoefsStorage) {
+
+  OVK_DEBUG_ASSERT(NumDonors >= 0, "Invalid num donors value.");
+  OVK_DEBUG_ASSERT(StencilSize > 0, "Invalid stencil size.");
+  OVK_DEBUG_ASSERT(InterpCoefsStorage != interp_coefs_storage::LAGRANGE || StencilSize == 1 ||
+    StencilSize == 2 || StencilSize == 4, "Lagrange interpolation coefficients require a stencil "
+    "size of 1, 2, or 4.");
+
+  MPI_Barrier(Comm_);
+
+  OVK_DEBUG_ASSERT(!ExtentsEditor_.Active(), "Cannot resize while editing extents.");
+  OVK_DEBUG_ASSERT(!CoordsEditor_.Active(), "Cannot resize while editing coords.");
+  OVK_DEBUG_ASSERT(!InterpCoefsEditor_.Active(), "Cannot resize while editing interp coefs.");
+  OVK_DEBUG_ASSERT(!DestinationsEditor_.Active(), "Cannot resize while editing destinations.");
+  OVK_DEBUG_ASSERT(!DestinationRanksEditor_.Active(), "Cannot resize while editing destination "
+    "ranks.");
+
+  NumDonors_ = NumDonors;
+  MaxStencilSize_ = StencilSize;
+
+  Compact_ = true;
+  InterpCoefsStorage_ = InterpCoefsStorage;
+
+  // Assign instead of clearing so the memory is released
+  Extents_ = array<int,3>({{2,MAX_DIMS,0}});
+  Destinations_ = array<int,2>({{MAX_DIMS,0}});
+
+  switch (InterpCoefsStorage_) {
+  case interp_coefs_storage::DOUBLE:
+    InterpCoefs_.Resize({{MAX_DIMS,StencilSize,NumDonors}});
+    FloatInterpCoefs_ = array<float,3>();
+    break;
+  case interp_coefs_storage::FLOAT:
+    InterpCoefs_ = array<double,3>({{MAX_DIMS,0,0}});
+    FloatInterpCoefs_.Resize({{MAX_DIMS,StencilSize,NumDonors}});
+    break;
+  case interp_coefs_storage::LAGRANGE:
+    InterpCoefs_ = array<double,3>({{MAX_DIMS,0,0}});
+    FloatInterpCoefs_ = array<float,3>();
+    break;
+  }
+
+  LowerCorners_.Resize({NumDonors}, -1);
+  Coords_.Resize({{MAX_DIMS,NumDonors}});
+  DestinationIndices_.Resize({NumDonors}, -1);
+  DestinationRanks_.Resize({NumDonors});
+
+  for (long long iCell = 0; iCell < NumDonors_; ++iCell) {
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Coords_(iDim,iCell) = 0.;
+    }
+    DestinationRanks_(iCell) = -1;
+  }
+
+  if (InterpCoefsStorage_ == interp_coefs_storage::DOUBLE) {
+    for (long long iCell = 0; iCell < NumDonors_; ++iCell) {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        InterpCoefs_(iDim,0,iCell) = iDim < NumDims_ ? 0. : 1.;
+        for (int iPoint = 1; iPoint < StencilSize; ++iPoint) {
+          InterpCoefs_(iDim,iPoint,iCell) = 0.;
+        }
+      }
+    }
+  } else if (InterpCoefsStorage_ == interp_coefs_storage::FLOAT) {
+    for (long long iCell = 0; iCell < NumDonors_; ++iCell) {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        FloatInterpCoefs_(iDim,0,iCell) = iDim < NumDims_ ? 0.f : 1.f;
+        for (int iPoint = 1; iPoint < StencilSize; ++iPoint) {
+          FloatInterpCoefs_(iDim,iPoint,iCell) = 0.f;
+        }
+      }
+    }
+  }
+
+  MPI_Barrier(Comm_);
+
+  ResizeEvent_.Trigger();
+  ExtentsEvent_.Trigger();
+  CoordsEvent_.Trigger();
+  InterpCoefsEvent_.Trigger();
+  DestinationsEvent_.Trigger();
+  DestinationRanksEvent_.Trigger();
+
+  MPI_Barrier(Comm_);
+
+}
+
+double connectivity_m::DonorInterpCoef(int iDim, int iPoint, long long iDonor) const {
+
+  switch (InterpCoefsStorage_) {
+  case interp_coefs_storage::DOUBLE:
+    return InterpCoefs_(iDim,iPoint,iDonor);
+  case interp_coefs_storage::FLOAT:
+    return double(FloatInterpCoefs_(iDim,iPoint,iDonor));
+  case interp_coefs_storage::LAGRANGE:
+    if (iDim < NumDims_) {
+      elem<double,4> Coefs;
+      core::LagrangeInterpCoefs(MaxStencilSize_, Coords_(iDim,iDonor), Coefs.Data());
+      return Coefs(iPoint);
+    } else {
+      return iPoint == 0 ? 1. : 0.;
+    }
+  }
+
+  return 0.;
+
+}
+
 bool connectivity_m::EditingExtents() const {
 
   return ExtentsEditor_.Active();
@@ -172,6 +298,9 @@ bool connectivity_m::EditingExtents() const {
 
 edit_handle<array<int,3>> connectivity_m::EditExtents() {
 
+  OVK_DEBUG_ASSERT(!Compact_, "Extents are not stored for compact connectivity; edit lower corners "
+    "instead.");
+
   if (!ExtentsEditor_.Active()) {
     MPI_Barrier(Comm_);
     floating_ref<connectivity_m> FloatingRef = FloatingRefGenerator_.Generate(*this);
@@ -197,6 +326,41 @@ void connectivity_m::RestoreExtents() {
 
 }
 
+bool connectivity_m::EditingLowerCorners() const {
+
+  return ExtentsEditor_.Active();
+
+}
+
+edit_handle<array<long long>> connectivity_m::EditLowerCorners() {
+
+  OVK_DEBUG_ASSERT(Compact_, "Lower corners are only stored for compact connectivity.");
+
+  if (!ExtentsEditor_.Active()) {
+    MPI_Barrier(Comm_);
+    floating_ref<connectivity_m> FloatingRef = FloatingRefGenerator_.Generate(*this);
+    auto DeactivateFunc = [FloatingRef] {
+      connectivity_m &ConnectivityM = *FloatingRef;
+      MPI_Barrier(ConnectivityM.Comm_);
+      ConnectivityM.ExtentsEvent_.Trigger();
+      MPI_Barrier(ConnectivityM.Comm_);
+    };
+    ExtentsEditor_.Activate(std::move(DeactivateFunc));
+  }
+
+  return ExtentsEditor_.Edit(LowerCorners_);
+
+}
+
+void connectivity_m::RestoreLowerCorners() {
+
+  OVK_DEBUG_ASSERT(ExtentsEditor_.Active(), "Unable to restore lower corners; not currently being "
+    "edited.");
+
+  ExtentsEditor_.Restore();
+
+}
+
 bool connectivity_m::EditingCoords() const {
 
   return CoordsEditor_.Active();
@@ -237,6 +401,9 @@ bool connectivity_m::EditingInterpCoefs() const {
 
 edit_handle<array<double,3>> connectivity_m::EditInterpCoefs() {
 
+  OVK_DEBUG_ASSERT(InterpCoefsStorage_ == interp_coefs_storage::DOUBLE, "Interp coefs are not "
+    "stored in double precision.");
+
   if (!InterpCoefsEditor_.Active()) {
     MPI_Barrier(Comm_);
     floating_ref<connectivity_m> FloatingRef = FloatingRefGenerator_.Generate(*this);
@@ -262,6 +429,42 @@ void connectivity_m::RestoreInterpCoefs() {
 
 }
 
+bool connectivity_m::EditingFloatInterpCoefs() const {
+
+  return InterpCoefsEditor_.Active();
+
+}
+
+edit_handle<array<float,3>> connectivity_m::EditFloatInterpCoefs() {
+
+  OVK_DEBUG_ASSERT(InterpCoefsStorage_ == interp_coefs_storage::FLOAT, "Interp coefs are not "
+    "stored in single precision.");
+
+  if (!InterpCoefsEditor_.Active()) {
+    MPI_Barrier(Comm_);
+    floating_ref<connectivity_m> FloatingRef = FloatingRefGenerator_.Generate(*this);
+    auto DeactivateFunc = [FloatingRef] {
+      connectivity_m &ConnectivityM = *FloatingRef;
+      MPI_Barrier(ConnectivityM.Comm_);
+      ConnectivityM.InterpCoefsEvent_.Trigger();
+      MPI_Barrier(ConnectivityM.Comm_);
+    };
+    InterpCoefsEditor_.Activate(std::move(DeactivateFunc));
+  }
+
+  return InterpCoefsEditor_.Edit(FloatInterpCoefs_);
+
+}
+
+void connectivity_m::RestoreFloatInterpCoefs() {
+
+  OVK_DEBUG_ASSERT(InterpCoefsEditor_.Active(), "Unable to restore float interp coefs; not "
+    "currently being edited.");
+
+  InterpCoefsEditor_.Restore();
+
+}
+
 bool connectivity_m::EditingDestinations() const {
 
   return DestinationsEditor_.Active();
@@ -270,6 +473,9 @@ bool connectivity_m::EditingDestinations() const {
 
 edit_handle<array<int,2>> connectivity_m::EditDestinations() {
 
+  OVK_DEBUG_ASSERT(!Compact_, "Destinations are not stored for compact connectivity; edit "
+    "destination indices instead.");
+
   if (!DestinationsEditor_.Active()) {
     MPI_Barrier(Comm_);
     floating_ref<connectivity_m> FloatingRef = FloatingRefGenerator_.Generate(*this);
@@ -295,6 +501,41 @@ void connectivity_m::RestoreDestinations() {
 
 }
 
+bool connectivity_m::EditingDestinationIndices() const {
+
+  return DestinationsEditor_.Active();
+
+}
+
+edit_handle<array<long long>> connectivity_m::EditDestinationIndices() {
+
+  OVK_DEBUG_ASSERT(Compact_, "Destination indices are only stored for compact connectivity.");
+
+  if (!DestinationsEditor_.Active()) {
+    MPI_Barrier(Comm_);
+    floating_ref<connectivity_m> FloatingRef = FloatingRefGenerator_.Generate(*this);
+    auto DeactivateFunc = [FloatingRef] {
+      connectivity_m &ConnectivityM = *FloatingRef;
+      MPI_Barrier(ConnectivityM.Comm_);
+      ConnectivityM.DestinationsEvent_.Trigger();
+      MPI_Barrier(ConnectivityM.Comm_);
+    };
+    DestinationsEditor_.Activate(std::move(DeactivateFunc));
+  }
+
+  return DestinationsEditor_.Edit(DestinationIndices_);
+
+}
+
+void connectivity_m::RestoreDestinationIndices() {
+
+  OVK_DEBUG_ASSERT(DestinationsEditor_.Active(), "Unable to restore destination indices; not "
+    "currently being edited.");
+
+  DestinationsEditor_.Restore();
+
+}
+
 bool connectivity_m::EditingDestinationRanks() const {
 
   return DestinationRanksEditor_.Active();
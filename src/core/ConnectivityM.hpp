@@ -12,7 +12,10 @@
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
 #include <ovk/core/Grid.hpp>
+#include <ovk/core/Indexer.hpp>
+#include <ovk/core/Range.hpp>
 #include <ovk/core/Requires.hpp>
+#include <ovk/core/Tuple.hpp>
 #include <ovk/core/TypeTraits.hpp>
 
 #include <mpi.h>
@@ -22,6 +25,13 @@
 
 namespace ovk {
 
+enum class interp_coefs_storage {
+  DOUBLE,
+  FLOAT,
+  // Not stored; computed from the donor coords as Lagrange coefficients
+  LAGRANGE
+};
+
 namespace connectivity_m_internal {
 
 // For doing stuff before creation and after destruction
@@ -85,11 +95,62 @@ public:
   int MaxStencilSize() const { return MaxStencilSize_; }
 
   void Resize(long long NumDonors, int MaxStencilSize);
+  // Compact storage for large numbers of donors: all stencils are StencilSize points wide in each
+  // dimension, donor extents and destinations are stored as linear indices (LowerCorners and
+  // DestinationIndices replace Extents and Destinations), and interpolation coefficients can be
+  // stored in single precision (FloatInterpCoefs) or not at all
+  void ResizeCompact(long long NumDonors, int StencilSize, interp_coefs_storage InterpCoefsStorage=
+    interp_coefs_storage::FLOAT);
   template <typename F, OVK_FUNCTION_REQUIRES(core::IsCallableWith<F>())> event_listener_handle
     AddResizeEventListener(F Listener) const {
     return ResizeEvent_.AddListener(std::move(Listener));
   }
 
+  bool Compact() const { return Compact_; }
+  interp_coefs_storage InterpCoefsStorage() const { return InterpCoefsStorage_; }
+
+  // Per-donor access for either storage
+  range DonorExtents(long long iDonor) const {
+    range Range;
+    if (Compact_) {
+      tuple<int> LowerCorner = GlobalIndexer_.ToTuple(LowerCorners_(iDonor));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Range.Begin(iDim) = LowerCorner(iDim);
+        Range.End(iDim) = LowerCorner(iDim) + (iDim < NumDims_ ? MaxStencilSize_ : 1);
+      }
+    } else {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Range.Begin(iDim) = Extents_(0,iDim,iDonor);
+        Range.End(iDim) = Extents_(1,iDim,iDonor);
+      }
+    }
+    return Range;
+  }
+  tuple<int> DonorLowerCorner(long long iDonor) const {
+    if (Compact_) {
+      return GlobalIndexer_.ToTuple(LowerCorners_(iDonor));
+    } else {
+      return {Extents_(0,0,iDonor), Extents_(0,1,iDonor), Extents_(0,2,iDonor)};
+    }
+  }
+  double DonorInterpCoef(int iDim, int iPoint, long long iDonor) const;
+  tuple<int> Destination(long long iDonor) const {
+    if (Compact_) {
+      return DestinationGlobalIndexer_.ToTuple(DestinationIndices_(iDonor));
+    } else {
+      return {Destinations_(0,iDonor), Destinations_(1,iDonor), Destinations_(2,iDonor)};
+    }
+  }
+  // Linear index of the destination point in the destination grid's global range
+  long long DestinationIndex(long long iDonor) const {
+    if (Compact_) {
+      return DestinationIndices_(iDonor);
+    } else {
+      return DestinationGlobalIndexer_.ToIndex(Destinations_(0,iDonor), Destinations_(1,iDonor),
+        Destinations_(2,iDonor));
+    }
+  }
+
   const array<int,3> &Extents() const { return Extents_; }
   bool EditingExtents() const;
   edit_handle<array<int,3>> EditExtents();
@@ -99,6 +160,13 @@ public:
     return ExtentsEvent_.AddListener(std::move(Listener));
   }
 
+  // Compact storage only; linear index of each donor's lower corner in the grid's global range
+  // (edits trigger extents events)
+  const array<long long> &LowerCorners() const { return LowerCorners_; }
+  bool EditingLowerCorners() const;
+  edit_handle<array<long long>> EditLowerCorners();
+  void RestoreLowerCorners();
+
   const array<double,2> &Coords() const { return Coords_; }
   bool EditingCoords() const;
   edit_handle<array<double,2>> EditCoords();
@@ -117,6 +185,12 @@ public:
     return InterpCoefsEvent_.AddListener(std::move(Listener));
   }
 
+  // Compact storage with interp_coefs_storage::FLOAT only (edits trigger interp coefs events)
+  const array<float,3> &FloatInterpCoefs() const { return FloatInterpCoefs_; }
+  bool EditingFloatInterpCoefs() const;
+  edit_handle<array<float,3>> EditFloatInterpCoefs();
+  void RestoreFloatInterpCoefs();
+
   const array<int,2> &Destinations() const { return Destinations_; }
   bool EditingDestinations() const;
   edit_handle<array<int,2>> EditDestinations();
@@ -126,6 +200,13 @@ public:
     return DestinationsEvent_.AddListener(std::move(Listener));
   }
 
+  // Compact storage only; linear index of each destination point in the destination grid's global
+  // range (edits trigger destinations events)
+  const array<long long> &DestinationIndices() const { return DestinationIndices_; }
+  bool EditingDestinationIndices() const;
+  edit_handle<array<long long>> EditDestinationIndices();
+  void RestoreDestinationIndices();
+
   const array<int> &DestinationRanks() const { return DestinationRanks_; }
   bool EditingDestinationRanks() const;
   edit_handle<array<int>> EditDestinationRanks();
@@ -148,7 +229,13 @@ private:
   int MaxStencilSize_;
   mutable event<void()> ResizeEvent_;
 
+  bool Compact_;
+  interp_coefs_storage InterpCoefsStorage_;
+  range_indexer_c<long long> GlobalIndexer_;
+  range_indexer_c<long long> DestinationGlobalIndexer_;
+
   array<int,3> Extents_;
+  array<long long> LowerCorners_;
   editor ExtentsEditor_;
   mutable event<void()> ExtentsEvent_;
 
@@ -157,10 +244,12 @@ private:
   mutable event<void()> CoordsEvent_;
 
   array<double,3> InterpCoefs_;
+  array<float,3> FloatInterpCoefs_;
   editor InterpCoefsEditor_;
   mutable event<void()> InterpCoefsEvent_;
 
   array<int,2> Destinations_;
+  array<long long> DestinationIndices_;
   editor DestinationsEditor_;
   mutable event<void()> DestinationsEvent_;
 
@@ -12,7 +12,10 @@
 #include "ovk/core/FloatingRef.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Grid.hpp"
+#include "ovk/core/Indexer.hpp"
 #include "ovk/core/Logger.hpp"
+#include "ovk/core/Range.hpp"
+#include "ovk/core/Tuple.hpp"
 
 #include <mpi.h>
 
@@ -51,6 +54,9 @@ connectivity_n::connectivity_n(std::shared_ptr<context> &&Context, const grid &G
   connectivity_n_base(std::move(Context), Grid, std::move(SourceGridInfo)),
   NumDims_(Grid_->Dimension()),
   NumReceivers_(0),
+  Compact_(false),
+  GlobalIndexer_(Grid_->GlobalRange()),
+  SourceGlobalIndexer_(SourceGridInfo_.GlobalRange()),
   Points_({{MAX_DIMS,0}}),
   Sources_({{MAX_DIMS,0}}),
   SourceRanks_({0})
@@ -105,6 +111,12 @@ void connectivity_n::Resize(long long NumReceivers) {
 
   NumReceivers_ = NumReceivers;
 
+  Compact_ = false;
+
+  // Assign instead of clearing so the memory is released
+  PointIndices_ = array<long long>();
+  SourceIndices_ = array<long long>();
+
   Points_.Resize({{MAX_DIMS,NumReceivers}});
   Sources_.Resize({{MAX_DIMS,NumReceivers}});
   SourceRanks_.Resize({NumReceivers});
@@ -136,6 +148,39 @@ void connectivity_n::Resize(long long NumReceivers) {
 
 }
 
+void connectivity_n::ResizeCompact(long long NumReceivers) {
+
+  OVK_DEBUG_ASSERT(NumReceivers >= 0, "Invalid num receivers value.");
+
+  MPI_Barrier(Comm_);
+
+  OVK_DEBUG_ASSERT(!PointsEditor_.Active(), "Cannot resize while editing points.");
+  OVK_DEBUG_ASSERT(!SourcesEditor_.Active(), "Cannot resize while editing sources.");
+  OVK_DEBUG_ASSERT(!SourceRanksEditor_.Active(), "Cannot resize while editing source ranks.");
+
+  NumReceivers_ = NumReceivers;
+
+  Compact_ = true;
+
+  // Assign instead of clearing so the memory is released
+  Points_ = array<int,2>({{MAX_DIMS,0}});
+  Sources_ = array<int,2>({{MAX_DIMS,0}});
+
+  PointIndices_.Resize({NumReceivers}, -1);
+  SourceIndices_.Resize({NumReceivers}, -1);
+  SourceRanks_.Resize({NumReceivers}, -1);
+
+  MPI_Barrier(Comm_);
+
+  ResizeEvent_.Trigger();
+  PointsEvent_.Trigger();
+  SourcesEvent_.Trigger();
+  SourceRanksEvent_.Trigger();
+
+  MPI_Barrier(Comm_);
+
+}
+
 bool connectivity_n::EditingPoints() const {
 
   return PointsEditor_.Active();
@@ -144,6 +189,9 @@ bool connectivity_n::EditingPoints() const {
 
 edit_handle<array<int,2>> connectivity_n::EditPoints() {
 
+  OVK_DEBUG_ASSERT(!Compact_, "Points are not stored for compact connectivity; edit point indices "
+    "instead.");
+
   if (!PointsEditor_.Active()) {
     MPI_Barrier(Comm_);
     floating_ref<connectivity_n> FloatingRef = FloatingRefGenerator_.Generate(*this);
@@ -168,6 +216,41 @@ void connectivity_n::RestorePoints() {
 
 }
 
+bool connectivity_n::EditingPointIndices() const {
+
+  return PointsEditor_.Active();
+
+}
+
+edit_handle<array<long long>> connectivity_n::EditPointIndices() {
+
+  OVK_DEBUG_ASSERT(Compact_, "Point indices are only stored for compact connectivity.");
+
+  if (!PointsEditor_.Active()) {
+    MPI_Barrier(Comm_);
+    floating_ref<connectivity_n> FloatingRef = FloatingRefGenerator_.Generate(*this);
+    auto DeactivateFunc = [FloatingRef] {
+      connectivity_n &ConnectivityN = *FloatingRef;
+      MPI_Barrier(ConnectivityN.Comm_);
+      ConnectivityN.PointsEvent_.Trigger();
+      MPI_Barrier(ConnectivityN.Comm_);
+    };
+    PointsEditor_.Activate(std::move(DeactivateFunc));
+  }
+
+  return PointsEditor_.Edit(PointIndices_);
+
+}
+
+void connectivity_n::RestorePointIndices() {
+
+  OVK_DEBUG_ASSERT(PointsEditor_.Active(), "Unable to restore point indices; not currently being "
+    "edited.");
+
+  PointsEditor_.Restore();
+
+}
+
 bool connectivity_n::EditingSources() const {
 
   return SourcesEditor_.Active();
@@ -176,6 +259,9 @@ bool connectivity_n::EditingSources() const {
 
 edit_handle<array<int,2>> connectivity_n::EditSources() {
 
+  OVK_DEBUG_ASSERT(!Compact_, "Sources are not stored for compact connectivity; edit source "
+    "indices instead.");
+
   if (!SourcesEditor_.Active()) {
     MPI_Barrier(Comm_);
     floating_ref<connectivity_n> FloatingRef = FloatingRefGenerator_.Generate(*this);
@@ -201,6 +287,41 @@ void connectivity_n::RestoreSources() {
 
 }
 
+bool connectivity_n::EditingSourceIndices() const {
+
+  return SourcesEditor_.Active();
+
+}
+
+edit_handle<array<long long>> connectivity_n::EditSourceIndices() {
+
+  OVK_DEBUG_ASSERT(Compact_, "Source indices are only stored for compact connectivity.");
+
+  if (!SourcesEditor_.Active()) {
+    MPI_Barrier(Comm_);
+    floating_ref<connectivity_n> FloatingRef = FloatingRefGenerator_.Generate(*this);
+    auto DeactivateFunc = [FloatingRef] {
+      connectivity_n &ConnectivityN = *FloatingRef;
+      MPI_Barrier(ConnectivityN.Comm_);
+      ConnectivityN.SourcesEvent_.Trigger();
+      MPI_Barrier(ConnectivityN.Comm_);
+    };
+    SourcesEditor_.Activate(std::move(DeactivateFunc));
+  }
+
+  return SourcesEditor_.Edit(SourceIndices_);
+
+}
+
+void connectivity_n::RestoreSourceIndices() {
+
+  OVK_DEBUG_ASSERT(SourcesEditor_.Active(), "Unable to restore source indices; not currently "
+    "being edited.");
+
+  SourcesEditor_.Restore();
+
+}
+
 bool connectivity_n::EditingSourceRanks() const {
 
   return SourceRanksEditor_.Active();
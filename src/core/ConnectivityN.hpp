@@ -12,7 +12,10 @@
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
 #include <ovk/core/Grid.hpp>
+#include <ovk/core/Indexer.hpp>
+#include <ovk/core/Range.hpp>
 #include <ovk/core/Requires.hpp>
+#include <ovk/core/Tuple.hpp>
 #include <ovk/core/TypeTraits.hpp>
 
 #include <mpi.h>
@@ -84,11 +87,41 @@ public:
   long long Size() const { return NumReceivers_; }
 
   void Resize(long long NumReceivers);
+  // Compact storage for large numbers of receivers: points and sources are stored as linear
+  // indices (PointIndices and SourceIndices replace Points and Sources)
+  void ResizeCompact(long long NumReceivers);
   template <typename F, OVK_FUNCTION_REQUIRES(core::IsCallableWith<F>())> event_listener_handle
     AddResizeEventListener(F Listener) const {
     return ResizeEvent_.AddListener(std::move(Listener));
   }
 
+  bool Compact() const { return Compact_; }
+
+  // Per-receiver access for either storage
+  tuple<int> Point(long long iReceiver) const {
+    if (Compact_) {
+      return GlobalIndexer_.ToTuple(PointIndices_(iReceiver));
+    } else {
+      return {Points_(0,iReceiver), Points_(1,iReceiver), Points_(2,iReceiver)};
+    }
+  }
+  // Linear index of the receiver point in the grid's global range
+  long long PointIndex(long long iReceiver) const {
+    if (Compact_) {
+      return PointIndices_(iReceiver);
+    } else {
+      return GlobalIndexer_.ToIndex(Points_(0,iReceiver), Points_(1,iReceiver), Points_(2,
+        iReceiver));
+    }
+  }
+  tuple<int> Source(long long iReceiver) const {
+    if (Compact_) {
+      return SourceGlobalIndexer_.ToTuple(SourceIndices_(iReceiver));
+    } else {
+      return {Sources_(0,iReceiver), Sources_(1,iReceiver), Sources_(2,iReceiver)};
+    }
+  }
+
   const array<int,2> &Points() const { return Points_; }
   bool EditingPoints() const;
   edit_handle<array<int,2>> EditPoints();
@@ -98,6 +131,13 @@ public:
     return PointsEvent_.AddListener(std::move(Listener));
   }
 
+  // Compact storage only; linear index of each receiver point in the grid's global range (edits
+  // trigger points events)
+  const array<long long> &PointIndices() const { return PointIndices_; }
+  bool EditingPointIndices() const;
+  edit_handle<array<long long>> EditPointIndices();
+  void RestorePointIndices();
+
   const array<int,2> &Sources() const { return Sources_; }
   bool EditingSources() const;
   edit_handle<array<int,2>> EditSources();
@@ -107,6 +147,13 @@ public:
     return SourcesEvent_.AddListener(std::move(Listener));
   }
 
+  // Compact storage only; linear index of each source cell in the source grid's global range
+  // (edits trigger sources events)
+  const array<long long> &SourceIndices() const { return SourceIndices_; }
+  bool EditingSourceIndices() const;
+  edit_handle<array<long long>> EditSourceIndices();
+  void RestoreSourceIndices();
+
   const array<int> &SourceRanks() const { return SourceRanks_; }
   bool EditingSourceRanks() const;
   edit_handle<array<int>> EditSourceRanks();
@@ -128,11 +175,17 @@ private:
   long long NumReceivers_;
   mutable event<void()> ResizeEvent_;
 
+  bool Compact_;
+  range_indexer_c<long long> GlobalIndexer_;
+  range_indexer_c<long long> SourceGlobalIndexer_;
+
   array<int,2> Points_;
+  array<long long> PointIndices_;
   editor PointsEditor_;
   mutable event<void()> PointsEvent_;
 
   array<int,2> Sources_;
+  array<long long> SourceIndices_;
   editor SourcesEditor_;
   mutable event<void()> SourcesEvent_;
 
@@ -10,8 +10,8 @@
 #include "ovk/core/CommunicationOps.hpp"
 #include "ovk/core/DistributedRegionHash.hpp"
 #include "ovk/core/Elem.hpp"
-#include "ovk/core/ElemSet.hpp"
 #include "ovk/core/Global.hpp"
+#include "ovk/core/HashSet.hpp"
 #include "ovk/core/Interval.hpp"
 #include "ovk/core/Map.hpp"
 #include "ovk/core/Range.hpp"
@@ -59,7 +59,7 @@ array<int> DetectNeighbors(const cart &Cart, comm_view Comm, const range &LocalR
   }
 
   array<elem<int,2>> ExtendedPointBinIDs({NumExtendedPoints});
-  elem_set<int,2> UniqueBinIDs;
+  hash_set<elem<int,2>> UniqueBinIDs;
 
   for (long long iPoint = 0; iPoint < NumExtendedPoints; ++iPoint) {
     tuple<int> Point = {
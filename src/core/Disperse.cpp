@@ -24,6 +24,8 @@ template <typename T> using disperse_overwrite_row = disperse_internal::disperse
   array_layout::ROW_MAJOR>;
 template <typename T> using disperse_overwrite_col = disperse_internal::disperse_overwrite<T,
   array_layout::COLUMN_MAJOR>;
+template <typename T> using disperse_overwrite_tiled = disperse_internal::disperse_overwrite<T,
+  array_layout::TILED>;
 }
 
 disperse CreateDisperseOverwrite(std::shared_ptr<context> Context, const disperse_map &DisperseMap,
@@ -126,6 +128,53 @@ disperse CreateDisperseOverwrite(std::shared_ptr<context> Context, const dispers
       break;
     }
     break;
+  case array_layout::TILED:
+    switch (ValueType) {
+    case data_type::BOOL:
+      Disperse = disperse_overwrite_tiled<bool>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::BYTE:
+      Disperse = disperse_overwrite_tiled<byte>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::INT:
+      Disperse = disperse_overwrite_tiled<int>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::LONG:
+      Disperse = disperse_overwrite_tiled<long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::LONG_LONG:
+      Disperse = disperse_overwrite_tiled<long long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::UNSIGNED_INT:
+      Disperse = disperse_overwrite_tiled<unsigned int>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::UNSIGNED_LONG:
+      Disperse = disperse_overwrite_tiled<unsigned long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::UNSIGNED_LONG_LONG:
+      Disperse = disperse_overwrite_tiled<unsigned long long>(std::move(Context), DisperseMap,
+        Count, FieldValuesRange);
+      break;
+    case data_type::FLOAT:
+      Disperse = disperse_overwrite_tiled<float>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::DOUBLE:
+      Disperse = disperse_overwrite_tiled<double>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    default:
+      OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+      break;
+    }
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -140,6 +189,8 @@ template <typename T> using disperse_append_row = disperse_internal::disperse_ap
   array_layout::ROW_MAJOR>;
 template <typename T> using disperse_append_col = disperse_internal::disperse_append<T,
   array_layout::COLUMN_MAJOR>;
+template <typename T> using disperse_append_tiled = disperse_internal::disperse_append<T,
+  array_layout::TILED>;
 }
 
 disperse CreateDisperseAppend(std::shared_ptr<context> Context, const disperse_map &DisperseMap,
@@ -240,6 +291,53 @@ disperse CreateDisperseAppend(std::shared_ptr<context> Context, const disperse_m
       break;
     }
     break;
+  case array_layout::TILED:
+    switch (ValueType) {
+    case data_type::BOOL:
+      Disperse = disperse_append_tiled<bool>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::BYTE:
+      Disperse = disperse_append_tiled<byte>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::INT:
+      Disperse = disperse_append_tiled<int>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::LONG:
+      Disperse = disperse_append_tiled<long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::LONG_LONG:
+      Disperse = disperse_append_tiled<long long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::UNSIGNED_INT:
+      Disperse = disperse_append_tiled<unsigned int>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::UNSIGNED_LONG:
+      Disperse = disperse_append_tiled<unsigned long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::UNSIGNED_LONG_LONG:
+      Disperse = disperse_append_tiled<unsigned long long>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::FLOAT:
+      Disperse = disperse_append_tiled<float>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    case data_type::DOUBLE:
+      Disperse = disperse_append_tiled<double>(std::move(Context), DisperseMap, Count,
+        FieldValuesRange);
+      break;
+    default:
+      OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+      break;
+    }
+    break;
   default:
     OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
     break;
@@ -56,16 +56,12 @@ public:
 
     parent_type::SetBufferViews(PackedValuesVoid, FieldValuesVoid);
 
-    const array<int,2> &Points = DisperseMap_->Points();
+    const disperse_map &DisperseMap = *DisperseMap_;
 
-    long long NumPoints = Points.Size(1);
+    long long NumPoints = DisperseMap.Count();
 
     for (long long iPoint = 0; iPoint < NumPoints; ++iPoint) {
-      tuple<int> Point = {
-        Points(0,iPoint),
-        Points(1,iPoint),
-        Points(2,iPoint)
-      };
+      tuple<int> Point = DisperseMap.GetPoint(iPoint);
       long long iFieldValue = FieldValuesIndexer_.ToIndex(Point);
       for (int iCount = 0; iCount < Count_; ++iCount) {
         FieldValues_(iCount)(iFieldValue) += PackedValues_(iCount)(iPoint);
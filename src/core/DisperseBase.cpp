@@ -26,6 +26,7 @@ template <array_layout Layout> disperse_base<Layout>::disperse_base(std::shared_
 
 template class disperse_base<array_layout::ROW_MAJOR>;
 template class disperse_base<array_layout::COLUMN_MAJOR>;
+template class disperse_base<array_layout::TILED>;
 
 template <typename T, array_layout Layout> disperse_base_for_type<T, Layout>::
   disperse_base_for_type(std::shared_ptr<context> &&Context, const disperse_map &DisperseMap, int
@@ -39,7 +40,7 @@ template <typename T, array_layout Layout> disperse_base_for_type<T, Layout>::
 template <typename T, array_layout Layout> void disperse_base_for_type<T, Layout>::SetBufferViews(
   const void *PackedValuesVoid, void *FieldValuesVoid) {
 
-  long long NumPoints = DisperseMap_->Points().Size(1);
+  long long NumPoints = DisperseMap_->Count();
 
   auto PackedValuesRaw = static_cast<const value_type * const *>(PackedValuesVoid);
   auto FieldValuesRaw = static_cast<value_type **>(FieldValuesVoid);
@@ -61,23 +62,33 @@ template <typename T, array_layout Layout> void disperse_base_for_type<T, Layout
 
 template class disperse_base_for_type<bool, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<bool, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<bool, array_layout::TILED>;
 template class disperse_base_for_type<byte, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<byte, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<byte, array_layout::TILED>;
 template class disperse_base_for_type<int, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<int, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<int, array_layout::TILED>;
 template class disperse_base_for_type<long, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<long, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<long, array_layout::TILED>;
 template class disperse_base_for_type<long long, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<long long, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<long long, array_layout::TILED>;
 template class disperse_base_for_type<unsigned int, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<unsigned int, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<unsigned int, array_layout::TILED>;
 template class disperse_base_for_type<unsigned long, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<unsigned long, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<unsigned long, array_layout::TILED>;
 template class disperse_base_for_type<unsigned long long, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<unsigned long long, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<unsigned long long, array_layout::TILED>;
 template class disperse_base_for_type<float, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<float, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<float, array_layout::TILED>;
 template class disperse_base_for_type<double, array_layout::ROW_MAJOR>;
 template class disperse_base_for_type<double, array_layout::COLUMN_MAJOR>;
+template class disperse_base_for_type<double, array_layout::TILED>;
 
 }}
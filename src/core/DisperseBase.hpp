@@ -50,6 +50,7 @@ protected:
 
 extern template class disperse_base<array_layout::ROW_MAJOR>;
 extern template class disperse_base<array_layout::COLUMN_MAJOR>;
+extern template class disperse_base<array_layout::TILED>;
 
 template <typename T, array_layout Layout> class disperse_base_for_type : public disperse_base<
   Layout> {
@@ -82,24 +83,34 @@ protected:
 
 extern template class disperse_base_for_type<bool, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<bool, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<bool, array_layout::TILED>;
 extern template class disperse_base_for_type<byte, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<byte, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<byte, array_layout::TILED>;
 extern template class disperse_base_for_type<int, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<int, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<int, array_layout::TILED>;
 extern template class disperse_base_for_type<long, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<long, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<long, array_layout::TILED>;
 extern template class disperse_base_for_type<long long, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<long long, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<long long, array_layout::TILED>;
 extern template class disperse_base_for_type<unsigned int, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<unsigned int, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<unsigned int, array_layout::TILED>;
 extern template class disperse_base_for_type<unsigned long, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<unsigned long, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<unsigned long, array_layout::TILED>;
 extern template class disperse_base_for_type<unsigned long long, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<unsigned long long, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<unsigned long long, array_layout::TILED>;
 extern template class disperse_base_for_type<float, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<float, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<float, array_layout::TILED>;
 extern template class disperse_base_for_type<double, array_layout::ROW_MAJOR>;
 extern template class disperse_base_for_type<double, array_layout::COLUMN_MAJOR>;
+extern template class disperse_base_for_type<double, array_layout::TILED>;
 
 }}
 
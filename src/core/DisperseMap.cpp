@@ -6,6 +6,8 @@
 #include "ovk/core/Array.hpp"
 #include "ovk/core/FloatingRef.hpp"
 #include "ovk/core/Global.hpp"
+#include "ovk/core/Indexer.hpp"
+#include "ovk/core/Range.hpp"
 
 #include <mpi.h>
 
@@ -18,4 +20,10 @@ disperse_map::disperse_map(array<int,2> Points):
   Points_(std::move(Points))
 {}
 
+disperse_map::disperse_map(const range &GlobalRange, array<long long> PointIndices):
+  Compact_(true),
+  PointIndices_(std::move(PointIndices)),
+  GlobalIndexer_(GlobalRange)
+{}
+
 }}
@@ -7,6 +7,9 @@
 #include <ovk/core/Array.hpp>
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/Indexer.hpp>
+#include <ovk/core/Range.hpp>
+#include <ovk/core/Tuple.hpp>
 
 #include <mpi.h>
 
@@ -19,21 +22,32 @@ public:
 
   disperse_map() = default;
   disperse_map(array<int,2> Points);
+  // Compact form; points are identified by their linear index in GlobalRange
+  disperse_map(const range &GlobalRange, array<long long> PointIndices);
 
   floating_ref<const disperse_map> GetFloatingRef() const {
     return FloatingRefGenerator_.Generate(*this);
   }
   floating_ref<disperse_map> GetFloatingRef() { return FloatingRefGenerator_.Generate(*this); }
 
-  long long Count() const { return Points_.Size(2); }
+  long long Count() const { return Compact_ ? PointIndices_.Count() : Points_.Size(1); }
 
-  const array<int,2> &Points() const { return Points_; }
+  tuple<int> GetPoint(long long iPoint) const {
+    if (Compact_) {
+      return GlobalIndexer_.ToTuple(PointIndices_(iPoint));
+    } else {
+      return {Points_(0,iPoint), Points_(1,iPoint), Points_(2,iPoint)};
+    }
+  }
 
 private:
 
   floating_ref_generator FloatingRefGenerator_;
 
+  bool Compact_ = false;
   array<int,2> Points_;
+  array<long long> PointIndices_;
+  range_indexer_c<long long> GlobalIndexer_;
 
 };
 
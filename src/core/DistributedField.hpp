@@ -13,6 +13,7 @@
 
 #include <mpi.h>
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -23,6 +24,7 @@ template <typename T> class distributed_field {
 public:
 
   using value_type = T;
+  static constexpr std::size_t Alignment = field<T>::Alignment;
   using index_type = long long;
   using tuple_element_type = int;
   using tuple_type = tuple<int>;
@@ -72,6 +74,14 @@ public:
     return *this;
   }
 
+  // Like Assign, except that the values are left uninitialized; for when every value is about to
+  // be overwritten anyway
+  distributed_field &AssignUninitialized(std::shared_ptr<const partition> Partition) {
+    Partition_ = std::move(Partition);
+    Values_.ResizeUninitialized(Partition_->ExtendedRange());
+    return *this;
+  }
+
   distributed_field &Assign(std::shared_ptr<const partition> Partition, const value_type &Value) {
     Partition_ = std::move(Partition);
     Values_.Assign(Partition_->ExtendedRange(), Value);
@@ -233,6 +243,8 @@ private:
 
 };
 
+template <typename T> constexpr std::size_t distributed_field<T>::Alignment;
+
 template <typename T> typename distributed_field<T>::iterator begin(distributed_field<T> &Field) {
   return Field.Begin();
 }
@@ -10,6 +10,7 @@
 #include "ovk/core/Debug.hpp"
 #include "ovk/core/DistributedField.hpp"
 #include "ovk/core/ElemSet.hpp"
+#include "ovk/core/ForEach.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Partition.hpp"
 #include "ovk/core/Range.hpp"
@@ -36,13 +37,10 @@ long long CountDistributedMask(const distributed_field<bool> &Mask) {
 
   long long Count = 0;
 
-  for (int k = Mask.LocalRange().Begin(2); k < Mask.LocalRange().End(2); ++k) {
-    for (int j = Mask.LocalRange().Begin(1); j < Mask.LocalRange().End(1); ++j) {
-      for (int i = Mask.LocalRange().Begin(0); i < Mask.LocalRange().End(0); ++i) {
-        Count += (long long)(Mask(i,j,k));
-      }
-    }
-  }
+  ForEachInRange(Mask.LocalRange(), Mask.Values().Indexer(), [&](const tuple<int> &, long long
+    iPoint) {
+    Count += (long long)(Mask[iPoint]);
+  });
 
   MPI_Allreduce(MPI_IN_PLACE, &Count, 1, MPI_LONG_LONG, MPI_SUM, Mask.Comm());
 
@@ -214,83 +212,75 @@ void ConnectedComponents(const distributed_field<bool> &Mask, int &NumComponents
 
   ComponentLabels.Assign(Partition, -1);
 
+  auto &Indexer = ComponentLabels.Values().Indexer();
+
   int NumLocalComponents = 0;
   union_find LocalComponentSets;
 
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        bool Value = Mask(Point);
-        int &Label = ComponentLabels(Point);
-        range NeighborRange;
-        for (int iDim = 0; iDim < NumDims; ++iDim) {
-          NeighborRange.Begin(iDim) = Point(iDim) - 1;
-          NeighborRange.End(iDim) = Point(iDim) + 2;
-        }
-        for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
-          NeighborRange.Begin(iDim) = 0;
-          NeighborRange.End(iDim) = 1;
-        }
-        NeighborRange = IntersectRanges(NeighborRange, LocalRange);
-        for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
-          for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
-            for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
-              tuple<int> Neighbor = {m,n,o};
-              bool NeighborValue = Mask(Neighbor);
-              if (NeighborValue == Value) {
-                int NeighborLabel = ComponentLabels(Neighbor);
-                if (NeighborLabel >= 0) {
-                  Label = NeighborLabel;
-                  goto done_looping_over_neighbors;
-                }
-              }
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &Point, long long iPoint) {
+    bool Value = Mask[iPoint];
+    int &Label = ComponentLabels[iPoint];
+    range NeighborRange;
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      NeighborRange.Begin(iDim) = Point(iDim) - 1;
+      NeighborRange.End(iDim) = Point(iDim) + 2;
+    }
+    for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
+      NeighborRange.Begin(iDim) = 0;
+      NeighborRange.End(iDim) = 1;
+    }
+    NeighborRange = IntersectRanges(NeighborRange, LocalRange);
+    for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
+      for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
+        for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
+          tuple<int> Neighbor = {m,n,o};
+          bool NeighborValue = Mask(Neighbor);
+          if (NeighborValue == Value) {
+            int NeighborLabel = ComponentLabels(Neighbor);
+            if (NeighborLabel >= 0) {
+              Label = NeighborLabel;
+              goto done_looping_over_neighbors;
             }
           }
-          done_looping_over_neighbors:;
-          if (Label < 0) {
-            Label = NumLocalComponents;
-            LocalComponentSets.Insert(Label);
-            ++NumLocalComponents;
-          }
         }
       }
+      done_looping_over_neighbors:;
+      if (Label < 0) {
+        Label = NumLocalComponents;
+        LocalComponentSets.Insert(Label);
+        ++NumLocalComponents;
+      }
     }
-  }
-
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        bool Value = Mask(Point);
-        int Label = ComponentLabels(Point);
-        range NeighborRange;
-        for (int iDim = 0; iDim < NumDims; ++iDim) {
-          NeighborRange.Begin(iDim) = Point(iDim) - 1;
-          NeighborRange.End(iDim) = Point(iDim) + 2;
-        }
-        for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
-          NeighborRange.Begin(iDim) = 0;
-          NeighborRange.End(iDim) = 1;
-        }
-        NeighborRange = IntersectRanges(NeighborRange, LocalRange);
-        for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
-          for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
-            for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
-              tuple<int> Neighbor = {m,n,o};
-              bool NeighborValue = Mask(Neighbor);
-              if (NeighborValue == Value) {
-                int NeighborLabel = ComponentLabels(Neighbor);
-                if (NeighborLabel >= 0) {
-                  LocalComponentSets.Union(Label, NeighborLabel);
-                }
-              }
+  });
+
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &Point, long long iPoint) {
+    bool Value = Mask[iPoint];
+    int Label = ComponentLabels[iPoint];
+    range NeighborRange;
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      NeighborRange.Begin(iDim) = Point(iDim) - 1;
+      NeighborRange.End(iDim) = Point(iDim) + 2;
+    }
+    for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
+      NeighborRange.Begin(iDim) = 0;
+      NeighborRange.End(iDim) = 1;
+    }
+    NeighborRange = IntersectRanges(NeighborRange, LocalRange);
+    for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
+      for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
+        for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
+          tuple<int> Neighbor = {m,n,o};
+          bool NeighborValue = Mask(Neighbor);
+          if (NeighborValue == Value) {
+            int NeighborLabel = ComponentLabels(Neighbor);
+            if (NeighborLabel >= 0) {
+              LocalComponentSets.Union(Label, NeighborLabel);
             }
           }
         }
       }
     }
-  }
+  });
 
   LocalComponentSets.Relabel();
 
@@ -305,16 +295,11 @@ void ConnectedComponents(const distributed_field<bool> &Mask, int &NumComponents
     LocalRootToContiguous[iLabel].Value() = iLabel;
   }
 
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        int &Label = ComponentLabels(Point);
-        int RootLabel = LocalComponentSets.Find(Label);
-        Label = LocalRootToContiguous(RootLabel);
-      }
-    }
-  }
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &, long long iPoint) {
+    int &Label = ComponentLabels[iPoint];
+    int RootLabel = LocalComponentSets.Find(Label);
+    Label = LocalRootToContiguous(RootLabel);
+  });
 
   union_find GlobalComponentSets;
 
@@ -322,16 +307,11 @@ void ConnectedComponents(const distributed_field<bool> &Mask, int &NumComponents
   MPI_Scan(&NumLocalComponents, &NumComponentsBeforeRank, 1, MPI_INT, MPI_SUM, Comm);
   NumComponentsBeforeRank -= NumLocalComponents;
 
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        int &Label = ComponentLabels(Point);
-        Label += NumComponentsBeforeRank;
-        GlobalComponentSets.Insert(Label);
-      }
-    }
-  }
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &, long long iPoint) {
+    int &Label = ComponentLabels[iPoint];
+    Label += NumComponentsBeforeRank;
+    GlobalComponentSets.Insert(Label);
+  });
 
   ComponentLabels.Exchange();
 
@@ -340,39 +320,34 @@ void ConnectedComponents(const distributed_field<bool> &Mask, int &NumComponents
 
   elem_set<int,2> ExtendedUnions;
 
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        bool Value = Mask(Point);
-        int Label = ComponentLabels(Point);
-        range NeighborRange;
-        for (int iDim = 0; iDim < NumDims; ++iDim) {
-          NeighborRange.Begin(iDim) = Point(iDim) - 1;
-          NeighborRange.End(iDim) = Point(iDim) + 2;
-        }
-        for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
-          NeighborRange.Begin(iDim) = 0;
-          NeighborRange.End(iDim) = 1;
-        }
-        NeighborRange = IntersectRanges(NeighborRange, ExtendedRange);
-        for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
-          for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
-            for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
-              tuple<int> Neighbor = {m,n,o};
-              if (!LocalRange.Contains(Neighbor)) {
-                bool NeighborValue = Mask(Neighbor);
-                if (NeighborValue == Value) {
-                  int NeighborLabel = ComponentLabels(Neighbor);
-                  ExtendedUnions.Insert({Label,NeighborLabel});
-                }
-              }
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &Point, long long iPoint) {
+    bool Value = Mask[iPoint];
+    int Label = ComponentLabels[iPoint];
+    range NeighborRange;
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      NeighborRange.Begin(iDim) = Point(iDim) - 1;
+      NeighborRange.End(iDim) = Point(iDim) + 2;
+    }
+    for (int iDim = NumDims; iDim < MAX_DIMS; ++iDim) {
+      NeighborRange.Begin(iDim) = 0;
+      NeighborRange.End(iDim) = 1;
+    }
+    NeighborRange = IntersectRanges(NeighborRange, ExtendedRange);
+    for (int o = NeighborRange.Begin(2); o < NeighborRange.End(2); ++o) {
+      for (int n = NeighborRange.Begin(1); n < NeighborRange.End(1); ++n) {
+        for (int m = NeighborRange.Begin(0); m < NeighborRange.End(0); ++m) {
+          tuple<int> Neighbor = {m,n,o};
+          if (!LocalRange.Contains(Neighbor)) {
+            bool NeighborValue = Mask(Neighbor);
+            if (NeighborValue == Value) {
+              int NeighborLabel = ComponentLabels(Neighbor);
+              ExtendedUnions.Insert({Label,NeighborLabel});
             }
           }
         }
       }
     }
-  }
+  });
 
   int NumExtendedUnions = ExtendedUnions.Count();
 
@@ -410,15 +385,10 @@ void ConnectedComponents(const distributed_field<bool> &Mask, int &NumComponents
 
   GlobalComponentSets.Relabel();
 
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        int &Label = ComponentLabels(Point);
-        Label = GlobalComponentSets.Find(Label);
-      }
-    }
-  }
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &, long long iPoint) {
+    int &Label = ComponentLabels[iPoint];
+    Label = GlobalComponentSets.Find(Label);
+  });
 
   ComponentLabels.Exchange();
 
@@ -427,15 +397,10 @@ void ConnectedComponents(const distributed_field<bool> &Mask, int &NumComponents
 
   array<int> LabelExists({MaxLabel+1}, 0);
 
-  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
-    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
-      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
-        tuple<int> Point = {i,j,k};
-        int Label = ComponentLabels(Point);
-        LabelExists(Label) = true;
-      }
-    }
-  }
+  ForEachInRange(LocalRange, Indexer, [&](const tuple<int> &, long long iPoint) {
+    int Label = ComponentLabels[iPoint];
+    LabelExists(Label) = true;
+  });
 
   MPI_Allreduce(MPI_IN_PLACE, LabelExists.Data(), LabelExists.Count(), MPI_INT, MPI_LOR, Comm);
 
@@ -26,8 +26,10 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <type_traits>
@@ -115,17 +117,31 @@ public:
 
 private:
 
+  // Regions are partitioned among ranks by recursive coordinate bisection, with split locations
+  // chosen from a weighted sample of region centroids so that each rank receives roughly the
+  // same number of regions; each rank then bins its regions on a uniform grid over its own part
+  struct partition_node {
+    int Rank;
+    int SplitDim;
+    coord_type Split;
+    int LowerChild;
+    int UpperChild;
+  };
+
+  struct partition_sample {
+    tuple<double> Centroid;
+    double Weight;
+  };
+
   int NumDims_;
 
   comm_view Comm_;
 
   extents_type GlobalExtents_;
 
-  range ProcRange_;
-  range_indexer<int> ProcIndexer_;
-  tuple<coord_type> ProcSize_;
-
-  array<int> ProcToBinMultipliers_;
+  array<partition_node> PartitionNodes_;
+  array<extents_type> ProcExtents_;
+  array<int,2> ProcNumBins_;
 
   array<region_data> RegionData_;
   range BinRange_;
@@ -133,6 +149,11 @@ private:
   field<long long> BinRegionIndicesStarts_;
   array<int> BinRegionIndices_;
 
+  int BuildPartition_(int RankBegin, int RankEnd, const extents_type &Extents,
+    array_view<partition_sample> Samples);
+
+  void MapToProcs_(int iNode, const extents_type &RegionExtents, set<int> &Procs) const;
+
   template <hashable_region_maps_to MapsTo> struct maps_to_tag {};
 
   template <typename IndexerType> set<typename IndexerType::index_type> MapToBins_(const range
@@ -155,7 +176,11 @@ private:
   static interval<double,MAX_DIMS> UnionExtents_(const interval<double,MAX_DIMS> &Left, const
     interval<double,MAX_DIMS> &Right);
 
-  static tuple<int> BinDecomp_(int NumDims, const extents_type &Extents, int MaxBins);
+  static int LastCoord_(const interval<int,MAX_DIMS> &Extents, int iDim);
+  static double LastCoord_(const interval<double,MAX_DIMS> &Extents, int iDim);
+
+  static int MakeSplit_(double Split, const interval<int,MAX_DIMS> &Extents, int iDim);
+  static double MakeSplit_(double Split, const interval<double,MAX_DIMS> &Extents, int iDim);
 
   static tuple<int> GetBinSize_(const interval<int,MAX_DIMS> &Extents, const tuple<int> &NumBins);
   static tuple<double> GetBinSize_(const interval<double,MAX_DIMS> &Extents, const tuple<int>
@@ -9,9 +9,6 @@ template <typename RegionType> distributed_region_hash<RegionType>::distributed_
   NumDims_(NumDims),
   Comm_(Comm),
   GlobalExtents_(MakeEmptyExtents_(NumDims, coord_type_tag<coord_type>())),
-  ProcRange_(MakeEmptyRange(NumDims)),
-  ProcIndexer_(ProcRange_),
-  ProcSize_(MakeUniformTuple<coord_type>(NumDims, coord_type(0), coord_type(1))),
   BinRange_(MakeEmptyRange(NumDims))
 {}
 
@@ -31,115 +28,97 @@ template <typename RegionType> distributed_region_hash<RegionType>::distributed_
   MPI_Allreduce(MPI_IN_PLACE, GlobalExtents_.Begin().Data(), NumDims_, CoordMPIType, MPI_MIN, Comm_);
   MPI_Allreduce(MPI_IN_PLACE, GlobalExtents_.End().Data(), NumDims_, CoordMPIType, MPI_MAX, Comm_);
 
-  tuple<int> NumProcs = BinDecomp_(NumDims_, GlobalExtents_, Comm_.Size());
+  // Sample a few local region centroids, weighted so that the samples from each rank add up to
+  // its number of regions
+  constexpr int MaxLocalSamples = 32;
+  int NumLocalSamples = LocalRegions.Count() < MaxLocalSamples ? int(LocalRegions.Count()) :
+    MaxLocalSamples;
 
-  ProcRange_ = range(NumProcs);
-  ProcIndexer_ = range_indexer<int>(ProcRange_);
+  array<double,2> LocalSampleValues({{NumLocalSamples,MAX_DIMS+1}});
 
-  ProcSize_ = GetBinSize_(GlobalExtents_, NumProcs);
-
-  array<set<int>> LocalRegionOverlappedProcs({LocalRegions.Count()});
-
-  for (int iRegion = 0; iRegion < LocalRegions.Count(); ++iRegion) {
-    LocalRegionOverlappedProcs(iRegion) = MapToBins_(ProcRange_, ProcIndexer_,
-      GlobalExtents_.Begin(), ProcSize_, LocalRegions(iRegion), 
-      maps_to_tag<region_traits::MapsTo()>());
-  }
-
-  set<int> SendToRanks;
-
-  for (auto &Ranks : LocalRegionOverlappedProcs) {
-    for (int Rank : Ranks) {
-      SendToRanks.Insert(Rank);
+  for (int iSample = 0; iSample < NumLocalSamples; ++iSample) {
+    long long iRegion = (iSample*LocalRegions.Count())/NumLocalSamples;
+    extents_type Extents = region_traits::ComputeExtents(NumDims_, LocalRegions(iRegion));
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      LocalSampleValues(iSample,iDim) = 0.5*(double(Extents.Begin(iDim)) +
+        double(Extents.End(iDim)));
     }
+    LocalSampleValues(iSample,MAX_DIMS) = double(LocalRegions.Count())/double(NumLocalSamples);
   }
 
-  array<int> RecvFromRanks = core::DynamicHandshake(Comm_, SendToRanks);
+  array<int> NumSamplesForRank({Comm_.Size()});
 
-  map<int,int> NumRegionsToRank;
-  map<int,int> NumRegionsFromRank;
+  MPI_Allgather(&NumLocalSamples, 1, MPI_INT, NumSamplesForRank.Data(), 1, MPI_INT, Comm_);
 
-  for (auto &Ranks : LocalRegionOverlappedProcs) {
-    for (int Rank : Ranks) {
-      ++NumRegionsToRank.Fetch(Rank, 0);
-    }
-  }
+  array<int> SampleValueCounts({Comm_.Size()});
+  array<int> SampleValueOffsets({Comm_.Size()});
 
-  for (int Rank : RecvFromRanks) {
-    NumRegionsFromRank.Insert(Rank);
+  int NumSamples = 0;
+  for (int Rank = 0; Rank < Comm_.Size(); ++Rank) {
+    SampleValueCounts(Rank) = (MAX_DIMS+1)*NumSamplesForRank(Rank);
+    SampleValueOffsets(Rank) = (MAX_DIMS+1)*NumSamples;
+    NumSamples += NumSamplesForRank(Rank);
   }
 
-  array<MPI_Request> Requests;
+  array<double,2> SampleValues({{NumSamples,MAX_DIMS+1}});
 
-  Requests.Reserve(SendToRanks.Count() + RecvFromRanks.Count());
+  MPI_Allgatherv(LocalSampleValues.Data(), (MAX_DIMS+1)*NumLocalSamples, MPI_DOUBLE,
+    SampleValues.Data(), SampleValueCounts.Data(), SampleValueOffsets.Data(), MPI_DOUBLE, Comm_);
 
-  for (int Rank : RecvFromRanks) {
-    MPI_Irecv(&NumRegionsFromRank(Rank), 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
+  array<partition_sample> Samples({NumSamples});
 
-  for (int Rank : SendToRanks) {
-    MPI_Isend(&NumRegionsToRank(Rank), 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
+  for (int iSample = 0; iSample < NumSamples; ++iSample) {
+    partition_sample &Sample = Samples(iSample);
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Sample.Centroid(iDim) = SampleValues(iSample,iDim);
+    }
+    Sample.Weight = SampleValues(iSample,MAX_DIMS);
   }
 
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
+  PartitionNodes_.Reserve(2*Comm_.Size()-1);
+  ProcExtents_.Resize({Comm_.Size()});
 
-  int NumRecvs = 0;
-  for (auto &Entry : NumRegionsFromRank) {
-    NumRecvs += Entry.Value();
-  }
+  BuildPartition_(0, Comm_.Size(), GlobalExtents_, Samples);
 
-  int NumSends = 0;
-  for (auto &Entry : NumRegionsToRank) {
-    NumSends += Entry.Value();
-  }
+  array<set<int>> LocalRegionOverlappedProcs({LocalRegions.Count()});
 
-  Requests.Reserve(NumSends + NumRecvs);
+  for (int iRegion = 0; iRegion < LocalRegions.Count(); ++iRegion) {
+    extents_type RegionExtents = region_traits::ComputeExtents(NumDims_, LocalRegions(iRegion));
+    MapToProcs_(0, RegionExtents, LocalRegionOverlappedProcs(iRegion));
+  }
 
   using mpi_region_type = typename mpi_traits::packed_type;
-  auto RegionMPIType = mpi_traits::CreateMPIType();
-  MPI_Type_commit(&RegionMPIType.Get());
 
-  array<mpi_region_type> SendRegions({LocalRegions.Count()});
-  array<mpi_region_type> RecvRegions({NumRecvs});
-
-  int iRecv = 0;
-  for (int Rank : RecvFromRanks) {
-    int NumRegions = NumRegionsFromRank(Rank);
-    for (int iRegionFromRank = 0; iRegionFromRank < NumRegions; ++iRegionFromRank) {
-      mpi_region_type &RecvRegion = RecvRegions(iRecv);
-      MPI_Irecv(&RecvRegion, 1, RegionMPIType, Rank, 0, Comm_, &Requests.Append());
-      ++iRecv;
-    }
-  }
+  map<int,array<mpi_region_type>> SendRegions;
 
   for (int iRegion = 0; iRegion < LocalRegions.Count(); ++iRegion) {
-    auto &Ranks = LocalRegionOverlappedProcs(iRegion);
-    mpi_region_type &SendRegion = SendRegions(iRegion);
-    SendRegion = mpi_traits::Pack(LocalRegions(iRegion));
-    for (int Rank : Ranks) {
-      MPI_Isend(&SendRegion, 1, RegionMPIType, Rank, 0, Comm_, &Requests.Append());
+    mpi_region_type SendRegion = mpi_traits::Pack(LocalRegions(iRegion));
+    for (int Rank : LocalRegionOverlappedProcs(iRegion)) {
+      SendRegions.Fetch(Rank).Append(SendRegion);
     }
   }
 
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
+  map<int,array<mpi_region_type>> RecvRegions = core::SparseExchange(Comm_, SendRegions);
+
+  int NumRecvs = 0;
+  for (auto &Entry : RecvRegions) {
+    NumRecvs += Entry.Value().Count();
+  }
 
   RegionData_.Resize({NumRecvs});
 
-  iRecv = 0;
-  for (int Rank : RecvFromRanks) {
-    int NumRegions = NumRegionsFromRank(Rank);
-    for (int iRegionFromRank = 0; iRegionFromRank < NumRegions; ++iRegionFromRank) {
+  int iRecv = 0;
+  for (auto &Entry : RecvRegions) {
+    int Rank = Entry.Key();
+    for (auto &RecvRegion : Entry.Value()) {
       region_data &Data = RegionData_(iRecv);
-      const mpi_region_type &RecvRegion = RecvRegions(iRecv);
       Data.Region_ = mpi_traits::Unpack(RecvRegion);
       Data.Rank_ = Rank;
       ++iRecv;
     }
   }
 
-  int ProcToBinMultiplier = 1;
+  tuple<int> NumBins = {1,1,1};
 
   if (RegionData_.Count() > 0) {
 
@@ -152,105 +131,72 @@ template <typename RegionType> distributed_region_hash<RegionType>::distributed_
     }
     AvgBinRegionLength /= double(NumDims_*RegionData_.Count());
 
-    double AvgProcLength = 0.;
+    // Choose the bin counts separately in each dimension, since partitions can be elongated
+    const extents_type &ProcExtents = ProcExtents_(Comm_.Rank());
     for (int iDim = 0; iDim < NumDims_; ++iDim) {
-      AvgProcLength += double(ProcSize_(iDim));
+      NumBins(iDim) = Max(int(2.*double(ProcExtents.Size(iDim))/AvgBinRegionLength),1);
     }
-    AvgProcLength /= double(NumDims_);
-
-    ProcToBinMultiplier = Max(int(2.*AvgProcLength/AvgBinRegionLength),1);
 
   }
 
-  ProcToBinMultipliers_.Resize({Comm_.Size()});
-
-  MPI_Allgather(&ProcToBinMultiplier, 1, MPI_INT, ProcToBinMultipliers_.Data(), 1, MPI_INT,
-    Comm_);
+  ProcNumBins_.Resize({{Comm_.Size(),MAX_DIMS}});
 
-  array<map<int,set<int>>> LocalRegionOverlappedBins({LocalRegions.Count()});
+  MPI_Allgather(NumBins.Data(), MAX_DIMS, MPI_INT, ProcNumBins_.Data(), MAX_DIMS, MPI_INT, Comm_);
 
-  Requests.Reserve(NumSends + NumRecvs);
+  // For each region sent to a rank, send the number of that rank's bins it overlaps followed by
+  // the bin indices, all in a single message per rank (tagged apart from RetrieveBins' messages)
+  constexpr int OVERLAPPED_BINS_TAG = 0;
+  core::message_aggregator<int> OverlappedBinsMessages(Comm_, OVERLAPPED_BINS_TAG);
 
-  array<map<int,int>> NumLocalRegionOverlappedBins({LocalRegions.Count()});
-  array<int> NumProcRegionOverlappedBins({RegionData_.Count()});
-
-  int iNextRegion = 0;
-  for (int Rank : RecvFromRanks) {
-    int NumRegions = NumRegionsFromRank(Rank);
-    for (int iRegionFromRank = 0; iRegionFromRank < NumRegions; ++iRegionFromRank) {
-      int &NumBins = NumProcRegionOverlappedBins(iNextRegion);
-      MPI_Irecv(&NumBins, 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-      ++iNextRegion;
-    }
+  for (auto &Entry : RecvRegions) {
+    OverlappedBinsMessages.AddSource(Entry.Key());
   }
 
   for (int iRegion = 0; iRegion < LocalRegions.Count(); ++iRegion) {
     const set<int> &OverlappedProcs = LocalRegionOverlappedProcs(iRegion);
-    auto &BinsForProc = LocalRegionOverlappedBins(iRegion);
-    auto &NumBinsForProc = NumLocalRegionOverlappedBins(iRegion);
     for (int iProc : OverlappedProcs) {
-      tuple<int> ProcLoc = ProcIndexer_.ToTuple(iProc);
       range ProcBinRange = MakeEmptyRange(NumDims_);
       for (int iDim = 0; iDim < NumDims_; ++iDim) {
         ProcBinRange.Begin(iDim) = 0;
-        ProcBinRange.End(iDim) = ProcToBinMultipliers_(iProc);
-      }
-      extents_type ProcExtents = MakeEmptyExtents_(NumDims_, coord_type_tag<coord_type>());
-      for (int iDim = 0; iDim < NumDims_; ++iDim) {
-        ProcExtents.Begin(iDim) = GlobalExtents_.Begin(iDim) + coord_type(ProcLoc(iDim))*
-          ProcSize_(iDim);
-        ProcExtents.End(iDim) = Min(GlobalExtents_.Begin(iDim) + coord_type(ProcLoc(iDim)+1)*
-          ProcSize_(iDim), GlobalExtents_.End(iDim));
+        ProcBinRange.End(iDim) = ProcNumBins_(iProc,iDim);
       }
+      const extents_type &ProcExtents = ProcExtents_(iProc);
       range_indexer_c<int> ProcBinIndexer(ProcBinRange);
       tuple<coord_type> ProcBinSize = GetBinSize_(ProcExtents, ProcBinRange.Size());
-      set<int> &Bins = BinsForProc.Insert(iProc);
-      Bins = MapToBins_(ProcBinRange, ProcBinIndexer, ProcExtents.Begin(),
+      set<int> Bins = MapToBins_(ProcBinRange, ProcBinIndexer, ProcExtents.Begin(),
         ProcBinSize, LocalRegions(iRegion), maps_to_tag<region_traits::MapsTo()>());
-      NumBinsForProc.Insert(iProc, int(Bins.Count()));
-    }
-    for (auto &Entry : NumBinsForProc) {
-      int Rank = Entry.Key();
-      const int &NumBins = Entry.Value();
-      MPI_Isend(&NumBins, 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
+      OverlappedBinsMessages.Append(iProc, int(Bins.Count()));
+      for (int iBin : Bins) {
+        OverlappedBinsMessages.Append(iProc, iBin);
+      }
     }
   }
 
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
+  OverlappedBinsMessages.Exchange();
 
   array<array<int>> ProcRegionOverlappedBins({RegionData_.Count()});
 
-  iNextRegion = 0;
-  for (int Rank : RecvFromRanks) {
-    int NumRegions = NumRegionsFromRank(Rank);
+  int iNextRegion = 0;
+  for (auto &Entry : RecvRegions) {
+    int Rank = Entry.Key();
+    int NumRegions = Entry.Value().Count();
+    array_view<const int> Values = OverlappedBinsMessages.Received(Rank);
+    int iValue = 0;
     for (int iRegionFromRank = 0; iRegionFromRank < NumRegions; ++iRegionFromRank) {
-      int NumBins = NumProcRegionOverlappedBins(iNextRegion);
-      array<int> &Bins = ProcRegionOverlappedBins(iNextRegion);
-      Bins.Resize({NumBins});
-      MPI_Irecv(Bins.Data(), NumBins, MPI_INT, Rank, 0, Comm_, &Requests.Append());
+      int NumBins = Values(iValue);
+      ++iValue;
+      ProcRegionOverlappedBins(iNextRegion) = array<int>({NumBins}, Values.Data()+iValue);
+      iValue += NumBins;
       ++iNextRegion;
     }
   }
 
-  for (int iRegion = 0; iRegion < LocalRegions.Count(); ++iRegion) {
-    auto &BinsForProc = LocalRegionOverlappedBins(iRegion);
-    for (auto &Entry : BinsForProc) {
-      int Rank = Entry.Key();
-      const set<int> &Bins = Entry.Value();
-      MPI_Isend(Bins.Data(), Bins.Count(), MPI_INT, Rank, 0, Comm_, &Requests.Append());
-    }
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
-
   if (RegionData_.Count() > 0) {
 
     BinRange_ = MakeEmptyRange(NumDims_);
     for (int iDim = 0; iDim < NumDims_; ++iDim) {
       BinRange_.Begin(iDim) = 0;
-      BinRange_.End(iDim) = ProcToBinMultiplier;
+      BinRange_.End(iDim) = NumBins(iDim);
     }
 
     range_indexer_c<int> BinIndexer(BinRange_);
@@ -299,26 +245,23 @@ template <typename RegionType> distributed_region_hash<RegionType>::distributed_
 template <typename RegionType> elem<int,2> distributed_region_hash<RegionType>::MapToBin(const
   tuple<coord_type> &Point) const {
 
-  tuple<int> ProcLoc = ClampToRange(ProcRange_, MapToUniformGridCell(NumDims_,
-    GlobalExtents_.Begin(), ProcSize_, Point));
+  int iNode = 0;
+  while (PartitionNodes_(iNode).LowerChild >= 0) {
+    const partition_node &Node = PartitionNodes_(iNode);
+    iNode = Point(Node.SplitDim) < Node.Split ? Node.LowerChild : Node.UpperChild;
+  }
 
-  int Rank = ProcIndexer_.ToIndex(ProcLoc);
+  int Rank = PartitionNodes_(iNode).Rank;
 
   range ProcBinRange = MakeEmptyRange(NumDims_);
   for (int iDim = 0; iDim < NumDims_; ++iDim) {
     ProcBinRange.Begin(iDim) = 0;
-    ProcBinRange.End(iDim) = ProcToBinMultipliers_(Rank);
+    ProcBinRange.End(iDim) = ProcNumBins_(Rank,iDim);
   }
 
   range_indexer_c<int> ProcBinIndexer(ProcBinRange);
 
-  extents_type ProcExtents = MakeEmptyExtents_(NumDims_, coord_type_tag<coord_type>());
-  for (int iDim = 0; iDim < NumDims_; ++iDim) {
-    ProcExtents.Begin(iDim) = GlobalExtents_.Begin(iDim) + coord_type(ProcLoc(iDim))*
-      ProcSize_(iDim);
-    ProcExtents.End(iDim) = Min(GlobalExtents_.Begin(iDim) + coord_type(ProcLoc(iDim)+1)*
-      ProcSize_(iDim), GlobalExtents_.End(iDim));
-  }
+  const extents_type &ProcExtents = ProcExtents_(Rank);
 
   tuple<coord_type> ProcBinSize = GetBinSize_(ProcExtents, ProcBinRange.Size());
 
@@ -340,55 +283,11 @@ template <typename RegionType> map<int,distributed_region_hash_retrieved_bins<Re
     BinRanks.Insert(Rank);
   }
 
-  array<int> RetrievingRanks = core::DynamicHandshake(Comm_, BinRanks);
-
-  array<MPI_Request> Requests;
-
-  Requests.Reserve(RetrievingRanks.Count()+BinRanks.Count());
-
-  map<int,int> NumBinsSending;
-  NumBinsSending.Reserve(RetrievingRanks.Count());
-
-  for (int Rank : RetrievingRanks) {
-    int &NumBins = NumBinsSending.Insert(Rank);
-    MPI_Irecv(&NumBins, 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
-
-  map<int,int> NumBinsReceiving;
-  NumBinsReceiving.Reserve(BinRanks.Count());
-
-  for (auto &BinID : BinIDs) {
-    int Rank = BinID(0);
-    ++NumBinsReceiving.Fetch(Rank, 0);
-  }
-
-  for (int Rank : BinRanks) {
-    int &NumBins = NumBinsReceiving(Rank);
-    MPI_Isend(&NumBins, 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
-
-  Requests.Reserve(RetrievingRanks.Count()+BinRanks.Count());
-
-  map<int,array<int>> BinsSending;
-  BinsSending.Reserve(RetrievingRanks.Count());
-
-  for (int Rank : RetrievingRanks) {
-    int NumBins = NumBinsSending(Rank);
-    array<int> &Bins = BinsSending.Insert(Rank);
-    Bins.Resize({NumBins});
-    MPI_Irecv(Bins.Data(), NumBins, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
-
   map<int,array<int>> BinsReceiving;
   BinsReceiving.Reserve(BinRanks.Count());
 
   for (int Rank : BinRanks) {
-    int NumBins = NumBinsReceiving(Rank);
-    array<int> &Bins = BinsReceiving.Insert(Rank);
-    Bins.Reserve(NumBins);
+    BinsReceiving.Insert(Rank);
   }
 
   for (auto &BinID : BinIDs) {
@@ -398,53 +297,18 @@ template <typename RegionType> map<int,distributed_region_hash_retrieved_bins<Re
     Bins.Append(iBin);
   }
 
-  for (int Rank : BinRanks) {
-    const array<int> &Bins = BinsReceiving(Rank);
-    MPI_Isend(Bins.Data(), Bins.Count(), MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
-
-  map<int,set<int>> SendingRegionIndices;
-  SendingRegionIndices.Reserve(RetrievingRanks.Count());
-
-  for (int Rank : RetrievingRanks) {
-    set<int> &RegionIndices = SendingRegionIndices.Insert(Rank);
-    const array<int> &Bins = BinsSending(Rank);
-    for (int iBin : Bins) {
-      int NumBinRegions = NumRegionsPerBin_[iBin];
-      int BinRegionIndicesStart = BinRegionIndicesStarts_[iBin];
-      for (int iBinRegion = 0; iBinRegion < NumBinRegions; ++iBinRegion) {
-        int iRegion = BinRegionIndices_(BinRegionIndicesStart+iBinRegion);
-        RegionIndices.Insert(iRegion);
-      }
-    }
-  }
-
-  Requests.Reserve(RetrievingRanks.Count()+BinRanks.Count());
-
-  map<int,int> NumRecvRegions;
-  NumRecvRegions.Reserve(BinRanks.Count());
-
-  for (int Rank : BinRanks) {
-    int &NumRegions = NumRecvRegions.Insert(Rank);
-    MPI_Irecv(&NumRegions, 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
-
-  map<int,int> NumSendRegions;
-  NumSendRegions.Reserve(RetrievingRanks.Count());
-
-  for (int Rank : RetrievingRanks) {
-    int &NumRegions = NumSendRegions.Insert(Rank);
-    NumRegions = SendingRegionIndices(Rank).Count();
-    MPI_Isend(&NumRegions, 1, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
+  map<int,array<int>> BinsSending = core::SparseExchange(Comm_, BinsReceiving);
 
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
+  array<int> RetrievingRanks(BinsSending.Keys());
 
-  Requests.Reserve(2*(RetrievingRanks.Count()+BinRanks.Count()));
+  // The amount of region data coming from each rank isn't known ahead of time, but each piece
+  // arrives in a single message from a known rank, so sizes are obtained by probing instead of by
+  // a separate round of count messages. Everything is sent in one round, with a tag per piece
+  // (tagged apart from the constructor's messages)
+  constexpr int REGIONS_TAG = 1;
+  constexpr int REGION_RANKS_TAG = 2;
+  constexpr int NUM_REGIONS_PER_BIN_TAG = 3;
+  constexpr int BIN_REGION_INDICES_TAG = 4;
 
   using mpi_region_type = typename mpi_traits::packed_type;
   auto RegionMPIType = mpi_traits::CreateMPIType();
@@ -455,25 +319,33 @@ template <typename RegionType> map<int,distributed_region_hash_retrieved_bins<Re
     array<int> Ranks;
   };
 
-  map<int,region_send_recv> RecvRegionData;
-  RecvRegionData.Reserve(BinRanks.Count());
+  struct bin_index_data {
+    array<int> NumRegionsPerBin;
+    array<int> BinRegionIndices;
+  };
 
-  for (int Rank : BinRanks) {
-    region_send_recv &Recv = RecvRegionData.Insert(Rank);
-    int NumRegions = NumRecvRegions(Rank);
-    Recv.Regions.Resize({NumRegions});
-    Recv.Ranks.Resize({NumRegions});
-    MPI_Irecv(Recv.Regions.Data(), NumRegions, RegionMPIType, Rank, 0, Comm_,
-      &Requests.Append());
-    MPI_Irecv(Recv.Ranks.Data(), NumRegions, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
+  array<MPI_Request> Requests;
+  Requests.Reserve(4*(RetrievingRanks.Count()+BinRanks.Count()));
 
   map<int,region_send_recv> SendRegionData;
   SendRegionData.Reserve(RetrievingRanks.Count());
 
+  map<int,bin_index_data> SendBinIndexData;
+  SendBinIndexData.Reserve(RetrievingRanks.Count());
+
   for (int Rank : RetrievingRanks) {
+    const array<int> &Bins = BinsSending(Rank);
+    int NumBins = Bins.Count();
+    set<int> RegionIndices;
+    for (int iBin : Bins) {
+      int NumBinRegions = NumRegionsPerBin_[iBin];
+      int BinRegionIndicesStart = BinRegionIndicesStarts_[iBin];
+      for (int iBinRegion = 0; iBinRegion < NumBinRegions; ++iBinRegion) {
+        int iRegion = BinRegionIndices_(BinRegionIndicesStart+iBinRegion);
+        RegionIndices.Insert(iRegion);
+      }
+    }
     region_send_recv &Send = SendRegionData.Insert(Rank);
-    const set<int> &RegionIndices = SendingRegionIndices(Rank);
     int NumRegions = RegionIndices.Count();
     Send.Regions.Resize({NumRegions});
     Send.Ranks.Resize({NumRegions});
@@ -483,78 +355,25 @@ template <typename RegionType> map<int,distributed_region_hash_retrieved_bins<Re
       Send.Regions(iSendRegion) = mpi_traits::Pack(Data.Region_);
       Send.Ranks(iSendRegion) = Data.Rank_;
     }
-    MPI_Isend(Send.Regions.Data(), NumRegions, RegionMPIType, Rank, 0, Comm_,
+    MPI_Isend(Send.Regions.Data(), NumRegions, RegionMPIType, Rank, REGIONS_TAG, Comm_,
       &Requests.Append());
-    MPI_Isend(Send.Ranks.Data(), NumRegions, MPI_INT, Rank, 0, Comm_, &Requests.Append());
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
-
-  Requests.Reserve(RetrievingRanks.Count()+BinRanks.Count());
-
-  struct bin_index_data {
-    array<int> NumRegionsPerBin;
-    array<int> BinRegionIndices;
-  };
-
-  map<int,bin_index_data> RecvBinIndexData;
-  RecvBinIndexData.Reserve(BinRanks.Count());
-
-  for (int Rank : BinRanks) {
-    bin_index_data &BinIndexData = RecvBinIndexData.Insert(Rank);
-    int NumBins = BinsReceiving(Rank).Count();
-    BinIndexData.NumRegionsPerBin.Resize({NumBins});
-    MPI_Irecv(BinIndexData.NumRegionsPerBin.Data(), NumBins, MPI_INT, Rank, 0, Comm_,
+    MPI_Isend(Send.Ranks.Data(), NumRegions, MPI_INT, Rank, REGION_RANKS_TAG, Comm_,
       &Requests.Append());
-  }
-
-  map<int,bin_index_data> SendBinIndexData;
-  SendBinIndexData.Reserve(RetrievingRanks.Count());
-
-  for (int Rank : RetrievingRanks) {
     bin_index_data &BinIndexData = SendBinIndexData.Insert(Rank);
-    const array<int> &Bins = BinsSending(Rank);
-    int NumBins = Bins.Count();
     BinIndexData.NumRegionsPerBin.Resize({NumBins});
+    long long TotalBinRegions = 0;
     for (int iSendBin = 0; iSendBin < NumBins; ++iSendBin) {
       int iBin = Bins[iSendBin];
       BinIndexData.NumRegionsPerBin(iSendBin) = NumRegionsPerBin_[iBin];
+      TotalBinRegions += (long long)(NumRegionsPerBin_[iBin]);
     }
-    MPI_Isend(BinIndexData.NumRegionsPerBin.Data(), NumBins, MPI_INT, Rank, 0, Comm_,
-      &Requests.Append());
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
-
-  Requests.Reserve(2*(RetrievingRanks.Count()+BinRanks.Count()));
-
-  for (int Rank : BinRanks) {
-    bin_index_data &BinIndexData = RecvBinIndexData(Rank);
-    long long TotalBinRegions = 0;
-    for (int NumRegions : BinIndexData.NumRegionsPerBin) {
-      TotalBinRegions += (long long)(NumRegions);
-    }
-    BinIndexData.BinRegionIndices.Resize({TotalBinRegions});
-    MPI_Irecv(BinIndexData.BinRegionIndices.Data(), TotalBinRegions, MPI_INT, Rank, 0, Comm_,
-      &Requests.Append());
-  }
-
-  for (int Rank : RetrievingRanks) {
-    bin_index_data &BinIndexData = SendBinIndexData(Rank);
-    const set<int> &RegionIndices = SendingRegionIndices(Rank);
-    const array<int> &Bins = BinsSending(Rank);
-    int NumBins = Bins.Count();
+    MPI_Isend(BinIndexData.NumRegionsPerBin.Data(), NumBins, MPI_INT, Rank,
+      NUM_REGIONS_PER_BIN_TAG, Comm_, &Requests.Append());
     array<int> BinRegionIndexToSendRegionIndex({RegionData_.Count()}, -1);
-    for (int iSendRegion = 0; iSendRegion < RegionIndices.Count(); ++iSendRegion) {
+    for (int iSendRegion = 0; iSendRegion < NumRegions; ++iSendRegion) {
       int iRegion = RegionIndices[iSendRegion];
       BinRegionIndexToSendRegionIndex(iRegion) = iSendRegion;
     }
-    long long TotalBinRegions = 0;
-    for (int iSendBin = 0; iSendBin < NumBins; ++iSendBin) {
-      TotalBinRegions += (long long)(BinIndexData.NumRegionsPerBin(iSendBin));
-    }
     BinIndexData.BinRegionIndices.Resize({TotalBinRegions});
     long long iSendBinRegionIndex = 0;
     for (int iSendBin = 0; iSendBin < NumBins; ++iSendBin) {
@@ -566,12 +385,42 @@ template <typename RegionType> map<int,distributed_region_hash_retrieved_bins<Re
         ++iSendBinRegionIndex;
       }
     }
-    MPI_Isend(BinIndexData.BinRegionIndices.Data(), TotalBinRegions, MPI_INT, Rank, 0, Comm_,
+    MPI_Isend(BinIndexData.BinRegionIndices.Data(), TotalBinRegions, MPI_INT, Rank,
+      BIN_REGION_INDICES_TAG, Comm_, &Requests.Append());
+  }
+
+  map<int,region_send_recv> RecvRegionData;
+  RecvRegionData.Reserve(BinRanks.Count());
+
+  map<int,bin_index_data> RecvBinIndexData;
+  RecvBinIndexData.Reserve(BinRanks.Count());
+
+  for (int Rank : BinRanks) {
+    MPI_Status Status;
+    region_send_recv &Recv = RecvRegionData.Insert(Rank);
+    MPI_Probe(Rank, REGIONS_TAG, Comm_, &Status);
+    int NumRegions;
+    MPI_Get_count(&Status, RegionMPIType, &NumRegions);
+    Recv.Regions.Resize({NumRegions});
+    Recv.Ranks.Resize({NumRegions});
+    MPI_Irecv(Recv.Regions.Data(), NumRegions, RegionMPIType, Rank, REGIONS_TAG, Comm_,
       &Requests.Append());
+    MPI_Irecv(Recv.Ranks.Data(), NumRegions, MPI_INT, Rank, REGION_RANKS_TAG, Comm_,
+      &Requests.Append());
+    bin_index_data &BinIndexData = RecvBinIndexData.Insert(Rank);
+    int NumBins = BinsReceiving(Rank).Count();
+    BinIndexData.NumRegionsPerBin.Resize({NumBins});
+    MPI_Irecv(BinIndexData.NumRegionsPerBin.Data(), NumBins, MPI_INT, Rank,
+      NUM_REGIONS_PER_BIN_TAG, Comm_, &Requests.Append());
+    MPI_Probe(Rank, BIN_REGION_INDICES_TAG, Comm_, &Status);
+    int TotalBinRegions;
+    MPI_Get_count(&Status, MPI_INT, &TotalBinRegions);
+    BinIndexData.BinRegionIndices.Resize({TotalBinRegions});
+    MPI_Irecv(BinIndexData.BinRegionIndices.Data(), TotalBinRegions, MPI_INT, Rank,
+      BIN_REGION_INDICES_TAG, Comm_, &Requests.Append());
   }
 
   MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-  Requests.Clear();
 
   map<int,retrieved_bins> RetrievedBins;
   RetrievedBins.Reserve(BinRanks.Count());
@@ -662,68 +511,157 @@ template <typename RegionType> interval<double,MAX_DIMS> distributed_region_hash
 
 }
 
-template <typename RegionType> tuple<int> distributed_region_hash<RegionType>::BinDecomp_(int
-  NumDims, const extents_type &Extents, int MaxBins) {
+template <typename RegionType> int distributed_region_hash<RegionType>::BuildPartition_(int
+  RankBegin, int RankEnd, const extents_type &Extents, array_view<partition_sample> Samples) {
 
-  tuple<int> NumBins = {1,1,1};
+  int iNode = PartitionNodes_.Count();
+  PartitionNodes_.Append();
 
-  if (NumDims == 1) {
+  if (RankEnd-RankBegin == 1) {
+    partition_node &Node = PartitionNodes_(iNode);
+    Node.Rank = RankBegin;
+    Node.SplitDim = -1;
+    Node.Split = coord_type(0);
+    Node.LowerChild = -1;
+    Node.UpperChild = -1;
+    ProcExtents_(RankBegin) = Extents;
+    return iNode;
+  }
 
-    NumBins(0) = MaxBins;
+  int NumLowerRanks = (RankEnd-RankBegin)/2;
+  double LowerFraction = double(NumLowerRanks)/double(RankEnd-RankBegin);
 
+  // Split along the dimension in which the samples are most spread out, or along the longest
+  // dimension if there aren't enough samples to tell
+  int SplitDim = 0;
+  if (Samples.Count() > 1) {
+    double MaxSpread = -1.;
+    for (int iDim = 0; iDim < NumDims_; ++iDim) {
+      double MinCoord = std::numeric_limits<double>::max();
+      double MaxCoord = std::numeric_limits<double>::lowest();
+      for (auto &Sample : Samples) {
+        MinCoord = Min(MinCoord, Sample.Centroid(iDim));
+        MaxCoord = Max(MaxCoord, Sample.Centroid(iDim));
+      }
+      if (MaxCoord-MinCoord > MaxSpread) {
+        SplitDim = iDim;
+        MaxSpread = MaxCoord-MinCoord;
+      }
+    }
   } else {
-
-    tuple<double> Length;
-    for (int iDim = 0; iDim < NumDims; ++iDim) {
-      Length(iDim) = double(Extents.Size(iDim));
+    for (int iDim = 1; iDim < NumDims_; ++iDim) {
+      if (Extents.Size(iDim) > Extents.Size(SplitDim)) {
+        SplitDim = iDim;
+      }
     }
+  }
 
-    double Volume = 1.;
-    for (int iDim = 0; iDim < NumDims; ++iDim) {
-      Volume *= Length(iDim);
-    }
+  auto CompareSamples = [SplitDim](const partition_sample &Left, const partition_sample &Right)
+    -> bool {
+    return Left.Centroid(SplitDim) < Right.Centroid(SplitDim);
+  };
 
-    int iMinLengthDim = 0;
-    double MinLength = std::numeric_limits<double>::max();
-    for (int iDim = 0; iDim < NumDims; ++iDim) {
-      if (Length(iDim) <= MinLength) {
-        iMinLengthDim = iDim;
-        MinLength = Length(iDim);
-      }
+  coord_type Split;
+
+  if (Samples.Count() > 0) {
+    std::sort(Samples.Begin(), Samples.End(), CompareSamples);
+    double TotalWeight = 0.;
+    for (auto &Sample : Samples) {
+      TotalWeight += Sample.Weight;
     }
+    double LowerWeight = 0.;
+    long long iSplitSample = 0;
+    while (iSplitSample < Samples.Count()-1) {
+      LowerWeight += Samples(iSplitSample).Weight;
+      if (LowerWeight >= LowerFraction*TotalWeight) break;
+      ++iSplitSample;
+    }
+    double SplitValue = Samples(iSplitSample).Centroid(SplitDim);
+    if (iSplitSample < Samples.Count()-1) {
+      SplitValue = 0.5*(SplitValue + Samples(iSplitSample+1).Centroid(SplitDim));
+    }
+    Split = MakeSplit_(SplitValue, Extents, SplitDim);
+  } else {
+    Split = MakeSplit_(double(Extents.Begin(SplitDim)) + LowerFraction*double(Extents.Size(
+      SplitDim)), Extents, SplitDim);
+  }
 
-    double Base = std::pow(double(MaxBins)/Volume, 1./double(NumDims));
+  long long NumLowerSamples = 0;
+  while (NumLowerSamples < Samples.Count() && Samples(NumLowerSamples).Centroid(SplitDim) <
+    double(Split)) {
+    ++NumLowerSamples;
+  }
 
-    NumBins(iMinLengthDim) = Max(int(Length(iMinLengthDim)*Base),1);
+  array_view<partition_sample> LowerSamples(Samples.Data(), {NumLowerSamples});
+  array_view<partition_sample> UpperSamples(Samples.Data()+NumLowerSamples,
+    {Samples.Count()-NumLowerSamples});
 
-    extents_type ExtentsReduced = MakeEmptyExtents_(NumDims-1, coord_type_tag<coord_type>());
+  extents_type LowerExtents = Extents;
+  LowerExtents.End(SplitDim) = Split;
 
-    int iReducedDim;
+  extents_type UpperExtents = Extents;
+  UpperExtents.Begin(SplitDim) = Split;
 
-    iReducedDim = 0;
-    for (int iDim = 0; iDim < NumDims; ++iDim) {
-      if (iDim != iMinLengthDim) {
-        ExtentsReduced.Begin(iReducedDim) = Extents.Begin(iDim);
-        ExtentsReduced.End(iReducedDim) = Extents.End(iDim);
-        ++iReducedDim;
-      }
-    }
+  int LowerChild = BuildPartition_(RankBegin, RankBegin+NumLowerRanks, LowerExtents,
+    LowerSamples);
+  int UpperChild = BuildPartition_(RankBegin+NumLowerRanks, RankEnd, UpperExtents, UpperSamples);
 
-    int MaxBinsReduced = MaxBins/NumBins(iMinLengthDim);
+  partition_node &Node = PartitionNodes_(iNode);
+  Node.Rank = -1;
+  Node.SplitDim = SplitDim;
+  Node.Split = Split;
+  Node.LowerChild = LowerChild;
+  Node.UpperChild = UpperChild;
 
-    tuple<int> NumBinsReduced = BinDecomp_(NumDims-1, ExtentsReduced, MaxBinsReduced);
+  return iNode;
 
-    iReducedDim = 0;
-    for (int iDim = 0; iDim < NumDims; ++iDim) {
-      if (iDim != iMinLengthDim) {
-        NumBins(iDim) = NumBinsReduced(iReducedDim);
-        ++iReducedDim;
-      }
-    }
+}
+
+template <typename RegionType> void distributed_region_hash<RegionType>::MapToProcs_(int iNode,
+  const extents_type &RegionExtents, set<int> &Procs) const {
+
+  const partition_node &Node = PartitionNodes_(iNode);
 
+  if (Node.LowerChild < 0) {
+    Procs.Insert(Node.Rank);
+    return;
+  }
+
+  // Points on the split belong to the upper partition
+  if (RegionExtents.Begin(Node.SplitDim) < Node.Split) {
+    MapToProcs_(Node.LowerChild, RegionExtents, Procs);
+  }
+  if (LastCoord_(RegionExtents, Node.SplitDim) >= Node.Split) {
+    MapToProcs_(Node.UpperChild, RegionExtents, Procs);
   }
 
-  return NumBins;
+}
+
+template <typename RegionType> int distributed_region_hash<RegionType>::LastCoord_(const
+  interval<int,MAX_DIMS> &Extents, int iDim) {
+
+  return Extents.End(iDim)-1;
+
+}
+
+template <typename RegionType> double distributed_region_hash<RegionType>::LastCoord_(const
+  interval<double,MAX_DIMS> &Extents, int iDim) {
+
+  return Extents.End(iDim);
+
+}
+
+template <typename RegionType> int distributed_region_hash<RegionType>::MakeSplit_(double Split,
+  const interval<int,MAX_DIMS> &Extents, int iDim) {
+
+  return Min(Max(int(std::floor(Split)), Extents.Begin(iDim)), Extents.End(iDim));
+
+}
+
+template <typename RegionType> double distributed_region_hash<RegionType>::MakeSplit_(double
+  Split, const interval<double,MAX_DIMS> &Extents, int iDim) {
+
+  return Min(Max(Split, Extents.Begin(iDim)), Extents.End(iDim));
 
 }
 
@@ -733,7 +671,7 @@ template <typename RegionType> tuple<int> distributed_region_hash<RegionType>::G
   tuple<int> BinSize;
 
   for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-    BinSize(iDim) = (Extents.Size(iDim)+NumBins(iDim)-1)/NumBins(iDim);
+    BinSize(iDim) = Max((Extents.Size(iDim)+NumBins(iDim)-1)/NumBins(iDim), 1);
   }
 
   return BinSize;
@@ -746,7 +684,8 @@ template <typename RegionType> tuple<double> distributed_region_hash<RegionType>
   tuple<double> BinSize;
 
   for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-    BinSize(iDim) = Extents.Size(iDim)/double(NumBins(iDim));
+    // Partitions can be flat if many samples lie on the split
+    BinSize(iDim) = Extents.Size(iDim) > 0. ? Extents.Size(iDim)/double(NumBins(iDim)) : 1.;
   }
 
   return BinSize;
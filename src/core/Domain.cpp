@@ -144,49 +144,69 @@ void domain_base::CreateGrids(array_view<const int> GridIDs, array<optional<grid
   }
 
   if (OVK_DEBUG) {
+    array<int> AtLeastOneLocal({NumCreates});
     for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
       int GridID = GridIDs(iCreate);
       OVK_DEBUG_ASSERT(GridID >= 0, "Invalid grid ID.");
       OVK_DEBUG_ASSERT(!GridExists(GridID), "Grid %i already exists.", GridID);
-      int IsLocalInt = IsLocal(iCreate) ? 1 : 0;
-      int AtLeastOneLocal;
-      MPI_Allreduce(&IsLocalInt, &AtLeastOneLocal, 1, MPI_INT, MPI_LOR, Comm_);
-      OVK_DEBUG_ASSERT(AtLeastOneLocal, "Grid must be local to at least one rank.");
+      AtLeastOneLocal(iCreate) = IsLocal(iCreate) ? 1 : 0;
+    }
+    MPI_Allreduce(MPI_IN_PLACE, AtLeastOneLocal.Data(), NumCreates, MPI_INT, MPI_LOR, Comm_);
+    for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
+      OVK_DEBUG_ASSERT(AtLeastOneLocal(iCreate), "Grid must be local to at least one rank.");
     }
   }
 
   if (Logger.LoggingStatus()) {
+    array<bool> IsRoot({NumCreates}, false);
+    array<std::string> GridNames({NumCreates});
     for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
-      bool IsRoot = false; 
       if (IsLocal(iCreate)) {
         int Rank;
         MPI_Comm_rank(MaybeParams(iCreate).Get().Comm(), &Rank);
-        IsRoot = Rank == 0;
+        IsRoot(iCreate) = Rank == 0;
       }
-      std::string GridName;
-      if (IsRoot) GridName = MaybeParams(iCreate).Get().Name();
-      core::BroadcastStringAnySource(GridName, IsRoot, Comm_);
-      Logger.LogStatus(Comm_.Rank() == 0, "Creating grid %s.%s...", *Name_, GridName);
+      if (IsRoot(iCreate)) GridNames(iCreate) = MaybeParams(iCreate).Get().Name();
+    }
+    core::BroadcastStringsAnySource(GridNames, IsRoot, Comm_);
+    for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
+      Logger.LogStatus(Comm_.Rank() == 0, "Creating grid %s.%s...", *Name_, GridNames(iCreate));
     }
   }
   auto Level1 = Logger.IncreaseStatusLevelAndIndent();
 
+  // Duplicate all of the local grids' communicators together rather than one grid at a time
+  array<comm_view> LocalGridComms;
+  for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
+    if (IsLocal(iCreate)) {
+      LocalGridComms.Append(MaybeParams(iCreate).Get().Comm());
+    }
+  }
+  array<comm> DuplicatedGridComms = core::DuplicateComms(LocalGridComms);
+
+  int iLocalGrid = 0;
   for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
     int GridID = GridIDs(iCreate);
     if (IsLocal(iCreate)) {
-      grid Grid = core::CreateGrid(Context_, MaybeParams(iCreate).Release());
+      grid Grid = core::CreateGrid(Context_, MaybeParams(iCreate).Release(),
+        std::move(DuplicatedGridComms(iLocalGrid)));
       LocalGrids_.Insert(GridID, std::move(Grid));
+      ++iLocalGrid;
     }
   }
 
+  array<grid *> MaybeGrids({NumCreates}, nullptr);
   for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
-    int GridID = GridIDs(iCreate);
-    grid *MaybeGrid = nullptr;
     if (IsLocal(iCreate)) {
-      MaybeGrid = &LocalGrids_(GridID);
+      MaybeGrids(iCreate) = &LocalGrids_(GridIDs(iCreate));
     }
-    grid_info GridInfo = core::CreateGridInfo(MaybeGrid, Comm_);
-    GridRecords_.Insert(GridID, std::move(GridInfo));
+  }
+
+  array<grid_info> GridInfos = core::CreateGridInfos(MaybeGrids, Comm_);
+
+  for (int iCreate = 0; iCreate < NumCreates; ++iCreate) {
+    int GridID = GridIDs(iCreate);
+    GridRecords_.Insert(GridID, std::move(GridInfos(iCreate)));
   }
 
   MPI_Barrier(Comm_);
@@ -22,7 +22,9 @@
 #include "ovk/core/FloatingRef.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Grid.hpp"
+#include "ovk/core/HashMap.hpp"
 #include "ovk/core/Indexer.hpp"
+#include "ovk/core/InterpCoefs.hpp"
 #include "ovk/core/Map.hpp"
 #include "ovk/core/Recv.hpp"
 #include "ovk/core/RecvMap.hpp"
@@ -43,8 +45,7 @@ namespace {
 
 long long BinDivide(long long N, int NumBins);
 
-array<long long> GetSendRecvOrder(const array<int,2> &ReceiverPoints, const range
-  &ReceiverGridGlobalRange);
+array<long long> GetSendRecvOrder(const array<long long> &ReceiverIndices);
 
 }
 
@@ -309,13 +310,8 @@ void exchanger::UpdateSourceDestRanks_() {
     const connectivity_m &ConnectivityM = *LocalM.Connectivity;
     LocalM.DestinationRanks = ConnectivityM.DestinationRanks();
     // Ensure only process containing lower corner of donor cell communicates
-    const array<int,3> &Extents = ConnectivityM.Extents();
     for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
-      tuple<int> CellLower = {
-        Extents(0,0,iDonor),
-        Extents(0,1,iDonor),
-        Extents(0,2,iDonor)
-      };
+      tuple<int> CellLower = ConnectivityM.DonorLowerCorner(iDonor);
       if (!MGrid.LocalRange().Contains(CellLower)) {
         LocalM.DestinationRanks(iDonor) = -1;
       }
@@ -348,7 +344,7 @@ void exchanger::UpdateSourceDestRanks_() {
   LinearPartition.MRanks.Resize(LinearPartition.Interval, -1);
   LinearPartition.NRanks.Resize(LinearPartition.Interval, -1);
 
-  map<int,long long> NumPointsBeforeGrid;
+  hash_map<int,long long> NumPointsBeforeGrid;
   long long NumPointsPartial = 0;
   for (int GridID : Domain.GridIDs()) {
     const grid_info &GridInfo = Domain.GridInfo(GridID);
@@ -365,32 +361,20 @@ void exchanger::UpdateSourceDestRanks_() {
     {}
   };
 
-  map<int,send_recv> MSends, NSends;
+  hash_map<int,send_recv> MSends, NSends;
 
   for (auto &ConnectivityID : ConnectivityMIDs) {
     int MGridID = ConnectivityID(0);
     int NGridID = ConnectivityID(1);
     const grid &MGrid = Domain.Grid(MGridID);
-    const grid_info &NGridInfo = Domain.GridInfo(NGridID);
-    range_indexer_c<long long> NGridGlobalIndexer(NGridInfo.Cart().Range());
     const local_m &LocalM = LocalMs_(ConnectivityID);
     const connectivity_m &ConnectivityM = *LocalM.Connectivity;
-    const array<int,3> &Extents = ConnectivityM.Extents();
-    const array<int,2> &Destinations = ConnectivityM.Destinations();
     const array<int> &DestinationRanks = LocalM.DestinationRanks;
     for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
-      tuple<int> CellLower = {
-        Extents(0,0,iDonor),
-        Extents(0,1,iDonor),
-        Extents(0,2,iDonor)
-      };
+      tuple<int> CellLower = ConnectivityM.DonorLowerCorner(iDonor);
       if (MGrid.LocalRange().Contains(CellLower) && DestinationRanks(iDonor) < 0) {
-        tuple<int> Point = {
-          Destinations(0,iDonor),
-          Destinations(1,iDonor),
-          Destinations(2,iDonor)
-        };
-        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + NGridGlobalIndexer.ToIndex(Point);
+        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + ConnectivityM.DestinationIndex(
+          iDonor);
         int iLinearPartition = int(iLinearPoint/LinearPartitionSize);
         send_recv &Send = MSends.Fetch(iLinearPartition);
         ++Send.Count;
@@ -400,20 +384,13 @@ void exchanger::UpdateSourceDestRanks_() {
 
   for (auto &ConnectivityID : ConnectivityNIDs) {
     int NGridID = ConnectivityID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    range_indexer_c<long long> NGridGlobalIndexer(NGrid.GlobalRange());
     const local_n &LocalN = LocalNs_(ConnectivityID);
     const connectivity_n &ConnectivityN = *LocalN.Connectivity;
-    const array<int,2> &Points = ConnectivityN.Points();
     const array<int> &SourceRanks = LocalN.SourceRanks;
     for (long long iReceiver = 0; iReceiver < ConnectivityN.Size(); ++iReceiver) {
       if (SourceRanks(iReceiver) < 0) {
-        tuple<int> Point = {
-          Points(0,iReceiver),
-          Points(1,iReceiver),
-          Points(2,iReceiver)
-        };
-        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + NGridGlobalIndexer.ToIndex(Point);
+        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + ConnectivityN.PointIndex(
+          iReceiver);
         int iLinearPartition = int(iLinearPoint/LinearPartitionSize);
         send_recv &Send = NSends.Fetch(iLinearPartition);
         ++Send.Count;
@@ -435,26 +412,14 @@ void exchanger::UpdateSourceDestRanks_() {
     int MGridID = ConnectivityID(0);
     int NGridID = ConnectivityID(1);
     const grid &MGrid = Domain.Grid(MGridID);
-    const grid_info &NGridInfo = Domain.GridInfo(NGridID);
-    range_indexer_c<long long> NGridGlobalIndexer(NGridInfo.Cart().Range());
     const local_m &LocalM = LocalMs_(ConnectivityID);
     const connectivity_m &ConnectivityM = *LocalM.Connectivity;
-    const array<int,3> &Extents = ConnectivityM.Extents();
-    const array<int,2> &Destinations = ConnectivityM.Destinations();
     const array<int> &DestinationRanks = LocalM.DestinationRanks;
     for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
-      tuple<int> CellLower = {
-        Extents(0,0,iDonor),
-        Extents(0,1,iDonor),
-        Extents(0,2,iDonor)
-      };
+      tuple<int> CellLower = ConnectivityM.DonorLowerCorner(iDonor);
       if (MGrid.LocalRange().Contains(CellLower) && DestinationRanks(iDonor) < 0) {
-        tuple<int> Point = {
-          Destinations(0,iDonor),
-          Destinations(1,iDonor),
-          Destinations(2,iDonor)
-        };
-        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + NGridGlobalIndexer.ToIndex(Point);
+        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + ConnectivityM.DestinationIndex(
+          iDonor);
         int iLinearPartition = int(iLinearPoint/LinearPartitionSize);
         send_recv &Send = MSends(iLinearPartition);
         Send.PointIndices.Append(iLinearPoint);
@@ -464,20 +429,13 @@ void exchanger::UpdateSourceDestRanks_() {
 
   for (auto &ConnectivityID : ConnectivityNIDs) {
     int NGridID = ConnectivityID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    range_indexer_c<long long> NGridGlobalIndexer(NGrid.GlobalRange());
     const local_n &LocalN = LocalNs_(ConnectivityID);
     const connectivity_n &ConnectivityN = *LocalN.Connectivity;
-    const array<int,2> &Points = ConnectivityN.Points();
     const array<int> &SourceRanks = LocalN.SourceRanks;
     for (long long iReceiver = 0; iReceiver < ConnectivityN.Size(); ++iReceiver) {
       if (SourceRanks(iReceiver) < 0) {
-        tuple<int> Point = {
-          Points(0,iReceiver),
-          Points(1,iReceiver),
-          Points(2,iReceiver)
-        };
-        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + NGridGlobalIndexer.ToIndex(Point);
+        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + ConnectivityN.PointIndex(
+          iReceiver);
         int iLinearPartition = int(iLinearPoint/LinearPartitionSize);
         send_recv &Send = NSends(iLinearPartition);
         Send.PointIndices.Append(iLinearPoint);
@@ -495,21 +453,41 @@ void exchanger::UpdateSourceDestRanks_() {
     Send.Ranks.Resize({Send.Count});
   }
 
-  array<int> MRecvFromRanks = core::DynamicHandshake(Comm, MSends.Keys());
-  array<int> NRecvFromRanks = core::DynamicHandshake(Comm, NSends.Keys());
+  // The owners of the linear partition don't know in advance who will be sending to them
+  map<int,array<long long>> MSendPointIndices, NSendPointIndices;
 
-  map<int,send_recv> MRecvs, NRecvs;
+  for (auto &Entry : MSends) {
+    MSendPointIndices.Insert(Entry.Key(), std::move(Entry.Value().PointIndices));
+  }
 
-  for (int Rank : MRecvFromRanks) {
-    MRecvs.Insert(Rank);
+  for (auto &Entry : NSends) {
+    NSendPointIndices.Insert(Entry.Key(), std::move(Entry.Value().PointIndices));
   }
 
-  for (int Rank : NRecvFromRanks) {
-    NRecvs.Insert(Rank);
+  map<int,array<long long>> MRecvPointIndices = core::SparseExchange(Comm, MSendPointIndices);
+  map<int,array<long long>> NRecvPointIndices = core::SparseExchange(Comm, NSendPointIndices);
+
+  MSendPointIndices.Clear();
+  NSendPointIndices.Clear();
+
+  hash_map<int,send_recv> MRecvs, NRecvs;
+
+  for (auto &Entry : MRecvPointIndices) {
+    send_recv &Recv = MRecvs.Insert(Entry.Key());
+    Recv.PointIndices = std::move(Entry.Value());
+    Recv.Count = Recv.PointIndices.Count();
+    Recv.Ranks.Resize({Recv.Count});
   }
 
-  MRecvFromRanks.Clear();
-  NRecvFromRanks.Clear();
+  for (auto &Entry : NRecvPointIndices) {
+    send_recv &Recv = NRecvs.Insert(Entry.Key());
+    Recv.PointIndices = std::move(Entry.Value());
+    Recv.Count = Recv.PointIndices.Count();
+    Recv.Ranks.Resize({Recv.Count});
+  }
+
+  MRecvPointIndices.Clear();
+  NRecvPointIndices.Clear();
 
   int NumMSends = MSends.Count();
   int NumNSends = NSends.Count();
@@ -535,74 +513,6 @@ void exchanger::UpdateSourceDestRanks_() {
     MPI_Irecv(Buffer, int(Count), DataType, SourceRank, Tag, RecvComm, &Request);
   };
 
-  for (auto &Entry : MRecvs) {
-    int Rank = Entry.Key();
-    send_recv &Recv = Entry.Value();
-    Irecv(&Recv.Count, 1, MPI_LONG_LONG, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : NRecvs) {
-    int Rank = Entry.Key();
-    send_recv &Recv = Entry.Value();
-    Irecv(&Recv.Count, 1, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  for (auto &Entry : MSends) {
-    int Rank = Entry.Key();
-    send_recv &Send = Entry.Value();
-    Isend(&Send.Count, 1, MPI_LONG_LONG, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : NSends) {
-    int Rank = Entry.Key();
-    send_recv &Send = Entry.Value();
-    Isend(&Send.Count, 1, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-
-  Requests.Clear();
-
-  for (auto &Entry : MRecvs) {
-    send_recv &Recv = Entry.Value();
-    Recv.PointIndices.Resize({Recv.Count});
-    Recv.Ranks.Resize({Recv.Count});
-  }
-
-  for (auto &Entry : NRecvs) {
-    send_recv &Recv = Entry.Value();
-    Recv.PointIndices.Resize({Recv.Count});
-    Recv.Ranks.Resize({Recv.Count});
-  }
-
-  for (auto &Entry : MRecvs) {
-    int Rank = Entry.Key();
-    send_recv &Recv = Entry.Value();
-    Irecv(Recv.PointIndices.Data(), Recv.Count, MPI_LONG_LONG, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : NRecvs) {
-    int Rank = Entry.Key();
-    send_recv &Recv = Entry.Value();
-    Irecv(Recv.PointIndices.Data(), Recv.Count, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  for (auto &Entry : MSends) {
-    int Rank = Entry.Key();
-    send_recv &Send = Entry.Value();
-    Isend(Send.PointIndices.Data(), Send.Count, MPI_LONG_LONG, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : NSends) {
-    int Rank = Entry.Key();
-    send_recv &Send = Entry.Value();
-    Isend(Send.PointIndices.Data(), Send.Count, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-
-  Requests.Clear();
-
   for (auto &Entry : MRecvs) {
     int Rank = Entry.Key();
     send_recv &Recv = Entry.Value();
@@ -686,26 +596,14 @@ void exchanger::UpdateSourceDestRanks_() {
     int MGridID = ConnectivityID(0);
     int NGridID = ConnectivityID(1);
     const grid &MGrid = Domain.Grid(MGridID);
-    const grid_info &NGridInfo = Domain.GridInfo(NGridID);
-    range_indexer_c<long long> NGridGlobalIndexer(NGridInfo.Cart().Range());
     local_m &LocalM = LocalMs_(ConnectivityID);
     const connectivity_m &ConnectivityM = *LocalM.Connectivity;
-    const array<int,3> &Extents = ConnectivityM.Extents();
-    const array<int,2> &Destinations = ConnectivityM.Destinations();
     array<int> &DestinationRanks = LocalM.DestinationRanks;
     for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
-      tuple<int> CellLower = {
-        Extents(0,0,iDonor),
-        Extents(0,1,iDonor),
-        Extents(0,2,iDonor)
-      };
+      tuple<int> CellLower = ConnectivityM.DonorLowerCorner(iDonor);
       if (MGrid.LocalRange().Contains(CellLower) && DestinationRanks(iDonor) < 0) {
-        tuple<int> Point = {
-          Destinations(0,iDonor),
-          Destinations(1,iDonor),
-          Destinations(2,iDonor)
-        };
-        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + NGridGlobalIndexer.ToIndex(Point);
+        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + ConnectivityM.DestinationIndex(
+          iDonor);
         int iLinearPartition = int(iLinearPoint/LinearPartitionSize);
         send_recv &Send = MSends(iLinearPartition);
         DestinationRanks(iDonor) = Send.Ranks(Send.Count);
@@ -716,20 +614,13 @@ void exchanger::UpdateSourceDestRanks_() {
 
   for (auto &ConnectivityID : ConnectivityNIDs) {
     int NGridID = ConnectivityID(1);
-    const grid &NGrid = Domain.Grid(NGridID);
-    range_indexer_c<long long> NGridGlobalIndexer(NGrid.GlobalRange());
     local_n &LocalN = LocalNs_(ConnectivityID);
     const connectivity_n &ConnectivityN = *LocalN.Connectivity;
-    const array<int,2> &Points = ConnectivityN.Points();
     array<int> &SourceRanks = LocalN.SourceRanks;
     for (long long iReceiver = 0; iReceiver < ConnectivityN.Size(); ++iReceiver) {
       if (SourceRanks(iReceiver) < 0) {
-        tuple<int> Point = {
-          Points(0,iReceiver),
-          Points(1,iReceiver),
-          Points(2,iReceiver)
-        };
-        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + NGridGlobalIndexer.ToIndex(Point);
+        long long iLinearPoint = NumPointsBeforeGrid(NGridID) + ConnectivityN.PointIndex(
+          iReceiver);
         int iLinearPartition = int(iLinearPoint/LinearPartitionSize);
         send_recv &Send = NSends(iLinearPartition);
         SourceRanks(iReceiver) = Send.Ranks(Send.Count);
@@ -744,14 +635,9 @@ void exchanger::UpdateSourceDestRanks_() {
       const grid &MGrid = Domain.Grid(MGridID);
       const local_m &LocalM = LocalMs_(ConnectivityID);
       const connectivity_m &ConnectivityM = *LocalM.Connectivity;
-      const array<int,3> &Extents = ConnectivityM.Extents();
       const array<int> &DestinationRanks = LocalM.DestinationRanks;
       for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
-        tuple<int> CellLower = {
-          Extents(0,0,iDonor),
-          Extents(0,1,iDonor),
-          Extents(0,2,iDonor)
-        };
+        tuple<int> CellLower = ConnectivityM.DonorLowerCorner(iDonor);
         OVK_DEBUG_ASSERT(DestinationRanks(iDonor) >= 0 || !MGrid.LocalRange().Contains(CellLower),
           "Failed to connect donor cell (%i,%i,%i) of grid %s to receiver point.", CellLower(0),
           CellLower(1), CellLower(2), MGrid.Name());
@@ -762,12 +648,11 @@ void exchanger::UpdateSourceDestRanks_() {
       const grid &NGrid = Domain.Grid(NGridID);
       const local_n &LocalN = LocalNs_(ConnectivityID);
       const connectivity_n &ConnectivityN = *LocalN.Connectivity;
-      const array<int,2> &Points = ConnectivityN.Points();
       const array<int> &SourceRanks = LocalN.SourceRanks;
       for (long long iReceiver = 0; iReceiver < ConnectivityN.Size(); ++iReceiver) {
+        tuple<int> Point = ConnectivityN.Point(iReceiver);
         OVK_DEBUG_ASSERT(SourceRanks(iReceiver) >= 0, "Failed to connect receiver point (%i,%i,%i) "
-          "of grid %s to donor cell.", Points(0,iReceiver), Points(1,iReceiver), Points(2,
-          iReceiver), NGrid.Name());
+          "of grid %s to donor cell.", Point(0), Point(1), Point(2), NGrid.Name());
       }
     }
   }
@@ -793,9 +678,19 @@ void exchanger::ResetExchanges_() {
       const connectivity_m &ConnectivityM = *LocalM.Connectivity;
       LocalM.Collects.Clear();
       LocalM.Sends.Clear();
-      LocalM.CollectMap = core::collect_map(MGrid.Partition(), ConnectivityM.Extents());
-      array<long long> Order = GetSendRecvOrder(ConnectivityM.Destinations(),
-        NGridInfo.Cart().Range());
+      array<long long> Order;
+      if (ConnectivityM.Compact()) {
+        LocalM.CollectMap = core::collect_map(MGrid.Partition(), ConnectivityM.LowerCorners(),
+          ConnectivityM.MaxStencilSize());
+        Order = GetSendRecvOrder(ConnectivityM.DestinationIndices());
+      } else {
+        LocalM.CollectMap = core::collect_map(MGrid.Partition(), ConnectivityM.Extents());
+        array<long long> DestinationIndices({ConnectivityM.Size()});
+        for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
+          DestinationIndices(iDonor) = ConnectivityM.DestinationIndex(iDonor);
+        }
+        Order = GetSendRecvOrder(DestinationIndices);
+      }
       LocalM.SendMap = core::send_map(LocalM.DestinationRanks, std::move(Order));
     }
     if (NGridInfo.IsLocal()) {
@@ -804,9 +699,19 @@ void exchanger::ResetExchanges_() {
       const connectivity_n &ConnectivityN = *LocalN.Connectivity;
       LocalN.Recvs.Clear();
       LocalN.Disperses.Clear();
-      array<long long> Order = GetSendRecvOrder(ConnectivityN.Points(), NGrid.GlobalRange());
+      array<long long> Order;
+      if (ConnectivityN.Compact()) {
+        Order = GetSendRecvOrder(ConnectivityN.PointIndices());
+        LocalN.DisperseMap = core::disperse_map(NGrid.GlobalRange(), ConnectivityN.PointIndices());
+      } else {
+        array<long long> PointIndices({ConnectivityN.Size()});
+        for (long long iReceiver = 0; iReceiver < ConnectivityN.Size(); ++iReceiver) {
+          PointIndices(iReceiver) = ConnectivityN.PointIndex(iReceiver);
+        }
+        Order = GetSendRecvOrder(PointIndices);
+        LocalN.DisperseMap = core::disperse_map(ConnectivityN.Points());
+      }
       LocalN.RecvMap = core::recv_map(LocalN.SourceRanks, std::move(Order));
-      LocalN.DisperseMap = core::disperse_map(ConnectivityN.Points());
     }
   }
 
@@ -928,8 +833,20 @@ void exchanger::CreateCollect(const elem<int,2> &ConnectivityID, int CollectID,
     break;
   case collect_op::INTERPOLATE:
     {
-    floating_ref<const array<double,3>> InterpCoefs = FloatingRefRebind(ConnectivityM.
-      GetFloatingRef(), ConnectivityM.InterpCoefs());
+    core::interp_coefs_ref InterpCoefs;
+    switch (ConnectivityM.InterpCoefsStorage()) {
+    case interp_coefs_storage::DOUBLE:
+      InterpCoefs = FloatingRefRebind(ConnectivityM.GetFloatingRef(), ConnectivityM.InterpCoefs());
+      break;
+    case interp_coefs_storage::FLOAT:
+      InterpCoefs = FloatingRefRebind(ConnectivityM.GetFloatingRef(), ConnectivityM.
+        FloatInterpCoefs());
+      break;
+    case interp_coefs_storage::LAGRANGE:
+      InterpCoefs = core::interp_coefs_ref(MGrid.Dimension(), ConnectivityM.MaxStencilSize(),
+        FloatingRefRebind(ConnectivityM.GetFloatingRef(), ConnectivityM.Coords()));
+      break;
+    }
 #ifdef OVK_HAVE_OPENMP
     Collect = core::CreateCollectInterpThreaded(Domain.SharedContext(), GridComm, Cart, LocalRange,
       CollectMap, ValueType, Count, GridValuesRange, GridValuesLayout, InterpCoefs);
@@ -1560,23 +1477,9 @@ long long BinDivide(long long N, int NumBins) {
 
 }
 
-array<long long> GetSendRecvOrder(const array<int,2> &ReceiverPoints, const range
-  &ReceiverGridGlobalRange) {
+array<long long> GetSendRecvOrder(const array<long long> &ReceiverIndices) {
 
-  long long NumReceivers = ReceiverPoints.Size(1);
-
-  range_indexer_c<long long> ReceiverGridGlobalIndexer(ReceiverGridGlobalRange);
-
-  array<long long> ReceiverIndices({NumReceivers});
-
-  for (long long iReceiver = 0; iReceiver < NumReceivers; ++iReceiver) {
-    tuple<int> Point = {
-      ReceiverPoints(0,iReceiver),
-      ReceiverPoints(1,iReceiver),
-      ReceiverPoints(2,iReceiver)
-    };
-    ReceiverIndices(iReceiver) = ReceiverGridGlobalIndexer.ToIndex(Point);
-  }
+  long long NumReceivers = ReceiverIndices.Count();
 
   bool Sorted = true;
 
@@ -4,22 +4,41 @@
 #ifndef OVK_CORE_FIELD_HPP_INCLUDED
 #define OVK_CORE_FIELD_HPP_INCLUDED
 
+#include <ovk/core/AlignedAllocator.hpp>
 #include <ovk/core/Array.hpp>
 #include <ovk/core/Indexer.hpp>
 #include <ovk/core/Global.hpp>
 
+#include <memory>
+
 namespace ovk {
 
-template <typename T> using field = array_c<T,MAX_DIMS>;
+template <typename T, typename Allocator=std::allocator<T>> using field = array_c<T,MAX_DIMS,
+  Allocator>;
 template <typename T> using field_view = array_view_c<T,MAX_DIMS>;
 
 using field_indexer = indexer_c<long long,int,MAX_DIMS>;
 
+// Stored in ARRAY_TILE_SIZE^3 tiles, so that stencil and interpolation neighborhoods touch fewer
+// cache lines than with field's column-major layout
+template <typename T, typename Allocator=std::allocator<T>> using tiled_field = array_t<T,
+  MAX_DIMS,Allocator>;
+template <typename T> using tiled_field_view = array_view_t<T,MAX_DIMS>;
+
+using tiled_field_indexer = indexer_t<long long,int,MAX_DIMS>;
+
 namespace core {
+// For fields whose kernels benefit from aligned vector loads
+template <typename T> using aligned_field = field<T,aligned_allocator<T>>;
+template <typename T> using aligned_tiled_field = tiled_field<T,aligned_allocator<T>>;
+
 template <typename T> constexpr bool IsField() {
   return IsArray<T>() && ArrayRank<T>() == MAX_DIMS && ArrayLayout<T>() ==
     array_layout::COLUMN_MAJOR;
 }
+template <typename T> constexpr bool IsTiledField() {
+  return IsArray<T>() && ArrayRank<T>() == MAX_DIMS && ArrayLayout<T>() == array_layout::TILED;
+}
 }
 
 }
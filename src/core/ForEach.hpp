@@ -6,6 +6,7 @@
 
 #include <ovk/core/Elem.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/Indexer.hpp>
 #include <ovk/core/Interval.hpp>
 #include <ovk/core/TypeSequence.hpp>
 #include <ovk/core/TypeTraits.hpp>
@@ -83,14 +84,113 @@ template <int N> struct helper<N, 0, array_layout::COLUMN_MAJOR> {
   }
 };
 
+template <array_layout Layout> struct layout_helper {
+  template <typename T, int N, typename FRef> static OVK_FORCE_INLINE void ForEach(const
+    interval<T,N> &Interval, FRef &&Func) {
+    // Have to use N-1 and count down because we can specialize on (N, 0) but not (N, N-1)
+    helper<N, N-1, Layout>::ForEach(Interval, std::forward<FRef>(Func));
+  }
+};
+
+// Visits one tile at a time (in the order they are stored) so that accesses stay within a tile
+template <> struct layout_helper<array_layout::TILED> {
+  template <typename T, int N, typename FRef> static OVK_FORCE_INLINE void ForEach(const
+    interval<T,N> &Interval, FRef &&Func) {
+    interval<T,N> TileInterval;
+    for (int iDim = 0; iDim < N; ++iDim) {
+      TileInterval.Begin(iDim) = 0;
+      TileInterval.End(iDim) = (Interval.Size(iDim)+ARRAY_TILE_SIZE-1)/ARRAY_TILE_SIZE;
+    }
+    helper<N, N-1, array_layout::COLUMN_MAJOR>::ForEach(TileInterval, [&](const elem<T,N>
+      &Tile) {
+      interval<T,N> TileValuesInterval;
+      for (int iDim = 0; iDim < N; ++iDim) {
+        TileValuesInterval.Begin(iDim) = Interval.Begin(iDim) + ARRAY_TILE_SIZE*Tile(iDim);
+        TileValuesInterval.End(iDim) = Min(TileValuesInterval.Begin(iDim)+ARRAY_TILE_SIZE,
+          Interval.End(iDim));
+      }
+      helper<N, N-1, array_layout::COLUMN_MAJOR>::ForEach(TileValuesInterval, Func);
+    });
+  }
+};
+
+// Walks the interval in the indexer's storage order, carrying the linear index along and
+// advancing it by the per-dimension strides instead of recomputing it for each tuple (innermost
+// dimension is always contiguous)
+template <int N, int I, array_layout Layout> struct in_range_helper;
+template <int N, int I> struct in_range_helper<N, I, array_layout::ROW_MAJOR> {
+  template <typename T, typename IndexType, typename FRef, typename... TupleElementTypes> static
+    OVK_FORCE_INLINE void ForEach(const interval<T,N> &Interval, const elem<IndexType,N> &Stride,
+    FRef &&Func, IndexType Index, TupleElementTypes... TupleElements) {
+    for (T i = Interval.Begin(N-1-I); i < Interval.End(N-1-I); ++i) {
+      in_range_helper<N, I-1, array_layout::ROW_MAJOR>::ForEach(Interval, Stride,
+        std::forward<FRef>(Func), Index, TupleElements..., i);
+      Index += Stride(N-1-I);
+    }
+  }
+};
+template <int N, int I> struct in_range_helper<N, I, array_layout::COLUMN_MAJOR> {
+  template <typename T, typename IndexType, typename FRef, typename... TupleElementTypes> static
+    OVK_FORCE_INLINE void ForEach(const interval<T,N> &Interval, const elem<IndexType,N> &Stride,
+    FRef &&Func, IndexType Index, TupleElementTypes... TupleElements) {
+    for (T i = Interval.Begin(I); i < Interval.End(I); ++i) {
+      in_range_helper<N, I-1, array_layout::COLUMN_MAJOR>::ForEach(Interval, Stride,
+        std::forward<FRef>(Func), Index, i, TupleElements...);
+      Index += Stride(I);
+    }
+  }
+};
+template <int N> struct in_range_helper<N, 0, array_layout::ROW_MAJOR> {
+  template <typename T, typename IndexType, typename FRef, typename... TupleElementTypes> static
+    OVK_FORCE_INLINE void ForEach(const interval<T,N> &Interval, const elem<IndexType,N> &,
+    FRef &&Func, IndexType Index, TupleElementTypes... TupleElements) {
+    for (T i = Interval.Begin(N-1); i < Interval.End(N-1); ++i) {
+      std::forward<FRef>(Func)(elem<T,N>(TupleElements...,i), Index);
+      ++Index;
+    }
+  }
+};
+template <int N> struct in_range_helper<N, 0, array_layout::COLUMN_MAJOR> {
+  template <typename T, typename IndexType, typename FRef, typename... TupleElementTypes> static
+    OVK_FORCE_INLINE void ForEach(const interval<T,N> &Interval, const elem<IndexType,N> &,
+    FRef &&Func, IndexType Index, TupleElementTypes... TupleElements) {
+    for (T i = Interval.Begin(0); i < Interval.End(0); ++i) {
+      std::forward<FRef>(Func)(elem<T,N>(i,TupleElements...), Index);
+      ++Index;
+    }
+  }
+};
+
 }
 
 template <array_layout Layout=array_layout::ROW_MAJOR, typename T, int N, typename FRef,
   OVK_FUNCTION_REQUIRES(IsCallableWith<FRef &&, const elem<T,N> &>() || for_each_internal::
   IsCallableWithTupleElements<FRef &&, T, N>())> OVK_FORCE_INLINE void ForEach(const interval<T,N>
   &Interval, FRef &&Func) {
-  // Have to use N-1 and count down because we can specialize on (N, 0) but not (N, N-1)
-  return for_each_internal::helper<N, N-1, Layout>::ForEach(Interval, std::forward<FRef>(Func));
+  return for_each_internal::layout_helper<Layout>::ForEach(Interval, std::forward<FRef>(Func));
+}
+
+// Calls Func(Tuple, Index) for each tuple in Interval, where Index is the tuple's linear index
+// according to Indexer (which must cover Interval); visits tuples in the indexer's storage order
+template <typename T, int N, typename IndexType, typename TupleElementType, array_layout Layout,
+  typename FRef, OVK_FUNCTION_REQUIRES(Layout != array_layout::TILED && IsCallableWith<FRef &&,
+  const elem<T,N> &, IndexType>())> OVK_FORCE_INLINE void ForEachInRange(const interval<T,N>
+  &Interval, const indexer<IndexType,TupleElementType,N,Layout> &Indexer, FRef &&Func) {
+  // Local copies so that stores made by Func can't be assumed to modify them
+  interval<T,N> LocalInterval = Interval;
+  elem<IndexType,N> Stride = Indexer.Stride();
+  for_each_internal::in_range_helper<N, N-1, Layout>::ForEach(LocalInterval, Stride,
+    std::forward<FRef>(Func), Indexer.ToIndex(Interval.Begin()));
+}
+
+// Tiled indexers have no per-dimension strides, so index each tuple directly
+template <typename T, int N, typename IndexType, typename TupleElementType, array_layout Layout,
+  typename FRef, OVK_FUNCTION_REQUIRES(Layout == array_layout::TILED && IsCallableWith<FRef &&,
+  const elem<T,N> &, IndexType>())> OVK_FORCE_INLINE void ForEachInRange(const interval<T,N>
+  &Interval, const indexer<IndexType,TupleElementType,N,Layout> &Indexer, FRef &&Func) {
+  for_each_internal::layout_helper<Layout>::ForEach(Interval, [&](const elem<T,N> &Tuple) {
+    std::forward<FRef>(Func)(Tuple, Indexer.ToIndex(Tuple));
+  });
 }
 
 }}
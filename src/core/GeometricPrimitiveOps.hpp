@@ -5,6 +5,7 @@
 #define OVK_CORE_GEOMETRIC_PRIMITIVE_OPS_HPP_INCLUDED
 
 #include <ovk/core/ArrayView.hpp>
+#include <ovk/core/Debug.hpp>
 #include <ovk/core/Elem.hpp>
 #include <ovk/core/Global.hpp>
 #include <ovk/core/Math.hpp>
@@ -71,6 +72,36 @@ elem<double,3> IsoHex64Node(const array_view<const elem<double,3>> &NodeCoords,
 optional<elem<double,3>> IsoHex64NodeInverse(const array_view<const elem<double,3>> &NodeCoords,
   const elem<double,3> &Coords, double Tolerance=1.e-12, int MaxSteps=100);
 
+// Number of points processed together by the batched inverses. 8 doubles fill one AVX-512 register
+// or two AVX registers; with AVX2 a width of 8 is still faster than scalar, while a width of 4 is
+// not. Without AVX the batched inverses are slower than the scalar ones at any width, so by default
+// (GEOMETRY_BATCH=AUTO in CMake) batching is only enabled when compiling for AVX
+constexpr int GEOMETRY_BATCH_WIDTH = 8;
+#if OVK_GEOMETRY_BATCH > 0 || (OVK_GEOMETRY_BATCH < 0 && defined(__AVX__))
+constexpr bool GEOMETRY_BATCH_ENABLED = true;
+#else
+constexpr bool GEOMETRY_BATCH_ENABLED = false;
+#endif
+
+// Batched inverses solve for many points at once. Data is laid out as structure-of-arrays with the
+// point index varying fastest, i.e., NodeCoords(iDim,iNode,iPoint), Coords(iDim,iPoint), and
+// LocalCoords(iDim,iPoint). Converged(iPoint) is false if the solve failed for that point
+void IsoLine4NodeInverseBatch(const array_view<const double,2> &NodeCoords, const array_view<const
+  double> &Coords, const array_view<double> &LocalCoords, const array_view<bool> &Converged, double
+  Tolerance=1.e-12, int MaxSteps=100);
+void IsoQuad4NodeNonUniformInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance=1.e-12, int MaxSteps=100);
+void IsoQuad16NodeInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance=1.e-12, int MaxSteps=100);
+void IsoHex8NodeNonUniformInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance=1.e-12, int MaxSteps=100);
+void IsoHex64NodeInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance=1.e-12, int MaxSteps=100);
+
 bool OverlapsLine(double LowerNodeCoord, double UpperNodeCoord, double Coords, double
   Tolerance=1.e-12);
 bool OverlapsQuadUniform(const elem<double,2> &LowerNodeCoords, const elem<double,2>
@@ -101,5 +132,6 @@ double VolumeHexNonUniform(const array_view<const elem<double,3>> &NodeCoords);
 #include <ovk/core/GeometricPrimitiveOpsLine.inl>
 #include <ovk/core/GeometricPrimitiveOpsQuad.inl>
 #include <ovk/core/GeometricPrimitiveOpsHex.inl>
+#include <ovk/core/GeometricPrimitiveOpsBatch.inl>
 
 #endif
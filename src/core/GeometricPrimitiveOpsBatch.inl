@@ -0,0 +1,248 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+namespace ovk {
+namespace core {
+
+namespace geometric_primitive_ops_internal {
+
+template <int NumNodesPerDim> struct iso_shape;
+
+template <> struct iso_shape<2> {
+  static elem<double,2> Interp(double U) { return LagrangeInterpLinear(U); }
+  static elem<double,2> InterpDeriv(double U) { return LagrangeInterpLinearDeriv(U); }
+};
+
+template <> struct iso_shape<4> {
+  static elem<double,4> Interp(double U) { return LagrangeInterpCubic(U); }
+  static elem<double,4> InterpDeriv(double U) { return LagrangeInterpCubicDeriv(U); }
+};
+
+inline elem<double,1> IsoNewtonStep(const elem<double,1> (&Jacobian)[1], const elem<double,1>
+  &Error) {
+  return {Error(0)/Jacobian[0](0)};
+}
+
+inline elem<double,2> IsoNewtonStep(const elem<double,2> (&Jacobian)[2], const elem<double,2>
+  &Error) {
+  return ColumnSolve2D(Jacobian[0], Jacobian[1], Error);
+}
+
+inline elem<double,3> IsoNewtonStep(const elem<double,3> (&Jacobian)[3], const elem<double,3>
+  &Error) {
+  return ColumnSolve3D(Jacobian[0], Jacobian[1], Jacobian[2], Error);
+}
+
+// Same Newton iteration as the scalar inverses, applied to GEOMETRY_BATCH_WIDTH points at a time.
+// Each step is evaluated for all lanes in structure-of-arrays form (innermost loops run over the
+// lanes so they can be vectorized); lanes that have converged are masked out of the update so
+// that every point takes exactly the same steps as it would in the scalar version
+template <int NumDims, int NumNodesPerDim> void IsoInverseBatch(const double *NodeCoords, const
+  double *Coords, double *LocalCoords, bool *Converged, long long NumPoints, double Tolerance, int
+  MaxSteps) {
+
+  constexpr int W = GEOMETRY_BATCH_WIDTH;
+  constexpr int N = NumNodesPerDim;
+  constexpr int NumNodes = NumDims == 1 ? N : NumDims == 2 ? N*N : N*N*N;
+
+  using shape = iso_shape<N>;
+
+  auto NodeCoordIndex = [NumPoints](int iDim, int iNode, long long iPoint) -> long long {
+    return (iDim*NumNodes + iNode)*NumPoints + iPoint;
+  };
+
+  for (long long iChunkStart = 0; iChunkStart < NumPoints; iChunkStart += W) {
+
+    int NumLanes = int(Min<long long>(NumPoints-iChunkStart, W));
+
+    // Unused lanes repeat the first point and start out converged
+    double ChunkNodeCoords[NumDims][NumNodes][W];
+    double ChunkCoords[NumDims][W];
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      for (int iNode = 0; iNode < NumNodes; ++iNode) {
+        for (int iLane = 0; iLane < W; ++iLane) {
+          long long iPoint = iChunkStart + (iLane < NumLanes ? iLane : 0);
+          ChunkNodeCoords[iDim][iNode][iLane] = NodeCoords[NodeCoordIndex(iDim,iNode,iPoint)];
+        }
+      }
+      for (int iLane = 0; iLane < W; ++iLane) {
+        long long iPoint = iChunkStart + (iLane < NumLanes ? iLane : 0);
+        ChunkCoords[iDim][iLane] = Coords[iDim*NumPoints+iPoint];
+      }
+    }
+
+    double ChunkLocalCoords[NumDims][W];
+    bool LaneConverged[W];
+    for (int iLane = 0; iLane < W; ++iLane) {
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        ChunkLocalCoords[iDim][iLane] = 0.5;
+      }
+      LaneConverged[iLane] = iLane >= NumLanes;
+    }
+
+    for (int iStep = 0; iStep <= MaxSteps; ++iStep) {
+
+      double Shape[NumDims][N][W];
+      double ShapeDeriv[NumDims][N][W];
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        for (int iLane = 0; iLane < W; ++iLane) {
+          elem<double,N> Interp = shape::Interp(ChunkLocalCoords[iDim][iLane]);
+          elem<double,N> InterpDeriv = shape::InterpDeriv(ChunkLocalCoords[iDim][iLane]);
+          for (int iShape = 0; iShape < N; ++iShape) {
+            Shape[iDim][iShape][iLane] = Interp(iShape);
+            ShapeDeriv[iDim][iShape][iLane] = InterpDeriv(iShape);
+          }
+        }
+      }
+
+      double MappedCoords[NumDims][W];
+      double Jacobian[NumDims][NumDims][W];
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        for (int iLane = 0; iLane < W; ++iLane) {
+          MappedCoords[iDim][iLane] = 0.;
+        }
+        for (int iDeriv = 0; iDeriv < NumDims; ++iDeriv) {
+          for (int iLane = 0; iLane < W; ++iLane) {
+            Jacobian[iDeriv][iDim][iLane] = 0.;
+          }
+        }
+      }
+
+      for (int iNode = 0; iNode < NumNodes; ++iNode) {
+        int NodeIndex[3] = {iNode % N, (iNode/N) % N, iNode/(N*N)};
+        double Weight[W];
+        double DerivWeight[NumDims][W];
+        for (int iLane = 0; iLane < W; ++iLane) {
+          Weight[iLane] = 1.;
+          for (int iDim = 0; iDim < NumDims; ++iDim) {
+            Weight[iLane] *= Shape[iDim][NodeIndex[iDim]][iLane];
+          }
+          for (int iDeriv = 0; iDeriv < NumDims; ++iDeriv) {
+            DerivWeight[iDeriv][iLane] = 1.;
+            for (int iDim = 0; iDim < NumDims; ++iDim) {
+              int iShape = NodeIndex[iDim];
+              DerivWeight[iDeriv][iLane] *= iDim == iDeriv ? ShapeDeriv[iDim][iShape][iLane] :
+                Shape[iDim][iShape][iLane];
+            }
+          }
+        }
+        for (int iDim = 0; iDim < NumDims; ++iDim) {
+          for (int iLane = 0; iLane < W; ++iLane) {
+            double Coord = ChunkNodeCoords[iDim][iNode][iLane];
+            MappedCoords[iDim][iLane] += Weight[iLane] * Coord;
+            for (int iDeriv = 0; iDeriv < NumDims; ++iDeriv) {
+              Jacobian[iDeriv][iDim][iLane] += DerivWeight[iDeriv][iLane] * Coord;
+            }
+          }
+        }
+      }
+
+      double Error[NumDims][W];
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        for (int iLane = 0; iLane < W; ++iLane) {
+          Error[iDim][iLane] = ChunkCoords[iDim][iLane] - MappedCoords[iDim][iLane];
+        }
+      }
+
+      bool AllConverged = true;
+      for (int iLane = 0; iLane < W; ++iLane) {
+        bool SmallEnough = true;
+        for (int iDim = 0; iDim < NumDims; ++iDim) {
+          SmallEnough = SmallEnough && std::abs(Error[iDim][iLane]) <= Tolerance;
+        }
+        LaneConverged[iLane] = LaneConverged[iLane] || SmallEnough;
+        AllConverged = AllConverged && LaneConverged[iLane];
+      }
+      if (AllConverged || iStep == MaxSteps) break;
+
+      for (int iLane = 0; iLane < W; ++iLane) {
+        elem<double,NumDims> LaneJacobian[NumDims];
+        elem<double,NumDims> LaneError;
+        for (int iDim = 0; iDim < NumDims; ++iDim) {
+          for (int iDeriv = 0; iDeriv < NumDims; ++iDeriv) {
+            LaneJacobian[iDeriv](iDim) = Jacobian[iDeriv][iDim][iLane];
+          }
+          LaneError(iDim) = Error[iDim][iLane];
+        }
+        elem<double,NumDims> Step = IsoNewtonStep(LaneJacobian, LaneError);
+        for (int iDim = 0; iDim < NumDims; ++iDim) {
+          double Updated = ChunkLocalCoords[iDim][iLane] + Step(iDim);
+          ChunkLocalCoords[iDim][iLane] = LaneConverged[iLane] ? ChunkLocalCoords[iDim][iLane] :
+            Updated;
+        }
+      }
+
+    }
+
+    for (int iLane = 0; iLane < NumLanes; ++iLane) {
+      long long iPoint = iChunkStart + iLane;
+      bool IsFinite = true;
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        LocalCoords[iDim*NumPoints+iPoint] = ChunkLocalCoords[iDim][iLane];
+        IsFinite = IsFinite && !IsNaN(ChunkLocalCoords[iDim][iLane]);
+      }
+      Converged[iPoint] = LaneConverged[iLane] && IsFinite;
+    }
+
+  }
+
+}
+
+}
+
+inline void IsoLine4NodeInverseBatch(const array_view<const double,2> &NodeCoords, const
+  array_view<const double> &Coords, const array_view<double> &LocalCoords, const array_view<bool>
+  &Converged, double Tolerance, int MaxSteps) {
+
+  OVK_DEBUG_ASSERT(NodeCoords.Size(0) == 4, "Incorrect number of nodes.");
+
+  geometric_primitive_ops_internal::IsoInverseBatch<1,4>(NodeCoords.Data(), Coords.Data(),
+    LocalCoords.Data(), Converged.Data(), Coords.Count(), Tolerance, MaxSteps);
+
+}
+
+inline void IsoQuad4NodeNonUniformInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance, int MaxSteps) {
+
+  OVK_DEBUG_ASSERT(NodeCoords.Size(1) == 4, "Incorrect number of nodes.");
+
+  geometric_primitive_ops_internal::IsoInverseBatch<2,2>(NodeCoords.Data(), Coords.Data(),
+    LocalCoords.Data(), Converged.Data(), Coords.Size(1), Tolerance, MaxSteps);
+
+}
+
+inline void IsoQuad16NodeInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance, int MaxSteps) {
+
+  OVK_DEBUG_ASSERT(NodeCoords.Size(1) == 16, "Incorrect number of nodes.");
+
+  geometric_primitive_ops_internal::IsoInverseBatch<2,4>(NodeCoords.Data(), Coords.Data(),
+    LocalCoords.Data(), Converged.Data(), Coords.Size(1), Tolerance, MaxSteps);
+
+}
+
+inline void IsoHex8NodeNonUniformInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance, int MaxSteps) {
+
+  OVK_DEBUG_ASSERT(NodeCoords.Size(1) == 8, "Incorrect number of nodes.");
+
+  geometric_primitive_ops_internal::IsoInverseBatch<3,2>(NodeCoords.Data(), Coords.Data(),
+    LocalCoords.Data(), Converged.Data(), Coords.Size(1), Tolerance, MaxSteps);
+
+}
+
+inline void IsoHex64NodeInverseBatch(const array_view<const double,3> &NodeCoords, const
+  array_view<const double,2> &Coords, const array_view<double,2> &LocalCoords, const
+  array_view<bool> &Converged, double Tolerance, int MaxSteps) {
+
+  OVK_DEBUG_ASSERT(NodeCoords.Size(1) == 64, "Incorrect number of nodes.");
+
+  geometric_primitive_ops_internal::IsoInverseBatch<3,4>(NodeCoords.Data(), Coords.Data(),
+    LocalCoords.Data(), Converged.Data(), Coords.Size(1), Tolerance, MaxSteps);
+
+}
+
+}}
@@ -67,7 +67,7 @@ geometry::geometry(std::shared_ptr<context> &&Context, const grid &Grid, params
   const range &ExtendedRange = Grid.ExtendedRange();
 
   for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
-    Coords_(iDim).Assign(Grid.SharedPartition());
+    Coords_(iDim).AssignUninitialized(Grid.SharedPartition());
   }
 
   for (int k = ExtendedRange.Begin(2); k < ExtendedRange.End(2); ++k) {
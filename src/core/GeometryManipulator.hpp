@@ -28,6 +28,16 @@ template <geometry_type Type_, int NumDims> struct geometry_manipulator_for_type
     const tuple<int> &Cell, const tuple<double> &PointCoords) const {
     return core::CoordsInCell<Type_, NumDims>(Coords, Cell, PointCoords);
   }
+  void CoordsInCells(const array_view<const field_view<const double>> &Coords, const array_view<
+    const tuple<int>> &Cells, const tuple<double> &PointCoords, const array_view<optional<
+    tuple<double>>> &MaybeLocalCoords) const {
+    core::CoordsInCells<Type_, NumDims>(Coords, Cells, PointCoords, MaybeLocalCoords);
+  }
+  void CoordsInCells(const array_view<const field_view<const double>> &Coords, const array_view<
+    const tuple<int>> &Cells, const array_view<const tuple<double>> &PointCoords, const
+    array_view<optional<tuple<double>>> &MaybeLocalCoords) const {
+    core::CoordsInCells<Type_, NumDims>(Coords, Cells, PointCoords, MaybeLocalCoords);
+  }
   double CellVolume(const array_view<const field_view<const double>> &Coords, const tuple<int>
     &Cell) const {
     return core::CellVolume<Type_, NumDims>(Coords, Cell);
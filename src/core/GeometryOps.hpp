@@ -12,10 +12,13 @@
 #include <ovk/core/GeometricPrimitiveOps.hpp>
 #include <ovk/core/GeometryBase.hpp>
 #include <ovk/core/Global.hpp>
+#include <ovk/core/Optional.hpp>
 #include <ovk/core/Range.hpp>
 #include <ovk/core/ScalarOps.hpp>
 #include <ovk/core/Tuple.hpp>
 
+#include <cmath>
+
 namespace ovk {
 namespace core {
 
@@ -26,6 +29,19 @@ template <geometry_type Type, int NumDims> optional<tuple<double>> CoordsInCell(
   const field_view<const double>> &Coords, const tuple<int> &Cell, const tuple<double>
   &PointCoords);
 
+// Same as CoordsInCell, but for a single point and several candidate cells at once. Curvilinear
+// cells are solved in batches if UseBatches is true
+template <geometry_type Type, int NumDims> void CoordsInCells(const array_view<const field_view<
+  const double>> &Coords, const array_view<const tuple<int>> &Cells, const tuple<double>
+  &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool
+  UseBatches=GEOMETRY_BATCH_ENABLED);
+
+// Same as above, but with a different point for each cell
+template <geometry_type Type, int NumDims> void CoordsInCells(const array_view<const field_view<
+  const double>> &Coords, const array_view<const tuple<int>> &Cells, const array_view<const
+  tuple<double>> &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool
+  UseBatches=GEOMETRY_BATCH_ENABLED);
+
 template <geometry_type Type, int NumDims> double CellVolume(const array_view<const field_view<const
   double>> &Coords, const tuple<int> &Cell);
 
@@ -20,6 +20,286 @@ template <> inline box CellBounds<geometry_type::CURVILINEAR, 2>(const array_vie
 template <> inline box CellBounds<geometry_type::CURVILINEAR, 3>(const array_view<const
   field_view<const double>> &Coords, const tuple<int> &Cell);
 
+namespace geometry_ops_internal {
+
+// Rectilinear cells map each axis independently, so the (tensor-product) isoparametric inverse
+// reduces to a 1D inverse per axis. NodeCoord(iNode) returns the coordinate along the axis of the
+// iNode-th node on the grid line through the cell. Uses the same cubic mapping as curvilinear
+// grids where the stencil fits, and falls back to linear near the edges of small grids
+template <typename F> optional<double> AxisCoordInCell(F &&NodeCoord, int Cell, int NodeBegin, int
+  NodeEnd, double PointCoord) {
+
+  optional<double> MaybeLocalCoord;
+
+  int ShiftedCell = Cell;
+  ShiftedCell = Max<int>(ShiftedCell, NodeBegin+1);
+  ShiftedCell = Min<int>(ShiftedCell, NodeEnd-3);
+
+  bool StencilFits = ShiftedCell-1 >= NodeBegin && ShiftedCell+2 < NodeEnd;
+
+  if (StencilFits) {
+    double NodeCoords[4];
+    for (int iNode = 0; iNode < 4; ++iNode) {
+      NodeCoords[iNode] = NodeCoord(ShiftedCell-1+iNode);
+    }
+    MaybeLocalCoord = IsoLine4NodeInverse(NodeCoords, PointCoord);
+    if (MaybeLocalCoord) {
+      *MaybeLocalCoord += double(ShiftedCell - Cell);
+    }
+  } else {
+    MaybeLocalCoord = IsoLine2NodeInverse(NodeCoord(Cell), NodeCoord(Cell+1), PointCoord);
+  }
+
+  return MaybeLocalCoord;
+
+}
+
+template <int NumDims> optional<tuple<double>> CoordsInCellRectilinear(const array_view<const
+  field_view<const double>> &Coords, const tuple<int> &Cell, const tuple<double> &PointCoords) {
+
+  optional<tuple<double>> MaybeLocalCoords;
+
+  const range &Extents = Coords(0).Extents();
+
+  tuple<double> LocalCoords = {0.,0.,0.};
+  for (int iDim = 0; iDim < NumDims; ++iDim) {
+    tuple<int> Node = Cell;
+    auto NodeCoord = [&](int iNode) -> double {
+      Node(iDim) = iNode;
+      return Coords(iDim)(Node);
+    };
+    auto MaybeLocalCoord = AxisCoordInCell(NodeCoord, Cell(iDim), Extents.Begin(iDim),
+      Extents.End(iDim), PointCoords(iDim));
+    if (!MaybeLocalCoord) return MaybeLocalCoords;
+    LocalCoords(iDim) = *MaybeLocalCoord;
+  }
+
+  MaybeLocalCoords = LocalCoords;
+
+  return MaybeLocalCoords;
+
+}
+
+template <int NumDims> optional<tuple<double>> CoordsInCellOrientedRectilinear(const array_view<
+  const field_view<const double>> &Coords, const tuple<int> &Cell, const tuple<double>
+  &PointCoords) {
+
+  optional<tuple<double>> MaybeLocalCoords;
+
+  const range &Extents = Coords(0).Extents();
+
+  long long iOrigin = Coords(0).Indexer().ToIndex(Cell);
+
+  tuple<double> Origin = {0.,0.,0.};
+  for (int iDim = 0; iDim < NumDims; ++iDim) {
+    Origin(iDim) = Coords(iDim)[iOrigin];
+  }
+
+  tuple<double> LocalCoords = {0.,0.,0.};
+  for (int iAxis = 0; iAxis < NumDims; ++iAxis) {
+    tuple<int> Node = Cell;
+    Node(iAxis) = Cell(iAxis)+1;
+    tuple<double> Axis = {0.,0.,0.};
+    double AxisLengthSq = 0.;
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      Axis(iDim) = Coords(iDim)(Node) - Origin(iDim);
+      AxisLengthSq += Axis(iDim)*Axis(iDim);
+    }
+    double AxisLength = std::sqrt(AxisLengthSq);
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      Axis(iDim) /= AxisLength;
+    }
+    auto NodeCoord = [&](int iNode) -> double {
+      Node(iAxis) = iNode;
+      long long iPoint = Coords(0).Indexer().ToIndex(Node);
+      double Coord = 0.;
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        Coord += (Coords(iDim)[iPoint] - Origin(iDim))*Axis(iDim);
+      }
+      return Coord;
+    };
+    double PointCoord = 0.;
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      PointCoord += (PointCoords(iDim) - Origin(iDim))*Axis(iDim);
+    }
+    auto MaybeLocalCoord = AxisCoordInCell(NodeCoord, Cell(iAxis), Extents.Begin(iAxis),
+      Extents.End(iAxis), PointCoord);
+    if (!MaybeLocalCoord) return MaybeLocalCoords;
+    LocalCoords(iAxis) = *MaybeLocalCoord;
+  }
+
+  MaybeLocalCoords = LocalCoords;
+
+  return MaybeLocalCoords;
+
+}
+
+// CellPointCoords(iCell) returns the coordinates of the point to locate in the iCell-th cell
+template <int NumDims, typename F> void CoordsInCellsCurvilinear(const array_view<const
+  field_view<const double>> &Coords, const array_view<const tuple<int>> &Cells, F
+  &&CellPointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool
+  UseBatches) {
+
+  constexpr int W = GEOMETRY_BATCH_WIDTH;
+  constexpr int NumNodes = NumDims == 2 ? 16 : 64;
+
+  const range &Extents = Coords(0).Extents();
+
+  long long NumCells = Cells.Count();
+
+  for (long long iChunkStart = 0; iChunkStart < NumCells; iChunkStart += W) {
+
+    long long iChunkEnd = Min<long long>(iChunkStart+W, NumCells);
+
+    long long BatchCells[W];
+    tuple<int> BatchShiftedCells[W];
+    int NumBatch = 0;
+    for (long long iCell = iChunkStart; iCell < iChunkEnd; ++iCell) {
+      MaybeLocalCoords(iCell).Reset();
+      const tuple<int> &Cell = Cells(iCell);
+      tuple<int> ShiftedCell = Cell;
+      bool StencilFits = true;
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        ShiftedCell(iDim) = Max<int>(ShiftedCell(iDim), Extents.Begin(iDim)+1);
+        ShiftedCell(iDim) = Min<int>(ShiftedCell(iDim), Extents.End(iDim)-3);
+        if (ShiftedCell(iDim)-1 < Extents.Begin(iDim) || ShiftedCell(iDim)+2 >=
+          Extents.End(iDim)) {
+          StencilFits = false;
+          break;
+        }
+      }
+      if (StencilFits) {
+        BatchCells[NumBatch] = iCell;
+        BatchShiftedCells[NumBatch] = ShiftedCell;
+        ++NumBatch;
+      }
+    }
+
+    // A partly filled batch still pays for all W lanes, which is slower than solving the few
+    // cells one at a time (the usual case when searching a single point's candidate cells)
+    if (!UseBatches || NumBatch < W) {
+      for (int iBatch = 0; iBatch < NumBatch; ++iBatch) {
+        long long iCell = BatchCells[iBatch];
+        MaybeLocalCoords(iCell) = CoordsInCell<geometry_type::CURVILINEAR, NumDims>(Coords,
+          Cells(iCell), CellPointCoords(iCell));
+      }
+      continue;
+    }
+
+    double NodeCoords[NumDims*NumNodes*W];
+    double PointCoordsBatch[NumDims*W];
+    double LocalCoords[NumDims*W];
+    bool Converged[W];
+
+    for (int iBatch = 0; iBatch < NumBatch; ++iBatch) {
+      const tuple<int> &ShiftedCell = BatchShiftedCells[iBatch];
+      int iNode = 0;
+      for (int k = ShiftedCell(2)-(NumDims > 2); k <= ShiftedCell(2)+2*(NumDims > 2); ++k) {
+        for (int j = ShiftedCell(1)-1; j <= ShiftedCell(1)+2; ++j) {
+          for (int i = ShiftedCell(0)-1; i <= ShiftedCell(0)+2; ++i) {
+            long long iPoint = Coords(0).Indexer().ToIndex(i,j,k);
+            for (int iDim = 0; iDim < NumDims; ++iDim) {
+              NodeCoords[(iDim*NumNodes+iNode)*NumBatch+iBatch] = Coords(iDim)[iPoint];
+            }
+            ++iNode;
+          }
+        }
+      }
+      const tuple<double> &PointCoords = CellPointCoords(BatchCells[iBatch]);
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        PointCoordsBatch[iDim*NumBatch+iBatch] = PointCoords(iDim);
+      }
+    }
+
+    array_view<const double,3> NodeCoordsView(NodeCoords, {{NumDims,NumNodes,NumBatch}});
+    array_view<const double,2> PointCoordsView(PointCoordsBatch, {{NumDims,NumBatch}});
+    array_view<double,2> LocalCoordsView(LocalCoords, {{NumDims,NumBatch}});
+    array_view<bool> ConvergedView(Converged, {{NumBatch}});
+
+    if (NumDims == 2) {
+      IsoQuad16NodeInverseBatch(NodeCoordsView, PointCoordsView, LocalCoordsView, ConvergedView);
+    } else {
+      IsoHex64NodeInverseBatch(NodeCoordsView, PointCoordsView, LocalCoordsView, ConvergedView);
+    }
+
+    for (int iBatch = 0; iBatch < NumBatch; ++iBatch) {
+      if (!Converged[iBatch]) continue;
+      long long iCell = BatchCells[iBatch];
+      const tuple<int> &Cell = Cells(iCell);
+      const tuple<int> &ShiftedCell = BatchShiftedCells[iBatch];
+      tuple<double> &CellLocalCoords = *(MaybeLocalCoords(iCell).Assign());
+      CellLocalCoords = {0.,0.,0.};
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        CellLocalCoords(iDim) = LocalCoordsView(iDim,iBatch) + double(ShiftedCell(iDim) -
+          Cell(iDim));
+      }
+    }
+
+  }
+
+}
+
+}
+
+template <geometry_type Type, int NumDims> void CoordsInCells(const array_view<const field_view<
+  const double>> &Coords, const array_view<const tuple<int>> &Cells, const tuple<double>
+  &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool) {
+
+  for (long long iCell = 0; iCell < Cells.Count(); ++iCell) {
+    MaybeLocalCoords(iCell) = CoordsInCell<Type, NumDims>(Coords, Cells(iCell), PointCoords);
+  }
+
+}
+
+template <geometry_type Type, int NumDims> void CoordsInCells(const array_view<const field_view<
+  const double>> &Coords, const array_view<const tuple<int>> &Cells, const array_view<const
+  tuple<double>> &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool) {
+
+  for (long long iCell = 0; iCell < Cells.Count(); ++iCell) {
+    MaybeLocalCoords(iCell) = CoordsInCell<Type, NumDims>(Coords, Cells(iCell),
+      PointCoords(iCell));
+  }
+
+}
+
+template <> inline void CoordsInCells<geometry_type::CURVILINEAR, 2>(const array_view<const
+  field_view<const double>> &Coords, const array_view<const tuple<int>> &Cells, const tuple<double>
+  &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool UseBatches) {
+
+  geometry_ops_internal::CoordsInCellsCurvilinear<2>(Coords, Cells, [&](long long) -> const
+    tuple<double> & { return PointCoords; }, MaybeLocalCoords, UseBatches);
+
+}
+
+template <> inline void CoordsInCells<geometry_type::CURVILINEAR, 3>(const array_view<const
+  field_view<const double>> &Coords, const array_view<const tuple<int>> &Cells, const tuple<double>
+  &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords, bool UseBatches) {
+
+  geometry_ops_internal::CoordsInCellsCurvilinear<3>(Coords, Cells, [&](long long) -> const
+    tuple<double> & { return PointCoords; }, MaybeLocalCoords, UseBatches);
+
+}
+
+template <> inline void CoordsInCells<geometry_type::CURVILINEAR, 2>(const array_view<const
+  field_view<const double>> &Coords, const array_view<const tuple<int>> &Cells, const array_view<
+  const tuple<double>> &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords,
+  bool UseBatches) {
+
+  geometry_ops_internal::CoordsInCellsCurvilinear<2>(Coords, Cells, [&](long long iCell) -> const
+    tuple<double> & { return PointCoords(iCell); }, MaybeLocalCoords, UseBatches);
+
+}
+
+template <> inline void CoordsInCells<geometry_type::CURVILINEAR, 3>(const array_view<const
+  field_view<const double>> &Coords, const array_view<const tuple<int>> &Cells, const array_view<
+  const tuple<double>> &PointCoords, const array_view<optional<tuple<double>>> &MaybeLocalCoords,
+  bool UseBatches) {
+
+  geometry_ops_internal::CoordsInCellsCurvilinear<3>(Coords, Cells, [&](long long iCell) -> const
+    tuple<double> & { return PointCoords(iCell); }, MaybeLocalCoords, UseBatches);
+
+}
+
 template <> inline bool OverlapsCell<geometry_type::UNIFORM, 1>(const array_view<const field_view<
   const double>> &Coords, double Tolerance, const tuple<int> &Cell, const tuple<double>
   &PointCoords) {
@@ -321,7 +601,7 @@ template <> inline optional<tuple<double>> CoordsInCell<geometry_type::RECTILINE
   array_view<const field_view<const double>> &Coords, const tuple<int> &Cell, const tuple<double>
   &PointCoords) {
 
-  return CoordsInCell<geometry_type::CURVILINEAR, 1>(Coords, Cell, PointCoords);
+  return geometry_ops_internal::CoordsInCellRectilinear<1>(Coords, Cell, PointCoords);
 
 }
 
@@ -329,7 +609,7 @@ template <> inline optional<tuple<double>> CoordsInCell<geometry_type::RECTILINE
   array_view<const field_view<const double>> &Coords, const tuple<int> &Cell, const tuple<double>
   &PointCoords) {
 
-  return CoordsInCell<geometry_type::CURVILINEAR, 2>(Coords, Cell, PointCoords);
+  return geometry_ops_internal::CoordsInCellRectilinear<2>(Coords, Cell, PointCoords);
 
 }
 
@@ -337,7 +617,7 @@ template <> inline optional<tuple<double>> CoordsInCell<geometry_type::RECTILINE
   array_view<const field_view<const double>> &Coords, const tuple<int> &Cell, const tuple<double>
   &PointCoords) {
 
-  return CoordsInCell<geometry_type::CURVILINEAR, 3>(Coords, Cell, PointCoords);
+  return geometry_ops_internal::CoordsInCellRectilinear<3>(Coords, Cell, PointCoords);
 
 }
 
@@ -408,7 +688,7 @@ template <> inline optional<tuple<double>> CoordsInCell<geometry_type::ORIENTED_
   const array_view<const field_view<const double>> &Coords, const tuple<int> &Cell, const
   tuple<double> &PointCoords) {
 
-  return CoordsInCell<geometry_type::CURVILINEAR, 1>(Coords, Cell, PointCoords);
+  return geometry_ops_internal::CoordsInCellRectilinear<1>(Coords, Cell, PointCoords);
 
 }
 
@@ -416,7 +696,7 @@ template <> inline optional<tuple<double>> CoordsInCell<geometry_type::ORIENTED_
   const array_view<const field_view<const double>> &Coords, const tuple<int> &Cell, const
   tuple<double> &PointCoords) {
 
-  return CoordsInCell<geometry_type::CURVILINEAR, 2>(Coords, Cell, PointCoords);
+  return geometry_ops_internal::CoordsInCellOrientedRectilinear<2>(Coords, Cell, PointCoords);
 
 }
 
@@ -424,7 +704,7 @@ template <> inline optional<tuple<double>> CoordsInCell<geometry_type::ORIENTED_
   const array_view<const field_view<const double>> &Coords, const tuple<int> &Cell, const
   tuple<double> &PointCoords) {
 
-  return CoordsInCell<geometry_type::CURVILINEAR, 3>(Coords, Cell, PointCoords);
+  return geometry_ops_internal::CoordsInCellOrientedRectilinear<3>(Coords, Cell, PointCoords);
 
 }
 
@@ -23,14 +23,18 @@ extern "C" {
 
 enum {
   OVK_MAX_DIMS = 3,
-  OVK_ALL_GRIDS = -1
+  OVK_ALL_GRIDS = -1,
+  OVK_ARRAY_TILE_SIZE = 4
 };
 
 typedef unsigned char byte;
 
 typedef enum {
   OVK_ROW_MAJOR,
-  OVK_COLUMN_MAJOR
+  OVK_COLUMN_MAJOR,
+  // OVK_ARRAY_TILE_SIZE^N tiles, stored one after another in column-major order; values within
+  // a tile are also column-major (tiles at the upper ends may be partial)
+  OVK_TILED
 } ovk_array_layout;
 
 static inline bool ovkValidArrayLayout(ovk_array_layout Layout) {
@@ -38,6 +42,7 @@ static inline bool ovkValidArrayLayout(ovk_array_layout Layout) {
   switch (Layout) {
   case OVK_ROW_MAJOR:
   case OVK_COLUMN_MAJOR:
+  case OVK_TILED:
     return true;
   default:
     return false;
@@ -25,9 +25,13 @@ constexpr int ALL_GRIDS = OVK_ALL_GRIDS;
 
 enum class array_layout : typename std::underlying_type<ovk_array_layout>::type {
   ROW_MAJOR = OVK_ROW_MAJOR,
-  COLUMN_MAJOR = OVK_COLUMN_MAJOR
+  COLUMN_MAJOR = OVK_COLUMN_MAJOR,
+  TILED = OVK_TILED
 };
 
+// Extent of a tile in each dimension for array_layout::TILED
+constexpr int ARRAY_TILE_SIZE = OVK_ARRAY_TILE_SIZE;
+
 inline bool ValidArrayLayout(array_layout Layout) {
   return ovkValidArrayLayout(ovk_array_layout(Layout));
 }
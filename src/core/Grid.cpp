@@ -4,6 +4,7 @@
 #include "ovk/core/Grid.hpp"
 
 #include "ovk/core/Array.hpp"
+#include "ovk/core/ArrayView.hpp"
 #include "ovk/core/Cart.hpp"
 #include "ovk/core/Comm.hpp"
 #include "ovk/core/CommunicationOps.hpp"
@@ -20,6 +21,7 @@
 
 #include <mpi.h>
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -47,8 +49,12 @@ grid_base::~grid_base() noexcept {
 }
 
 grid::grid(std::shared_ptr<context> &&Context, params &&Params):
-  grid(std::move(Context), std::move(Params), Params.NumDims_, DuplicateComm(Params.Comm_),
-    Params.Cart_, Params.LocalRange_)
+  grid(std::move(Context), std::move(Params), DuplicateComm(Params.Comm_))
+{}
+
+grid::grid(std::shared_ptr<context> &&Context, params &&Params, comm &&Comm):
+  grid(std::move(Context), std::move(Params), Params.NumDims_, std::move(Comm), Params.Cart_,
+    Params.LocalRange_)
 {}
 
 grid::grid(std::shared_ptr<context> &&Context, params &&Params, int NumDims, comm &&Comm, const cart
@@ -179,6 +185,12 @@ grid grid::internal_Create(std::shared_ptr<context> &&Context, params &&Params)
 
 }
 
+grid grid::internal_Create(std::shared_ptr<context> &&Context, params &&Params, comm &&Comm) {
+
+  return {std::move(Context), std::move(Params), std::move(Comm)};
+
+}
+
 namespace core {
 
 grid CreateGrid(std::shared_ptr<context> Context, grid::params Params) {
@@ -189,6 +201,14 @@ grid CreateGrid(std::shared_ptr<context> Context, grid::params Params) {
 
 }
 
+grid CreateGrid(std::shared_ptr<context> Context, grid::params Params, comm Comm) {
+
+  OVK_DEBUG_ASSERT(Context, "Invalid context.");
+
+  return grid::internal_Create(std::move(Context), std::move(Params), std::move(Comm));
+
+}
+
 }
 
 grid::params &grid::params::SetName(std::string Name) {
@@ -311,51 +331,82 @@ grid::params &grid::params::SetPeriodicStorage(periodic_storage PeriodicStorage)
 
 }
 
-grid_info::grid_info(grid *MaybeGrid, comm_view Comm) {
+grid_info grid_info::internal_Create(grid *MaybeGrid, comm_view Comm) {
 
-  IsLocal_ = MaybeGrid != nullptr;
-  bool IsRoot = false;
-  if (IsLocal_) {
-    IsRoot = MaybeGrid->Comm().Rank() == 0;
-  }
+  array<grid_info> GridInfos = internal_CreateMultiple(array_view<grid * const>(&MaybeGrid, {1}),
+    Comm);
 
-  if (IsRoot) RootRank_ = Comm.Rank();
-  core::BroadcastAnySource(&RootRank_, 1, MPI_INT, IsRoot, Comm);
+  return std::move(GridInfos(0));
 
-  if (IsRoot) Name_ = MaybeGrid->Name();
-  core::BroadcastString(*Name_, RootRank_, Comm);
+}
 
-  int NumDims;
-  if (IsRoot) {
-    NumDims = MaybeGrid->Dimension();
-  }
-  MPI_Bcast(&NumDims, 1, MPI_INT, RootRank_, Comm);
+array<grid_info> grid_info::internal_CreateMultiple(array_view<grid * const> MaybeGrids, comm_view
+  Comm) {
 
-  Cart_ = MakeEmptyCart(NumDims);
+  int NumGrids = MaybeGrids.Count();
 
-  if (IsRoot) {
-    Cart_.Range() = MaybeGrid->Cart().Range();
+  array<bool> IsRoot({NumGrids}, false);
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    grid *MaybeGrid = MaybeGrids(iGrid);
+    IsRoot(iGrid) = MaybeGrid && MaybeGrid->Comm().Rank() == 0;
   }
-  MPI_Bcast(Cart_.Range().Begin().Data(), MAX_DIMS, MPI_INT, RootRank_, Comm);
-  MPI_Bcast(Cart_.Range().End().Data(), MAX_DIMS, MPI_INT, RootRank_, Comm);
 
-  if (IsRoot) {
-    Cart_.Periodic() = MaybeGrid->Cart().Periodic();
+  // Each grid's root fills in its values and everyone else leaves them at the minimum, so a single
+  // max reduction distributes them to all ranks
+  enum : int {
+    ROOT_RANK = 0,
+    NUM_DIMS,
+    PERIODIC_STORAGE,
+    RANGE_BEGIN,
+    RANGE_END = RANGE_BEGIN + MAX_DIMS,
+    PERIODIC = RANGE_END + MAX_DIMS,
+    NUM_VALUES = PERIODIC + MAX_DIMS
+  };
+
+  array<int,2> Values({{NumGrids,NUM_VALUES}}, std::numeric_limits<int>::min());
+
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    if (!IsRoot(iGrid)) continue;
+    const grid &Grid = *MaybeGrids(iGrid);
+    const cart &Cart = Grid.Cart();
+    Values(iGrid,ROOT_RANK) = Comm.Rank();
+    Values(iGrid,NUM_DIMS) = Grid.Dimension();
+    Values(iGrid,PERIODIC_STORAGE) = int(Cart.PeriodicStorage());
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Values(iGrid,RANGE_BEGIN+iDim) = Cart.Range().Begin(iDim);
+      Values(iGrid,RANGE_END+iDim) = Cart.Range().End(iDim);
+      Values(iGrid,PERIODIC+iDim) = int(Cart.Periodic(iDim));
+    }
   }
-  MPI_Bcast(Cart_.Periodic().Data(), MAX_DIMS, MPI_C_BOOL, RootRank_, Comm);
 
-  if (IsRoot) {
-    Cart_.PeriodicStorage() = MaybeGrid->Cart().PeriodicStorage();
+  MPI_Allreduce(MPI_IN_PLACE, Values.Data(), NumGrids*NUM_VALUES, MPI_INT, MPI_MAX, Comm);
+
+  array<std::string> Names({NumGrids});
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    if (IsRoot(iGrid)) Names(iGrid) = MaybeGrids(iGrid)->Name();
   }
-  MPI_Bcast(&Cart_.PeriodicStorage(), 1, core::GetMPIDataType<periodic_storage>(), RootRank_, Comm);
 
-  CellCart_ = core::CartPointToCell(Cart_);
+  core::BroadcastStringsAnySource(Names, IsRoot, Comm);
 
-}
+  array<grid_info> GridInfos({NumGrids});
 
-grid_info grid_info::internal_Create(grid *MaybeGrid, comm_view Comm) {
+  for (int iGrid = 0; iGrid < NumGrids; ++iGrid) {
+    grid_info &GridInfo = GridInfos(iGrid);
+    GridInfo.IsLocal_ = MaybeGrids(iGrid) != nullptr;
+    GridInfo.RootRank_ = Values(iGrid,ROOT_RANK);
+    GridInfo.Name_ = std::move(Names(iGrid));
+    cart &Cart = GridInfo.Cart_;
+    Cart = MakeEmptyCart(Values(iGrid,NUM_DIMS));
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Cart.Range().Begin(iDim) = Values(iGrid,RANGE_BEGIN+iDim);
+      Cart.Range().End(iDim) = Values(iGrid,RANGE_END+iDim);
+      Cart.Periodic(iDim) = bool(Values(iGrid,PERIODIC+iDim));
+    }
+    Cart.PeriodicStorage() = periodic_storage(Values(iGrid,PERIODIC_STORAGE));
+    GridInfo.CellCart_ = core::CartPointToCell(Cart);
+  }
 
-  return {MaybeGrid, Comm};
+  return GridInfos;
 
 }
 
@@ -367,6 +418,12 @@ grid_info CreateGridInfo(grid *MaybeGrid, comm_view Comm) {
 
 }
 
+array<grid_info> CreateGridInfos(array_view<grid * const> MaybeGrids, comm_view Comm) {
+
+  return grid_info::internal_CreateMultiple(MaybeGrids, Comm);
+
+}
+
 }
 
 }
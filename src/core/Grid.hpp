@@ -5,6 +5,7 @@
 #define OVK_CORE_GRID_HPP_INCLUDED
 
 #include <ovk/core/Array.hpp>
+#include <ovk/core/ArrayView.hpp>
 #include <ovk/core/Cart.hpp>
 #include <ovk/core/Comm.hpp>
 #include <ovk/core/Context.hpp>
@@ -123,6 +124,7 @@ public:
   periodic_storage PeriodicStorage() const { return Partition_->Cart().PeriodicStorage(); }
 
   static grid internal_Create(std::shared_ptr<context> &&Context, params &&Params);
+  static grid internal_Create(std::shared_ptr<context> &&Context, params &&Params, comm &&Comm);
 
 private:
 
@@ -134,6 +136,7 @@ private:
   std::shared_ptr<const partition> CellPartition_;
 
   grid(std::shared_ptr<context> &&Context, params &&Params);
+  grid(std::shared_ptr<context> &&Context, params &&Params, comm &&Comm);
   grid(std::shared_ptr<context> &&Context, params &&Params, int NumDims, comm &&Comm, const cart
     &Cart, const range &LocalRange);
   grid(std::shared_ptr<context> &&Context, params &&Params, int NumDims, comm &&Comm, const cart
@@ -152,6 +155,9 @@ private:
 
 namespace core {
 grid CreateGrid(std::shared_ptr<context> Context, grid::params Params);
+// Same as above, but with an already-duplicated copy of Params' communicator (e.g., from
+// DuplicateComms) instead of duplicating it here
+grid CreateGrid(std::shared_ptr<context> Context, grid::params Params, comm Comm);
 }
 
 class grid_info {
@@ -169,6 +175,8 @@ public:
   bool IsLocal() const { return IsLocal_; }
 
   static grid_info internal_Create(grid *MaybeGrid, comm_view Comm);
+  static array<grid_info> internal_CreateMultiple(array_view<grid * const> MaybeGrids, comm_view
+    Comm);
 
 private:
 
@@ -178,12 +186,12 @@ private:
   cart CellCart_ = MakeEmptyCart(2);
   bool IsLocal_ = false;
 
-  grid_info(grid *MaybeGrid, comm_view Comm);
-
 };
 
 namespace core {
 grid_info CreateGridInfo(grid *MaybeGrid, comm_view Comm);
+// Creates info for several grids at once using a fixed number of collectives on Comm
+array<grid_info> CreateGridInfos(array_view<grid * const> MaybeGrids, comm_view Comm);
 }
 
 }
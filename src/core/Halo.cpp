@@ -8,6 +8,7 @@
 #include "ovk/core/Cart.hpp"
 #include "ovk/core/Comm.hpp"
 #include "ovk/core/Context.hpp"
+#include "ovk/core/Debug.hpp"
 #include "ovk/core/Field.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Profiler.hpp"
@@ -191,12 +192,66 @@ halo_map::halo_map(const cart &Cart, const range &LocalRange, const range &Exten
 
 }
 
+halo_map::halo_map(const halo_map &ColumnMajorMap, const range &ExtendedRange, array_layout
+  Layout):
+  NeighborRanks_(ColumnMajorMap.NeighborRanks_)
+{
+
+  switch (Layout) {
+  case array_layout::ROW_MAJOR:
+    Relayout_<array_layout::ROW_MAJOR>(ColumnMajorMap, ExtendedRange);
+    break;
+  case array_layout::COLUMN_MAJOR:
+    Relayout_<array_layout::COLUMN_MAJOR>(ColumnMajorMap, ExtendedRange);
+    break;
+  case array_layout::TILED:
+    Relayout_<array_layout::TILED>(ColumnMajorMap, ExtendedRange);
+    break;
+  default:
+    OVK_DEBUG_ASSERT(false, "Unhandled enum value.");
+    break;
+  }
+
+}
+
+template <array_layout Layout> void halo_map::Relayout_(const halo_map &ColumnMajorMap, const
+  range &ExtendedRange) {
+
+  field_indexer ColumnMajorIndexer(ExtendedRange);
+  range_indexer<long long,Layout> Indexer(ExtendedRange);
+
+  auto RelayoutIndices = [&](const array<long long> &ColumnMajorIndices) -> array<long long> {
+    array<long long> Indices({ColumnMajorIndices.Count()});
+    for (long long i = 0; i < ColumnMajorIndices.Count(); ++i) {
+      Indices(i) = Indexer.ToIndex(ColumnMajorIndexer.ToTuple(ColumnMajorIndices(i)));
+    }
+    return Indices;
+  };
+
+  int NumNeighbors = NeighborRanks_.Count();
+
+  NeighborSendIndices_.Resize({NumNeighbors});
+  NeighborRecvIndices_.Resize({NumNeighbors});
+
+  for (int iNeighbor = 0; iNeighbor < NumNeighbors; ++iNeighbor) {
+    NeighborSendIndices_(iNeighbor) = RelayoutIndices(ColumnMajorMap.NeighborSendIndices_(
+      iNeighbor));
+    NeighborRecvIndices_(iNeighbor) = RelayoutIndices(ColumnMajorMap.NeighborRecvIndices_(
+      iNeighbor));
+  }
+
+  LocalToLocalSourceIndices_ = RelayoutIndices(ColumnMajorMap.LocalToLocalSourceIndices_);
+  LocalToLocalDestIndices_ = RelayoutIndices(ColumnMajorMap.LocalToLocalDestIndices_);
+
+}
+
 }
 
 halo::halo(std::shared_ptr<context> Context, const cart &Cart, comm Comm, const range
   &LocalRange, const range &ExtendedRange, const map<int,decomp_info> &Neighbors):
   Context_(std::move(Context)),
-  Comm_(std::move(Comm))
+  Comm_(std::move(Comm)),
+  ExtendedRange_(ExtendedRange)
 {
 
   profiler &Profiler = Context_->core_Profiler();
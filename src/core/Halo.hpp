@@ -16,6 +16,7 @@
 #include <ovk/core/FloatingRef.hpp>
 #include <ovk/core/Global.hpp>
 #include <ovk/core/Map.hpp>
+#include <ovk/core/Optional.hpp>
 #include <ovk/core/Profiler.hpp>
 #include <ovk/core/Range.hpp>
 #include <ovk/core/Request.hpp>
@@ -42,6 +43,10 @@ public:
   halo_map(const cart &Cart, const range &LocalRange, const range &ExtendedRange, const
     map<int,decomp_info> &Neighbors);
 
+  // Same exchange pattern as a map created by the constructor above (which indexes column-major
+  // field data), but indexing field data stored with a different layout
+  halo_map(const halo_map &ColumnMajorMap, const range &ExtendedRange, array_layout Layout);
+
   floating_ref<const halo_map> GetFloatingRef() const {
     return FloatingRefGenerator_.Generate(*this);
   }
@@ -74,6 +79,9 @@ private:
   array<long long> LocalToLocalSourceIndices_;
   array<long long> LocalToLocalDestIndices_;
 
+  template <array_layout Layout> void Relayout_(const halo_map &ColumnMajorMap, const range
+    &ExtendedRange);
+
 };
 
 class halo_exchanger {
@@ -138,6 +146,12 @@ public:
   template <typename T, OVK_FUNCDECL_REQUIRES(!std::is_const<T>::value)> request
     Exchange(field_view<T> View) const;
 
+  template <typename FieldType, OVK_FUNCDECL_REQUIRES(IsTiledField<FieldType>())> request
+    Exchange(FieldType &Field) const;
+
+  template <typename T, OVK_FUNCDECL_REQUIRES(!std::is_const<T>::value)> request
+    Exchange(tiled_field_view<T> View) const;
+
 private:
 
   using halo_map = halo_internal::halo_map;
@@ -147,9 +161,16 @@ private:
 
   comm Comm_;
 
+  range ExtendedRange_;
+
   halo_map HaloMap_;
+  mutable optional<halo_map> TiledHaloMap_;
 
   mutable map<int,array<halo_exchanger>> HaloExchangers_;
+  mutable map<int,array<halo_exchanger>> TiledHaloExchangers_;
+
+  template <typename T> request Exchange_(const halo_map &HaloMap, map<int,array<halo_exchanger>>
+    &HaloExchangers, T *FieldData) const;
 
   static constexpr int TOTAL_TIME = profiler::HALO_TIME;
   static constexpr int SETUP_TIME = profiler::HALO_SETUP_TIME;
@@ -221,8 +242,8 @@ private:
 
   floating_ref<const halo_map> HaloMap_;
 
-  array<array<mpi_value_type>> SendBuffers_;
-  array<array<mpi_value_type>> RecvBuffers_;
+  array<core::aligned_array<mpi_value_type>> SendBuffers_;
+  array<core::aligned_array<mpi_value_type>> RecvBuffers_;
   array<MPI_Request> MPIRequests_;
 
   bool Active_ = false;
@@ -18,6 +18,41 @@ template <typename FieldType, OVK_FUNCDEF_REQUIRES(IsField<FieldType>())> reques
 template <typename T, OVK_FUNCDEF_REQUIRES(!std::is_const<T>::value)> request
   halo::Exchange(field_view<T> View) const {
 
+  return Exchange_(HaloMap_, HaloExchangers_, View.Data());
+
+}
+
+template <typename FieldType, OVK_FUNCDEF_REQUIRES(IsTiledField<FieldType>())> request
+  halo::Exchange(FieldType &Field) const {
+
+  using value_type = array_value_type<FieldType>;
+
+  tiled_field_view<value_type> View(Field);
+
+  return Exchange(View);
+
+}
+
+template <typename T, OVK_FUNCDEF_REQUIRES(!std::is_const<T>::value)> request
+  halo::Exchange(tiled_field_view<T> View) const {
+
+  // Most fields aren't tiled, so only set up the tiled map the first time it's needed
+  if (!TiledHaloMap_.Present()) {
+    profiler &Profiler = Context_->core_Profiler();
+    Profiler.StartSync(TOTAL_TIME, Comm_);
+    Profiler.Start(SETUP_TIME);
+    TiledHaloMap_.Assign(HaloMap_, ExtendedRange_, array_layout::TILED);
+    Profiler.Stop(SETUP_TIME);
+    Profiler.Stop(TOTAL_TIME);
+  }
+
+  return Exchange_(*TiledHaloMap_, TiledHaloExchangers_, View.Data());
+
+}
+
+template <typename T> request halo::Exchange_(const halo_map &HaloMap, map<int,array<
+  halo_exchanger>> &HaloExchangers, T *FieldData) const {
+
   OVK_DEBUG_ASSERT(IsSupportedDataType<T>(), "Unsupported data type.");
 
   profiler &Profiler = Context_->core_Profiler();
@@ -27,7 +62,7 @@ template <typename T, OVK_FUNCDEF_REQUIRES(!std::is_const<T>::value)> request
 
   data_type DataType = GetDataType<T>();
 
-  array<halo_exchanger> &HaloExchangersForType = HaloExchangers_.Fetch(int(DataType));
+  array<halo_exchanger> &HaloExchangersForType = HaloExchangers.Fetch(int(DataType));
 
   int iHaloExchanger = 0;
   while (iHaloExchanger < HaloExchangersForType.Count() && HaloExchangersForType(iHaloExchanger).
@@ -38,7 +73,7 @@ template <typename T, OVK_FUNCDEF_REQUIRES(!std::is_const<T>::value)> request
     Profiler.Stop(EXCHANGE_TIME);
     Profiler.Start(SETUP_TIME);
     HaloExchangersForType.Append(halo_internal::halo_exchanger_for_type<T>(*Context_, Comm_,
-      HaloMap_));
+      HaloMap));
     Profiler.Stop(SETUP_TIME);
     Profiler.Start(EXCHANGE_TIME);
   }
@@ -49,7 +84,7 @@ template <typename T, OVK_FUNCDEF_REQUIRES(!std::is_const<T>::value)> request
     Profiler.Stop(TOTAL_TIME);
   });
 
-  return HaloExchanger.Exchange(View.Data());
+  return HaloExchanger.Exchange(FieldData);
 
 }
 
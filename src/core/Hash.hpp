@@ -0,0 +1,59 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_CORE_HASH_HPP_INCLUDED
+#define OVK_CORE_HASH_HPP_INCLUDED
+
+#include <ovk/core/Elem.hpp>
+#include <ovk/core/Global.hpp>
+#include <ovk/core/Requires.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace ovk {
+
+namespace core {
+
+// Final mixing step of splitmix64; spreads consecutive integers (IDs, ranks, etc.) across the
+// full range so that the low bits can be used directly to select a slot
+inline std::size_t MixHash(std::uint64_t Value) {
+  Value ^= Value >> 30;
+  Value *= 0xbf58476d1ce4e5b9ull;
+  Value ^= Value >> 27;
+  Value *= 0x94d049bb133111ebull;
+  Value ^= Value >> 31;
+  return std::size_t(Value);
+}
+
+inline std::size_t CombineHash(std::size_t Seed, std::size_t Value) {
+  return MixHash(std::uint64_t(Seed)*0x9e3779b97f4a7c15ull + std::uint64_t(Value));
+}
+
+}
+
+template <typename T, typename=void> struct hash : std::hash<T> {};
+
+template <typename T> struct hash<T, OVK_SPECIALIZATION_REQUIRES(std::is_integral<T>::value ||
+  std::is_enum<T>::value)> {
+  std::size_t operator()(T Value) const {
+    return core::MixHash(std::uint64_t(Value));
+  }
+};
+
+template <typename T, int N> struct hash<elem<T,N>> {
+  std::size_t operator()(const elem<T,N> &Elem) const {
+    hash<T> ElementHash;
+    std::size_t Hash = 0;
+    for (int iElement = 0; iElement < N; ++iElement) {
+      Hash = core::CombineHash(Hash, ElementHash(Elem(iElement)));
+    }
+    return Hash;
+  }
+};
+
+}
+
+#endif
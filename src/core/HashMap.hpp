@@ -0,0 +1,284 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_CORE_HASH_MAP_HPP_INCLUDED
+#define OVK_CORE_HASH_MAP_HPP_INCLUDED
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/ArrayTraits.hpp>
+#include <ovk/core/Global.hpp>
+#include <ovk/core/Hash.hpp>
+#include <ovk/core/HashSet.hpp>
+#include <ovk/core/IteratorTraits.hpp>
+#include <ovk/core/Map.hpp>
+#include <ovk/core/PointerIterator.hpp>
+#include <ovk/core/Requires.hpp>
+#include <ovk/core/TypeTraits.hpp>
+
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ovk {
+
+// Unordered counterpart to map, with the same interface minus the ordering-related operations
+// (LowerBound, UpperBound, hinted Insert). Entries are stored densely and are kept parallel to
+// the keys in a hash_set, so iteration visits them in an unspecified order
+template <typename KeyType, typename ValueType, typename HashType=hash<KeyType>, typename
+  KeyEqualType=std::equal_to<KeyType>, bool Contiguous_=MapContiguousDefault<ValueType>()> class
+  hash_map {
+
+public:
+
+  using key_type = KeyType;
+  using value_type = ValueType;
+  using hash_type = HashType;
+  using key_equal_type = KeyEqualType;
+  using key_set_type = hash_set<KeyType, HashType, KeyEqualType>;
+  static constexpr bool Contiguous = Contiguous_;
+  using index_type = long long;
+  using entry = map_entry<KeyType,ValueType,Contiguous>;
+  using iterator = core::pointer_iterator<hash_map, entry *>;
+  using const_iterator = core::pointer_iterator<hash_map, const entry *>;
+
+  hash_map() = default;
+
+  explicit hash_map(hash_type Hash, key_equal_type KeyEqual=key_equal_type()):
+    Keys_(std::move(Hash), std::move(KeyEqual))
+  {}
+
+  hash_map(std::initializer_list<entry> EntriesList) {
+    Reserve(EntriesList.size());
+    for (auto &Entry : EntriesList) {
+      Insert(Entry);
+    }
+  }
+
+  // Don't care about input iterators enough to implement a second overload
+  template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsForwardIterator<IterType>() &&
+    std::is_convertible<core::iterator_reference_type<IterType>, entry>::value)>
+    hash_map(IterType Begin, IterType End) {
+    Reserve(index_type(std::distance(Begin, End)));
+    IterType Iter = Begin;
+    while (Iter != End) {
+      Insert(*Iter);
+      ++Iter;
+    }
+  }
+
+  value_type &Insert(const entry &Entry) {
+    return Insert_(Entry.Key(), Entry.Value());
+  }
+
+  value_type &Insert(entry &&Entry) {
+    return Insert_(Entry.Key(), std::move(Entry.Value()));
+  }
+
+  value_type &Insert(const key_type &Key, const value_type &Value) {
+    return Insert_(Key, Value);
+  }
+
+  value_type &Insert(const key_type &Key, value_type &&Value) {
+    return Insert_(Key, std::move(Value));
+  }
+
+  template <typename... Args, OVK_FUNCTION_REQUIRES(std::is_constructible<value_type, Args &&...
+    >::value && !core::IsCopyOrMoveArgument<value_type, Args &&...>())> value_type &Insert(const
+    key_type &Key, Args &&... Arguments) {
+    return Insert_(Key, std::forward<Args>(Arguments)...);
+  }
+
+  void Erase(const key_type &Key) {
+    EraseEntry_(Keys_.Erase_(Key));
+  }
+
+  // Erasing moves the last entry into the vacated position, so the returned iterator is the same
+  // as the one passed in
+  iterator Erase(const_iterator Pos) {
+    index_type iEntry = index_type(Pos - Begin());
+    key_type Key = Pos->Key();
+    EraseEntry_(Keys_.Erase_(Key));
+    return iterator(Entries_.Data() + iEntry);
+  }
+
+  template <typename F, OVK_FUNCTION_REQUIRES(core::IsCallableAs<F &&, bool(const entry &)>())> void
+    EraseIf(F &&Predicate) {
+    index_type iEntry = 0;
+    while (iEntry < Entries_.Count()) {
+      if (std::forward<F>(Predicate)(Entries_(iEntry))) {
+        key_type Key = Entries_(iEntry).Key();
+        EraseEntry_(Keys_.Erase_(Key));
+      } else {
+        ++iEntry;
+      }
+    }
+  }
+
+  template <typename F, OVK_FUNCTION_REQUIRES(!core::IsCallableAs<F &&, bool(const entry &)>() &&
+    core::IsCallableAs<F &&, bool(const key_type &)>())> void EraseIf(F &&Predicate) {
+    index_type iEntry = 0;
+    while (iEntry < Entries_.Count()) {
+      if (std::forward<F>(Predicate)(Entries_(iEntry).Key())) {
+        key_type Key = Entries_(iEntry).Key();
+        EraseEntry_(Keys_.Erase_(Key));
+      } else {
+        ++iEntry;
+      }
+    }
+  }
+
+  void Clear() {
+    Keys_.Clear();
+    Entries_.Clear();
+  }
+
+  void Reserve(index_type Count) {
+    Keys_.Reserve(Count);
+    Entries_.Reserve(Count);
+  }
+
+  bool Contains(const key_type &Key) const {
+    return Keys_.Contains(Key);
+  }
+
+  const_iterator Find(const key_type &Key) const {
+    auto KeysIter = Keys_.Find(Key);
+    return const_iterator(Entries_.Data() + (KeysIter - Keys_.Begin()));
+  }
+  iterator Find(const key_type &Key) {
+    auto KeysIter = Keys_.Find(Key);
+    return iterator(Entries_.Data() + (KeysIter - Keys_.Begin()));
+  }
+
+  index_type Count() const { return Entries_.Count(); }
+
+  bool Empty() const { return Entries_.Empty(); }
+
+  index_type Capacity() const { return Entries_.Capacity(); }
+
+  const key_set_type &Keys() const { return Keys_; }
+
+  const value_type &operator()(const key_type &Key) const {
+    return Entries_(Keys_.Index_(Key)).Value();
+  }
+
+  value_type &operator()(const key_type &Key) {
+    return Entries_(Keys_.Index_(Key)).Value();
+  }
+
+  value_type &Fetch(const key_type &Key, const value_type &InsertValue) {
+    return Fetch_(Key, InsertValue);
+  }
+
+  value_type &Fetch(const key_type &Key, value_type &&InsertValue) {
+    return Fetch_(Key, std::move(InsertValue));
+  }
+
+  template <typename... Args, OVK_FUNCTION_REQUIRES(std::is_constructible<value_type, Args &&...
+    >::value && !core::IsCopyOrMoveArgument<value_type, Args &&...>())> value_type &Fetch(const
+    key_type &Key, Args &&... Arguments) {
+    return Fetch_(Key, std::forward<Args>(Arguments)...);
+  }
+
+  const entry &operator[](index_type Index) const { return Entries_(Index); }
+  entry &operator[](index_type Index) { return Entries_(Index); }
+
+  const entry *Data() const { return Entries_.Data(); }
+  entry *Data() { return Entries_.Data(); }
+
+  const_iterator Begin() const { return const_iterator(Entries_.Data()); }
+  iterator Begin() { return iterator(Entries_.Data()); }
+  const_iterator CBegin() const { return const_iterator(Entries_.Data()); }
+
+  const_iterator End() const { return const_iterator(Entries_.Data() + Entries_.Count()); }
+  iterator End() { return iterator(Entries_.Data() + Entries_.Count()); }
+  const_iterator CEnd() const { return const_iterator(Entries_.Data() + Entries_.Count()); }
+
+  const hash_type &Hash() const { return Keys_.Hash(); }
+
+  const key_equal_type &KeyEqual() const { return Keys_.KeyEqual(); }
+
+private:
+
+  key_set_type Keys_;
+  array<entry> Entries_;
+
+  template <typename... Args> value_type &Insert_(const key_type &Key, Args &&... Arguments) {
+    auto Result = Keys_.Insert_(Key);
+    index_type iEntry = Result.first;
+    if (Result.second) {
+      Entries_.Append(Key, std::forward<Args>(Arguments)...);
+    } else {
+      Entries_(iEntry) = entry(Key, std::forward<Args>(Arguments)...);
+    }
+    return Entries_(iEntry).Value();
+  }
+
+  template <typename... Args> value_type &Fetch_(const key_type &Key, Args &&... Arguments) {
+    auto Result = Keys_.Insert_(Key);
+    index_type iEntry = Result.first;
+    if (Result.second) {
+      Entries_.Append(Key, std::forward<Args>(Arguments)...);
+    }
+    return Entries_(iEntry).Value();
+  }
+
+  // Mirrors the key set's move-last-into-hole erasure
+  void EraseEntry_(index_type iEntry) {
+    if (iEntry < 0) return;
+    index_type iLastEntry = Entries_.Count()-1;
+    if (iEntry != iLastEntry) {
+      Entries_(iEntry) = std::move(Entries_(iLastEntry));
+    }
+    Entries_.Erase(iLastEntry);
+  }
+
+  friend class core::test_helper<hash_map>;
+
+};
+
+template <typename KeyType, typename ValueType, typename HashType, typename KeyEqualType, bool
+  Contiguous> typename hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous>::iterator
+  begin(hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous> &Map) {
+  return Map.Begin();
+}
+
+template <typename KeyType, typename ValueType, typename HashType, typename KeyEqualType, bool
+  Contiguous> typename hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous>::
+  const_iterator begin(const hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous> &Map)
+  {
+  return Map.Begin();
+}
+
+template <typename KeyType, typename ValueType, typename HashType, typename KeyEqualType, bool
+  Contiguous> typename hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous>::iterator
+  end(hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous> &Map) {
+  return Map.End();
+}
+
+template <typename KeyType, typename ValueType, typename HashType, typename KeyEqualType, bool
+  Contiguous> typename hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous>::
+  const_iterator end(const hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous> &Map) {
+  return Map.End();
+}
+
+template <typename KeyType, typename ValueType, typename HashType, typename KeyEqualType, bool
+  Contiguous> struct array_traits<hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous>>
+  {
+  using map_type = hash_map<KeyType, ValueType, HashType, KeyEqualType, Contiguous>;
+  using value_type = typename map_type::entry;
+  static constexpr int Rank = 1;
+  static constexpr array_layout Layout = array_layout::ROW_MAJOR;
+  template <int> static long long ExtentBegin(const map_type &) { return 0; }
+  template <int> static long long ExtentEnd(const map_type &Map) {
+    return Map.Count();
+  }
+  static const value_type *Data(const map_type &Map) { return Map.Data(); }
+  static value_type *Data(map_type &Map) { return Map.Data(); }
+};
+
+}
+
+#endif
@@ -0,0 +1,256 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_CORE_HASH_SET_HPP_INCLUDED
+#define OVK_CORE_HASH_SET_HPP_INCLUDED
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/ArrayTraits.hpp>
+#include <ovk/core/Global.hpp>
+#include <ovk/core/Hash.hpp>
+#include <ovk/core/IteratorTraits.hpp>
+#include <ovk/core/PointerIterator.hpp>
+#include <ovk/core/Requires.hpp>
+#include <ovk/core/TypeTraits.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace ovk {
+
+template <typename KeyType, typename ValueType, typename HashType, typename KeyEqualType, bool
+  Contiguous> class hash_map;
+
+// Unordered counterpart to set. Values are stored densely (in insertion order, until something is
+// erased) and located via an open-addressing table with linear probing, so Insert, Erase, and
+// Contains are expected constant time. Use this when only membership matters; if the values need
+// to be visited in sorted order, build a set from it afterwards
+template <typename ValueType, typename HashType=hash<ValueType>, typename KeyEqualType=
+  std::equal_to<ValueType>> class hash_set {
+
+public:
+
+  using value_type = ValueType;
+  using hash_type = HashType;
+  using key_equal_type = KeyEqualType;
+  using index_type = long long;
+  // Values aren't mutable, so iterator is const
+  using iterator = core::pointer_iterator<hash_set, const value_type *>;
+  using const_iterator = iterator;
+
+  hash_set() = default;
+
+  explicit hash_set(hash_type Hash, key_equal_type KeyEqual=key_equal_type()):
+    Hash_(std::move(Hash)),
+    KeyEqual_(std::move(KeyEqual))
+  {}
+
+  hash_set(std::initializer_list<value_type> ValuesList) {
+    Reserve(ValuesList.size());
+    for (auto &Value : ValuesList) {
+      Insert(Value);
+    }
+  }
+
+  // Don't care about input iterators enough to implement a second overload
+  template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsForwardIterator<IterType>() &&
+    std::is_convertible<core::iterator_reference_type<IterType>, value_type>::value)>
+    hash_set(IterType Begin, IterType End) {
+    Reserve(std::distance(Begin, End));
+    IterType Iter = Begin;
+    while (Iter != End) {
+      Insert(*Iter);
+      ++Iter;
+    }
+  }
+
+  void Reserve(index_type Count) {
+    Values_.Reserve(Count);
+    if (2*Count > Slots_.Count()) {
+      Rehash_(2*Count);
+    }
+  }
+
+  void Insert(const value_type &Value) {
+    Insert_(Value);
+  }
+
+  void Erase(const value_type &Value) {
+    Erase_(Value);
+  }
+
+  // Erasing moves the last value into the vacated position, so the returned iterator is the same
+  // as the one passed in
+  iterator Erase(iterator Pos) {
+    index_type iValue = index_type(Pos - Begin());
+    value_type Value = *Pos;
+    Erase_(Value);
+    return iterator(Values_.Data() + iValue);
+  }
+
+  template <typename F, OVK_FUNCTION_REQUIRES(core::IsCallableAs<F &&, bool(const value_type &)>())>
+    void EraseIf(F &&Predicate) {
+    index_type iValue = 0;
+    while (iValue < Values_.Count()) {
+      if (std::forward<F>(Predicate)(Values_(iValue))) {
+        value_type Value = Values_(iValue);
+        Erase_(Value);
+      } else {
+        ++iValue;
+      }
+    }
+  }
+
+  void Clear() {
+    Values_.Clear();
+    Slots_.Fill(-1);
+  }
+
+  bool Contains(const value_type &Value) const {
+    return Index_(Value) >= 0;
+  }
+
+  iterator Find(const value_type &Value) const {
+    index_type iValue = Index_(Value);
+    if (iValue < 0) iValue = Values_.Count();
+    return iterator(Values_.Data() + iValue);
+  }
+
+  index_type Count() const { return Values_.Count(); }
+
+  bool Empty() const { return Values_.Empty(); }
+
+  index_type Capacity() const { return Values_.Capacity(); }
+
+  const value_type &operator[](index_type Index) const { return Values_(Index); }
+
+  const value_type *Data() const { return Values_.Data(); }
+
+  iterator Begin() const { return iterator(Values_.Data()); }
+
+  iterator End() const { return iterator(Values_.Data() + Values_.Count()); }
+
+  const hash_type &Hash() const { return Hash_; }
+
+  const key_equal_type &KeyEqual() const { return KeyEqual_; }
+
+private:
+
+  array<value_type> Values_;
+  // Index into Values_ or -1 if unoccupied; size is always a power of 2
+  array<index_type> Slots_;
+  hash_type Hash_;
+  key_equal_type KeyEqual_;
+
+  std::size_t HomeSlot_(const value_type &Value) const {
+    return Hash_(Value) & std::size_t(Slots_.Count()-1);
+  }
+
+  std::size_t NextSlot_(std::size_t iSlot) const {
+    return (iSlot+1) & std::size_t(Slots_.Count()-1);
+  }
+
+  // Returns the slot containing the value, or the unoccupied slot where it would be inserted
+  std::size_t FindSlot_(const value_type &Value) const {
+    std::size_t iSlot = HomeSlot_(Value);
+    while (true) {
+      index_type iValue = Slots_(iSlot);
+      if (iValue < 0 || KeyEqual_(Values_(iValue), Value)) return iSlot;
+      iSlot = NextSlot_(iSlot);
+    }
+  }
+
+  index_type Index_(const value_type &Value) const {
+    if (Values_.Empty()) return -1;
+    return Slots_(FindSlot_(Value));
+  }
+
+  void Rehash_(index_type MinSlots) {
+    index_type NumSlots = 8;
+    while (NumSlots < MinSlots) NumSlots *= 2;
+    Slots_.Assign({NumSlots}, -1);
+    for (index_type iValue = 0; iValue < Values_.Count(); ++iValue) {
+      Slots_(FindSlot_(Values_(iValue))) = iValue;
+    }
+  }
+
+  // Returns the index of the value and whether it was newly inserted; keeps load factor <= 1/2
+  std::pair<index_type, bool> Insert_(const value_type &Value) {
+    if (2*(Values_.Count()+1) > Slots_.Count()) {
+      Rehash_(2*(Values_.Count()+1));
+    }
+    std::size_t iSlot = FindSlot_(Value);
+    index_type iValue = Slots_(iSlot);
+    if (iValue >= 0) return {iValue, false};
+    iValue = Values_.Count();
+    Values_.Append(Value);
+    Slots_(iSlot) = iValue;
+    return {iValue, true};
+  }
+
+  // Returns the index the value occupied before being erased (now holding what was previously the
+  // last value), or -1 if it wasn't present
+  index_type Erase_(const value_type &Value) {
+    if (Values_.Empty()) return -1;
+    std::size_t iSlot = FindSlot_(Value);
+    index_type iValue = Slots_(iSlot);
+    if (iValue < 0) return -1;
+    EraseSlot_(iSlot);
+    index_type iLastValue = Values_.Count()-1;
+    if (iValue != iLastValue) {
+      Slots_(FindSlot_(Values_(iLastValue))) = iValue;
+      Values_(iValue) = std::move(Values_(iLastValue));
+    }
+    Values_.Erase(iLastValue);
+    return iValue;
+  }
+
+  // Backward shift deletion; keeps probe sequences intact without tombstones
+  void EraseSlot_(std::size_t iSlot) {
+    std::size_t SlotMask = std::size_t(Slots_.Count()-1);
+    std::size_t iEmptySlot = iSlot;
+    std::size_t iNextSlot = NextSlot_(iSlot);
+    while (Slots_(iNextSlot) >= 0) {
+      std::size_t iHomeSlot = HomeSlot_(Values_(Slots_(iNextSlot)));
+      if (((iNextSlot - iHomeSlot) & SlotMask) >= ((iNextSlot - iEmptySlot) & SlotMask)) {
+        Slots_(iEmptySlot) = Slots_(iNextSlot);
+        iEmptySlot = iNextSlot;
+      }
+      iNextSlot = NextSlot_(iNextSlot);
+    }
+    Slots_(iEmptySlot) = -1;
+  }
+
+  template <typename, typename, typename, typename, bool> friend class hash_map;
+  friend class core::test_helper<hash_set>;
+
+};
+
+template <typename ValueType, typename HashType, typename KeyEqualType> typename hash_set<ValueType,
+  HashType, KeyEqualType>::iterator begin(const hash_set<ValueType, HashType, KeyEqualType> &Set) {
+  return Set.Begin();
+}
+
+template <typename ValueType, typename HashType, typename KeyEqualType> typename hash_set<ValueType,
+  HashType, KeyEqualType>::iterator end(const hash_set<ValueType, HashType, KeyEqualType> &Set) {
+  return Set.End();
+}
+
+template <typename ValueType, typename HashType, typename KeyEqualType> struct array_traits<
+  hash_set<ValueType, HashType, KeyEqualType>> {
+  using set_type = hash_set<ValueType, HashType, KeyEqualType>;
+  using value_type = typename set_type::value_type;
+  static constexpr int Rank = 1;
+  static constexpr array_layout Layout = array_layout::ROW_MAJOR;
+  template <int> static long long ExtentBegin(const set_type &) { return 0; }
+  template <int> static long long ExtentEnd(const set_type &Set) { return Set.Count(); }
+  static const value_type *Data(const set_type &Set) { return Set.Data(); }
+  // No non-const Data access
+};
+
+}
+
+#endif
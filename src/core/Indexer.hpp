@@ -377,6 +377,125 @@ private:
 
 };
 
+// Tiles are visited in column-major order and values within each tile are column-major, so the
+// offset of a value is the number of values in the full tile slabs that precede it along each
+// dimension plus its offset within its own (possibly partial) tile. No padding is needed
+template <typename IndexType, typename TupleElementType, int Rank_, typename... TupleElementTypes>
+  class indexer_base<IndexType, TupleElementType, Rank_, array_layout::TILED, core::type_sequence<
+  TupleElementTypes...>> {
+
+public:
+
+  static_assert(std::is_integral<IndexType>::value, "Index type must be an integer type.");
+  static_assert(std::is_integral<TupleElementType>::value, "Tuple element type must be an integer "
+    "type.");
+
+  using index_type = IndexType;
+  using tuple_element_type = TupleElementType;
+  static constexpr int Rank = Rank_;
+  static constexpr array_layout Layout = array_layout::TILED;
+  using tuple_type = elem<tuple_element_type,Rank>;
+  using interval_type = interval<tuple_element_type,Rank>;
+
+protected:
+
+  tuple_type Begin_;
+  tuple_type Size_;
+  elem<index_type,Rank> SlabStride_;
+
+public:
+
+  OVK_FORCE_INLINE indexer_base():
+    Begin_(MakeUniformElem<tuple_element_type,Rank>(0)),
+    Size_(MakeUniformElem<tuple_element_type,Rank>(0)),
+    SlabStride_(MakeUniformElem<index_type,Rank>(0))
+  {}
+
+  OVK_FORCE_INLINE explicit indexer_base(const interval_type &Extents):
+    Begin_(Extents.Begin()),
+    Size_(Extents.Size())
+  {
+    index_type Stride = ARRAY_TILE_SIZE;
+    for (int iDim = 0; iDim < Rank; ++iDim) {
+      SlabStride_(iDim) = Stride;
+      Stride *= index_type(Size_(iDim));
+    }
+  }
+
+  const tuple_type &Begin() const { return Begin_; }
+  const tuple_type &Size() const { return Size_; }
+
+  template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsRandomAccessIterator<IterType>() &&
+    std::is_convertible<core::iterator_reference_type<IterType>, tuple_element_type>::value)>
+    OVK_FORCE_INLINE index_type ToIndex(IterType First) const {
+    return TupleToIndex_(First);
+  }
+
+  template <typename ArrayType, OVK_FUNCTION_REQUIRES(core::IsArray<ArrayType>() &&
+    !core::IsIterator<ArrayType>() && std::is_convertible<core::array_access_type<const ArrayType
+    &>, tuple_element_type>::value && core::ArrayRank<ArrayType>() == 1 &&
+    (core::ArrayHasRuntimeExtents<ArrayType>() || (core::StaticArrayHasExtentsBegin<ArrayType,0>()
+    && core::StaticArrayHasExtentsEnd<ArrayType,Rank>())))> OVK_FORCE_INLINE index_type
+    ToIndex(const ArrayType &Array) const {
+    return TupleToIndex_(Array);
+  }
+
+  OVK_FORCE_INLINE index_type ToIndex(TupleElementTypes... TupleElements) const {
+    const tuple_element_type Tuple[Rank] = {TupleElements...};
+    return TupleToIndex_(Tuple);
+  }
+
+  tuple_type ToTuple(index_type Index) const {
+
+    tuple_type Tuple;
+    tuple_type TileSize;
+
+    index_type ReducedIndex = Index;
+    index_type OuterTileSize = 1;
+    for (int iDim = Rank-1; iDim >= 0; --iDim) {
+      index_type SlabSize = SlabStride_(iDim)*OuterTileSize;
+      tuple_element_type TileBegin = ARRAY_TILE_SIZE*tuple_element_type(ReducedIndex/SlabSize);
+      ReducedIndex -= index_type(TileBegin/ARRAY_TILE_SIZE)*SlabSize;
+      TileSize(iDim) = Min<tuple_element_type>(ARRAY_TILE_SIZE, Size_(iDim)-TileBegin);
+      Tuple(iDim) = Begin_(iDim) + TileBegin;
+      OuterTileSize *= index_type(TileSize(iDim));
+    }
+
+    for (int iDim = 0; iDim < Rank; ++iDim) {
+      tuple_element_type Offset = tuple_element_type(ReducedIndex % TileSize(iDim));
+      Tuple(iDim) += Offset;
+      ReducedIndex /= TileSize(iDim);
+    }
+
+    return Tuple;
+
+  }
+
+private:
+
+  template <typename ArrayOrIterType> OVK_FORCE_INLINE index_type TupleToIndex_(const
+    ArrayOrIterType &Tuple) const {
+
+    index_type SlabsOffset = 0;
+    index_type TileOffset = 0;
+    index_type OuterTileSize = 1;
+    for (int iDim = Rank-1; iDim >= 0; --iDim) {
+      tuple_element_type Offset = tuple_element_type(Tuple[iDim] - Begin_(iDim));
+      tuple_element_type iTile = Offset/ARRAY_TILE_SIZE;
+      tuple_element_type TileBegin = iTile*ARRAY_TILE_SIZE;
+      tuple_element_type TileSize = Min<tuple_element_type>(ARRAY_TILE_SIZE, Size_(iDim)-
+        TileBegin);
+      SlabsOffset += index_type(iTile)*SlabStride_(iDim)*OuterTileSize;
+      TileOffset = TileOffset*index_type(TileSize) + index_type(Offset-TileBegin);
+      OuterTileSize *= index_type(TileSize);
+    }
+
+    return SlabsOffset + TileOffset;
+
+  }
+
+};
+
 }
 
 template <typename IndexType, typename TupleElementType, int Rank_, array_layout Layout_=
@@ -408,6 +527,8 @@ template <typename IndexType, typename TupleElementType, int Rank> using indexer
   IndexType, TupleElementType, Rank, array_layout::ROW_MAJOR>;
 template <typename IndexType, typename TupleElementType, int Rank> using indexer_c = indexer<
   IndexType, TupleElementType, Rank, array_layout::COLUMN_MAJOR>;
+template <typename IndexType, typename TupleElementType, int Rank> using indexer_t = indexer<
+  IndexType, TupleElementType, Rank, array_layout::TILED>;
 
 template <typename IndexType, typename TupleElementType, int Rank, array_layout Layout> constexpr
   bool operator==(const indexer<IndexType, TupleElementType, Rank, Layout> &Left, const indexer<
@@ -415,6 +536,12 @@ template <typename IndexType, typename TupleElementType, int Rank, array_layout
   return Left.Begin() == Right.Begin() && Left.Stride() == Right.Stride();
 }
 
+template <typename IndexType, typename TupleElementType, int Rank> bool operator==(const
+  indexer<IndexType, TupleElementType, Rank, array_layout::TILED> &Left, const indexer<IndexType,
+  TupleElementType, Rank, array_layout::TILED> &Right) {
+  return Left.Begin() == Right.Begin() && Left.Size() == Right.Size();
+}
+
 template <typename IndexType, typename TupleElementType, int Rank, array_layout Layout> constexpr
   bool operator!=(const indexer<IndexType, TupleElementType, Rank, Layout> &Left, const indexer<
   IndexType, TupleElementType, Rank, Layout> &Right) {
@@ -0,0 +1,88 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_CORE_INTERP_COEFS_HPP_INCLUDED
+#define OVK_CORE_INTERP_COEFS_HPP_INCLUDED
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Debug.hpp>
+#include <ovk/core/FloatingRef.hpp>
+#include <ovk/core/Global.hpp>
+#include <ovk/core/Math.hpp>
+
+#include <utility>
+
+namespace ovk {
+namespace core {
+
+// Per-donor interpolation coefficients in any of the forms an M side of connectivity can hold
+// them: stored in double or single precision, or computed on demand from the donor coords as
+// Lagrange coefficients
+class interp_coefs_ref {
+
+public:
+
+  interp_coefs_ref() = default;
+
+  interp_coefs_ref(floating_ref<const array<double,3>> Coefs):
+    DoubleCoefs_(std::move(Coefs)),
+    MaxStencilSize_(DoubleCoefs_->Size(1))
+  {}
+
+  interp_coefs_ref(floating_ref<const array<float,3>> Coefs):
+    FloatCoefs_(std::move(Coefs)),
+    MaxStencilSize_(FloatCoefs_->Size(1))
+  {}
+
+  interp_coefs_ref(int NumDims, int StencilSize, floating_ref<const array<double,2>> Coords):
+    Coords_(std::move(Coords)),
+    NumDims_(NumDims),
+    MaxStencilSize_(StencilSize)
+  {}
+
+  int MaxStencilSize() const { return MaxStencilSize_; }
+
+  // Coefs must have extents {MAX_DIMS,MaxStencilSize()}
+  void Get(long long iDonor, array<double,2> &Coefs) const {
+    if (DoubleCoefs_) {
+      const array<double,3> &Values = *DoubleCoefs_;
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        for (int iPoint = 0; iPoint < MaxStencilSize_; ++iPoint) {
+          Coefs(iDim,iPoint) = Values(iDim,iPoint,iDonor);
+        }
+      }
+    } else if (FloatCoefs_) {
+      const array<float,3> &Values = *FloatCoefs_;
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        for (int iPoint = 0; iPoint < MaxStencilSize_; ++iPoint) {
+          Coefs(iDim,iPoint) = double(Values(iDim,iPoint,iDonor));
+        }
+      }
+    } else {
+      OVK_DEBUG_ASSERT(Coords_, "Interpolation coefficients reference is empty.");
+      const array<double,2> &Coords = *Coords_;
+      for (int iDim = 0; iDim < NumDims_; ++iDim) {
+        LagrangeInterpCoefs(MaxStencilSize_, Coords(iDim,iDonor), &Coefs(iDim,0));
+      }
+      for (int iDim = NumDims_; iDim < MAX_DIMS; ++iDim) {
+        Coefs(iDim,0) = 1.;
+        for (int iPoint = 1; iPoint < MaxStencilSize_; ++iPoint) {
+          Coefs(iDim,iPoint) = 0.;
+        }
+      }
+    }
+  }
+
+private:
+
+  floating_ref<const array<double,3>> DoubleCoefs_;
+  floating_ref<const array<float,3>> FloatCoefs_;
+  floating_ref<const array<double,2>> Coords_;
+  int NumDims_ = MAX_DIMS;
+  int MaxStencilSize_ = 0;
+
+};
+
+}}
+
+#endif
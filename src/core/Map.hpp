@@ -148,15 +148,20 @@ private:
 
 };
 
+// The allocator is rebound for the key and entry storage; values of non-contiguous maps are still
+// allocated individually
 template <typename KeyType, typename ValueType, typename KeyCompareType=std::less<KeyType>,
-  bool Contiguous_=MapContiguousDefault<ValueType>()> class map {
+  bool Contiguous_=MapContiguousDefault<ValueType>(), typename AllocatorType=std::allocator<
+  map_entry<KeyType,ValueType,Contiguous_>>> class map {
 
 public:
 
   using key_type = KeyType;
   using value_type = ValueType;
   using key_compare_type = KeyCompareType;
-  using key_set_type = set<KeyType, KeyCompareType>;
+  using allocator_type = AllocatorType;
+  using key_set_type = set<KeyType, KeyCompareType, typename std::allocator_traits<
+    allocator_type>::template rebind_alloc<KeyType>>;
   static constexpr bool Contiguous = Contiguous_;
   using index_type = long long;
   using entry = map_entry<KeyType,ValueType,Contiguous>;
@@ -169,36 +174,31 @@ public:
     Keys_(std::move(KeyCompare))
   {}
 
+  explicit map(const allocator_type &Allocator):
+    Keys_(typename key_set_type::allocator_type(Allocator)),
+    Entries_(typename entries_type::allocator_type(Allocator))
+  {}
+
+  map(key_compare_type KeyCompare, const allocator_type &Allocator):
+    Keys_(std::move(KeyCompare), typename key_set_type::allocator_type(Allocator)),
+    Entries_(typename entries_type::allocator_type(Allocator))
+  {}
+
   map(std::initializer_list<entry> EntriesList) {
-    Keys_.Reserve(EntriesList.size());
-    Entries_.Reserve(EntriesList.size());
-    for (auto &Entry : EntriesList) {
-      Insert(Entry);
-    }
+    Build_(EntriesList.begin(), EntriesList.end());
   }
 
   map(std::initializer_list<entry> EntriesList, key_compare_type KeyCompare):
     Keys_(std::move(KeyCompare))
   {
-    Keys_.Reserve(EntriesList.size());
-    Entries_.Reserve(EntriesList.size());
-    for (auto &Entry : EntriesList) {
-      Insert(Entry);
-    }
+    Build_(EntriesList.begin(), EntriesList.end());
   }
 
   // Don't care about input iterators enough to implement a second overload
   template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsForwardIterator<IterType>() &&
     std::is_convertible<core::iterator_reference_type<IterType>, entry>::value)>
     map(IterType Begin, IterType End) {
-    index_type NumEntries = index_type(std::distance(Begin, End));
-    Keys_.Reserve(NumEntries);
-    Entries_.Reserve(NumEntries);
-    IterType Iter = Begin;
-    while (Iter != End) {
-      Insert(*Iter);
-      ++Iter;
-    }
+    Build_(Begin, End);
   }
 
   // Don't care about input iterators enough to implement a second overload
@@ -207,14 +207,7 @@ public:
     map(IterType Begin, IterType End, key_compare_type KeyCompare):
     Keys_(std::move(KeyCompare))
   {
-    index_type NumEntries = index_type(std::distance(Begin, End));
-    Keys_.Reserve(NumEntries);
-    Entries_.Reserve(NumEntries);
-    IterType Iter = Begin;
-    while (Iter != End) {
-      Insert(*Iter);
-      ++Iter;
-    }
+    Build_(Begin, End);
   }
 
   map &operator=(std::initializer_list<entry> EntriesList) {
@@ -222,13 +215,7 @@ public:
   }
 
   map &Assign(std::initializer_list<entry> EntriesList) {
-    Keys_.Clear();
-    Entries_.Clear();
-    Keys_.Reserve(EntriesList.size());
-    Entries_.Reserve(EntriesList.size());
-    for (auto &Entry : EntriesList) {
-      Insert(Entry);
-    }
+    Build_(EntriesList.begin(), EntriesList.end());
     return *this;
   }
 
@@ -236,16 +223,7 @@ public:
   template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsForwardIterator<IterType>() &&
     std::is_convertible<core::iterator_reference_type<IterType>, entry>::value)>
     map &Assign(IterType Begin, IterType End) {
-    index_type NumEntries = index_type(std::distance(Begin, End));
-    Keys_.Clear();
-    Entries_.Clear();
-    Keys_.Reserve(NumEntries);
-    Entries_.Reserve(NumEntries);
-    IterType Iter = Begin;
-    while (Iter != End) {
-      Insert(*Iter);
-      ++Iter;
-    }
+    Build_(Begin, End);
     return *this;
   }
 
@@ -505,46 +483,88 @@ public:
 
   const key_compare_type &KeyCompare() const { return Keys_.Compare(); }
 
+  allocator_type Allocator() const { return allocator_type(Entries_.Allocator()); }
+
   bool KeyCompare(const value_type &Left, const value_type &Right) const {
     return Keys_.Compare(Left, Right);
   }
 
 private:
 
+  using entries_type = array<entry, 1, array_layout::ROW_MAJOR, typename std::allocator_traits<
+    allocator_type>::template rebind_alloc<entry>>;
+
   key_set_type Keys_;
-  array<entry> Entries_;
+  entries_type Entries_;
+
+  // Appends everything and sorts once instead of inserting entries one at a time, which would be
+  // quadratic for unsorted input
+  template <typename IterType> void Build_(IterType Begin, IterType End) {
+    index_type NumEntries = index_type(std::distance(Begin, End));
+    array<entry> Entries;
+    Entries.Reserve(NumEntries);
+    IterType Iter = Begin;
+    while (Iter != End) {
+      Entries.Append(*Iter);
+      ++Iter;
+    }
+    array<index_type> Order({NumEntries});
+    for (index_type iEntry = 0; iEntry < NumEntries; ++iEntry) {
+      Order(iEntry) = iEntry;
+    }
+    const key_set_type &Keys = Keys_;
+    std::stable_sort(Order.Begin(), Order.End(), [&Keys, &Entries](index_type iLeft, index_type
+      iRight) -> bool {
+      return Keys.Compare(Entries(iLeft).Key(), Entries(iRight).Key());
+    });
+    Keys_.Clear();
+    Entries_.Clear();
+    Keys_.Reserve(NumEntries);
+    Entries_.Reserve(NumEntries);
+    for (index_type iOrder = 0; iOrder < NumEntries; ++iOrder) {
+      index_type iEntry = Order(iOrder);
+      // Later entries with the same key take precedence, same as repeated Insert
+      if (iOrder+1 < NumEntries && !Keys_.Compare(Entries(iEntry).Key(),
+        Entries(Order(iOrder+1)).Key())) continue;
+      Keys_.Insert(Keys_.End(), Entries(iEntry).Key());
+      Entries_.Append(std::move(Entries(iEntry)));
+    }
+  }
 
   friend class core::test_helper<map>;
 
 };
 
-template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous> typename
-  map<KeyType, ValueType, KeyCompareType, Contiguous>::iterator begin(map<KeyType, ValueType,
-  KeyCompareType, Contiguous> &Map) {
+template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous, typename
+  AllocatorType> typename map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType>::
+  iterator begin(map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType> &Map) {
   return Map.Begin();
 }
 
-template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous> typename
-  map<KeyType, ValueType, KeyCompareType, Contiguous>::const_iterator begin(const map<KeyType,
-  ValueType, KeyCompareType, Contiguous> &Map) {
+template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous, typename
+  AllocatorType> typename map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType>::
+  const_iterator begin(const map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType>
+  &Map) {
   return Map.Begin();
 }
 
-template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous> typename
-  map<KeyType, ValueType, KeyCompareType, Contiguous>::iterator end(map<KeyType, ValueType,
-  KeyCompareType, Contiguous> &Map) {
+template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous, typename
+  AllocatorType> typename map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType>::
+  iterator end(map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType> &Map) {
   return Map.End();
 }
 
-template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous> typename
-  map<KeyType, ValueType, KeyCompareType, Contiguous>::const_iterator end(const map<KeyType,
-  ValueType, KeyCompareType, Contiguous> &Map) {
+template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous, typename
+  AllocatorType> typename map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType>::
+  const_iterator end(const map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType> &Map)
+  {
   return Map.End();
 }
 
-template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous> struct
-  array_traits<map<KeyType, ValueType, KeyCompareType, Contiguous>> {
-  using map_type = map<KeyType, ValueType, KeyCompareType, Contiguous>;
+template <typename KeyType, typename ValueType, typename KeyCompareType, bool Contiguous, typename
+  AllocatorType> struct array_traits<map<KeyType, ValueType, KeyCompareType, Contiguous,
+  AllocatorType>> {
+  using map_type = map<KeyType, ValueType, KeyCompareType, Contiguous, AllocatorType>;
   using value_type = typename map_type::entry;
   static constexpr int Rank = 1;
   static constexpr array_layout Layout = array_layout::ROW_MAJOR;
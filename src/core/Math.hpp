@@ -4,6 +4,7 @@
 #ifndef OVK_CORE_MATH_HPP_INCLUDED
 #define OVK_CORE_MATH_HPP_INCLUDED
 
+#include <ovk/core/Debug.hpp>
 #include <ovk/core/Elem.hpp>
 #include <ovk/core/Global.hpp>
 #include <ovk/core/Tuple.hpp>
@@ -29,6 +30,7 @@ elem<double,2> LagrangeInterpLinear(double U);
 elem<double,2> LagrangeInterpLinearDeriv(double U);
 elem<double,4> LagrangeInterpCubic(double U);
 elem<double,4> LagrangeInterpCubicDeriv(double U);
+void LagrangeInterpCoefs(int StencilSize, double U, double *Coefs);
 
 tuple<int> MapToUniformGridCell(int NumDims, const tuple<int> &Origin, const tuple<int> &CellSize,
   const tuple<int> &Point);
@@ -120,6 +120,35 @@ inline elem<double,4> LagrangeInterpCubicDeriv(double U) {
 
 }
 
+// Coefficients for a 1-, 2-, or 4-point stencil (constant, linear, or cubic); U is the position
+// within the stencil's cell, as for LagrangeInterpLinear and LagrangeInterpCubic
+inline void LagrangeInterpCoefs(int StencilSize, double U, double *Coefs) {
+
+  switch (StencilSize) {
+  case 1:
+    Coefs[0] = 1.;
+    break;
+  case 2: {
+    elem<double,2> LinearCoefs = LagrangeInterpLinear(U);
+    Coefs[0] = LinearCoefs(0);
+    Coefs[1] = LinearCoefs(1);
+    break;
+  }
+  case 4: {
+    elem<double,4> CubicCoefs = LagrangeInterpCubic(U);
+    Coefs[0] = CubicCoefs(0);
+    Coefs[1] = CubicCoefs(1);
+    Coefs[2] = CubicCoefs(2);
+    Coefs[3] = CubicCoefs(3);
+    break;
+  }
+  default:
+    OVK_DEBUG_ASSERT(false, "Unsupported Lagrange stencil size.");
+    break;
+  }
+
+}
+
 inline tuple<int> MapToUniformGridCell(int NumDims, const tuple<int> &Origin, const tuple<int>
   &CellSize, const tuple<int> &Point) {
 
@@ -8,12 +8,15 @@
 #include "ovk/core/Box.hpp"
 #include "ovk/core/Field.hpp"
 #include "ovk/core/FieldOps.hpp"
+#include "ovk/core/GeometricPrimitiveOps.hpp"
 #include "ovk/core/GeometryManipulator.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Optional.hpp"
 #include "ovk/core/Range.hpp"
 #include "ovk/core/Tuple.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -42,6 +45,26 @@ struct compute_cell_bounds {
   }
 };
 
+struct compute_bounds {
+  template <typename T> void operator()(const T &Manipulator, int NumDims, const range &CellRange,
+    const array<field_view<const double>> &Coords, field_view<const bool> CellMask, double
+    MaxTolerance, box &Bounds) const {
+    tuple<double> ScaleFactor = MakeUniformTuple<double>(NumDims, 1.+2.*MaxTolerance, 1.);
+    Bounds = MakeEmptyBox(NumDims);
+    for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
+      for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
+        for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
+          tuple<int> Cell = {i,j,k};
+          if (CellMask(Cell)) {
+            Bounds = UnionBoxes(Bounds, ScaleBox(Manipulator.CellBounds(Coords, Cell),
+              ScaleFactor));
+          }
+        }
+      }
+    }
+  }
+};
+
 struct compute_cell_volumes {
   template <typename T> void operator()(const T &Manipulator, int NumDims, const range &CellRange,
     const array<field_view<const double>> &Coords, field_view<const bool> CellMask,
@@ -69,7 +92,14 @@ overlap_accel::overlap_accel(geometry_type GeometryType, int NumDims):
   CellRange_(MakeEmptyRange(NumDims)),
   CellIndexer_(CellRange_),
   Coords_({MAX_DIMS}),
-  Bounds_(MakeEmptyBox(NumDims))
+  Bounds_(MakeEmptyBox(NumDims)),
+  UseAxisSearch_(false),
+  UniformAxes_(GeometryType == geometry_type::UNIFORM || GeometryType ==
+    geometry_type::ORIENTED_UNIFORM),
+  AxisOrigin_(MakeUniformTuple<double>(NumDims, 0.)),
+  AxisDirections_({MAX_DIMS}),
+  AxisSpacing_(MakeUniformTuple<double>(NumDims, 1.)),
+  AxisNodeCoords_({MAX_DIMS})
 {}
 
 overlap_accel::overlap_accel(geometry_type GeometryType, int NumDims, const range &CellRange,
@@ -81,13 +111,32 @@ overlap_accel::overlap_accel(geometry_type GeometryType, int NumDims, const rang
   GeometryManipulator_(GeometryType, NumDims),
   CellRange_(CellRange),
   CellIndexer_(CellRange),
-  Coords_({MAX_DIMS})
+  Coords_({MAX_DIMS}),
+  CellMask_(CellMask),
+  UseAxisSearch_(false),
+  UniformAxes_(GeometryType == geometry_type::UNIFORM || GeometryType ==
+    geometry_type::ORIENTED_UNIFORM),
+  AxisOrigin_(MakeUniformTuple<double>(NumDims, 0.)),
+  AxisDirections_({MAX_DIMS}),
+  AxisSpacing_(MakeUniformTuple<double>(NumDims, 1.)),
+  AxisNodeCoords_({MAX_DIMS})
 {
 
   for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
     Coords_(iDim) = Coords(iDim);
   }
 
+  // Grids with axis-aligned structure don't need the per-cell bounds used to build the tree
+  if (UniformAxes_ || GeometryType == geometry_type::RECTILINEAR || GeometryType ==
+    geometry_type::ORIENTED_RECTILINEAR) {
+    GeometryManipulator_.Apply(compute_bounds(), NumDims, CellRange, Coords_, CellMask,
+      MaxTolerance, Bounds_);
+    if (!Bounds_.Empty()) {
+      UseAxisSearch_ = CreateAxisSearch_();
+    }
+    if (UseAxisSearch_) return;
+  }
+
   field<box> CellBounds(CellRange);
 
   GeometryManipulator_.Apply(compute_cell_bounds(), NumDims, CellRange, Coords_, CellMask,
@@ -102,7 +151,7 @@ overlap_accel::overlap_accel(geometry_type GeometryType, int NumDims, const rang
 
   if (!Bounds_.Empty()) {
 
-    field<double> CellVolumes(CellRange);
+    core::aligned_field<double> CellVolumes(CellRange);
 
     GeometryManipulator_.Apply(compute_cell_volumes(), NumDims, CellRange, Coords_, CellMask,
       CellVolumes);
@@ -283,92 +332,254 @@ void overlap_accel::FindCell(const tuple<double> &PointCoords, double Tolerance,
   optional<tuple<int>> &MaybeCell, optional<tuple<double>> &MaybeCellCoords) const {
 
   if (Bounds_.Contains(PointCoords)) {
-    FindCellInNode_(*Root_, PointCoords, Tolerance, MaybeCell, MaybeCellCoords);
+    if (UseAxisSearch_) {
+      FindCellAlongAxes_(PointCoords, Tolerance, MaybeCell, MaybeCellCoords);
+    } else {
+      FindCellInNode_(*Root_, PointCoords, Tolerance, MaybeCell, MaybeCellCoords);
+    }
   }
 
 }
 
 namespace {
-struct find_cell_in_bin {
-  template <typename T> void operator()(const T &Manipulator, int NumDims, const array<field_view<
-    const double>> &Coords, const array_view<const long long> &BinCells, const array<long long>
-    &NodeContainedCells, const field_indexer &CellIndexer, const tuple<double> &PointCoords, double
-    Tolerance, optional<tuple<int>> &MaybeCell, optional<tuple<double>> &MaybeCellCoords) const {
 
-    bool BestInside = false;
-    double BestMaxCenterDistance = std::numeric_limits<double>::max();
-    double BestOutsideDistanceSq = std::numeric_limits<double>::max();
+// Tracks the best cell found so far when searching a point's candidate cells. Cells containing the
+// point are preferred (the one whose center is closest, if several do), followed by the cell that
+// the point is closest to being inside of
+struct cell_search_state {
+  bool BestInside = false;
+  double BestMaxCenterDistance = std::numeric_limits<double>::max();
+  double BestOutsideDistanceSq = std::numeric_limits<double>::max();
+};
 
-    for (long long iContainedCell : BinCells) {
+void UpdateBestCell(int NumDims, const tuple<int> &Cell, const tuple<double> &CellCoords,
+  cell_search_state &State, optional<tuple<int>> &MaybeCell, optional<tuple<double>>
+  &MaybeCellCoords) {
 
-      long long iCell = NodeContainedCells(iContainedCell);
-      tuple<int> Cell = CellIndexer.ToTuple(iCell);
+  bool Inside = true;
+  for (int iDim = 0; iDim < NumDims; ++iDim) {
+    if (CellCoords(iDim) < 0. || CellCoords(iDim) > 1.) {
+      Inside = false;
+      break;
+    }
+  }
+
+  if (State.BestInside) {
 
-      if (!Manipulator.OverlapsCell(Coords, Tolerance, Cell, PointCoords)) continue;
+    if (Inside) {
+      double MaxCenterDistance = 0.;
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        MaxCenterDistance = Max(MaxCenterDistance, std::abs(CellCoords(iDim)-0.5));
+      }
+      if (MaxCenterDistance < State.BestMaxCenterDistance) {
+        MaybeCell = Cell;
+        MaybeCellCoords = CellCoords;
+        State.BestMaxCenterDistance = MaxCenterDistance;
+      }
+    }
 
-      auto MaybeCellCoords_ = Manipulator.CoordsInCell(Coords, Cell, PointCoords);
-      if (!MaybeCellCoords_) continue;
-      const tuple<double> &CellCoords = *MaybeCellCoords_;
+  } else {
 
-      bool Inside = true;
+    if (Inside) {
+      MaybeCell = Cell;
+      MaybeCellCoords = CellCoords;
+      State.BestInside = true;
+      State.BestMaxCenterDistance = 0.;
       for (int iDim = 0; iDim < NumDims; ++iDim) {
-        if (CellCoords(iDim) < 0. || CellCoords(iDim) > 1.) {
-          Inside = false;
-          break;
-        }
+        State.BestMaxCenterDistance = Max(State.BestMaxCenterDistance, std::abs(CellCoords(iDim)-
+          0.5));
       }
 
-      if (BestInside) {
+    } else {
 
-        if (Inside) {
-          double MaxCenterDistance = 0.;
-          for (int iDim = 0; iDim < NumDims; ++iDim) {
-            MaxCenterDistance = Max(MaxCenterDistance, std::abs(CellCoords(iDim)-0.5));
-          }
-          if (MaxCenterDistance < BestMaxCenterDistance) {
-            MaybeCell = Cell;
-            MaybeCellCoords = CellCoords;
-            BestMaxCenterDistance = MaxCenterDistance;
-          }
+      double OutsideDistanceSq = 0.;
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        double ClampOffset = 0.;
+        if (CellCoords(iDim) > 1.) {
+          ClampOffset = 1.-CellCoords(iDim);
+        } else if (CellCoords(iDim) < 0.) {
+          ClampOffset = -CellCoords(iDim);
         }
+        OutsideDistanceSq += ClampOffset*ClampOffset;
+      }
+      if (OutsideDistanceSq < State.BestOutsideDistanceSq) {
+        MaybeCell = Cell;
+        MaybeCellCoords = CellCoords;
+        State.BestOutsideDistanceSq = OutsideDistanceSq;
+      }
 
-      } else {
+    }
 
-        if (Inside) {
-          MaybeCell = Cell;
-          MaybeCellCoords = CellCoords;
-          BestInside = true;
-          BestMaxCenterDistance = 0.;
-          for (int iDim = 0; iDim < NumDims; ++iDim) {
-            BestMaxCenterDistance = Max(BestMaxCenterDistance, std::abs(CellCoords(iDim)-0.5));
-          }
+  }
 
-        } else {
-
-          double OutsideDistanceSq = 0.;
-          for (int iDim = 0; iDim < NumDims; ++iDim) {
-            double ClampOffset = 0.;
-            if (CellCoords(iDim) > 1.) {
-              ClampOffset = 1.-CellCoords(iDim);
-            } else if (CellCoords(iDim) < 0.) {
-              ClampOffset = -CellCoords(iDim);
-            }
-            OutsideDistanceSq += ClampOffset*ClampOffset;
-          }
-          if (OutsideDistanceSq < BestOutsideDistanceSq) {
-            MaybeCell = Cell;
-            MaybeCellCoords = CellCoords;
-            BestOutsideDistanceSq = OutsideDistanceSq;
-          }
+}
+
+// CandidateCell(iCandidate) returns the linear index of the iCandidate-th cell to check
+struct find_cell_in_candidates {
+  template <typename T, typename F> void operator()(const T &Manipulator, int NumDims, const
+    array<field_view<const double>> &Coords, long long NumCandidates, F &&CandidateCell, const
+    field_indexer &CellIndexer, const tuple<double> &PointCoords, double Tolerance,
+    optional<tuple<int>> &MaybeCell, optional<tuple<double>> &MaybeCellCoords) const {
+
+    cell_search_state State;
 
+    // Overlap tests are cheap; inverse mappings for the overlapping cells are computed in batches
+    tuple<int> BatchCells[GEOMETRY_BATCH_WIDTH];
+    optional<tuple<double>> BatchCellCoords[GEOMETRY_BATCH_WIDTH];
+
+    long long iCandidate = 0;
+    while (iCandidate < NumCandidates) {
+
+      int NumBatchCells = 0;
+      while (iCandidate < NumCandidates && NumBatchCells < GEOMETRY_BATCH_WIDTH) {
+        tuple<int> Cell = CellIndexer.ToTuple(CandidateCell(iCandidate));
+        if (Manipulator.OverlapsCell(Coords, Tolerance, Cell, PointCoords)) {
+          BatchCells[NumBatchCells] = Cell;
+          ++NumBatchCells;
         }
+        ++iCandidate;
+      }
 
+      Manipulator.CoordsInCells(Coords, array_view<const tuple<int>>(BatchCells,
+        {{NumBatchCells}}), PointCoords, array_view<optional<tuple<double>>>(BatchCellCoords,
+        {{NumBatchCells}}));
+
+      for (int iBatchCell = 0; iBatchCell < NumBatchCells; ++iBatchCell) {
+        if (!BatchCellCoords[iBatchCell]) continue;
+        UpdateBestCell(NumDims, BatchCells[iBatchCell], *BatchCellCoords[iBatchCell], State,
+          MaybeCell, MaybeCellCoords);
       }
 
     }
 
   }
 };
+
+// Candidate cells are given as linear indices, with those of the iPoint-th point in the range
+// [CandidateStarts(iPoint),CandidateStarts(iPoint+1)) of CandidateCells. A point rarely overlaps
+// enough candidates to fill a batch on its own, so the inverse mappings are batched across points
+struct find_cells_in_candidates {
+  template <typename T> void operator()(const T &Manipulator, int NumDims, const
+    array<field_view<const double>> &Coords, array_view<const long long> CandidateStarts,
+    array_view<const long long> CandidateCells, const field_indexer &CellIndexer,
+    array_view<const tuple<double>> PointCoords, array_view<const double> Tolerances,
+    array_view<optional<tuple<int>>> MaybeCells, array_view<optional<tuple<double>>>
+    MaybeCellCoords) const {
+
+    long long NumPoints = PointCoords.Count();
+
+    array<long long> OverlappingPoints;
+    array<tuple<int>> OverlappingCells;
+    array<tuple<double>> OverlappingPointCoords;
+    OverlappingPoints.Reserve(CandidateCells.Count());
+    OverlappingCells.Reserve(CandidateCells.Count());
+    OverlappingPointCoords.Reserve(CandidateCells.Count());
+
+    for (long long iPoint = 0; iPoint < NumPoints; ++iPoint) {
+      for (long long iCandidate = CandidateStarts(iPoint); iCandidate < CandidateStarts(iPoint+1);
+        ++iCandidate) {
+        tuple<int> Cell = CellIndexer.ToTuple(CandidateCells(iCandidate));
+        if (Manipulator.OverlapsCell(Coords, Tolerances(iPoint), Cell, PointCoords(iPoint))) {
+          OverlappingPoints.Append(iPoint);
+          OverlappingCells.Append(Cell);
+          OverlappingPointCoords.Append(PointCoords(iPoint));
+        }
+      }
+    }
+
+    long long NumOverlapping = OverlappingCells.Count();
+
+    array<optional<tuple<double>>> OverlappingCellCoords({NumOverlapping});
+
+    Manipulator.CoordsInCells(Coords, OverlappingCells, OverlappingPointCoords,
+      OverlappingCellCoords);
+
+    array<cell_search_state> States({NumPoints});
+
+    for (long long iOverlapping = 0; iOverlapping < NumOverlapping; ++iOverlapping) {
+      if (!OverlappingCellCoords(iOverlapping)) continue;
+      long long iPoint = OverlappingPoints(iOverlapping);
+      UpdateBestCell(NumDims, OverlappingCells(iOverlapping), *OverlappingCellCoords(iOverlapping),
+        States(iPoint), MaybeCells(iPoint), MaybeCellCoords(iPoint));
+    }
+
+  }
+};
+
+}
+
+void overlap_accel::FindCells(array_view<const tuple<double>> PointCoords, array_view<const
+  double> Tolerances, array_view<optional<tuple<int>>> MaybeCells, array_view<optional<
+  tuple<double>>> MaybeCellCoords) const {
+
+  long long NumPoints = PointCoords.Count();
+
+  for (long long iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    MaybeCells(iPoint).Reset();
+    MaybeCellCoords(iPoint).Reset();
+  }
+
+  if (UseAxisSearch_) {
+    for (long long iPoint = 0; iPoint < NumPoints; ++iPoint) {
+      FindCell(PointCoords(iPoint), Tolerances(iPoint), MaybeCells(iPoint),
+        MaybeCellCoords(iPoint));
+    }
+    return;
+  }
+
+  // Bounds the size of the candidate list
+  constexpr long long MAX_CHUNK_POINTS = 1024;
+
+  array<long long> CandidateStarts;
+  array<long long> CandidateCells;
+  CandidateStarts.Reserve(Min(NumPoints, MAX_CHUNK_POINTS)+1);
+
+  for (long long iChunkStart = 0; iChunkStart < NumPoints; iChunkStart += MAX_CHUNK_POINTS) {
+
+    long long iChunkEnd = Min(iChunkStart+MAX_CHUNK_POINTS, NumPoints);
+    long long NumChunkPoints = iChunkEnd - iChunkStart;
+
+    CandidateStarts.Clear();
+    CandidateCells.Clear();
+
+    CandidateStarts.Append(0);
+    for (long long iPoint = iChunkStart; iPoint < iChunkEnd; ++iPoint) {
+      const tuple<double> &Point = PointCoords(iPoint);
+      if (Bounds_.Contains(Point)) {
+        const node &Leaf = FindLeaf_(*Root_, Point);
+        long long iBin = Leaf.Hash->MapToBin(Point);
+        if (iBin >= 0) {
+          for (long long iBinCell : Leaf.Hash->RetrieveBin(iBin)) {
+            CandidateCells.Append(Leaf.CellIndices(iBinCell));
+          }
+        }
+      }
+      CandidateStarts.Append(CandidateCells.Count());
+    }
+
+    GeometryManipulator_.Apply(find_cells_in_candidates(), NumDims_, Coords_, CandidateStarts,
+      CandidateCells, CellIndexer_, array_view<const tuple<double>>(PointCoords.Data()+iChunkStart,
+      {{NumChunkPoints}}), array_view<const double>(Tolerances.Data()+iChunkStart,
+      {{NumChunkPoints}}), array_view<optional<tuple<int>>>(MaybeCells.Data()+iChunkStart,
+      {{NumChunkPoints}}), array_view<optional<tuple<double>>>(MaybeCellCoords.Data()+iChunkStart,
+      {{NumChunkPoints}}));
+
+  }
+
+}
+
+const overlap_accel::node &overlap_accel::FindLeaf_(const node &Root, const tuple<double>
+  &PointCoords) const {
+
+  const node *Node = &Root;
+
+  while (!Node->Hash) {
+    Node = PointCoords(Node->SplitDim) <= Node->Split ? Node->LeftChild.get() :
+      Node->RightChild.get();
+  }
+
+  return *Node;
+
 }
 
 void overlap_accel::FindCellInNode_(const node &Node, const tuple<double> &PointCoords, double
@@ -390,12 +601,140 @@ void overlap_accel::FindCellInNode_(const node &Node, const tuple<double> &Point
 
     if (iBin >= 0) {
       array_view<const long long> BinCells = Node.Hash->RetrieveBin(iBin);
-      GeometryManipulator_.Apply(find_cell_in_bin(), NumDims_, Coords_, BinCells, Node.CellIndices,
-        CellIndexer_, PointCoords, Tolerance, MaybeCell, MaybeCellCoords);
+      auto CandidateCell = [&](long long iBinCell) -> long long {
+        return Node.CellIndices(BinCells(iBinCell));
+      };
+      GeometryManipulator_.Apply(find_cell_in_candidates(), NumDims_, Coords_, BinCells.Count(),
+        CandidateCell, CellIndexer_, PointCoords, Tolerance, MaybeCell, MaybeCellCoords);
+    }
+
+  }
+
+}
+
+
+bool overlap_accel::CreateAxisSearch_() {
+
+  const tuple<int> &Origin = CellRange_.Begin();
+  long long iOrigin = Coords_(0).Indexer().ToIndex(Origin);
+
+  for (int iDim = 0; iDim < NumDims_; ++iDim) {
+    AxisOrigin_(iDim) = Coords_(iDim)[iOrigin];
+  }
+
+  for (int iAxis = 0; iAxis < NumDims_; ++iAxis) {
+
+    tuple<int> Node = Origin;
+    Node(iAxis) = Origin(iAxis)+1;
+    long long iNode = Coords_(0).Indexer().ToIndex(Node);
+
+    tuple<double> &Direction = AxisDirections_(iAxis);
+    Direction = {0.,0.,0.};
+    double LengthSq = 0.;
+    for (int iDim = 0; iDim < NumDims_; ++iDim) {
+      Direction(iDim) = Coords_(iDim)[iNode] - AxisOrigin_(iDim);
+      LengthSq += Direction(iDim)*Direction(iDim);
     }
+    if (LengthSq <= 0.) return false;
+    double Length = std::sqrt(LengthSq);
+    for (int iDim = 0; iDim < NumDims_; ++iDim) {
+      Direction(iDim) /= Length;
+    }
+
+    int NumNodes = CellRange_.Size(iAxis)+1;
+    array<double> &NodeCoords = AxisNodeCoords_(iAxis);
+    NodeCoords.Resize({NumNodes});
+    for (int iNodeOnAxis = 0; iNodeOnAxis < NumNodes; ++iNodeOnAxis) {
+      Node(iAxis) = Origin(iAxis)+iNodeOnAxis;
+      iNode = Coords_(0).Indexer().ToIndex(Node);
+      double Coord = 0.;
+      for (int iDim = 0; iDim < NumDims_; ++iDim) {
+        Coord += (Coords_(iDim)[iNode] - AxisOrigin_(iDim))*Direction(iDim);
+      }
+      NodeCoords(iNodeOnAxis) = Coord;
+    }
+
+    // Binary search requires strictly increasing node coordinates
+    for (int iNodeOnAxis = 1; iNodeOnAxis < NumNodes; ++iNodeOnAxis) {
+      if (NodeCoords(iNodeOnAxis) <= NodeCoords(iNodeOnAxis-1)) return false;
+    }
+
+    AxisSpacing_(iAxis) = (NodeCoords(NumNodes-1) - NodeCoords(0))/double(NumNodes-1);
 
   }
 
+  return true;
+
+}
+
+void overlap_accel::FindCellAlongAxes_(const tuple<double> &PointCoords, double Tolerance,
+  optional<tuple<int>> &MaybeCell, optional<tuple<double>> &MaybeCellCoords) const {
+
+  tuple<int> CandidatesBegin = CellRange_.Begin();
+  tuple<int> CandidatesEnd = CellRange_.End();
+
+  for (int iAxis = 0; iAxis < NumDims_; ++iAxis) {
+
+    const tuple<double> &Direction = AxisDirections_(iAxis);
+    double Coord = 0.;
+    for (int iDim = 0; iDim < NumDims_; ++iDim) {
+      Coord += (PointCoords(iDim) - AxisOrigin_(iDim))*Direction(iDim);
+    }
+
+    const array<double> &NodeCoords = AxisNodeCoords_(iAxis);
+    int NumCells = int(NodeCoords.Count())-1;
+
+    int iCell;
+    if (UniformAxes_) {
+      // Clamp before converting to avoid overflow for points far outside the grid
+      double CellCoord = Min(Max(std::floor(Coord/AxisSpacing_(iAxis)), 0.), double(NumCells-1));
+      iCell = int(CellCoord);
+      // Roundoff can put points that lie on a node in the wrong cell
+      if (Coord < NodeCoords(iCell)) {
+        iCell = Max(iCell-1, 0);
+      } else if (iCell < NumCells-1 && Coord >= NodeCoords(iCell+1)) {
+        ++iCell;
+      }
+    } else {
+      iCell = int(std::upper_bound(NodeCoords.Begin(), NodeCoords.End(), Coord) -
+        NodeCoords.Begin())-1;
+      iCell = Min(Max(iCell, 0), NumCells-1);
+    }
+
+    auto LocalCoord = [&](int iCell_) -> double {
+      return (Coord - NodeCoords(iCell_))/(NodeCoords(iCell_+1) - NodeCoords(iCell_));
+    };
+
+    // Neighboring cells may also overlap the point within the tolerance
+    int iCellBegin = iCell;
+    int iCellEnd = iCell+1;
+    if (iCell > 0 && LocalCoord(iCell-1) <= 1.+Tolerance) --iCellBegin;
+    if (iCell < NumCells-1 && LocalCoord(iCell+1) >= -Tolerance) ++iCellEnd;
+
+    CandidatesBegin(iAxis) = CellRange_.Begin(iAxis) + iCellBegin;
+    CandidatesEnd(iAxis) = CellRange_.Begin(iAxis) + iCellEnd;
+
+  }
+
+  long long CandidateCells[27];
+  int NumCandidates = 0;
+  for (int k = CandidatesBegin(2); k < CandidatesEnd(2); ++k) {
+    for (int j = CandidatesBegin(1); j < CandidatesEnd(1); ++j) {
+      for (int i = CandidatesBegin(0); i < CandidatesEnd(0); ++i) {
+        if (CellMask_(i,j,k)) {
+          CandidateCells[NumCandidates] = CellIndexer_.ToIndex(i,j,k);
+          ++NumCandidates;
+        }
+      }
+    }
+  }
+
+  auto CandidateCell = [&](long long iCandidate) -> long long {
+    return CandidateCells[iCandidate];
+  };
+  GeometryManipulator_.Apply(find_cell_in_candidates(), NumDims_, Coords_, NumCandidates,
+    CandidateCell, CellIndexer_, PointCoords, Tolerance, MaybeCell, MaybeCellCoords);
+
 }
 
 }}
@@ -34,6 +34,11 @@ public:
   void FindCell(const tuple<double> &PointCoords, double Tolerance, optional<tuple<int>> &MaybeCell,
     optional<tuple<double>> &MaybeCellCoords) const;
 
+  // Same as FindCell, but for many points at once (with a tolerance for each)
+  void FindCells(array_view<const tuple<double>> PointCoords, array_view<const double> Tolerances,
+    array_view<optional<tuple<int>>> MaybeCells, array_view<optional<tuple<double>>>
+    MaybeCellCoords) const;
+
 private:
 
   using bounding_box_hash = region_hash<box>;
@@ -56,18 +61,35 @@ private:
   field_indexer CellIndexer_;
 
   array<field_view<const double>> Coords_;
+  field_view<const bool> CellMask_;
 
   box Bounds_;
 
+  // Rectilinear grids skip the tree and locate cells by binary searching the node coordinates
+  // along each (possibly rotated) grid axis; uniform grids compute the cell index directly
+  bool UseAxisSearch_;
+  bool UniformAxes_;
+  tuple<double> AxisOrigin_;
+  array<tuple<double>> AxisDirections_;
+  tuple<double> AxisSpacing_;
+  array<array<double>> AxisNodeCoords_;
+
   optional<node> Root_;
 
   node CreateNode_(const box &AccelBounds, const field<box> &CellBounds, const field<double>
     &CellVolumes, const array<long long> &ContainedCellIndices, int Depth, int MaxDepth, long long
     NumCellsLeaf, double MaxUnoccupiedVolume, double MaxCellVolumeVariation, double BinScale) const;
 
+  bool CreateAxisSearch_();
+
+  void FindCellAlongAxes_(const tuple<double> &PointCoords, double Tolerance, optional<tuple<int>>
+    &MaybeCell, optional<tuple<double>> &MaybeCellCoords) const;
+
   void FindCellInNode_(const node &Node, const tuple<double> &PointCoords, double Tolerance,
     optional<tuple<int>> &MaybeCell, optional<tuple<double>> &MaybeCellCoords) const;
 
+  const node &FindLeaf_(const node &Root, const tuple<double> &PointCoords) const;
+
 };
 
 }}
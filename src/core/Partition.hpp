@@ -81,6 +81,16 @@ public:
     return Halo_.Exchange(View);
   }
 
+  template <typename FieldType, OVK_FUNCTION_REQUIRES(core::IsTiledField<FieldType>())> request
+    Exchange(FieldType &Field) const {
+    return Halo_.Exchange(Field);
+  }
+
+  template <typename T, OVK_FUNCTION_REQUIRES(!std::is_const<T>::value)> request
+    Exchange(tiled_field_view<T> View) const {
+    return Halo_.Exchange(View);
+  }
+
 private:
 
   std::shared_ptr<context> Context_;
@@ -8,6 +8,7 @@
 #include "ovk/core/Debug.hpp"
 #include "ovk/core/Global.hpp"
 #include "ovk/core/Map.hpp"
+#include "ovk/core/Set.hpp"
 #include "ovk/core/TextProcessing.hpp"
 
 #include <mpi.h>
@@ -37,6 +38,7 @@ const map_noncontig<int,std::string> profiler::TimerNames_ = {
   {ASSEMBLER_OVERLAP_SEARCH_TIME, "Assembler::Overlap::Search"},
   {ASSEMBLER_OVERLAP_SEARCH_BUILD_ACCEL_TIME, "Assembler::Overlap::Search::BuildAccel"},
   {ASSEMBLER_OVERLAP_SEARCH_QUERY_ACCEL_TIME, "Assembler::Overlap::Search::QueryAccel"},
+  {ASSEMBLER_OVERLAP_SEARCH_SHIP_QUERIES_TIME, "Assembler::Overlap::Search::ShipQueries"},
   {ASSEMBLER_OVERLAP_SYNC_TIME, "Assembler::Overlap::Sync"},
   {ASSEMBLER_OVERLAP_CREATE_TIME, "Assembler::Overlap::Create"},
   {ASSEMBLER_OVERLAP_FILL_TIME, "Assembler::Overlap::Fill"},
@@ -102,7 +104,18 @@ const map_noncontig<int,std::string> profiler::TimerNames_ = {
   {XINTOUT_IMPORT_DISTRIBUTE_FIND_RANKS_TIME, "XINTOUT::Import::Distribute::FindRanks"},
   {XINTOUT_IMPORT_DISTRIBUTE_HANDSHAKE_TIME, "XINTOUT::Import::Distribute::Handshake"},
   {XINTOUT_IMPORT_DISTRIBUTE_SEND_DATA_TIME, "XINTOUT::Import::Distribute::SendData"},
-  {XINTOUT_IMPORT_SET_CONNECTIVITIES_TIME, "XINTOUT::Import::SetConnectivities"}
+  {XINTOUT_IMPORT_SET_CONNECTIVITIES_TIME, "XINTOUT::Import::SetConnectivities"},
+  {CHECKPOINT_EXPORT_TIME, "Checkpoint::Export"},
+  {CHECKPOINT_EXPORT_WRITE_TIME, "Checkpoint::Export::Write"},
+  {CHECKPOINT_IMPORT_TIME, "Checkpoint::Import"},
+  {CHECKPOINT_IMPORT_READ_TIME, "Checkpoint::Import::Read"},
+  {CHECKPOINT_IMPORT_DISTRIBUTE_TIME, "Checkpoint::Import::Distribute"},
+  {CHECKPOINT_IMPORT_SET_COMPONENTS_TIME, "Checkpoint::Import::SetComponents"}
+};
+
+const map_noncontig<int,std::string> profiler::StatNames_ = {
+  {ASSEMBLER_OVERLAP_SEARCH_IMBALANCE_BEFORE_STAT, "Assembler::Overlap::Search::ImbalanceBefore"},
+  {ASSEMBLER_OVERLAP_SEARCH_IMBALANCE_AFTER_STAT, "Assembler::Overlap::Search::ImbalanceAfter"}
 };
 
 profiler::profiler(comm_view Comm):
@@ -110,6 +123,8 @@ profiler::profiler(comm_view Comm):
 {
   OVK_DEBUG_ASSERT(TimerNames_.Count() == profiler_internal_TIMER_ID_COUNT, "Timer name map has "
     "incorrect size.");
+  OVK_DEBUG_ASSERT(StatNames_.Count() == profiler_internal_STAT_ID_COUNT, "Stat name map has "
+    "incorrect size.");
 }
 
 void profiler::Enable() {
@@ -164,58 +179,82 @@ void profiler::Stop_(int TimerID) {
 
 }
 
-std::string profiler::WriteProfile() const {
+void profiler::Record_(int StatID, double Value) {
 
-  std::string ProfileString;
+  OVK_DEBUG_ASSERT(StatID >= 0 && StatID < profiler_internal_STAT_ID_COUNT, "Invalid stat ID.");
 
-  if (Enabled_) {
+  Stats_.Fetch(StatID) = Value;
 
-    set<int> GlobalTimerIDs;
+}
 
-    array<int> TimerWasUsed({profiler_internal_TIMER_ID_COUNT}, 0);
-    for (int TimerID : Timers_.Keys()) {
-      TimerWasUsed(TimerID) = 1;
-    }
-    MPI_Allreduce(MPI_IN_PLACE, TimerWasUsed.Data(), TimerWasUsed.Count(), MPI_INT, MPI_LOR, Comm_);
-    for (int TimerID = 0; TimerID < profiler_internal_TIMER_ID_COUNT; ++TimerID) {
-      if (TimerWasUsed(TimerID)) {
-        GlobalTimerIDs.Insert(TimerID);
-      }
-    }
+namespace {
 
-    int NumGlobalTimers = GlobalTimerIDs.Count();
-
-    array<double> Times;
-    Times.Reserve(NumGlobalTimers);
-    for (int iTimer = 0; iTimer < NumGlobalTimers; ++iTimer) {
-      int TimerID = GlobalTimerIDs[iTimer];
-      auto Iter = Timers_.Find(TimerID);
-      if (Iter != Timers_.End()) {
-        const timer &Timer = Iter->Value().Timer;
-        Times.Append(Timer.Accumulated());
-      } else {
-        Times.Append(0.);
-      }
-    }
+// Writes "<name>: <min> <max> <avg>" over all ranks for each ID that has a value on any rank
+template <typename F> std::string WriteMinMaxAvg(comm_view Comm, int IDCount, const
+  map_noncontig<int,std::string> &Names, const set<int> &LocalIDs, F GetValue) {
 
-    array<double> MinTimes({NumGlobalTimers});
-    array<double> MaxTimes({NumGlobalTimers});
-    array<double> AvgTimes({NumGlobalTimers});
+  std::string String;
 
-    MPI_Allreduce(Times.Data(), MinTimes.Data(), NumGlobalTimers, MPI_DOUBLE, MPI_MIN, Comm_);
-    MPI_Allreduce(Times.Data(), MaxTimes.Data(), NumGlobalTimers, MPI_DOUBLE, MPI_MAX, Comm_);
-    MPI_Allreduce(Times.Data(), AvgTimes.Data(), NumGlobalTimers, MPI_DOUBLE, MPI_SUM, Comm_);
+  set<int> GlobalIDs;
 
-    for (int iTimer = 0; iTimer < NumGlobalTimers; ++iTimer) {
-      AvgTimes(iTimer) /= double(Comm_.Size());
+  array<int> IDWasUsed({IDCount}, 0);
+  for (int ID : LocalIDs) {
+    IDWasUsed(ID) = 1;
+  }
+  MPI_Allreduce(MPI_IN_PLACE, IDWasUsed.Data(), IDCount, MPI_INT, MPI_LOR, Comm);
+  for (int ID = 0; ID < IDCount; ++ID) {
+    if (IDWasUsed(ID)) {
+      GlobalIDs.Insert(ID);
     }
+  }
 
-    for (int iTimer = 0; iTimer < NumGlobalTimers; ++iTimer) {
-      int TimerID = GlobalTimerIDs[iTimer];
-      const std::string &TimerName = TimerNames_(TimerID);
-      ProfileString += StringPrint("%s: %f %f %f\n", TimerName, MinTimes(iTimer), MaxTimes(iTimer),
-        AvgTimes(iTimer));
-    }
+  int NumGlobalIDs = GlobalIDs.Count();
+
+  array<double> Values;
+  Values.Reserve(NumGlobalIDs);
+  for (int ID : GlobalIDs) {
+    Values.Append(LocalIDs.Contains(ID) ? GetValue(ID) : 0.);
+  }
+
+  array<double> MinValues({NumGlobalIDs});
+  array<double> MaxValues({NumGlobalIDs});
+  array<double> AvgValues({NumGlobalIDs});
+
+  MPI_Allreduce(Values.Data(), MinValues.Data(), NumGlobalIDs, MPI_DOUBLE, MPI_MIN, Comm);
+  MPI_Allreduce(Values.Data(), MaxValues.Data(), NumGlobalIDs, MPI_DOUBLE, MPI_MAX, Comm);
+  MPI_Allreduce(Values.Data(), AvgValues.Data(), NumGlobalIDs, MPI_DOUBLE, MPI_SUM, Comm);
+
+  for (int iID = 0; iID < NumGlobalIDs; ++iID) {
+    AvgValues(iID) /= double(Comm.Size());
+  }
+
+  for (int iID = 0; iID < NumGlobalIDs; ++iID) {
+    const std::string &Name = Names(GlobalIDs[iID]);
+    String += StringPrint("%s: %f %f %f\n", Name, MinValues(iID), MaxValues(iID),
+      AvgValues(iID));
+  }
+
+  return String;
+
+}
+
+}
+
+std::string profiler::WriteProfile() const {
+
+  std::string ProfileString;
+
+  if (Enabled_) {
+
+    ProfileString += WriteMinMaxAvg(Comm_, profiler_internal_TIMER_ID_COUNT, TimerNames_,
+      Timers_.Keys(), [&](int TimerID) -> double {
+      return Timers_(TimerID).Timer.Accumulated();
+    });
+
+    ProfileString += WriteMinMaxAvg(Comm_, profiler_internal_STAT_ID_COUNT, StatNames_,
+      Stats_.Keys(), [&](int StatID) -> double {
+      return Stats_(StatID);
+    });
 
   }
 
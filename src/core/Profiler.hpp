@@ -63,6 +63,7 @@ public:
     ASSEMBLER_OVERLAP_SEARCH_TIME,
     ASSEMBLER_OVERLAP_SEARCH_BUILD_ACCEL_TIME,
     ASSEMBLER_OVERLAP_SEARCH_QUERY_ACCEL_TIME,
+    ASSEMBLER_OVERLAP_SEARCH_SHIP_QUERIES_TIME,
     ASSEMBLER_OVERLAP_SYNC_TIME,
     ASSEMBLER_OVERLAP_CREATE_TIME,
     ASSEMBLER_OVERLAP_FILL_TIME,
@@ -129,9 +130,23 @@ public:
     XINTOUT_IMPORT_DISTRIBUTE_HANDSHAKE_TIME,
     XINTOUT_IMPORT_DISTRIBUTE_SEND_DATA_TIME,
     XINTOUT_IMPORT_SET_CONNECTIVITIES_TIME,
+    CHECKPOINT_EXPORT_TIME,
+    CHECKPOINT_EXPORT_WRITE_TIME,
+    CHECKPOINT_IMPORT_TIME,
+    CHECKPOINT_IMPORT_READ_TIME,
+    CHECKPOINT_IMPORT_DISTRIBUTE_TIME,
+    CHECKPOINT_IMPORT_SET_COMPONENTS_TIME,
     profiler_internal_TIMER_ID_COUNT
   };
 
+  // Quantities other than times; reported alongside the timers using the most recently recorded
+  // value on each rank
+  enum : int {
+    ASSEMBLER_OVERLAP_SEARCH_IMBALANCE_BEFORE_STAT = 0,
+    ASSEMBLER_OVERLAP_SEARCH_IMBALANCE_AFTER_STAT,
+    profiler_internal_STAT_ID_COUNT
+  };
+
   profiler() = default;
   explicit profiler(comm_view Comm);
 
@@ -145,6 +160,8 @@ public:
   OVK_FORCE_INLINE void StartSync(int TimerID, MPI_Comm Comm);
   OVK_FORCE_INLINE void Stop(int TimerID);
 
+  OVK_FORCE_INLINE void Record(int StatID, double Value);
+
   std::string WriteProfile() const;
 
 private:
@@ -160,13 +177,16 @@ private:
   comm_view Comm_ = MPI_COMM_SELF;
   bool Enabled_ = false;
   map<int,timer_entry> Timers_;
+  map<int,double> Stats_;
 
   void Start_(int TimerID);
   void StartSync_(int TimerID, MPI_Comm Comm);
   void Stop_(int TimerID);
+  void Record_(int StatID, double Value);
 
   // Set non-contiguous because std::string is not noexcept movable until C++17
   static const map_noncontig<int,std::string> TimerNames_;
+  static const map_noncontig<int,std::string> StatNames_;
 
 };
 
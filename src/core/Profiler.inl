@@ -78,4 +78,13 @@ OVK_FORCE_INLINE void profiler::Stop(int TimerID) {
 
 }
 
+OVK_FORCE_INLINE void profiler::Record(int StatID, double Value) {
+
+  if (Enabled_) {
+    // Don't want to force everything inline, just the if statement
+    Record_(StatID, Value);
+  }
+
+}
+
 }}
@@ -31,6 +31,8 @@ template <typename IndexType> using range_indexer_r = range_indexer<IndexType,
   array_layout::ROW_MAJOR>;
 template <typename IndexType> using range_indexer_c = range_indexer<IndexType,
   array_layout::COLUMN_MAJOR>;
+template <typename IndexType> using range_indexer_t = range_indexer<IndexType,
+  array_layout::TILED>;
 
 namespace core {
 template <> struct hashable_region_traits<range> {
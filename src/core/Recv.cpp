@@ -172,7 +172,7 @@ private:
   int Tag_;
 
   array<array_view<value_type>> Values_;
-  array<array<mpi_value_type,2>> Buffers_;
+  array<core::aligned_array<mpi_value_type,2>> Buffers_;
   array<long long> NextBufferEntry_;
   array<MPI_Request> MPIRequests_;
 
@@ -57,7 +57,7 @@ private:
   range BinRange_;
   field_indexer BinIndexer_;
   extents_type Extents_;
-  tuple<double> BinSize_;
+  tuple<coord_type> BinSize_;
   array<long long> BinRegionIndicesStarts_;
   array<long long> BinRegionIndices_;
 
@@ -164,7 +164,7 @@ private:
   int Tag_;
 
   array<array_view<const value_type>> Values_;
-  array<array<mpi_value_type,2>> Buffers_;
+  array<core::aligned_array<mpi_value_type,2>> Buffers_;
   array<long long> NextBufferEntry_;
   array<MPI_Request> MPIRequests_;
 
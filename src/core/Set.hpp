@@ -20,12 +20,14 @@
 
 namespace ovk {
 
-template <typename ValueType, typename CompareType=std::less<ValueType>> class set {
+template <typename ValueType, typename CompareType=std::less<ValueType>, typename AllocatorType=
+  std::allocator<ValueType>> class set {
 
 public:
 
   using value_type = ValueType;
   using compare_type = CompareType;
+  using allocator_type = AllocatorType;
   using index_type = long long;
   // Values aren't mutable, so iterator is const
   using iterator = core::pointer_iterator<set, const value_type *>;
@@ -37,23 +39,24 @@ public:
     Compare_(std::move(Compare))
   {}
 
+  explicit set(const allocator_type &Allocator):
+    Values_(Allocator)
+  {}
+
+  set(compare_type Compare, const allocator_type &Allocator):
+    Values_(Allocator),
+    Compare_(std::move(Compare))
+  {}
+
   set(std::initializer_list<value_type> ValuesList) {
-    Values_.Reserve(ValuesList.size());
-    for (auto &Value : ValuesList) {
-      Insert(Value);
-    }
+    Build_(ValuesList.begin(), ValuesList.end());
   }
 
   // Don't care about input iterators enough to implement a second overload
   template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsForwardIterator<IterType>() &&
     std::is_convertible<core::iterator_reference_type<IterType>, value_type>::value)>
     set(IterType Begin, IterType End) {
-    Values_.Reserve(std::distance(Begin, End));
-    IterType Iter = Begin;
-    while (Iter != End) {
-      Insert(*Iter);
-      ++Iter;
-    }
+    Build_(Begin, End);
   }
 
   // Don't care about input iterators enough to implement a second overload
@@ -62,12 +65,7 @@ public:
     set(IterType Begin, IterType End, compare_type Compare):
     Compare_(std::move(Compare))
   {
-    Values_.Reserve(std::distance(Begin, End));
-    IterType Iter = Begin;
-    while (Iter != End) {
-      Insert(*Iter);
-      ++Iter;
-    }
+    Build_(Begin, End);
   }
 
   set &operator=(std::initializer_list<value_type> ValuesList) {
@@ -75,11 +73,7 @@ public:
   }
 
   set &Assign(std::initializer_list<value_type> ValuesList) {
-    Values_.Clear();
-    Values_.Reserve(ValuesList.size());
-    for (auto &Value : ValuesList) {
-      Insert(Value);
-    }
+    Build_(ValuesList.begin(), ValuesList.end());
     return *this;
   }
 
@@ -87,13 +81,7 @@ public:
   template <typename IterType, OVK_FUNCTION_REQUIRES(core::IsForwardIterator<IterType>()
     && std::is_convertible<core::iterator_reference_type<IterType>, value_type>::value)>
     set &Assign(IterType Begin, IterType End) {
-    Values_.Clear();
-    Values_.Reserve(std::distance(Begin, End));
-    IterType Iter = Begin;
-    while (Iter != End) {
-      Insert(*Iter);
-      ++Iter;
-    }
+    Build_(Begin, End);
     return *this;
   }
 
@@ -184,28 +172,57 @@ public:
 
   const compare_type &Compare() const { return Compare_; }
 
+  allocator_type Allocator() const { return Values_.Allocator(); }
+
   bool Compare(const value_type &Left, const value_type &Right) const {
     return Compare_(Left, Right);
   }
 
 private:
 
-  array<value_type> Values_;
+  using values_type = array<value_type, 1, array_layout::ROW_MAJOR, allocator_type>;
+
+  values_type Values_;
   compare_type Compare_;
 
-  typename array<value_type>::const_iterator LowerBound_(const value_type &Value) const {
+  // Appends everything and sorts once instead of inserting values one at a time, which would be
+  // quadratic for unsorted input
+  // Builds into a temporary so that the input range may alias the set's own values
+  template <typename IterType> void Build_(IterType Begin, IterType End) {
+    values_type Values;
+    Values.Reserve(std::distance(Begin, End));
+    IterType Iter = Begin;
+    while (Iter != End) {
+      Values.Append(*Iter);
+      ++Iter;
+    }
+    std::stable_sort(Values.Begin(), Values.End(), Compare_);
+    // Keep the first of any equivalent values, same as repeated Insert
+    const compare_type &Compare = Compare_;
+    auto UniqueEnd = std::unique(Values.Begin(), Values.End(), [&Compare](const value_type &Left,
+      const value_type &Right) -> bool {
+      return !Compare(Left, Right);
+    });
+    index_type NumUnique = index_type(UniqueEnd - Values.Begin());
+    while (Values.Count() > NumUnique) {
+      Values.Erase(Values.Count()-1);
+    }
+    Values_ = std::move(Values);
+  }
+
+  typename values_type::const_iterator LowerBound_(const value_type &Value) const {
     return std::lower_bound(Values_.Begin(), Values_.End(), Value, Compare_);
   }
 
-  typename array<value_type>::iterator LowerBound_(const value_type &Value) {
+  typename values_type::iterator LowerBound_(const value_type &Value) {
     return std::lower_bound(Values_.Begin(), Values_.End(), Value, Compare_);
   }
 
-  typename array<value_type>::const_iterator UpperBound_(const value_type &Value) const {
+  typename values_type::const_iterator UpperBound_(const value_type &Value) const {
     return std::upper_bound(Values_.Begin(), Values_.End(), Value, Compare_);
   }
 
-  typename array<value_type>::iterator UpperBound_(const value_type &Value) {
+  typename values_type::iterator UpperBound_(const value_type &Value) {
     return std::upper_bound(Values_.Begin(), Values_.End(), Value, Compare_);
   }
 
@@ -213,19 +230,20 @@ private:
 
 };
 
-template <typename ValueType, typename CompareType> typename set<ValueType, CompareType>::iterator
-  begin(const set<ValueType, CompareType> &Set) {
+template <typename ValueType, typename CompareType, typename AllocatorType> typename set<ValueType,
+  CompareType, AllocatorType>::iterator begin(const set<ValueType, CompareType, AllocatorType> &Set)
+  {
   return Set.Begin();
 }
 
-template <typename ValueType, typename CompareType> typename set<ValueType, CompareType>::iterator
-  end(const set<ValueType, CompareType> &Set) {
+template <typename ValueType, typename CompareType, typename AllocatorType> typename set<ValueType,
+  CompareType, AllocatorType>::iterator end(const set<ValueType, CompareType, AllocatorType> &Set) {
   return Set.End();
 }
 
-template <typename ValueType, typename CompareType> struct array_traits<set<ValueType, CompareType>>
-  {
-  using set_type = set<ValueType, CompareType>;
+template <typename ValueType, typename CompareType, typename AllocatorType> struct array_traits<
+  set<ValueType, CompareType, AllocatorType>> {
+  using set_type = set<ValueType, CompareType, AllocatorType>;
   using value_type = typename set_type::value_type;
   static constexpr int Rank = 1;
   static constexpr array_layout Layout = array_layout::ROW_MAJOR;
@@ -6,16 +6,21 @@
 
 #include <ovk/core/Array.hpp>
 #include <ovk/core/Global.hpp>
-#include <ovk/core/Map.hpp>
+#include <ovk/core/HashMap.hpp>
 #include <ovk/core/PointerIterator.hpp>
-#include <ovk/core/ScalarOps.hpp>
-#include <ovk/core/Set.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 namespace ovk {
 namespace core {
 
+// Disjoint sets of integer elements, with union by rank and path halving. Elements are located via
+// a lookup table that spans the range of inserted elements, so it is intended for (mostly) dense
+// labels such as those produced by connected component labeling. If the span grows much larger
+// than the number of elements (more than MAX_LOOKUP_SPAN_RATIO times, past MIN_SPARSE_SPAN), the
+// table is replaced by a hash map, so sparse labels cost extra hashing but not extra memory
 class union_find {
 
 public:
@@ -33,87 +38,90 @@ public:
   }
 
   void Insert(int Element) {
-    auto Iter = Elements_.LowerBound(Element);
-    if (Iter == Elements_.End() || *Iter > Element) {
-      Iter = Elements_.Insert(Iter, Element);
-      int iElement = int(Iter - Elements_.Begin());
-      for (int iOtherElement = 0; iOtherElement < ParentIndices_.Count(); ++iOtherElement) {
-        if (ParentIndices_(iOtherElement) >= iElement) {
-          ++ParentIndices_(iOtherElement);
-        }
-      }
-      ParentIndices_.Insert(iElement, iElement);
-      Ranks_.Insert(iElement, 0);
+    if (Index_(Element) >= 0) return;
+    ExpandLookup_(Element);
+    int iElement = int(Elements_.Count());
+    Elements_.Append(Element);
+    ParentIndices_.Append(iElement);
+    Ranks_.Append(0);
+    if (Sparse_) {
+      SparseElementIndices_.Insert(Element, iElement);
+    } else {
+      ElementIndices_(Element-LookupBegin_) = iElement;
     }
+    SortedElementsCurrent_ = false;
   }
 
   int Find(int Element) {
-    auto Iter = Elements_.Find(Element);
-    if (Iter != Elements_.End()) {
-      int iElement = Iter - Elements_.Begin();
-      int iRoot = Find_(iElement);
-      return Elements_[iRoot];
+    int iElement = Index_(Element);
+    if (iElement >= 0) {
+      return Elements_(Find_(iElement));
     } else {
       return -1;
     }
   }
 
   int Union(int LeftElement, int RightElement) {
-    auto LeftIter = Elements_.Find(LeftElement);
-    auto RightIter = Elements_.Find(RightElement);
-    int iLeft = -1;
-    int iRight = -1;
-    if (LeftIter != Elements_.End()) iLeft = LeftIter - Elements_.Begin();
-    if (RightIter != Elements_.End()) iRight = RightIter - Elements_.Begin();
+    int iLeft = Index_(LeftElement);
+    int iRight = Index_(RightElement);
     if (iLeft >= 0 && iRight >= 0) {
       int iLeftRoot = Find_(iLeft);
       int iRightRoot = Find_(iRight);
       if (iLeftRoot != iRightRoot) {
         if (Ranks_(iLeftRoot) < Ranks_(iRightRoot)) {
           ParentIndices_(iLeftRoot) = iRightRoot;
-          return Elements_[iRightRoot];
+          return Elements_(iRightRoot);
         } else if (Ranks_(iLeftRoot) > Ranks_(iRightRoot)) {
           ParentIndices_(iRightRoot) = iLeftRoot;
-          return Elements_[iLeftRoot];
+          return Elements_(iLeftRoot);
         } else {
           ParentIndices_(iRightRoot) = iLeftRoot;
           ++Ranks_(iLeftRoot);
-          return Elements_[iLeftRoot];
+          return Elements_(iLeftRoot);
         }
       } else {
-        return Elements_[iLeftRoot];
+        return Elements_(iLeftRoot);
       }
     } else if (iLeft >= 0) {
-      int iLeftRoot = Find_(iLeft);
-      return Elements_[iLeftRoot];
+      return Elements_(Find_(iLeft));
     } else if (iRight >= 0) {
-      int iRightRoot = Find_(iRight);
-      return Elements_[iRightRoot];
+      return Elements_(Find_(iRight));
     } else {
       return -1;
     }
   }
 
-  // Shuffle things around so that root of each set is the smallest contained element
+  // Shuffle things around so that root of each set is the smallest contained element; also
+  // flattens the sets so that subsequent calls to Find are constant time
   void Relabel() {
-    map<int,int> OldRootIndexToNewRootIndex;
-    for (int iElement = 0; iElement < Elements_.Count(); ++iElement) {
+    int NumElements = int(Elements_.Count());
+    array<int> OldRootIndices({NumElements});
+    array<int> NewRootIndices({NumElements}, -1);
+    for (int iElement = 0; iElement < NumElements; ++iElement) {
       int iOldRoot = Find_(iElement);
-      int &iNewRoot = OldRootIndexToNewRootIndex.Fetch(iOldRoot, iOldRoot);
-      if (Elements_[iElement] < Elements_[iOldRoot]) {
+      OldRootIndices(iElement) = iOldRoot;
+      int &iNewRoot = NewRootIndices(iOldRoot);
+      if (iNewRoot < 0 || Elements_(iElement) < Elements_(iNewRoot)) {
         iNewRoot = iElement;
       }
     }
-    for (int iElement = 0; iElement < Elements_.Count(); ++iElement) {
-      ParentIndices_(iElement) = OldRootIndexToNewRootIndex(ParentIndices_(iElement));
+    for (int iElement = 0; iElement < NumElements; ++iElement) {
+      ParentIndices_(iElement) = NewRootIndices(OldRootIndices(iElement));
       Ranks_(iElement) = ParentIndices_(iElement) == iElement ? 1 : 0;
     }
   }
 
   int Count() const { return int(Elements_.Count()); }
 
-  iterator Begin() const { return iterator(Elements_.Data()); }
-  iterator End() const { return iterator(Elements_.Data()+Elements_.Count()); }
+  // Iterates over elements in sorted order
+  iterator Begin() const {
+    UpdateSortedElements_();
+    return iterator(SortedElements_.Data());
+  }
+  iterator End() const {
+    UpdateSortedElements_();
+    return iterator(SortedElements_.Data()+SortedElements_.Count());
+  }
 
   // Google Test doesn't use free begin/end functions and instead expects container to have
   // lowercase begin/end methods
@@ -122,15 +130,98 @@ public:
 
 private:
 
-  set<int> Elements_;
+  // Element data is stored in insertion order
+  array<int> Elements_;
   array<int> ParentIndices_;
   array<int> Ranks_;
 
+  static constexpr long long MAX_LOOKUP_SPAN_RATIO = 8;
+  static constexpr long long MIN_SPARSE_SPAN = 1 << 16;
+
+  // Index of each element in [LookupBegin_,LookupBegin_+ElementIndices_.Count()), or -1
+  int LookupBegin_ = 0;
+  array<int> ElementIndices_;
+
+  // Used instead of the table once the elements are too sparse
+  bool Sparse_ = false;
+  hash_map<int,int> SparseElementIndices_;
+
+  mutable bool SortedElementsCurrent_ = true;
+  mutable array<int> SortedElements_;
+
+  int Index_(int Element) const {
+    if (Sparse_) {
+      auto Iter = SparseElementIndices_.Find(Element);
+      return Iter != SparseElementIndices_.End() ? Iter->Value() : -1;
+    }
+    long long iLookup = (long long)(Element) - LookupBegin_;
+    if (iLookup >= 0 && iLookup < ElementIndices_.Count()) {
+      return ElementIndices_(iLookup);
+    } else {
+      return -1;
+    }
+  }
+
+  // Grows the lookup table geometrically so that inserting elements one at a time in either
+  // direction is amortized constant time
+  void ExpandLookup_(int Element) {
+    if (Sparse_) return;
+    long long OldBegin = LookupBegin_;
+    long long OldEnd = OldBegin + ElementIndices_.Count();
+    if (ElementIndices_.Count() == 0) {
+      OldBegin = Element;
+      OldEnd = Element;
+    }
+    if (Element >= OldBegin && Element < OldEnd) return;
+    long long OldSize = OldEnd - OldBegin;
+    long long Begin = OldBegin;
+    long long End = OldEnd;
+    if (Element < OldBegin) {
+      Begin = std::min<long long>(Element, OldBegin - OldSize);
+      Begin = std::max<long long>(Begin, std::numeric_limits<int>::min());
+    } else {
+      End = std::max<long long>((long long)(Element) + 1, OldEnd + OldSize);
+      End = std::min<long long>(End, (long long)(std::numeric_limits<int>::max()) + 1);
+    }
+    long long NumElements = Elements_.Count() + 1;
+    if (End-Begin > MIN_SPARSE_SPAN && End-Begin > MAX_LOOKUP_SPAN_RATIO*NumElements) {
+      SwitchToSparse_();
+      return;
+    }
+    array<int> ElementIndices({End-Begin}, -1);
+    for (long long iOld = 0; iOld < OldSize; ++iOld) {
+      ElementIndices(OldBegin-Begin+iOld) = ElementIndices_(iOld);
+    }
+    LookupBegin_ = int(Begin);
+    ElementIndices_ = std::move(ElementIndices);
+  }
+
+  void SwitchToSparse_() {
+    int NumElements = int(Elements_.Count());
+    SparseElementIndices_.Reserve(2*NumElements);
+    for (int iElement = 0; iElement < NumElements; ++iElement) {
+      SparseElementIndices_.Insert(Elements_(iElement), iElement);
+    }
+    LookupBegin_ = 0;
+    ElementIndices_.Clear();
+    Sparse_ = true;
+  }
+
+  void UpdateSortedElements_() const {
+    if (!SortedElementsCurrent_) {
+      SortedElements_ = Elements_;
+      std::sort(SortedElements_.Begin(), SortedElements_.End());
+      SortedElementsCurrent_ = true;
+    }
+  }
+
+  // Path halving
   int Find_(int iElement) {
-    if (ParentIndices_(iElement) != iElement) {
-      ParentIndices_(iElement) = Find_(ParentIndices_(iElement));
+    while (ParentIndices_(iElement) != iElement) {
+      ParentIndices_(iElement) = ParentIndices_(ParentIndices_(iElement));
+      iElement = ParentIndices_(iElement);
     }
-    return ParentIndices_(iElement);
+    return iElement;
   }
 
 };
@@ -11,6 +11,7 @@
 #include <ovk/core/Requires.hpp>
 #include <ovk/core/TypeTraits.hpp>
 
+#include <algorithm>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
@@ -87,21 +88,65 @@ template <typename Allocator, typename IterType, OVK_FUNCTION_REQUIRES(!IsForwar
   }
 }
 
+// Allocator adaptor that skips the value-initialization (i.e., zero fill) of trivially
+// default-constructible elements that std::vector performs when constructing without arguments;
+// vector then does the fill itself only when it's actually wanted
+template <typename Allocator> class default_init_allocator : public Allocator {
+
+private:
+
+  using traits = std::allocator_traits<Allocator>;
+
+public:
+
+  template <typename U> struct rebind {
+    using other = default_init_allocator<typename traits::template rebind_alloc<U>>;
+  };
+
+  default_init_allocator() = default;
+
+  default_init_allocator(const Allocator &Other) noexcept:
+    Allocator(Other)
+  {}
+
+  template <typename OtherAllocator> default_init_allocator(const default_init_allocator<
+    OtherAllocator> &Other) noexcept:
+    Allocator(static_cast<const OtherAllocator &>(Other))
+  {}
+
+  template <typename U, OVK_FUNCTION_REQUIRES(std::is_trivially_default_constructible<U>::value)>
+    void construct(U *Pointer) noexcept {
+    ::new(static_cast<void *>(Pointer)) U;
+  }
+
+  template <typename U, OVK_FUNCTION_REQUIRES(!std::is_trivially_default_constructible<U>::value)>
+    void construct(U *Pointer) {
+    traits::construct(static_cast<Allocator &>(*this), Pointer);
+  }
+
+  template <typename U, typename... Args> void construct(U *Pointer, Args &&... Arguments) {
+    traits::construct(static_cast<Allocator &>(*this), Pointer, std::forward<Args>(Arguments)...);
+  }
+
+};
+
 }
 
 // Wrapper around std::vector to avoid the abomination that is std::vector<bool>
-template <typename T, typename Allocator=std::allocator<T>> class vector {
+template <typename T, typename AllocatorType=std::allocator<T>> class vector {
 
 public:
 
   using value_type = T;
-  using allocator_type = Allocator;
+  using allocator_type = AllocatorType;
 
 private:
 
   using storage_value_type = vector_internal::no_bool<value_type>;
-  using storage_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<
-    storage_value_type>;
+  using storage_base_allocator_type = typename std::allocator_traits<allocator_type>::template
+    rebind_alloc<storage_value_type>;
+  using storage_allocator_type = vector_internal::default_init_allocator<
+    storage_base_allocator_type>;
   using storage_type = std::vector<storage_value_type, storage_allocator_type>;
   using storage_iterator = typename storage_type::iterator;
   using const_storage_iterator = typename storage_type::const_iterator;
@@ -114,14 +159,31 @@ public:
 
   vector() = default;
 
+  explicit vector(const allocator_type &Allocator):
+    Values_(storage_allocator_type(storage_base_allocator_type(Allocator)))
+  {}
+
   explicit vector(index_type NumValues):
     Values_(NumValues)
-  {}
+  {
+    ValueInitialize_(0);
+  }
+
+  vector(index_type NumValues, const allocator_type &Allocator):
+    Values_(NumValues, storage_allocator_type(storage_base_allocator_type(Allocator)))
+  {
+    ValueInitialize_(0);
+  }
 
   vector(index_type NumValues, const value_type &Value):
     Values_(NumValues, reinterpret_cast<const storage_value_type &>(Value))
   {}
 
+  vector(index_type NumValues, const value_type &Value, const allocator_type &Allocator):
+    Values_(NumValues, reinterpret_cast<const storage_value_type &>(Value), storage_allocator_type(
+      storage_base_allocator_type(Allocator)))
+  {}
+
   vector(std::initializer_list<value_type> ValuesList):
     Values_(vector_internal::ConstructFromInitializerList<storage_allocator_type>(ValuesList))
   {}
@@ -166,6 +228,13 @@ public:
   }
 
   void Resize(index_type NumValues) {
+    index_type NumValuesOld = Count();
+    Values_.resize(NumValues);
+    ValueInitialize_(NumValuesOld);
+  }
+
+  // New values are default-initialized, i.e., left indeterminate for trivial types
+  void ResizeDefaultInit(index_type NumValues) {
     Values_.resize(NumValues);
   }
 
@@ -248,6 +317,8 @@ public:
     return Begin() + iValue;
   }
 
+  allocator_type Allocator() const { return allocator_type(Values_.get_allocator()); }
+
   index_type Count() const { return index_type(Values_.size()); }
   index_type Capacity() const { return index_type(Values_.capacity()); }
 
@@ -306,6 +377,18 @@ private:
 
   storage_type Values_;
 
+  // Explicit counterpart to the zero fill skipped by default_init_allocator
+  void ValueInitialize_(index_type iStart) {
+    ValueInitialize_(iStart, std::integral_constant<bool, std::is_trivially_default_constructible<
+      storage_value_type>::value>());
+  }
+  void ValueInitialize_(index_type iStart, std::true_type) {
+    for (auto Iter = Values_.begin()+std::min(iStart, Count()); Iter != Values_.end(); ++Iter) {
+      *Iter = storage_value_type();
+    }
+  }
+  void ValueInitialize_(index_type, std::false_type) {}
+
   friend class test_helper<vector>;
 
 };
@@ -0,0 +1,46 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include "ovk/extras-c/Checkpoint.h"
+
+#include "ovk/extras-c/Global.h"
+#include "ovk/extras/Global.hpp"
+#include "ovk/extras/Checkpoint.hpp"
+#include "ovk/core-c/Global.h"
+#include "ovk/core/Debug.hpp"
+
+#include <string>
+
+extern "C" {
+
+void ovkExportCheckpoint(const ovk_domain *Domain, int StateComponentID, int OverlapComponentID,
+  int ConnectivityComponentID, const char *Path, MPI_Info MPIInfo, ovk_error *Error) {
+
+  OVK_DEBUG_ASSERT(Domain, "Invalid domain pointer.");
+  OVK_DEBUG_ASSERT(Path, "Invalid path pointer.");
+
+  auto &DomainCPP = *reinterpret_cast<const ovk::domain *>(Domain);
+  ovk::captured_error ErrorCPP;
+  ovk::ExportCheckpoint(DomainCPP, StateComponentID, OverlapComponentID, ConnectivityComponentID,
+    Path, MPIInfo, ErrorCPP);
+
+  *Error = ovk_error(ErrorCPP.Code());
+
+}
+
+void ovkImportCheckpoint(ovk_domain *Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const char *Path, MPI_Info MPIInfo, ovk_error *Error) {
+
+  OVK_DEBUG_ASSERT(Domain, "Invalid domain pointer.");
+  OVK_DEBUG_ASSERT(Path, "Invalid path pointer.");
+
+  auto &DomainCPP = *reinterpret_cast<ovk::domain *>(Domain);
+  ovk::captured_error ErrorCPP;
+  ovk::ImportCheckpoint(DomainCPP, StateComponentID, OverlapComponentID, ConnectivityComponentID,
+    Path, MPIInfo, ErrorCPP);
+
+  *Error = ovk_error(ErrorCPP.Code());
+
+}
+
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_EXTRAS_C_CHECKPOINT_H_INCLUDED
+#define OVK_EXTRAS_C_CHECKPOINT_H_INCLUDED
+
+#include <ovk/extras-c/Global.h>
+#include <ovk/core-c/Domain.h>
+
+#include <mpi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ovkExportCheckpoint(const ovk_domain *Domain, int StateComponentID, int OverlapComponentID,
+  int ConnectivityComponentID, const char *Path, MPI_Info MPIInfo, ovk_error *Error);
+void ovkImportCheckpoint(ovk_domain *Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const char *Path, MPI_Info MPIInfo, ovk_error *Error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
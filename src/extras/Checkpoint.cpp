@@ -0,0 +1,1772 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include "ovk/extras/Checkpoint.hpp"
+
+#include "ovk/extras/Global.hpp"
+#include "ovk/core/Array.hpp"
+#include "ovk/core/ArrayView.hpp"
+#include "ovk/core/Cart.hpp"
+#include "ovk/core/Comm.hpp"
+#include "ovk/core/CommunicationOps.hpp"
+#include "ovk/core/ConnectivityComponent.hpp"
+#include "ovk/core/ConnectivityM.hpp"
+#include "ovk/core/ConnectivityN.hpp"
+#include "ovk/core/Context.hpp"
+#include "ovk/core/DataType.hpp"
+#include "ovk/core/DistributedField.hpp"
+#include "ovk/core/Domain.hpp"
+#include "ovk/core/Editor.hpp"
+#include "ovk/core/Elem.hpp"
+#include "ovk/core/ElemMap.hpp"
+#include "ovk/core/Error.hpp"
+#include "ovk/core/Field.hpp"
+#include "ovk/core/Grid.hpp"
+#include "ovk/core/Logger.hpp"
+#include "ovk/core/Map.hpp"
+#include "ovk/core/OverlapComponent.hpp"
+#include "ovk/core/OverlapM.hpp"
+#include "ovk/core/OverlapN.hpp"
+#include "ovk/core/Profiler.hpp"
+#include "ovk/core/Range.hpp"
+#include "ovk/core/RegionHash.hpp"
+#include "ovk/core/ScalarOps.hpp"
+#include "ovk/core/ScopeGuard.hpp"
+#include "ovk/core/Set.hpp"
+#include "ovk/core/State.hpp"
+#include "ovk/core/StateComponent.hpp"
+#include "ovk/core/Tuple.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace ovk {
+
+namespace {
+
+// File layout (native byte order; readers use the byte order mark to detect a mismatch):
+//
+//   char[8] magic, int byte order mark, int version, int header size
+//   int[header size] header (grid signatures, decomposition, and state/overlap/connectivity IDs)
+//   For each grid, in order of ID:
+//     flags section (only for grids that have a state)
+//     overlap M, overlap N, connectivity M, and connectivity N sections
+//
+// Each section is a list of fixed-size records:
+//
+//   int number of ints per record, int number of doubles per record
+//   long long[number of ranks] number of records written by each rank
+//   int[] record ints, double[] record doubles (record-major, ordered by writing rank)
+
+constexpr int EXPORT_TIME = core::profiler::CHECKPOINT_EXPORT_TIME;
+constexpr int EXPORT_WRITE_TIME = core::profiler::CHECKPOINT_EXPORT_WRITE_TIME;
+constexpr int IMPORT_TIME = core::profiler::CHECKPOINT_IMPORT_TIME;
+constexpr int IMPORT_READ_TIME = core::profiler::CHECKPOINT_IMPORT_READ_TIME;
+constexpr int IMPORT_DISTRIBUTE_TIME = core::profiler::CHECKPOINT_IMPORT_DISTRIBUTE_TIME;
+constexpr int IMPORT_SET_COMPONENTS_TIME = core::profiler::CHECKPOINT_IMPORT_SET_COMPONENTS_TIME;
+
+const char MAGIC[8] = {'O', 'V', 'K', 'C', 'K', 'P', 'T', '\0'};
+constexpr int BYTE_ORDER_MARK = 0x01020304;
+constexpr int VERSION = 1;
+constexpr MPI_Offset PREFIX_SIZE = sizeof(MAGIC) + 3*sizeof(int);
+// Far more than any real header needs (a few ints per grid per rank); guards against allocating
+// based on a corrupted length
+constexpr int MAX_HEADER_INTS = 1 << 27;
+
+// Ints: N grid ID, cell, destination point, destination rank; doubles: coords
+constexpr int OVERLAP_M_NUM_INTS = 2 + 2*MAX_DIMS;
+constexpr int OVERLAP_M_NUM_DOUBLES = MAX_DIMS;
+
+// Ints: M grid ID, point, source cell, source rank
+constexpr int OVERLAP_N_NUM_INTS = 2 + 2*MAX_DIMS;
+
+// Ints: N grid ID, extents, destination point, destination rank; doubles: coords, interp coefs
+// (padded to the largest stencil size of any connectivity in the section)
+constexpr int CONNECTIVITY_M_NUM_INTS = 2 + 3*MAX_DIMS;
+
+// Ints: M grid ID, point, source point, source rank
+constexpr int CONNECTIVITY_N_NUM_INTS = 2 + 2*MAX_DIMS;
+
+struct record_data {
+  int NumInts;
+  int NumDoubles;
+  long long Count = 0;
+  array<int> Ints;
+  array<double> Doubles;
+  record_data(int NumInts_, int NumDoubles_):
+    NumInts(NumInts_),
+    NumDoubles(NumDoubles_)
+  {}
+};
+
+struct checkpoint_grid {
+  std::string Name;
+  range GlobalRange;
+  tuple<bool> Periodic;
+  periodic_storage PeriodicStorage;
+  array<range> LocalRanges;
+};
+
+struct checkpoint_header {
+  int NumDims;
+  int NumRanks;
+  map<int,checkpoint_grid> Grids;
+  array<int> StateGridIDs;
+  array<elem<int,2>> OverlapIDs;
+  array<elem<int,2>> ConnectivityIDs;
+  elem_map<int,2,int> ConnectivityMaxStencilSizes;
+};
+
+struct section_info {
+  int NumInts;
+  int NumDoubles;
+  array<long long> Starts;
+  MPI_Offset IntsOffset;
+  MPI_Offset DoublesOffset;
+};
+
+// Local ranges of a grid in the current decomposition, hashed so that the rank owning a given
+// point or cell can be found quickly
+struct grid_decomp {
+  array<int> Ranks;
+  array<range> LocalRanges;
+  array<range> CellLocalRanges;
+  core::region_hash<range> LocalRangeHash;
+  core::region_hash<range> CellLocalRangeHash;
+  explicit grid_decomp(int NumDims):
+    LocalRangeHash(NumDims),
+    CellLocalRangeHash(NumDims)
+  {}
+};
+
+void GatherLocalRanges(const domain &Domain, map<int,array<range>> &LocalRangesForGrid,
+  map<int,array<range>> &CellLocalRangesForGrid);
+array<int> EncodeHeader(const domain &Domain, const map<int,array<range>> &LocalRangesForGrid,
+  const checkpoint_header &Header);
+bool DecodeHeader(array_view<const int> HeaderInts, checkpoint_header &Header);
+bool HeaderMatchesDomain(const checkpoint_header &Header, const domain &Domain, const std::string
+  &Path);
+int SectionMaxStencilSize(const checkpoint_header &Header, int MGridID);
+
+record_data CollectFlags(const domain &Domain, int StateComponentID, int GridID);
+record_data CollectOverlapM(const domain &Domain, int OverlapComponentID, int GridID);
+record_data CollectOverlapN(const domain &Domain, int OverlapComponentID, int GridID);
+record_data CollectConnectivityM(const domain &Domain, int ConnectivityComponentID, int GridID,
+  int MaxStencilSize);
+record_data CollectConnectivityN(const domain &Domain, int ConnectivityComponentID, int GridID);
+
+template <typename T> bool WriteAtAll(MPI_File File, MPI_Offset Offset, const T *Data, long long
+  Count, comm_view Comm);
+template <typename T> bool ReadAtAll(MPI_File File, MPI_Offset Offset, T *Data, long long Count,
+  comm_view Comm);
+bool WriteSection(MPI_File File, MPI_Offset &Offset, const record_data &Records, comm_view Comm);
+bool ReadSectionInfo(MPI_File File, MPI_Offset &Offset, int NumRanks, section_info &Info,
+  comm_view Comm);
+bool ReadRecords(MPI_File File, const section_info &Info, long long Begin, long long End,
+  record_data &Records, comm_view Comm);
+bool ReadFlagsInRange(MPI_File File, const section_info &Info, const array<range> &FileLocalRanges,
+  const range &LocalRange, record_data &Records);
+
+map<int,grid_decomp> CreateGridDecomps(const domain &Domain, const map<int,array<range>>
+  &LocalRangesForGrid, const map<int,array<range>> &CellLocalRangesForGrid);
+int FindOwner(const core::region_hash<range> &Hash, const array<range> &Ranges, const tuple<int>
+  &Point);
+record_data RouteRecords(comm_view Comm, map<int,record_data> &SendRecordsForRank, int NumInts, int
+  NumDoubles);
+void AppendRecord(map<int,record_data> &RecordsForRank, int Rank, const record_data &Source,
+  long long iSourceRecord, array_view<const int> Ints={});
+map<int,record_data> RouteOverlapM(const domain &Domain, const map<int,grid_decomp> &Decomps, int
+  GridID, const record_data &Records);
+map<int,record_data> RouteOverlapN(const map<int,grid_decomp> &Decomps, int GridID, const
+  record_data &Records);
+map<int,record_data> RouteConnectivityM(const domain &Domain, const map<int,grid_decomp> &Decomps,
+  const checkpoint_header &Header, int GridID, const section_info &Info, long long Begin, const
+  record_data &Records);
+map<int,record_data> RouteConnectivityN(const map<int,grid_decomp> &Decomps, int GridID,
+  const record_data &Records);
+void SortRecords(const domain &Domain, int GridID, bool IndexOnOtherGrid, record_data &Records);
+
+void SetStates(domain &Domain, int StateComponentID, const checkpoint_header &Header,
+  map<int,record_data> &FlagsForLocalGrid);
+void SetOverlaps(domain &Domain, int OverlapComponentID, const checkpoint_header &Header,
+  map<int,record_data> &OverlapMForLocalGrid, map<int,record_data> &OverlapNForLocalGrid);
+void SetConnectivities(domain &Domain, int ConnectivityComponentID, const checkpoint_header &Header,
+  map<int,record_data> &ConnectivityMForLocalGrid, map<int,record_data>
+  &ConnectivityNForLocalGrid);
+
+bool AllSucceeded(bool Success, comm_view Comm);
+
+}
+
+void ExportCheckpoint(const domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo) {
+
+  OVK_DEBUG_ASSERT(Domain.ComponentExists(StateComponentID), "Invalid state component ID.");
+  OVK_DEBUG_ASSERT(Domain.ComponentExists(OverlapComponentID), "Invalid overlap component ID.");
+  OVK_DEBUG_ASSERT(Domain.ComponentExists(ConnectivityComponentID), "Invalid connectivity "
+    "component ID.");
+
+  const context &Context = Domain.Context();
+  core::logger &Logger = Context.core_Logger();
+  core::profiler &Profiler = Context.core_Profiler();
+
+  const comm &Comm = Domain.Comm();
+
+  Profiler.StartSync(EXPORT_TIME, Comm);
+  auto StopExportTimer = core::OnScopeExit([&] { Profiler.Stop(EXPORT_TIME); });
+
+  Logger.LogStatus(Comm.Rank() == 0, "Writing checkpoint file '%s'...", Path);
+  auto Level1 = Logger.IncreaseStatusLevelAndIndent();
+
+  const auto &StateComponent = Domain.Component<state_component>(StateComponentID);
+  const auto &OverlapComponent = Domain.Component<overlap_component>(OverlapComponentID);
+  const auto &ConnectivityComponent = Domain.Component<connectivity_component>(
+    ConnectivityComponentID);
+
+  map<int,array<range>> LocalRangesForGrid, CellLocalRangesForGrid;
+  GatherLocalRanges(Domain, LocalRangesForGrid, CellLocalRangesForGrid);
+
+  checkpoint_header Header;
+  Header.NumDims = Domain.Dimension();
+  Header.NumRanks = Comm.Size();
+  for (int GridID : StateComponent.StateIDs()) {
+    Header.StateGridIDs.Append(GridID);
+  }
+  for (auto &OverlapID : OverlapComponent.OverlapIDs()) {
+    Header.OverlapIDs.Append(OverlapID);
+  }
+  for (auto &ConnectivityID : ConnectivityComponent.ConnectivityIDs()) {
+    Header.ConnectivityIDs.Append(ConnectivityID);
+  }
+
+  // Stencil sizes are only known on the donor grid's ranks
+  int NumConnectivities = Header.ConnectivityIDs.Count();
+  array<int> MaxStencilSizes({NumConnectivities}, 0);
+  for (int iConnectivity = 0; iConnectivity < NumConnectivities; ++iConnectivity) {
+    const elem<int,2> &ConnectivityID = Header.ConnectivityIDs(iConnectivity);
+    if (ConnectivityComponent.LocalConnectivityMIDs().Contains(ConnectivityID)) {
+      MaxStencilSizes(iConnectivity) = ConnectivityComponent.ConnectivityM(ConnectivityID).
+        MaxStencilSize();
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, MaxStencilSizes.Data(), NumConnectivities, MPI_INT, MPI_MAX, Comm);
+  for (int iConnectivity = 0; iConnectivity < NumConnectivities; ++iConnectivity) {
+    Header.ConnectivityMaxStencilSizes.Insert(Header.ConnectivityIDs(iConnectivity),
+      MaxStencilSizes(iConnectivity));
+  }
+
+  array<int> HeaderInts = EncodeHeader(Domain, LocalRangesForGrid, Header);
+
+  captured_error Error;
+
+  Profiler.Start(EXPORT_WRITE_TIME);
+
+  try {
+
+    MPI_File File;
+    // MPI_File_open missing const qualifier for path string on some platforms
+    int MPIError = MPI_File_open(Comm, const_cast<char *>(Path.c_str()), MPI_MODE_WRONLY |
+      MPI_MODE_CREATE, MPIInfo, &File);
+    if (!AllSucceeded(MPIError == MPI_SUCCESS, Comm)) {
+      if (MPIError == MPI_SUCCESS) MPI_File_close(&File);
+      Logger.LogError(Comm.Rank() == 0, "Unable to open file '%s'.", Path);
+      throw file_open_error(Path);
+    }
+    auto CloseFile = core::OnScopeExit([&] { MPI_File_close(&File); });
+
+    bool Success = MPI_File_set_size(File, 0) == MPI_SUCCESS;
+
+    if (Comm.Rank() == 0) {
+      int Prefix[3] = {BYTE_ORDER_MARK, VERSION, int(HeaderInts.Count())};
+      MPI_Status Status;
+      Success = Success && MPI_File_write_at(File, 0, const_cast<char *>(MAGIC), sizeof(MAGIC),
+        MPI_BYTE, &Status) == MPI_SUCCESS;
+      Success = Success && MPI_File_write_at(File, sizeof(MAGIC), Prefix, 3, MPI_INT, &Status) ==
+        MPI_SUCCESS;
+      Success = Success && MPI_File_write_at(File, PREFIX_SIZE, HeaderInts.Data(),
+        int(HeaderInts.Count()), MPI_INT, &Status) == MPI_SUCCESS;
+    }
+
+    MPI_Offset Offset = PREFIX_SIZE + MPI_Offset(HeaderInts.Count())*sizeof(int);
+
+    for (int GridID : Domain.GridIDs()) {
+      if (StateComponent.StateExists(GridID)) {
+        record_data Flags = CollectFlags(Domain, StateComponentID, GridID);
+        Success = WriteSection(File, Offset, Flags, Comm) && Success;
+      }
+      record_data OverlapM = CollectOverlapM(Domain, OverlapComponentID, GridID);
+      Success = WriteSection(File, Offset, OverlapM, Comm) && Success;
+      record_data OverlapN = CollectOverlapN(Domain, OverlapComponentID, GridID);
+      Success = WriteSection(File, Offset, OverlapN, Comm) && Success;
+      record_data ConnectivityM = CollectConnectivityM(Domain, ConnectivityComponentID, GridID,
+        SectionMaxStencilSize(Header, GridID));
+      Success = WriteSection(File, Offset, ConnectivityM, Comm) && Success;
+      record_data ConnectivityN = CollectConnectivityN(Domain, ConnectivityComponentID, GridID);
+      Success = WriteSection(File, Offset, ConnectivityN, Comm) && Success;
+    }
+
+    if (!AllSucceeded(Success, Comm)) {
+      Logger.LogError(Comm.Rank() == 0, "Failed to write checkpoint data to file '%s'.", Path);
+      throw file_write_error(Path);
+    }
+
+  } catch (const error &WriteError) {
+
+    Error = WriteError.Capture();
+
+  }
+
+  Profiler.Stop(EXPORT_WRITE_TIME);
+
+  Error.Check(Comm);
+
+  Level1.Reset();
+  Logger.LogStatus(Comm.Rank() == 0, "Done writing checkpoint file.");
+
+}
+
+void ExportCheckpoint(const domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo, captured_error &Error) {
+
+  Error.Reset();
+
+  try {
+    ExportCheckpoint(Domain, StateComponentID, OverlapComponentID, ConnectivityComponentID, Path,
+      MPIInfo);
+  } catch (const error &ExportError) {
+    Error = ExportError.Capture();
+  }
+
+}
+
+void ImportCheckpoint(domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo) {
+
+  OVK_DEBUG_ASSERT(Domain.ComponentExists(StateComponentID), "Invalid state component ID.");
+  OVK_DEBUG_ASSERT(Domain.ComponentExists(OverlapComponentID), "Invalid overlap component ID.");
+  OVK_DEBUG_ASSERT(Domain.ComponentExists(ConnectivityComponentID), "Invalid connectivity "
+    "component ID.");
+
+  context &Context = Domain.Context();
+  core::logger &Logger = Context.core_Logger();
+  core::profiler &Profiler = Context.core_Profiler();
+
+  const comm &Comm = Domain.Comm();
+
+  Profiler.StartSync(IMPORT_TIME, Comm);
+  auto StopImportTimer = core::OnScopeExit([&] { Profiler.Stop(IMPORT_TIME); });
+
+  Logger.LogStatus(Comm.Rank() == 0, "Reading checkpoint file '%s'...", Path);
+  auto Level1 = Logger.IncreaseStatusLevelAndIndent();
+
+  map<int,array<range>> LocalRangesForGrid, CellLocalRangesForGrid;
+  GatherLocalRanges(Domain, LocalRangesForGrid, CellLocalRangesForGrid);
+
+  checkpoint_header Header;
+
+  map<int,record_data> FlagsForLocalGrid;
+  map<int,record_data> OverlapMForLocalGrid, OverlapNForLocalGrid;
+  map<int,record_data> ConnectivityMForLocalGrid, ConnectivityNForLocalGrid;
+
+  captured_error Error;
+
+  Profiler.Start(IMPORT_READ_TIME);
+  auto StopReadTimer = core::OnScopeExit([&] { Profiler.Stop(IMPORT_READ_TIME); });
+
+  MPI_File File;
+  // MPI_File_open missing const qualifier for path string on some platforms
+  int MPIError = MPI_File_open(Comm, const_cast<char *>(Path.c_str()), MPI_MODE_RDONLY, MPIInfo,
+    &File);
+  if (!AllSucceeded(MPIError == MPI_SUCCESS, Comm)) {
+    if (MPIError == MPI_SUCCESS) MPI_File_close(&File);
+    Logger.LogError(Comm.Rank() == 0, "Unable to open file '%s'.", Path);
+    throw file_open_error(Path);
+  }
+  auto CloseFile = core::OnScopeExit([&] { MPI_File_close(&File); });
+
+  array<int> HeaderInts;
+
+  try {
+    if (Comm.Rank() == 0) {
+      char Magic[sizeof(MAGIC)];
+      int Prefix[3];
+      MPI_Status Status;
+      bool Success = MPI_File_read_at(File, 0, Magic, sizeof(MAGIC), MPI_BYTE, &Status) ==
+        MPI_SUCCESS;
+      Success = Success && MPI_File_read_at(File, sizeof(MAGIC), Prefix, 3, MPI_INT, &Status) ==
+        MPI_SUCCESS;
+      if (!Success || std::memcmp(Magic, MAGIC, sizeof(MAGIC)) != 0) {
+        Logger.LogError(true, "File '%s' is not a checkpoint file.", Path);
+        throw file_read_error(Path);
+      }
+      if (Prefix[0] != BYTE_ORDER_MARK) {
+        Logger.LogError(true, "Checkpoint file '%s' was written with a different byte order.",
+          Path);
+        throw file_read_error(Path);
+      }
+      if (Prefix[1] != VERSION) {
+        Logger.LogError(true, "Checkpoint file '%s' has unsupported version %i.", Path, Prefix[1]);
+        throw file_read_error(Path);
+      }
+      MPI_Offset FileSize;
+      Success = MPI_File_get_size(File, &FileSize) == MPI_SUCCESS;
+      if (!Success || Prefix[2] < 0 || Prefix[2] > MAX_HEADER_INTS || PREFIX_SIZE +
+        MPI_Offset(Prefix[2])*MPI_Offset(sizeof(int)) > FileSize) {
+        Logger.LogError(true, "Checkpoint file '%s' is truncated or has a corrupted header.",
+          Path);
+        throw file_read_error(Path);
+      }
+      HeaderInts.Resize({Prefix[2]});
+      Success = MPI_File_read_at(File, PREFIX_SIZE, HeaderInts.Data(), Prefix[2], MPI_INT,
+        &Status) == MPI_SUCCESS;
+      int ReadSize = 0;
+      if (Success) MPI_Get_count(&Status, MPI_INT, &ReadSize);
+      if (!Success || ReadSize != Prefix[2]) {
+        Logger.LogError(true, "Failed to read header of checkpoint file '%s'.", Path);
+        throw file_read_error(Path);
+      }
+    }
+  } catch (const error &ReadHeaderError) {
+    Error = ReadHeaderError.Capture();
+  }
+
+  Logger.SyncIndicator(Comm);
+
+  Error.Check(Comm);
+
+  int NumHeaderInts = int(HeaderInts.Count());
+  MPI_Bcast(&NumHeaderInts, 1, MPI_INT, 0, Comm);
+  HeaderInts.Resize({NumHeaderInts});
+  MPI_Bcast(HeaderInts.Data(), NumHeaderInts, MPI_INT, 0, Comm);
+
+  if (!DecodeHeader(HeaderInts, Header)) {
+    Logger.LogError(Comm.Rank() == 0, "Checkpoint file '%s' has a corrupted header.", Path);
+    throw file_read_error(Path);
+  }
+
+  if (!HeaderMatchesDomain(Header, Domain, Path)) {
+    throw file_read_error(Path);
+  }
+
+  bool SameDecomp = Header.NumRanks == Comm.Size();
+  if (SameDecomp) {
+    for (int GridID : Domain.GridIDs()) {
+      const array<range> &FileLocalRanges = Header.Grids(GridID).LocalRanges;
+      const array<range> &LocalRanges = LocalRangesForGrid(GridID);
+      for (int Rank = 0; Rank < Comm.Size(); ++Rank) {
+        SameDecomp = SameDecomp && FileLocalRanges(Rank) == LocalRanges(Rank);
+      }
+    }
+  }
+
+  if (SameDecomp) {
+    Logger.LogStatus(Comm.Rank() == 0, "Decomposition matches checkpoint; reading local data "
+      "directly.");
+  } else {
+    Logger.LogStatus(Comm.Rank() == 0, "Decomposition differs from checkpoint (written on %i "
+      "ranks); redistributing.", Header.NumRanks);
+  }
+
+  map<int,grid_decomp> Decomps;
+  if (!SameDecomp) {
+    Decomps = CreateGridDecomps(Domain, LocalRangesForGrid, CellLocalRangesForGrid);
+  }
+
+  set<int> StateGridIDs;
+  for (int GridID : Header.StateGridIDs) {
+    StateGridIDs.Insert(GridID);
+  }
+
+  int Rank = Comm.Rank();
+  int Size = Comm.Size();
+
+  MPI_Offset Offset = PREFIX_SIZE + MPI_Offset(NumHeaderInts)*sizeof(int);
+
+  bool Success = true;
+
+  // Reads a section's records, either this rank's own slice when the decomposition matches, or an
+  // even share of the section that must then be routed to the appropriate ranks
+  auto ReadSection = [&](section_info &Info, long long &Begin, record_data &Records) {
+    Success = ReadSectionInfo(File, Offset, Header.NumRanks, Info, Comm) && Success;
+    long long Total = Info.Starts(Header.NumRanks);
+    long long End;
+    if (SameDecomp) {
+      Begin = Info.Starts(Rank);
+      End = Info.Starts(Rank+1);
+    } else {
+      Begin = (Total*Rank)/Size;
+      End = (Total*(Rank+1))/Size;
+    }
+    Records = record_data(Info.NumInts, Info.NumDoubles);
+    Success = ReadRecords(File, Info, Begin, End, Records, Comm) && Success;
+  };
+
+  for (int GridID : Domain.GridIDs()) {
+
+    bool GridIsLocal = Domain.GridIsLocal(GridID);
+
+    section_info Info;
+    long long Begin;
+
+    if (StateGridIDs.Contains(GridID)) {
+      record_data Records(1, 0);
+      if (SameDecomp) {
+        ReadSection(Info, Begin, Records);
+      } else {
+        Success = ReadSectionInfo(File, Offset, Header.NumRanks, Info, Comm) && Success;
+        if (GridIsLocal) {
+          Success = ReadFlagsInRange(File, Info, Header.Grids(GridID).LocalRanges,
+            Domain.Grid(GridID).LocalRange(), Records) && Success;
+        }
+      }
+      if (GridIsLocal) FlagsForLocalGrid.Insert(GridID, std::move(Records));
+    }
+
+    record_data Records(0, 0);
+
+    ReadSection(Info, Begin, Records);
+    if (!SameDecomp) {
+      Profiler.Start(IMPORT_DISTRIBUTE_TIME);
+      map<int,record_data> Sends = RouteOverlapM(Domain, Decomps, GridID, Records);
+      Records = RouteRecords(Comm, Sends, Info.NumInts, Info.NumDoubles);
+      if (GridIsLocal) SortRecords(Domain, GridID, true, Records);
+      Profiler.Stop(IMPORT_DISTRIBUTE_TIME);
+    }
+    if (GridIsLocal) OverlapMForLocalGrid.Insert(GridID, std::move(Records));
+
+    ReadSection(Info, Begin, Records);
+    if (!SameDecomp) {
+      Profiler.Start(IMPORT_DISTRIBUTE_TIME);
+      map<int,record_data> Sends = RouteOverlapN(Decomps, GridID, Records);
+      Records = RouteRecords(Comm, Sends, Info.NumInts, Info.NumDoubles);
+      if (GridIsLocal) SortRecords(Domain, GridID, false, Records);
+      Profiler.Stop(IMPORT_DISTRIBUTE_TIME);
+    }
+    if (GridIsLocal) OverlapNForLocalGrid.Insert(GridID, std::move(Records));
+
+    ReadSection(Info, Begin, Records);
+    if (!SameDecomp) {
+      Profiler.Start(IMPORT_DISTRIBUTE_TIME);
+      map<int,record_data> Sends = RouteConnectivityM(Domain, Decomps, Header, GridID, Info, Begin,
+        Records);
+      Records = RouteRecords(Comm, Sends, Info.NumInts, Info.NumDoubles);
+      if (GridIsLocal) SortRecords(Domain, GridID, true, Records);
+      Profiler.Stop(IMPORT_DISTRIBUTE_TIME);
+    }
+    if (GridIsLocal) ConnectivityMForLocalGrid.Insert(GridID, std::move(Records));
+
+    ReadSection(Info, Begin, Records);
+    if (!SameDecomp) {
+      Profiler.Start(IMPORT_DISTRIBUTE_TIME);
+      map<int,record_data> Sends = RouteConnectivityN(Decomps, GridID, Records);
+      Records = RouteRecords(Comm, Sends, Info.NumInts, Info.NumDoubles);
+      if (GridIsLocal) SortRecords(Domain, GridID, false, Records);
+      Profiler.Stop(IMPORT_DISTRIBUTE_TIME);
+    }
+    if (GridIsLocal) ConnectivityNForLocalGrid.Insert(GridID, std::move(Records));
+
+  }
+
+  if (!AllSucceeded(Success, Comm)) {
+    Logger.LogError(Comm.Rank() == 0, "Failed to read checkpoint data from file '%s'.", Path);
+    throw file_read_error(Path);
+  }
+
+  CloseFile.Dismiss();
+  MPI_File_close(&File);
+
+  StopReadTimer.Dismiss();
+  Profiler.Stop(IMPORT_READ_TIME);
+
+  Profiler.StartSync(IMPORT_SET_COMPONENTS_TIME, Comm);
+  SetStates(Domain, StateComponentID, Header, FlagsForLocalGrid);
+  SetOverlaps(Domain, OverlapComponentID, Header, OverlapMForLocalGrid, OverlapNForLocalGrid);
+  SetConnectivities(Domain, ConnectivityComponentID, Header, ConnectivityMForLocalGrid,
+    ConnectivityNForLocalGrid);
+  Profiler.Stop(IMPORT_SET_COMPONENTS_TIME);
+
+  Level1.Reset();
+  Logger.LogStatus(Comm.Rank() == 0, "Done reading checkpoint file.");
+
+}
+
+void ImportCheckpoint(domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo, captured_error &Error) {
+
+  Error.Reset();
+
+  try {
+    ImportCheckpoint(Domain, StateComponentID, OverlapComponentID, ConnectivityComponentID, Path,
+      MPIInfo);
+  } catch (const error &ImportError) {
+    Error = ImportError.Capture();
+  }
+
+}
+
+namespace {
+
+void GatherLocalRanges(const domain &Domain, map<int,array<range>> &LocalRangesForGrid,
+  map<int,array<range>> &CellLocalRangesForGrid) {
+
+  const comm &Comm = Domain.Comm();
+
+  int NumGrids = Domain.GridCount();
+
+  array<int,2> SendData({{NumGrids,4*MAX_DIMS}}, 0);
+  int iGrid = 0;
+  for (int GridID : Domain.GridIDs()) {
+    if (Domain.GridIsLocal(GridID)) {
+      const grid &Grid = Domain.Grid(GridID);
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        SendData(iGrid,iDim) = Grid.LocalRange().Begin(iDim);
+        SendData(iGrid,MAX_DIMS+iDim) = Grid.LocalRange().End(iDim);
+        SendData(iGrid,2*MAX_DIMS+iDim) = Grid.CellLocalRange().Begin(iDim);
+        SendData(iGrid,3*MAX_DIMS+iDim) = Grid.CellLocalRange().End(iDim);
+      }
+    }
+    ++iGrid;
+  }
+
+  array<int,3> RecvData({{Comm.Size(),NumGrids,4*MAX_DIMS}});
+  MPI_Allgather(SendData.Data(), 4*MAX_DIMS*NumGrids, MPI_INT, RecvData.Data(), 4*MAX_DIMS*
+    NumGrids, MPI_INT, Comm);
+
+  LocalRangesForGrid.Clear();
+  CellLocalRangesForGrid.Clear();
+
+  iGrid = 0;
+  for (int GridID : Domain.GridIDs()) {
+    array<range> &LocalRanges = LocalRangesForGrid.Insert(GridID, array<range>({Comm.Size()}));
+    array<range> &CellLocalRanges = CellLocalRangesForGrid.Insert(GridID, array<range>({
+      Comm.Size()}));
+    for (int Rank = 0; Rank < Comm.Size(); ++Rank) {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        LocalRanges(Rank).Begin(iDim) = RecvData(Rank,iGrid,iDim);
+        LocalRanges(Rank).End(iDim) = RecvData(Rank,iGrid,MAX_DIMS+iDim);
+        CellLocalRanges(Rank).Begin(iDim) = RecvData(Rank,iGrid,2*MAX_DIMS+iDim);
+        CellLocalRanges(Rank).End(iDim) = RecvData(Rank,iGrid,3*MAX_DIMS+iDim);
+      }
+    }
+    ++iGrid;
+  }
+
+}
+
+array<int> EncodeHeader(const domain &Domain, const map<int,array<range>> &LocalRangesForGrid,
+  const checkpoint_header &Header) {
+
+  array<int> HeaderInts;
+
+  HeaderInts.Append(Header.NumDims);
+  HeaderInts.Append(Domain.GridCount());
+  HeaderInts.Append(Header.NumRanks);
+  HeaderInts.Append(int(Header.StateGridIDs.Count()));
+  HeaderInts.Append(int(Header.OverlapIDs.Count()));
+  HeaderInts.Append(int(Header.ConnectivityIDs.Count()));
+
+  for (int GridID : Domain.GridIDs()) {
+    const grid_info &GridInfo = Domain.GridInfo(GridID);
+    const cart &Cart = GridInfo.Cart();
+    HeaderInts.Append(GridID);
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      HeaderInts.Append(Cart.Range().Begin(iDim));
+    }
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      HeaderInts.Append(Cart.Range().End(iDim));
+    }
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      HeaderInts.Append(int(Cart.Periodic(iDim)));
+    }
+    HeaderInts.Append(int(Cart.PeriodicStorage()));
+    const std::string &Name = GridInfo.Name();
+    HeaderInts.Append(int(Name.length()));
+    for (char Character : Name) {
+      HeaderInts.Append(int(Character));
+    }
+    for (auto &LocalRange : LocalRangesForGrid(GridID)) {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        HeaderInts.Append(LocalRange.Begin(iDim));
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        HeaderInts.Append(LocalRange.End(iDim));
+      }
+    }
+  }
+
+  for (int GridID : Header.StateGridIDs) {
+    HeaderInts.Append(GridID);
+  }
+
+  for (auto &OverlapID : Header.OverlapIDs) {
+    HeaderInts.Append(OverlapID(0));
+    HeaderInts.Append(OverlapID(1));
+  }
+
+  for (auto &ConnectivityID : Header.ConnectivityIDs) {
+    HeaderInts.Append(ConnectivityID(0));
+    HeaderInts.Append(ConnectivityID(1));
+    HeaderInts.Append(Header.ConnectivityMaxStencilSizes(ConnectivityID));
+  }
+
+  return HeaderInts;
+
+}
+
+bool DecodeHeader(array_view<const int> HeaderInts, checkpoint_header &Header) {
+
+  long long iInt = 0;
+  bool Valid = true;
+
+  auto Next = [&]() -> int {
+    if (iInt < HeaderInts.Count()) {
+      return HeaderInts(iInt++);
+    } else {
+      Valid = false;
+      return 0;
+    }
+  };
+
+  Header.NumDims = Next();
+  int NumGrids = Next();
+  Header.NumRanks = Next();
+  int NumStates = Next();
+  int NumOverlaps = Next();
+  int NumConnectivities = Next();
+
+  if (!Valid || Header.NumDims < 1 || Header.NumDims > MAX_DIMS || NumGrids < 0 ||
+    Header.NumRanks < 1 || NumStates < 0 || NumOverlaps < 0 || NumConnectivities < 0) {
+    return false;
+  }
+
+  Header.Grids.Clear();
+  for (int iGrid = 0; iGrid < NumGrids && Valid; ++iGrid) {
+    int GridID = Next();
+    checkpoint_grid &Grid = Header.Grids.Insert(GridID);
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Grid.GlobalRange.Begin(iDim) = Next();
+    }
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Grid.GlobalRange.End(iDim) = Next();
+    }
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      Grid.Periodic(iDim) = Next() != 0;
+    }
+    Grid.PeriodicStorage = periodic_storage(Next());
+    int NameLength = Next();
+    if (NameLength < 0) return false;
+    Grid.Name.clear();
+    for (int iCharacter = 0; iCharacter < NameLength; ++iCharacter) {
+      Grid.Name.push_back(char(Next()));
+    }
+    Grid.LocalRanges.Resize({Header.NumRanks});
+    for (auto &LocalRange : Grid.LocalRanges) {
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        LocalRange.Begin(iDim) = Next();
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        LocalRange.End(iDim) = Next();
+      }
+    }
+  }
+
+  Header.StateGridIDs.Clear();
+  for (int iState = 0; iState < NumStates; ++iState) {
+    Header.StateGridIDs.Append(Next());
+  }
+
+  Header.OverlapIDs.Clear();
+  for (int iOverlap = 0; iOverlap < NumOverlaps; ++iOverlap) {
+    int MGridID = Next();
+    int NGridID = Next();
+    Header.OverlapIDs.Append(elem<int,2>(MGridID, NGridID));
+  }
+
+  Header.ConnectivityIDs.Clear();
+  Header.ConnectivityMaxStencilSizes.Clear();
+  for (int iConnectivity = 0; iConnectivity < NumConnectivities; ++iConnectivity) {
+    int MGridID = Next();
+    int NGridID = Next();
+    int MaxStencilSize = Next();
+    elem<int,2> ConnectivityID = {MGridID, NGridID};
+    Header.ConnectivityIDs.Append(ConnectivityID);
+    Header.ConnectivityMaxStencilSizes.Insert(ConnectivityID, MaxStencilSize);
+  }
+
+  return Valid && iInt == HeaderInts.Count() && Header.Grids.Count() == NumGrids;
+
+}
+
+bool HeaderMatchesDomain(const checkpoint_header &Header, const domain &Domain, const std::string
+  &Path) {
+
+  const comm &Comm = Domain.Comm();
+  core::logger &Logger = Domain.Context().core_Logger();
+
+  if (Header.NumDims != Domain.Dimension()) {
+    Logger.LogError(Comm.Rank() == 0, "Checkpoint file '%s' has dimension %i; expected %i.", Path,
+      Header.NumDims, Domain.Dimension());
+    return false;
+  }
+
+  if (Header.Grids.Count() != Domain.GridCount()) {
+    Logger.LogError(Comm.Rank() == 0, "Checkpoint file '%s' has %i grids; expected %i.", Path,
+      Header.Grids.Count(), Domain.GridCount());
+    return false;
+  }
+
+  for (int GridID : Domain.GridIDs()) {
+    const grid_info &GridInfo = Domain.GridInfo(GridID);
+    const cart &Cart = GridInfo.Cart();
+    if (!Header.Grids.Contains(GridID)) {
+      Logger.LogError(Comm.Rank() == 0, "Checkpoint file '%s' does not contain grid %s.", Path,
+        GridInfo.Name());
+      return false;
+    }
+    const checkpoint_grid &Grid = Header.Grids(GridID);
+    if (Grid.Name != GridInfo.Name() || Grid.GlobalRange != Cart.Range() || Grid.Periodic !=
+      Cart.Periodic() || Grid.PeriodicStorage != Cart.PeriodicStorage()) {
+      Logger.LogError(Comm.Rank() == 0, "Grid %s does not match grid %s in checkpoint file '%s'.",
+        GridInfo.Name(), Grid.Name, Path);
+      return false;
+    }
+  }
+
+  for (auto &ConnectivityID : Header.ConnectivityIDs) {
+    int MaxStencilSize = Header.ConnectivityMaxStencilSizes(ConnectivityID);
+    if (MaxStencilSize < 1) {
+      Logger.LogError(Comm.Rank() == 0, "Checkpoint file '%s' has a corrupted header.", Path);
+      return false;
+    }
+  }
+
+  return true;
+
+}
+
+int SectionMaxStencilSize(const checkpoint_header &Header, int MGridID) {
+
+  int MaxStencilSize = 1;
+
+  for (auto &ConnectivityID : Header.ConnectivityIDs) {
+    if (ConnectivityID(0) == MGridID) {
+      MaxStencilSize = Max(MaxStencilSize, Header.ConnectivityMaxStencilSizes(ConnectivityID));
+    }
+  }
+
+  return MaxStencilSize;
+
+}
+
+record_data CollectFlags(const domain &Domain, int StateComponentID, int GridID) {
+
+  record_data Records(1, 0);
+
+  if (!Domain.GridIsLocal(GridID)) return Records;
+
+  const auto &StateComponent = Domain.Component<state_component>(StateComponentID);
+  const distributed_field<state_flags> &Flags = StateComponent.State(GridID).Flags();
+  const range &LocalRange = Domain.Grid(GridID).LocalRange();
+
+  Records.Count = LocalRange.Count();
+  Records.Ints.Reserve(Records.Count);
+
+  for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
+    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        tuple<int> Point = {i,j,k};
+        Records.Ints.Append(int(Flags(Point)));
+      }
+    }
+  }
+
+  return Records;
+
+}
+
+record_data CollectOverlapM(const domain &Domain, int OverlapComponentID, int GridID) {
+
+  record_data Records(OVERLAP_M_NUM_INTS, OVERLAP_M_NUM_DOUBLES);
+
+  const auto &OverlapComponent = Domain.Component<overlap_component>(OverlapComponentID);
+
+  for (auto &OverlapID : OverlapComponent.LocalOverlapMIDs()) {
+    if (OverlapID(0) != GridID) continue;
+    const overlap_m &OverlapM = OverlapComponent.OverlapM(OverlapID);
+    const array<int,2> &Cells = OverlapM.Cells();
+    const array<double,2> &Coords = OverlapM.Coords();
+    const array<int,2> &Destinations = OverlapM.Destinations();
+    const array<int> &DestinationRanks = OverlapM.DestinationRanks();
+    for (long long iCell = 0; iCell < OverlapM.Size(); ++iCell) {
+      Records.Ints.Append(OverlapID(1));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Cells(iDim,iCell));
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Destinations(iDim,iCell));
+      }
+      Records.Ints.Append(DestinationRanks(iCell));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Doubles.Append(Coords(iDim,iCell));
+      }
+      ++Records.Count;
+    }
+  }
+
+  return Records;
+
+}
+
+record_data CollectOverlapN(const domain &Domain, int OverlapComponentID, int GridID) {
+
+  record_data Records(OVERLAP_N_NUM_INTS, 0);
+
+  const auto &OverlapComponent = Domain.Component<overlap_component>(OverlapComponentID);
+
+  for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
+    if (OverlapID(1) != GridID) continue;
+    const overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
+    const array<int,2> &Points = OverlapN.Points();
+    const array<int,2> &Sources = OverlapN.Sources();
+    const array<int> &SourceRanks = OverlapN.SourceRanks();
+    for (long long iPoint = 0; iPoint < OverlapN.Size(); ++iPoint) {
+      Records.Ints.Append(OverlapID(0));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Points(iDim,iPoint));
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Sources(iDim,iPoint));
+      }
+      Records.Ints.Append(SourceRanks(iPoint));
+      ++Records.Count;
+    }
+  }
+
+  return Records;
+
+}
+
+record_data CollectConnectivityM(const domain &Domain, int ConnectivityComponentID, int GridID,
+  int MaxStencilSize) {
+
+  record_data Records(CONNECTIVITY_M_NUM_INTS, MAX_DIMS*(1+MaxStencilSize));
+
+  const auto &ConnectivityComponent = Domain.Component<connectivity_component>(
+    ConnectivityComponentID);
+
+  for (auto &ConnectivityID : ConnectivityComponent.LocalConnectivityMIDs()) {
+    if (ConnectivityID(0) != GridID) continue;
+    const connectivity_m &ConnectivityM = ConnectivityComponent.ConnectivityM(ConnectivityID);
+    const array<double,2> &Coords = ConnectivityM.Coords();
+    const array<int> &DestinationRanks = ConnectivityM.DestinationRanks();
+    int StencilSize = ConnectivityM.MaxStencilSize();
+    // Per-donor accessors so that compact connectivity is written out in the same format
+    for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
+      range DonorExtents = ConnectivityM.DonorExtents(iDonor);
+      tuple<int> Destination = ConnectivityM.Destination(iDonor);
+      Records.Ints.Append(ConnectivityID(1));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(DonorExtents.Begin(iDim));
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(DonorExtents.End(iDim));
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Destination(iDim));
+      }
+      Records.Ints.Append(DestinationRanks(iDonor));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Doubles.Append(Coords(iDim,iDonor));
+      }
+      for (int iPoint = 0; iPoint < MaxStencilSize; ++iPoint) {
+        for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+          Records.Doubles.Append(iPoint < StencilSize ? ConnectivityM.DonorInterpCoef(iDim,iPoint,
+            iDonor) : 0.);
+        }
+      }
+      ++Records.Count;
+    }
+  }
+
+  return Records;
+
+}
+
+record_data CollectConnectivityN(const domain &Domain, int ConnectivityComponentID, int GridID) {
+
+  record_data Records(CONNECTIVITY_N_NUM_INTS, 0);
+
+  const auto &ConnectivityComponent = Domain.Component<connectivity_component>(
+    ConnectivityComponentID);
+
+  for (auto &ConnectivityID : ConnectivityComponent.LocalConnectivityNIDs()) {
+    if (ConnectivityID(1) != GridID) continue;
+    const connectivity_n &ConnectivityN = ConnectivityComponent.ConnectivityN(ConnectivityID);
+    const array<int> &SourceRanks = ConnectivityN.SourceRanks();
+    for (long long iReceiver = 0; iReceiver < ConnectivityN.Size(); ++iReceiver) {
+      tuple<int> Point = ConnectivityN.Point(iReceiver);
+      tuple<int> Source = ConnectivityN.Source(iReceiver);
+      Records.Ints.Append(ConnectivityID(0));
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Point(iDim));
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Records.Ints.Append(Source(iDim));
+      }
+      Records.Ints.Append(SourceRanks(iReceiver));
+      ++Records.Count;
+    }
+  }
+
+  return Records;
+
+}
+
+// MPI I/O counts are ints, so large transfers are split up; every rank must make the same number
+// of collective calls
+template <typename T> bool WriteAtAll(MPI_File File, MPI_Offset Offset, const T *Data, long long
+  Count, comm_view Comm) {
+
+  constexpr long long MAX_CHUNK_SIZE = std::numeric_limits<int>::max()/sizeof(T);
+
+  long long NumChunks = (Count + MAX_CHUNK_SIZE - 1)/MAX_CHUNK_SIZE;
+  MPI_Allreduce(MPI_IN_PLACE, &NumChunks, 1, MPI_LONG_LONG, MPI_MAX, Comm);
+
+  bool Success = true;
+
+  for (long long iChunk = 0; iChunk < NumChunks; ++iChunk) {
+    long long ChunkBegin = Min(iChunk*MAX_CHUNK_SIZE, Count);
+    long long ChunkEnd = Min((iChunk+1)*MAX_CHUNK_SIZE, Count);
+    MPI_Status Status;
+    int MPIError = MPI_File_write_at_all(File, Offset + MPI_Offset(ChunkBegin)*sizeof(T),
+      const_cast<T *>(Data) + ChunkBegin, int(ChunkEnd-ChunkBegin), core::GetMPIDataType<T>(),
+      &Status);
+    Success = Success && MPIError == MPI_SUCCESS;
+  }
+
+  return Success;
+
+}
+
+template <typename T> bool ReadAtAll(MPI_File File, MPI_Offset Offset, T *Data, long long Count,
+  comm_view Comm) {
+
+  constexpr long long MAX_CHUNK_SIZE = std::numeric_limits<int>::max()/sizeof(T);
+
+  long long NumChunks = (Count + MAX_CHUNK_SIZE - 1)/MAX_CHUNK_SIZE;
+  MPI_Allreduce(MPI_IN_PLACE, &NumChunks, 1, MPI_LONG_LONG, MPI_MAX, Comm);
+
+  bool Success = true;
+
+  for (long long iChunk = 0; iChunk < NumChunks; ++iChunk) {
+    long long ChunkBegin = Min(iChunk*MAX_CHUNK_SIZE, Count);
+    long long ChunkEnd = Min((iChunk+1)*MAX_CHUNK_SIZE, Count);
+    MPI_Status Status;
+    int MPIError = MPI_File_read_at_all(File, Offset + MPI_Offset(ChunkBegin)*sizeof(T), Data +
+      ChunkBegin, int(ChunkEnd-ChunkBegin), core::GetMPIDataType<T>(), &Status);
+    Success = Success && MPIError == MPI_SUCCESS;
+  }
+
+  return Success;
+
+}
+
+bool WriteSection(MPI_File File, MPI_Offset &Offset, const record_data &Records, comm_view Comm) {
+
+  int NumRanks = Comm.Size();
+
+  array<long long> Counts({NumRanks});
+  MPI_Allgather(&Records.Count, 1, MPI_LONG_LONG, Counts.Data(), 1, MPI_LONG_LONG, Comm);
+
+  long long Start = 0;
+  long long Total = 0;
+  for (int Rank = 0; Rank < NumRanks; ++Rank) {
+    if (Rank == Comm.Rank()) Start = Total;
+    Total += Counts(Rank);
+  }
+
+  bool Success = true;
+
+  if (Comm.Rank() == 0) {
+    int RecordSize[2] = {Records.NumInts, Records.NumDoubles};
+    MPI_Status Status;
+    Success = Success && MPI_File_write_at(File, Offset, RecordSize, 2, MPI_INT, &Status) ==
+      MPI_SUCCESS;
+    Success = Success && MPI_File_write_at(File, Offset + 2*sizeof(int), Counts.Data(), NumRanks,
+      MPI_LONG_LONG, &Status) == MPI_SUCCESS;
+  }
+
+  MPI_Offset IntsOffset = Offset + 2*sizeof(int) + MPI_Offset(NumRanks)*sizeof(long long);
+  MPI_Offset DoublesOffset = IntsOffset + MPI_Offset(Total)*Records.NumInts*sizeof(int);
+
+  Success = WriteAtAll(File, IntsOffset + MPI_Offset(Start)*Records.NumInts*sizeof(int),
+    Records.Ints.Data(), Records.Count*Records.NumInts, Comm) && Success;
+  Success = WriteAtAll(File, DoublesOffset + MPI_Offset(Start)*Records.NumDoubles*sizeof(double),
+    Records.Doubles.Data(), Records.Count*Records.NumDoubles, Comm) && Success;
+
+  Offset = DoublesOffset + MPI_Offset(Total)*Records.NumDoubles*sizeof(double);
+
+  return Success;
+
+}
+
+bool ReadSectionInfo(MPI_File File, MPI_Offset &Offset, int NumRanks, section_info &Info,
+  comm_view Comm) {
+
+  int RecordSize[2];
+  bool Success = ReadAtAll(File, Offset, RecordSize, 2, Comm);
+
+  array<long long> Counts({NumRanks}, 0);
+  Success = ReadAtAll(File, Offset + 2*sizeof(int), Counts.Data(), NumRanks, Comm) && Success;
+
+  // Make sure corrupted data can't result in huge allocations
+  Success = Success && AllSucceeded(true, Comm);
+  if (!Success || RecordSize[0] < 0 || RecordSize[1] < 0) {
+    RecordSize[0] = 0;
+    RecordSize[1] = 0;
+    Counts.Fill(0);
+    Success = false;
+  }
+
+  Info.NumInts = RecordSize[0];
+  Info.NumDoubles = RecordSize[1];
+
+  Info.Starts.Resize({NumRanks+1});
+  Info.Starts(0) = 0;
+  for (int Rank = 0; Rank < NumRanks; ++Rank) {
+    Info.Starts(Rank+1) = Info.Starts(Rank) + Counts(Rank);
+  }
+
+  long long Total = Info.Starts(NumRanks);
+
+  Info.IntsOffset = Offset + 2*sizeof(int) + MPI_Offset(NumRanks)*sizeof(long long);
+  Info.DoublesOffset = Info.IntsOffset + MPI_Offset(Total)*Info.NumInts*sizeof(int);
+
+  Offset = Info.DoublesOffset + MPI_Offset(Total)*Info.NumDoubles*sizeof(double);
+
+  return Success;
+
+}
+
+bool ReadRecords(MPI_File File, const section_info &Info, long long Begin, long long End,
+  record_data &Records, comm_view Comm) {
+
+  Records.NumInts = Info.NumInts;
+  Records.NumDoubles = Info.NumDoubles;
+  Records.Count = End - Begin;
+  Records.Ints.Resize({Records.Count*Records.NumInts});
+  Records.Doubles.Resize({Records.Count*Records.NumDoubles});
+
+  bool Success = ReadAtAll(File, Info.IntsOffset + MPI_Offset(Begin)*Info.NumInts*sizeof(int),
+    Records.Ints.Data(), Records.Count*Records.NumInts, Comm);
+  Success = ReadAtAll(File, Info.DoublesOffset + MPI_Offset(Begin)*Info.NumDoubles*sizeof(double),
+    Records.Doubles.Data(), Records.Count*Records.NumDoubles, Comm) && Success;
+
+  return Success;
+
+}
+
+// Assembles the flags for LocalRange from the blocks written by each rank in the checkpoint's
+// decomposition; rows that are contiguous in the file are read together
+bool ReadFlagsInRange(MPI_File File, const section_info &Info, const array<range> &FileLocalRanges,
+  const range &LocalRange, record_data &Records) {
+
+  Records = record_data(1, 0);
+  Records.Count = LocalRange.Count();
+  Records.Ints.Resize({Records.Count}, 0);
+
+  if (Info.NumInts != 1) return false;
+
+  field_indexer LocalIndexer(LocalRange);
+
+  bool Success = true;
+
+  for (int FileRank = 0; FileRank < FileLocalRanges.Count(); ++FileRank) {
+    const range &FileLocalRange = FileLocalRanges(FileRank);
+    range Intersection = IntersectRanges(FileLocalRange, LocalRange);
+    if (Intersection.Empty()) continue;
+    if (Info.Starts(FileRank+1) - Info.Starts(FileRank) != FileLocalRange.Count()) return false;
+    field_indexer FileIndexer(FileLocalRange);
+    MPI_Offset RankOffset = Info.IntsOffset + MPI_Offset(Info.Starts(FileRank))*sizeof(int);
+    int RowSize = Intersection.Size(0);
+    int RowsPerRead = Intersection.Size(0) == FileLocalRange.Size(0) ? Intersection.Size(1) : 1;
+    array<int> Buffer({RowsPerRead*RowSize});
+    for (int k = Intersection.Begin(2); k < Intersection.End(2); ++k) {
+      for (int j = Intersection.Begin(1); j < Intersection.End(1); j += RowsPerRead) {
+        long long iFile = FileIndexer.ToIndex(Intersection.Begin(0),j,k);
+        MPI_Status Status;
+        int MPIError = MPI_File_read_at(File, RankOffset + MPI_Offset(iFile)*sizeof(int),
+          Buffer.Data(), RowsPerRead*RowSize, MPI_INT, &Status);
+        Success = Success && MPIError == MPI_SUCCESS;
+        for (int iRow = 0; iRow < RowsPerRead; ++iRow) {
+          long long iLocal = LocalIndexer.ToIndex(Intersection.Begin(0),j+iRow,k);
+          for (int i = 0; i < RowSize; ++i) {
+            Records.Ints(iLocal+i) = Buffer(iRow*RowSize+i);
+          }
+        }
+      }
+    }
+  }
+
+  return Success;
+
+}
+
+map<int,grid_decomp> CreateGridDecomps(const domain &Domain, const map<int,array<range>>
+  &LocalRangesForGrid, const map<int,array<range>> &CellLocalRangesForGrid) {
+
+  int NumDims = Domain.Dimension();
+
+  map<int,grid_decomp> Decomps;
+
+  for (int GridID : Domain.GridIDs()) {
+    const array<range> &LocalRanges = LocalRangesForGrid(GridID);
+    const array<range> &CellLocalRanges = CellLocalRangesForGrid(GridID);
+    grid_decomp &Decomp = Decomps.Insert(GridID, NumDims);
+    for (int Rank = 0; Rank < LocalRanges.Count(); ++Rank) {
+      if (!LocalRanges(Rank).Empty()) {
+        Decomp.Ranks.Append(Rank);
+        Decomp.LocalRanges.Append(LocalRanges(Rank));
+        Decomp.CellLocalRanges.Append(CellLocalRanges(Rank));
+      }
+    }
+    int NumMembers = Decomp.Ranks.Count();
+    int NumBinsPerDim = Max(int(std::round(std::pow(double(NumMembers), 1./double(NumDims)))), 1);
+    tuple<int> NumBins = MakeUniformTuple<int>(NumDims, NumBinsPerDim, 1);
+    Decomp.LocalRangeHash = core::region_hash<range>(NumDims, NumBins, Decomp.LocalRanges);
+    Decomp.CellLocalRangeHash = core::region_hash<range>(NumDims, NumBins,
+      Decomp.CellLocalRanges);
+  }
+
+  return Decomps;
+
+}
+
+// Returns the index of the range containing Point, or -1 if there is none
+int FindOwner(const core::region_hash<range> &Hash, const array<range> &Ranges, const tuple<int>
+  &Point) {
+
+  long long iBin = Hash.MapToBin(Point);
+  if (iBin < 0) return -1;
+
+  for (long long iRange : Hash.RetrieveBin(iBin)) {
+    if (Ranges(iRange).Contains(Point)) return int(iRange);
+  }
+
+  return -1;
+
+}
+
+record_data RouteRecords(comm_view Comm, map<int,record_data> &SendRecordsForRank, int NumInts, int
+  NumDoubles) {
+
+  // Receivers don't know in advance which ranks will send to them; send data is consumed
+  map<int,array<int>> SendInts;
+  map<int,array<double>> SendDoubles;
+  for (auto &Entry : SendRecordsForRank) {
+    record_data &SendRecords = Entry.Value();
+    SendInts.Insert(Entry.Key(), std::move(SendRecords.Ints));
+    SendDoubles.Insert(Entry.Key(), std::move(SendRecords.Doubles));
+  }
+
+  map<int,array<int>> RecvInts = core::SparseExchange(Comm, SendInts);
+  map<int,array<double>> RecvDoubles = core::SparseExchange(Comm, SendDoubles);
+
+  SendRecordsForRank.Clear();
+
+  record_data Records(NumInts, NumDoubles);
+
+  long long NumIntValues = 0;
+  for (auto &Entry : RecvInts) {
+    NumIntValues += Entry.Value().Count();
+  }
+  long long NumDoubleValues = 0;
+  for (auto &Entry : RecvDoubles) {
+    NumDoubleValues += Entry.Value().Count();
+  }
+
+  Records.Count = NumInts > 0 ? NumIntValues/NumInts : NumDoubles > 0 ? NumDoubleValues/NumDoubles :
+    0;
+
+  Records.Ints.Reserve(NumIntValues);
+  for (auto &Entry : RecvInts) {
+    for (int Value : Entry.Value()) {
+      Records.Ints.Append(Value);
+    }
+  }
+
+  Records.Doubles.Reserve(NumDoubleValues);
+  for (auto &Entry : RecvDoubles) {
+    for (double Value : Entry.Value()) {
+      Records.Doubles.Append(Value);
+    }
+  }
+
+  return Records;
+
+}
+
+// Appends a copy of a record to the records being sent to Rank, optionally replacing its ints
+void AppendRecord(map<int,record_data> &RecordsForRank, int Rank, const record_data &Source,
+  long long iSourceRecord, array_view<const int> Ints) {
+
+  record_data &Records = RecordsForRank.Fetch(Rank, Source.NumInts, Source.NumDoubles);
+
+  for (int iInt = 0; iInt < Source.NumInts; ++iInt) {
+    Records.Ints.Append(Ints.Count() > 0 ? Ints(iInt) : Source.Ints(iSourceRecord*Source.NumInts+
+      iInt));
+  }
+  for (int iDouble = 0; iDouble < Source.NumDoubles; ++iDouble) {
+    Records.Doubles.Append(Source.Doubles(iSourceRecord*Source.NumDoubles+iDouble));
+  }
+  ++Records.Count;
+
+}
+
+// Recreates the overlap M data the assembler would have produced for the current decomposition:
+// each overlapping cell is stored on every rank whose cell cover range contains it, mapped into
+// that rank's cell local range if possible
+map<int,record_data> RouteOverlapM(const domain &Domain, const map<int,grid_decomp> &Decomps, int
+  GridID, const record_data &Records) {
+
+  int NumDims = Domain.Dimension();
+
+  const grid_info &GridInfo = Domain.GridInfo(GridID);
+  const cart &Cart = GridInfo.Cart();
+  const cart &CellCart = GridInfo.CellCart();
+  const grid_decomp &Decomp = Decomps(GridID);
+
+  range NeighborRange = MakeEmptyRange(NumDims);
+  for (int iDim = 0; iDim < NumDims; ++iDim) {
+    NeighborRange.End(iDim) = 2;
+  }
+
+  map<int,record_data> Sends;
+  array<int> Ints({Records.NumInts});
+
+  for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+    const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+    int DestinationRank = RecordInts[1+2*MAX_DIMS];
+    // Only entries for cells owned by the writing rank are unique
+    if (DestinationRank < 0) continue;
+    int NGridID = RecordInts[0];
+    tuple<int> Cell = {RecordInts[1], RecordInts[2], RecordInts[3]};
+    tuple<int> Destination = {RecordInts[4], RecordInts[5], RecordInts[6]};
+    const grid_decomp &NDecomp = Decomps(NGridID);
+    int iDestinationOwner = FindOwner(NDecomp.LocalRangeHash, NDecomp.LocalRanges, Destination);
+    set<int> CandidateMembers;
+    for (int k = NeighborRange.Begin(2); k < NeighborRange.End(2); ++k) {
+      for (int j = NeighborRange.Begin(1); j < NeighborRange.End(1); ++j) {
+        for (int i = NeighborRange.Begin(0); i < NeighborRange.End(0); ++i) {
+          tuple<int> NeighborCell = CellCart.PeriodicAdjust({Cell(0)+i, Cell(1)+j, Cell(2)+k});
+          if (!CellCart.Range().Contains(NeighborCell)) continue;
+          int iMember = FindOwner(Decomp.CellLocalRangeHash, Decomp.CellLocalRanges,
+            NeighborCell);
+          if (iMember >= 0) CandidateMembers.Insert(iMember);
+        }
+      }
+    }
+    for (int iMember : CandidateMembers) {
+      const range &CellLocalRange = Decomp.CellLocalRanges(iMember);
+      range CellCoverRange = CellLocalRange;
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        if (CellLocalRange.Begin(iDim) > CellCart.Range().Begin(iDim) || (Cart.Periodic(iDim) &&
+          CellLocalRange.End(iDim) != CellCart.Range().End(iDim))) {
+          CellCoverRange.Begin(iDim) = CellLocalRange.Begin(iDim)-1;
+        }
+      }
+      auto MaybeCoverCell = Cart.MapToRange(CellCoverRange, Cell);
+      if (!MaybeCoverCell) continue;
+      auto MaybeOwnCell = Cart.MapToRange(CellLocalRange, Cell);
+      tuple<int> MappedCell = MaybeOwnCell ? *MaybeOwnCell : *MaybeCoverCell;
+      for (int iInt = 0; iInt < Records.NumInts; ++iInt) {
+        Ints(iInt) = RecordInts[iInt];
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Ints(1+iDim) = MappedCell(iDim);
+      }
+      Ints(1+2*MAX_DIMS) = MaybeOwnCell && iDestinationOwner >= 0 ?
+        NDecomp.Ranks(iDestinationOwner) : -1;
+      AppendRecord(Sends, Decomp.Ranks(iMember), Records, iRecord, Ints);
+    }
+  }
+
+  return Sends;
+
+}
+
+map<int,record_data> RouteOverlapN(const map<int,grid_decomp> &Decomps, int GridID, const
+  record_data &Records) {
+
+  const grid_decomp &Decomp = Decomps(GridID);
+
+  map<int,record_data> Sends;
+  array<int> Ints({Records.NumInts});
+
+  for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+    const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+    int MGridID = RecordInts[0];
+    tuple<int> Point = {RecordInts[1], RecordInts[2], RecordInts[3]};
+    tuple<int> Source = {RecordInts[4], RecordInts[5], RecordInts[6]};
+    int iMember = FindOwner(Decomp.LocalRangeHash, Decomp.LocalRanges, Point);
+    if (iMember < 0) continue;
+    const grid_decomp &MDecomp = Decomps(MGridID);
+    int iSourceOwner = FindOwner(MDecomp.CellLocalRangeHash, MDecomp.CellLocalRanges, Source);
+    for (int iInt = 0; iInt < Records.NumInts; ++iInt) {
+      Ints(iInt) = RecordInts[iInt];
+    }
+    Ints(1+2*MAX_DIMS) = iSourceOwner >= 0 ? MDecomp.Ranks(iSourceOwner) : -1;
+    AppendRecord(Sends, Decomp.Ranks(iMember), Records, iRecord, Ints);
+  }
+
+  return Sends;
+
+}
+
+// Donors are stored on every rank whose local range overlaps the donor extents, mapped into that
+// rank's local range. Copies held by other ranks in the checkpoint are skipped (only the rank
+// containing the lower corner of the extents is used as a source). Destination ranks are left to
+// be detected by the exchanger, as in assembly
+map<int,record_data> RouteConnectivityM(const domain &Domain, const map<int,grid_decomp> &Decomps,
+  const checkpoint_header &Header, int GridID, const section_info &Info, long long Begin, const
+  record_data &Records) {
+
+  const grid_info &GridInfo = Domain.GridInfo(GridID);
+  const cart &Cart = GridInfo.Cart();
+  const grid_decomp &Decomp = Decomps(GridID);
+  const array<range> &FileLocalRanges = Header.Grids(GridID).LocalRanges;
+
+  map<int,record_data> Sends;
+  array<int> Ints({Records.NumInts});
+
+  int FileRank = 0;
+
+  for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+    while (Info.Starts(FileRank+1) <= Begin+iRecord) ++FileRank;
+    const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+    range DonorRange;
+    for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+      DonorRange.Begin(iDim) = RecordInts[1+iDim];
+      DonorRange.End(iDim) = RecordInts[1+MAX_DIMS+iDim];
+    }
+    if (!FileLocalRanges(FileRank).Contains(DonorRange.Begin())) continue;
+    set<int> CandidateMembers;
+    for (int k = DonorRange.Begin(2); k < DonorRange.End(2); ++k) {
+      for (int j = DonorRange.Begin(1); j < DonorRange.End(1); ++j) {
+        for (int i = DonorRange.Begin(0); i < DonorRange.End(0); ++i) {
+          tuple<int> Point = Cart.PeriodicAdjust({i,j,k});
+          if (!Cart.Range().Contains(Point)) continue;
+          int iMember = FindOwner(Decomp.LocalRangeHash, Decomp.LocalRanges, Point);
+          if (iMember >= 0) CandidateMembers.Insert(iMember);
+        }
+      }
+    }
+    for (int iMember : CandidateMembers) {
+      auto MaybeMappedDonorRange = Cart.MapToRange(Decomp.LocalRanges(iMember), DonorRange);
+      if (!MaybeMappedDonorRange) continue;
+      const range &MappedDonorRange = *MaybeMappedDonorRange;
+      for (int iInt = 0; iInt < Records.NumInts; ++iInt) {
+        Ints(iInt) = RecordInts[iInt];
+      }
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Ints(1+iDim) = MappedDonorRange.Begin(iDim);
+        Ints(1+MAX_DIMS+iDim) = MappedDonorRange.End(iDim);
+      }
+      Ints(1+3*MAX_DIMS) = -1;
+      AppendRecord(Sends, Decomp.Ranks(iMember), Records, iRecord, Ints);
+    }
+  }
+
+  return Sends;
+
+}
+
+map<int,record_data> RouteConnectivityN(const map<int,grid_decomp> &Decomps, int GridID,
+  const record_data &Records) {
+
+  const grid_decomp &Decomp = Decomps(GridID);
+
+  map<int,record_data> Sends;
+  array<int> Ints({Records.NumInts});
+
+  for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+    const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+    tuple<int> Point = {RecordInts[1], RecordInts[2], RecordInts[3]};
+    int iMember = FindOwner(Decomp.LocalRangeHash, Decomp.LocalRanges, Point);
+    if (iMember < 0) continue;
+    for (int iInt = 0; iInt < Records.NumInts; ++iInt) {
+      Ints(iInt) = RecordInts[iInt];
+    }
+    Ints(1+2*MAX_DIMS) = -1;
+    AppendRecord(Sends, Decomp.Ranks(iMember), Records, iRecord, Ints);
+  }
+
+  return Sends;
+
+}
+
+// Puts routed records into the order produced by assembly: grouped by the other grid in the
+// pair, then by the global index of the destination (M side) or receiver point (N side)
+void SortRecords(const domain &Domain, int GridID, bool IndexOnOtherGrid, record_data &Records) {
+
+  long long Count = Records.Count;
+  int NumInts = Records.NumInts;
+  int NumDoubles = Records.NumDoubles;
+
+  // M side records store the destination point after the extents/cell
+  int iPointInt = IndexOnOtherGrid ? (NumInts == CONNECTIVITY_M_NUM_INTS ? 1+2*MAX_DIMS :
+    1+MAX_DIMS) : 1;
+
+  map<int,field_indexer> Indexers;
+
+  array<int> OtherGridIDs({Count});
+  array<long long> PointIndices({Count});
+  for (long long iRecord = 0; iRecord < Count; ++iRecord) {
+    const int *RecordInts = Records.Ints.Data() + iRecord*NumInts;
+    int OtherGridID = RecordInts[0];
+    int IndexGridID = IndexOnOtherGrid ? OtherGridID : GridID;
+    if (!Indexers.Contains(IndexGridID)) {
+      Indexers.Insert(IndexGridID, Domain.GridInfo(IndexGridID).GlobalRange());
+    }
+    tuple<int> Point = {RecordInts[iPointInt], RecordInts[iPointInt+1], RecordInts[iPointInt+2]};
+    OtherGridIDs(iRecord) = OtherGridID;
+    PointIndices(iRecord) = Indexers(IndexGridID).ToIndex(Point);
+  }
+
+  array<long long> Order({Count});
+  for (long long iRecord = 0; iRecord < Count; ++iRecord) {
+    Order(iRecord) = iRecord;
+  }
+  std::sort(Order.Data(), Order.Data()+Count, [&](long long iLeft, long long iRight) -> bool {
+    return OtherGridIDs(iLeft) < OtherGridIDs(iRight) || (OtherGridIDs(iLeft) ==
+      OtherGridIDs(iRight) && PointIndices(iLeft) < PointIndices(iRight));
+  });
+
+  record_data SortedRecords(NumInts, NumDoubles);
+  SortedRecords.Count = Count;
+  SortedRecords.Ints.Resize({Count*NumInts});
+  SortedRecords.Doubles.Resize({Count*NumDoubles});
+  for (long long iRecord = 0; iRecord < Count; ++iRecord) {
+    long long iOrder = Order(iRecord);
+    for (int iInt = 0; iInt < NumInts; ++iInt) {
+      SortedRecords.Ints(iRecord*NumInts+iInt) = Records.Ints(iOrder*NumInts+iInt);
+    }
+    for (int iDouble = 0; iDouble < NumDoubles; ++iDouble) {
+      SortedRecords.Doubles(iRecord*NumDoubles+iDouble) = Records.Doubles(iOrder*NumDoubles+
+        iDouble);
+    }
+  }
+
+  Records = std::move(SortedRecords);
+
+}
+
+void SetStates(domain &Domain, int StateComponentID, const checkpoint_header &Header,
+  map<int,record_data> &FlagsForLocalGrid) {
+
+  auto StateComponentEditHandle = Domain.EditComponent<state_component>(StateComponentID);
+  state_component &StateComponent = *StateComponentEditHandle;
+
+  array<int> MissingStateGridIDs;
+  for (int GridID : Header.StateGridIDs) {
+    if (!StateComponent.StateExists(GridID)) {
+      MissingStateGridIDs.Append(GridID);
+    }
+  }
+  StateComponent.CreateStates(MissingStateGridIDs);
+
+  for (int GridID : Domain.LocalGridIDs()) {
+    if (!FlagsForLocalGrid.Contains(GridID)) continue;
+    const record_data &Records = FlagsForLocalGrid(GridID);
+    const range &LocalRange = Domain.Grid(GridID).LocalRange();
+    auto StateEditHandle = StateComponent.EditState(GridID);
+    auto FlagsEditHandle = StateEditHandle->EditFlags();
+    distributed_field<state_flags> &Flags = *FlagsEditHandle;
+    long long iRecord = 0;
+    for (int k = LocalRange.Begin(2); k < LocalRange.End(2); ++k) {
+      for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+        for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+          tuple<int> Point = {i,j,k};
+          Flags(Point) = state_flags(Records.Ints(iRecord));
+          ++iRecord;
+        }
+      }
+    }
+    Flags.Exchange();
+  }
+
+}
+
+void SetOverlaps(domain &Domain, int OverlapComponentID, const checkpoint_header &Header,
+  map<int,record_data> &OverlapMForLocalGrid, map<int,record_data> &OverlapNForLocalGrid) {
+
+  auto OverlapComponentEditHandle = Domain.EditComponent<overlap_component>(OverlapComponentID);
+  overlap_component &OverlapComponent = *OverlapComponentEditHandle;
+
+  OverlapComponent.ClearOverlaps();
+  OverlapComponent.CreateOverlaps(Header.OverlapIDs);
+
+  for (auto &OverlapID : OverlapComponent.LocalOverlapMIDs()) {
+    const record_data &Records = OverlapMForLocalGrid(OverlapID(0));
+    long long NumCells = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      if (Records.Ints(iRecord*Records.NumInts) == OverlapID(1)) ++NumCells;
+    }
+    auto OverlapMEditHandle = OverlapComponent.EditOverlapM(OverlapID);
+    overlap_m &OverlapM = *OverlapMEditHandle;
+    OverlapM.Resize(NumCells);
+    auto CellsEditHandle = OverlapM.EditCells();
+    auto CoordsEditHandle = OverlapM.EditCoords();
+    auto DestinationsEditHandle = OverlapM.EditDestinations();
+    auto DestinationRanksEditHandle = OverlapM.EditDestinationRanks();
+    array<int,2> &Cells = *CellsEditHandle;
+    array<double,2> &Coords = *CoordsEditHandle;
+    array<int,2> &Destinations = *DestinationsEditHandle;
+    array<int> &DestinationRanks = *DestinationRanksEditHandle;
+    long long iCell = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+      const double *RecordDoubles = Records.Doubles.Data() + iRecord*Records.NumDoubles;
+      if (RecordInts[0] != OverlapID(1)) continue;
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Cells(iDim,iCell) = RecordInts[1+iDim];
+        Destinations(iDim,iCell) = RecordInts[1+MAX_DIMS+iDim];
+        Coords(iDim,iCell) = RecordDoubles[iDim];
+      }
+      DestinationRanks(iCell) = RecordInts[1+2*MAX_DIMS];
+      ++iCell;
+    }
+  }
+
+  for (auto &OverlapID : OverlapComponent.LocalOverlapNIDs()) {
+    const record_data &Records = OverlapNForLocalGrid(OverlapID(1));
+    long long NumPoints = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      if (Records.Ints(iRecord*Records.NumInts) == OverlapID(0)) ++NumPoints;
+    }
+    auto OverlapNEditHandle = OverlapComponent.EditOverlapN(OverlapID);
+    overlap_n &OverlapN = *OverlapNEditHandle;
+    OverlapN.Resize(NumPoints);
+    auto PointsEditHandle = OverlapN.EditPoints();
+    auto SourcesEditHandle = OverlapN.EditSources();
+    auto SourceRanksEditHandle = OverlapN.EditSourceRanks();
+    array<int,2> &Points = *PointsEditHandle;
+    array<int,2> &Sources = *SourcesEditHandle;
+    array<int> &SourceRanks = *SourceRanksEditHandle;
+    long long iPoint = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+      if (RecordInts[0] != OverlapID(0)) continue;
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Points(iDim,iPoint) = RecordInts[1+iDim];
+        Sources(iDim,iPoint) = RecordInts[1+MAX_DIMS+iDim];
+      }
+      SourceRanks(iPoint) = RecordInts[1+2*MAX_DIMS];
+      ++iPoint;
+    }
+  }
+
+}
+
+void SetConnectivities(domain &Domain, int ConnectivityComponentID, const checkpoint_header &Header,
+  map<int,record_data> &ConnectivityMForLocalGrid, map<int,record_data>
+  &ConnectivityNForLocalGrid) {
+
+  auto ConnectivityComponentEditHandle = Domain.EditComponent<connectivity_component>(
+    ConnectivityComponentID);
+  connectivity_component &ConnectivityComponent = *ConnectivityComponentEditHandle;
+
+  ConnectivityComponent.ClearConnectivities();
+  ConnectivityComponent.CreateConnectivities(Header.ConnectivityIDs);
+
+  for (auto &ConnectivityID : ConnectivityComponent.LocalConnectivityMIDs()) {
+    const record_data &Records = ConnectivityMForLocalGrid(ConnectivityID(0));
+    int MaxStencilSize = Header.ConnectivityMaxStencilSizes(ConnectivityID);
+    int SectionStencilSize = Records.NumDoubles/MAX_DIMS - 1;
+    long long NumDonors = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      if (Records.Ints(iRecord*Records.NumInts) == ConnectivityID(1)) ++NumDonors;
+    }
+    auto ConnectivityMEditHandle = ConnectivityComponent.EditConnectivityM(ConnectivityID);
+    connectivity_m &ConnectivityM = *ConnectivityMEditHandle;
+    ConnectivityM.Resize(NumDonors, MaxStencilSize);
+    auto ExtentsEditHandle = ConnectivityM.EditExtents();
+    auto CoordsEditHandle = ConnectivityM.EditCoords();
+    auto InterpCoefsEditHandle = ConnectivityM.EditInterpCoefs();
+    auto DestinationsEditHandle = ConnectivityM.EditDestinations();
+    auto DestinationRanksEditHandle = ConnectivityM.EditDestinationRanks();
+    array<int,3> &Extents = *ExtentsEditHandle;
+    array<double,2> &Coords = *CoordsEditHandle;
+    array<double,3> &InterpCoefs = *InterpCoefsEditHandle;
+    array<int,2> &Destinations = *DestinationsEditHandle;
+    array<int> &DestinationRanks = *DestinationRanksEditHandle;
+    long long iDonor = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+      const double *RecordDoubles = Records.Doubles.Data() + iRecord*Records.NumDoubles;
+      if (RecordInts[0] != ConnectivityID(1)) continue;
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Extents(0,iDim,iDonor) = RecordInts[1+iDim];
+        Extents(1,iDim,iDonor) = RecordInts[1+MAX_DIMS+iDim];
+        Destinations(iDim,iDonor) = RecordInts[1+2*MAX_DIMS+iDim];
+        Coords(iDim,iDonor) = RecordDoubles[iDim];
+      }
+      DestinationRanks(iDonor) = RecordInts[1+3*MAX_DIMS];
+      for (int iPoint = 0; iPoint < MaxStencilSize; ++iPoint) {
+        for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+          InterpCoefs(iDim,iPoint,iDonor) = iPoint < SectionStencilSize ?
+            RecordDoubles[MAX_DIMS*(1+iPoint)+iDim] : 0.;
+        }
+      }
+      ++iDonor;
+    }
+  }
+
+  for (auto &ConnectivityID : ConnectivityComponent.LocalConnectivityNIDs()) {
+    const record_data &Records = ConnectivityNForLocalGrid(ConnectivityID(1));
+    long long NumReceivers = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      if (Records.Ints(iRecord*Records.NumInts) == ConnectivityID(0)) ++NumReceivers;
+    }
+    auto ConnectivityNEditHandle = ConnectivityComponent.EditConnectivityN(ConnectivityID);
+    connectivity_n &ConnectivityN = *ConnectivityNEditHandle;
+    ConnectivityN.Resize(NumReceivers);
+    auto PointsEditHandle = ConnectivityN.EditPoints();
+    auto SourcesEditHandle = ConnectivityN.EditSources();
+    auto SourceRanksEditHandle = ConnectivityN.EditSourceRanks();
+    array<int,2> &Points = *PointsEditHandle;
+    array<int,2> &Sources = *SourcesEditHandle;
+    array<int> &SourceRanks = *SourceRanksEditHandle;
+    long long iReceiver = 0;
+    for (long long iRecord = 0; iRecord < Records.Count; ++iRecord) {
+      const int *RecordInts = Records.Ints.Data() + iRecord*Records.NumInts;
+      if (RecordInts[0] != ConnectivityID(0)) continue;
+      for (int iDim = 0; iDim < MAX_DIMS; ++iDim) {
+        Points(iDim,iReceiver) = RecordInts[1+iDim];
+        Sources(iDim,iReceiver) = RecordInts[1+MAX_DIMS+iDim];
+      }
+      SourceRanks(iReceiver) = RecordInts[1+2*MAX_DIMS];
+      ++iReceiver;
+    }
+  }
+
+}
+
+bool AllSucceeded(bool Success, comm_view Comm) {
+
+  int SuccessInt = int(Success);
+  MPI_Allreduce(MPI_IN_PLACE, &SuccessInt, 1, MPI_INT, MPI_LAND, Comm);
+
+  return SuccessInt != 0;
+
+}
+
+}
+
+}
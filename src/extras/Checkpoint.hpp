@@ -0,0 +1,34 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#ifndef OVK_EXTRAS_CHECKPOINT_HPP_INCLUDED
+#define OVK_EXTRAS_CHECKPOINT_HPP_INCLUDED
+
+#include <ovk/extras/Global.hpp>
+#include <ovk/core/Domain.hpp>
+#include <ovk/core/Error.hpp>
+
+#include <mpi.h>
+
+#include <string>
+
+namespace ovk {
+
+// Checkpoint files store the output of assembly (state flags, overlaps, and connectivities) so
+// that a restarted run can skip assembling again. Importing requires the same grids as when the
+// checkpoint was exported; if the grids have been decomposed differently since then, the data
+// is redistributed to match the current decomposition.
+
+void ExportCheckpoint(const domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo);
+void ExportCheckpoint(const domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo, captured_error &Error);
+
+void ImportCheckpoint(domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo);
+void ImportCheckpoint(domain &Domain, int StateComponentID, int OverlapComponentID, int
+  ConnectivityComponentID, const std::string &Path, MPI_Info MPIInfo, captured_error &Error);
+
+}
+
+#endif
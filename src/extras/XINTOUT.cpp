@@ -20,8 +20,8 @@
 #include "ovk/core/Decomp.hpp"
 #include "ovk/core/Editor.hpp"
 #include "ovk/core/Elem.hpp"
-#include "ovk/core/ElemSet.hpp"
 #include "ovk/core/Error.hpp"
+#include "ovk/core/HashSet.hpp"
 #include "ovk/core/Interval.hpp"
 #include "ovk/core/Logger.hpp"
 #include "ovk/core/Map.hpp"
@@ -1239,7 +1239,8 @@ void ReadDonors(xintout_grid &XINTOUTGrid, const std::string &HOPath, const std:
         NumInterpCoefsBeforeChunk[iDim] -= NumLocalInterpCoefs[iDim];
       }
 
-      array<double> InterpCoefs({NumLocalInterpCoefs[0]+NumLocalInterpCoefs[1]+
+      array<double> InterpCoefs;
+      InterpCoefs.ResizeUninitialized({NumLocalInterpCoefs[0]+NumLocalInterpCoefs[1]+
         NumLocalInterpCoefs[2]});
       double *Buffer = InterpCoefs.Data();
       DatasetOffset = XInterpCoefsOffset;
@@ -1642,24 +1643,39 @@ void MatchDonorsAndReceivers(xintout &XINTOUT) {
   Profiler.Stop(IMPORT_MATCH_MAP_TO_BINS_TIME);
   Profiler.StartSync(IMPORT_MATCH_HANDSHAKE_TIME, Comm);
 
-  array<int> DonorRecvFromRanks = core::DynamicHandshake(Comm, DonorSends.Keys());
-  array<int> ReceiverRecvFromRanks = core::DynamicHandshake(Comm, ReceiverSends.Keys());
+  // Exchanging counts also tells each rank who it will be receiving from
+  map<int,array<long long>> DonorSendCounts;
+  for (auto &Entry : DonorSends) {
+    DonorSendCounts.Insert(Entry.Key(), array<long long>({1}, Entry.Value().Count));
+  }
+
+  map<int,array<long long>> ReceiverSendCounts;
+  for (auto &Entry : ReceiverSends) {
+    ReceiverSendCounts.Insert(Entry.Key(), array<long long>({1}, Entry.Value().Count));
+  }
+
+  map<int,array<long long>> DonorRecvCounts = core::SparseExchange(Comm, DonorSendCounts);
+  map<int,array<long long>> ReceiverRecvCounts = core::SparseExchange(Comm, ReceiverSendCounts);
 
   Profiler.Stop(IMPORT_MATCH_HANDSHAKE_TIME);
   Profiler.StartSync(IMPORT_MATCH_SEND_TO_BINS_TIME, Comm);
 
   map<int,send_recv> DonorRecvs;
-  for (int Rank : DonorRecvFromRanks) {
-    DonorRecvs.Insert(Rank);
+  for (auto &Entry : DonorRecvCounts) {
+    send_recv &Recv = DonorRecvs.Insert(Entry.Key());
+    Recv.Count = Entry.Value()(0);
   }
 
   map<int,send_recv> ReceiverRecvs;
-  for (int Rank : ReceiverRecvFromRanks) {
-    ReceiverRecvs.Insert(Rank);
+  for (auto &Entry : ReceiverRecvCounts) {
+    send_recv &Recv = ReceiverRecvs.Insert(Entry.Key());
+    Recv.Count = Entry.Value()(0);
   }
 
-  DonorRecvFromRanks.Clear();
-  ReceiverRecvFromRanks.Clear();
+  DonorSendCounts.Clear();
+  ReceiverSendCounts.Clear();
+  DonorRecvCounts.Clear();
+  ReceiverRecvCounts.Clear();
 
   int NumDonorSends = DonorSends.Count();
   int NumReceiverSends = ReceiverSends.Count();
@@ -1686,34 +1702,6 @@ void MatchDonorsAndReceivers(xintout &XINTOUT) {
     MPI_Irecv(Buffer, int(Count), DataType, SourceRank, Tag, RecvComm, &Request);
   };
 
-  for (auto &Entry : DonorRecvs) {
-    int Rank = Entry.Key();
-    send_recv &Recv = Entry.Value();
-    Irecv(&Recv.Count, 1, MPI_LONG_LONG, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : ReceiverRecvs) {
-    int Rank = Entry.Key();
-    send_recv &Recv = Entry.Value();
-    Irecv(&Recv.Count, 1, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  for (auto &Entry : DonorSends) {
-    int Rank = Entry.Key();
-    send_recv &Send = Entry.Value();
-    Isend(&Send.Count, 1, MPI_LONG_LONG, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : ReceiverSends) {
-    int Rank = Entry.Key();
-    send_recv &Send = Entry.Value();
-    Isend(&Send.Count, 1, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-
-  Requests.Clear();
-
   for (auto &Entry : DonorRecvs) {
     int Rank = Entry.Key();
     send_recv &Recv = Entry.Value();
@@ -1931,7 +1919,7 @@ void DistributeGridConnectivityData(const xintout_grid &XINTOUTGrid, const grid
 
   Profiler.StartSync(IMPORT_DISTRIBUTE_MAP_TO_BINS_TIME, Comm);
 
-  elem_set<int,2> UniqueBinIDs;
+  hash_set<elem<int,2>> UniqueBinIDs;
 
   long long NumChunkDonors = 0;
   long long NumChunkDonorPoints = 0;
@@ -2222,24 +2210,41 @@ void DistributeGridConnectivityData(const xintout_grid &XINTOUTGrid, const grid
   Profiler.Stop(IMPORT_DISTRIBUTE_FIND_RANKS_TIME);
   Profiler.StartSync(IMPORT_DISTRIBUTE_HANDSHAKE_TIME, Comm);
 
-  array<int> DonorRecvFromRanks = core::DynamicHandshake(Comm, DonorSends.Keys());
-  array<int> ReceiverRecvFromRanks = core::DynamicHandshake(Comm, ReceiverSends.Keys());
+  // Exchanging sizes also tells each rank who it will be receiving from
+  map<int,array<long long>> DonorSendSizes;
+  for (auto &Entry : DonorSends) {
+    const donor_send_recv &Send = Entry.Value();
+    DonorSendSizes.Insert(Entry.Key(), array<long long>({2}, {Send.Count,Send.MaxSize}));
+  }
+
+  map<int,array<long long>> ReceiverSendSizes;
+  for (auto &Entry : ReceiverSends) {
+    ReceiverSendSizes.Insert(Entry.Key(), array<long long>({1}, Entry.Value().Count));
+  }
+
+  map<int,array<long long>> DonorRecvSizes = core::SparseExchange(Comm, DonorSendSizes);
+  map<int,array<long long>> ReceiverRecvSizes = core::SparseExchange(Comm, ReceiverSendSizes);
 
   Profiler.Stop(IMPORT_DISTRIBUTE_HANDSHAKE_TIME);
   Profiler.StartSync(IMPORT_DISTRIBUTE_SEND_DATA_TIME, Comm);
 
   map<int,donor_send_recv> DonorRecvs;
-  for (int Rank : DonorRecvFromRanks) {
-    DonorRecvs.Insert(Rank);
+  for (auto &Entry : DonorRecvSizes) {
+    donor_send_recv &Recv = DonorRecvs.Insert(Entry.Key());
+    Recv.Count = Entry.Value()(0);
+    Recv.MaxSize = int(Entry.Value()(1));
   }
 
   map<int,receiver_send_recv> ReceiverRecvs;
-  for (int Rank : ReceiverRecvFromRanks) {
-    ReceiverRecvs.Insert(Rank);
+  for (auto &Entry : ReceiverRecvSizes) {
+    receiver_send_recv &Recv = ReceiverRecvs.Insert(Entry.Key());
+    Recv.Count = Entry.Value()(0);
   }
 
-  DonorRecvFromRanks.Clear();
-  ReceiverRecvFromRanks.Clear();
+  DonorSendSizes.Clear();
+  ReceiverSendSizes.Clear();
+  DonorRecvSizes.Clear();
+  ReceiverRecvSizes.Clear();
 
   int NumDonorSends = DonorSends.Count();
   int NumReceiverSends = ReceiverSends.Count();
@@ -2268,36 +2273,6 @@ void DistributeGridConnectivityData(const xintout_grid &XINTOUTGrid, const grid
     MPI_Irecv(Buffer, Count, DataType, SourceRank, Tag, RecvComm, &Request);
   };
 
-  for (auto &Entry : DonorRecvs) {
-    int Rank = Entry.Key();
-    donor_send_recv &Recv = Entry.Value();
-    Irecv(&Recv.Count, 1, MPI_LONG_LONG, Rank, 0, Comm);
-    Irecv(&Recv.MaxSize, 1, MPI_INT, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : ReceiverRecvs) {
-    int Rank = Entry.Key();
-    receiver_send_recv &Recv = Entry.Value();
-    Irecv(&Recv.Count, 1, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  for (auto &Entry : DonorSends) {
-    int Rank = Entry.Key();
-    donor_send_recv &Send = Entry.Value();
-    Isend(&Send.Count, 1, MPI_LONG_LONG, Rank, 0, Comm);
-    Isend(&Send.MaxSize, 1, MPI_INT, Rank, 0, Comm);
-  }
-
-  for (auto &Entry : ReceiverSends) {
-    int Rank = Entry.Key();
-    receiver_send_recv &Send = Entry.Value();
-    Isend(&Send.Count, 1, MPI_LONG_LONG, Rank, 1, Comm);
-  }
-
-  MPI_Waitall(Requests.Count(), Requests.Data(), MPI_STATUSES_IGNORE);
-
-  Requests.Clear();
-
   for (auto &Entry : DonorRecvs) {
     int Rank = Entry.Key();
     donor_send_recv &Recv = Entry.Value();
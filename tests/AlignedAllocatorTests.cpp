@@ -0,0 +1,118 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/AlignedAllocator.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/DistributedField.hpp>
+#include <ovk/core/Field.hpp>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+class AlignedAllocatorTests : public tests::mpi_test {};
+
+using testing::ElementsAre;
+
+TEST_F(AlignedAllocatorTests, Allocate) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using allocator = ovk::core::aligned_allocator<double, 64>;
+
+  EXPECT_EQ(allocator::Alignment, 64u);
+
+  // Enough different sizes that some of the underlying allocations start off of the boundary
+  {
+    allocator Allocator;
+    for (std::size_t NumValues = 1; NumValues < 20; ++NumValues) {
+      double *Values = Allocator.allocate(NumValues);
+      EXPECT_TRUE(ovk::core::IsAligned(Values, 64));
+      for (std::size_t iValue = 0; iValue < NumValues; ++iValue) {
+        Values[iValue] = double(iValue);
+      }
+      Allocator.deallocate(Values, NumValues);
+    }
+  }
+
+  // Alignment is never less than that of the value type
+  {
+    struct alignas(128) wide { char Value; };
+    using wide_allocator = ovk::core::aligned_allocator<wide, 16>;
+    EXPECT_EQ(wide_allocator::Alignment, 128u);
+    wide_allocator Allocator;
+    wide *Values = Allocator.allocate(3);
+    EXPECT_TRUE(ovk::core::IsAligned(Values, 128));
+    Allocator.deallocate(Values, 3);
+  }
+
+  // Rebind and compare
+  {
+    allocator Allocator;
+    ovk::core::aligned_allocator<char, 64> OtherAllocator(Allocator);
+    EXPECT_EQ((std::allocator_traits<allocator>::rebind_alloc<char>::Alignment), 64u);
+    EXPECT_TRUE(allocator(OtherAllocator) == Allocator);
+    EXPECT_FALSE(allocator(OtherAllocator) != Allocator);
+  }
+
+  // Queried alignment of other allocators
+  {
+    EXPECT_EQ(ovk::core::AllocatorAlignment<allocator>(), 64u);
+    EXPECT_EQ(ovk::core::AllocatorAlignment<std::allocator<double>>(), alignof(double));
+  }
+
+}
+
+TEST_F(AlignedAllocatorTests, Containers) {
+
+  if (TestComm().Rank() != 0) return;
+
+  // Array
+  {
+    ovk::core::aligned_array<int> Array({3}, 1);
+    EXPECT_EQ(Array.Alignment, std::size_t(OVK_ALIGNMENT));
+    EXPECT_TRUE(ovk::core::IsAligned(Array.Data(), OVK_ALIGNMENT));
+    EXPECT_THAT(Array, ElementsAre(1,1,1));
+    for (int iValue = 0; iValue < 100; ++iValue) {
+      Array.Append(2);
+      EXPECT_TRUE(ovk::core::IsAligned(Array.Data(), OVK_ALIGNMENT));
+    }
+    ovk::array<int> UnalignedArray = Array;
+    EXPECT_EQ(UnalignedArray.Alignment, alignof(int));
+    EXPECT_EQ(UnalignedArray.Count(), 103);
+  }
+
+  // Bool
+  {
+    ovk::core::aligned_array<bool> Array({3});
+    EXPECT_TRUE(ovk::core::IsAligned(Array.Data(), OVK_ALIGNMENT));
+    Array(1) = true;
+    EXPECT_THAT(Array, ElementsAre(false,true,false));
+  }
+
+  // Fields keep the default allocator unless they opt in
+  {
+    EXPECT_TRUE((std::is_same<ovk::field<double>, ovk::array_c<double,3>>::value));
+    EXPECT_EQ(ovk::distributed_field<double>::Alignment, alignof(double));
+    ovk::core::aligned_field<double> Field({{5,3,1}}, 1.);
+    EXPECT_EQ(Field.Alignment, std::size_t(OVK_ALIGNMENT));
+    EXPECT_TRUE(ovk::core::IsAligned(Field.Data(), OVK_ALIGNMENT));
+    Field.Resize({{7,3,1}});
+    EXPECT_TRUE(ovk::core::IsAligned(Field.Data(), OVK_ALIGNMENT));
+    EXPECT_EQ(Field(4,2,0), 1.);
+    ovk::core::aligned_field<double> MovedField = std::move(Field);
+    EXPECT_TRUE(ovk::core::IsAligned(MovedField.Data(), OVK_ALIGNMENT));
+    ovk::field<double> UnalignedField = MovedField;
+    EXPECT_EQ(UnalignedField(4,2,0), 1.);
+  }
+
+}
@@ -0,0 +1,228 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/Arena.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Map.hpp>
+#include <ovk/core/Set.hpp>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class ArenaTests : public tests::mpi_test {};
+
+using testing::ElementsAre;
+
+TEST_F(ArenaTests, Allocate) {
+
+  if (TestComm().Rank() != 0) return;
+
+  ovk::core::arena Arena(64);
+
+  // Sequential within a block, respecting alignment
+  {
+    void *First = Arena.Allocate(3, 1);
+    void *Second = Arena.Allocate(8, 8);
+    EXPECT_EQ(std::uintptr_t(Second) % 8, 0u);
+    EXPECT_GT(std::uintptr_t(Second), std::uintptr_t(First));
+    EXPECT_LE(std::uintptr_t(Second) - std::uintptr_t(First), 16u);
+    EXPECT_EQ(Arena.Capacity(), 64u);
+    EXPECT_EQ(Arena.LiveAllocationCount(), 2);
+    Arena.Deallocate(First, 3);
+    Arena.Deallocate(Second, 8);
+    EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+  }
+
+  // Larger than the next block size
+  {
+    void *Large = Arena.Allocate(1000, 64);
+    EXPECT_EQ(std::uintptr_t(Large) % 64, 0u);
+    EXPECT_GE(Arena.Capacity(), 64u+1000u);
+    Arena.Deallocate(Large, 1000);
+  }
+
+  // Release keeps the largest block
+  {
+    std::size_t LargestBlockSize = Arena.Capacity() - 64;
+    Arena.Release();
+    EXPECT_EQ(Arena.Capacity(), LargestBlockSize);
+    void *Reused = Arena.Allocate(1000, 64);
+    EXPECT_EQ(Arena.Capacity(), LargestBlockSize);
+    Arena.Deallocate(Reused, 1000);
+  }
+
+}
+
+TEST_F(ArenaTests, Rewind) {
+
+  if (TestComm().Rank() != 0) return;
+
+  ovk::core::arena Arena(64, 256);
+
+  void *Base = Arena.Allocate(16, 8);
+
+  // Rewinding to a marker frees what was allocated since and keeps earlier allocations
+  {
+    ovk::core::arena::marker Marker = Arena.Mark();
+    void *First = Arena.Allocate(16, 8);
+    void *Large = Arena.Allocate(100, 8);
+    std::size_t Capacity = Arena.Capacity();
+    EXPECT_GT(Capacity, 64u);
+    Arena.Deallocate(First, 16);
+    Arena.Deallocate(Large, 100);
+    Arena.Rewind(Marker);
+    EXPECT_EQ(Arena.LiveAllocationCount(), 1);
+    // Freed block is small enough to keep for reuse
+    EXPECT_EQ(Arena.Capacity(), Capacity);
+    void *Reused = Arena.Allocate(16, 8);
+    EXPECT_EQ(Reused, First);
+    Arena.Deallocate(Reused, 16);
+  }
+
+  // Scope rewinds on exit
+  {
+    ovk::core::arena::marker Marker = Arena.Mark();
+    {
+      ovk::core::arena_scope Scope(Arena);
+      ovk::core::arena_array<int> Values({64}, Arena);
+    }
+    ovk::core::arena::marker AfterScope = Arena.Mark();
+    EXPECT_EQ(AfterScope.NumBlocks, Marker.NumBlocks);
+    EXPECT_EQ(AfterScope.Offset, Marker.Offset);
+    EXPECT_EQ(AfterScope.NextBlockSize, Marker.NextBlockSize);
+  }
+
+  Arena.Deallocate(Base, 16);
+
+  // Release resets block growth and doesn't keep blocks past the retained size limit
+  {
+    void *Huge = Arena.Allocate(1000, 8);
+    EXPECT_GE(Arena.Capacity(), 1000u);
+    Arena.Deallocate(Huge, 1000);
+    Arena.Release();
+    EXPECT_LE(Arena.Capacity(), 256u);
+    EXPECT_EQ(Arena.Mark().NextBlockSize, 64u);
+  }
+
+}
+
+TEST_F(ArenaTests, Allocator) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using allocator = ovk::core::arena_allocator<int>;
+
+  ovk::core::arena Arena;
+
+  // Attached
+  {
+    allocator Allocator(Arena);
+    EXPECT_EQ(Allocator.Arena(), &Arena);
+    int *Values = Allocator.allocate(4);
+    EXPECT_EQ(Arena.LiveAllocationCount(), 1);
+    Allocator.deallocate(Values, 4);
+    EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+  }
+
+  // Unattached
+  {
+    allocator Allocator;
+    EXPECT_EQ(Allocator.Arena(), nullptr);
+    int *Values = Allocator.allocate(4);
+    EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+    Allocator.deallocate(Values, 4);
+  }
+
+  // Rebind and compare
+  {
+    allocator Allocator(Arena);
+    ovk::core::arena_allocator<double> OtherAllocator(Allocator);
+    EXPECT_EQ(OtherAllocator.Arena(), &Arena);
+    EXPECT_TRUE(allocator(OtherAllocator) == Allocator);
+    EXPECT_TRUE(allocator() != Allocator);
+  }
+
+  Arena.Release();
+
+}
+
+TEST_F(ArenaTests, Containers) {
+
+  if (TestComm().Rank() != 0) return;
+
+  ovk::core::arena Arena;
+
+  // Array
+  {
+    ovk::core::arena_array<int> Array({4}, 1, Arena);
+    EXPECT_EQ(Array.Allocator().Arena(), &Arena);
+    EXPECT_THAT(Array, ElementsAre(1,1,1,1));
+    Array.Append(2);
+    EXPECT_THAT(Array, ElementsAre(1,1,1,1,2));
+    ovk::core::arena_array<int> MovedArray = std::move(Array);
+    EXPECT_EQ(MovedArray.Allocator().Arena(), &Arena);
+    ovk::core::arena_array<int> AssignedArray;
+    AssignedArray = std::move(MovedArray);
+    EXPECT_EQ(AssignedArray.Allocator().Arena(), &Arena);
+    ovk::array<int> HeapArray = AssignedArray;
+    EXPECT_THAT(HeapArray, ElementsAre(1,1,1,1,2));
+    EXPECT_GT(Arena.LiveAllocationCount(), 0);
+  }
+  EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+
+  // Bool
+  {
+    ovk::core::arena_array<bool> Array({3}, Arena);
+    EXPECT_THAT(Array, ElementsAre(false,false,false));
+    Array(1) = true;
+    EXPECT_THAT(Array, ElementsAre(false,true,false));
+  }
+  EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+
+  // Field
+  {
+    ovk::core::arena_field<double> Field({{2,3,1}}, Arena);
+    EXPECT_EQ(Field.Count(), 6);
+    Field.Fill(1.);
+    Field.Resize({{3,3,1}});
+    EXPECT_EQ(Field(1,2,0), 1.);
+    EXPECT_EQ(Field(2,2,0), 0.);
+  }
+  EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+
+  // Set and map
+  {
+    using set_type = ovk::set<int, std::less<int>, ovk::core::arena_allocator<int>>;
+    set_type Set(Arena);
+    Set.Insert(3);
+    Set.Insert(1);
+    Set.Insert(2);
+    EXPECT_EQ(Set.Allocator().Arena(), &Arena);
+    EXPECT_THAT(std::vector<int>(Set.Begin(), Set.End()), ElementsAre(1,2,3));
+    using map_type = ovk::map<int, double, std::less<int>, true, ovk::core::arena_allocator<
+      ovk::map_entry<int,double>>>;
+    map_type Map(Arena);
+    Map.Insert(2, 2.);
+    Map.Insert(1, 1.);
+    EXPECT_EQ(Map.Allocator().Arena(), &Arena);
+    EXPECT_EQ(Map(1), 1.);
+    EXPECT_EQ(Map(2), 2.);
+    EXPECT_EQ(Map.Begin()->Key(), 1);
+  }
+  EXPECT_EQ(Arena.LiveAllocationCount(), 0);
+
+  Arena.Release();
+
+}
@@ -2268,6 +2268,115 @@ TEST_F(ArrayTests, Resize) {
 
 }
 
+TEST_F(ArrayTests, ResizeDefaultInit) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using array_1d = ovk::array<int>;
+  using array_row = ovk::array<int,3>;
+  using array_noncopyable = ovk::array<noncopyable<int>>;
+  using helper_1d = ovk::core::test_helper<array_1d>;
+  using helper_row = ovk::core::test_helper<array_row>;
+  using helper_noncopyable = ovk::core::test_helper<array_noncopyable>;
+
+  // One-dimensional, change size
+  {
+    array_1d Array({4}, {0,1,2,3});
+    Array.ResizeDefaultInit({5});
+    auto &View = helper_1d::GetView(Array);
+    auto &Values = helper_1d::GetValues(Array);
+    EXPECT_THAT(View.Extents().Begin(), ElementsAre(0));
+    EXPECT_THAT(View.Extents().End(), ElementsAre(5));
+    EXPECT_EQ(Values.Count(), 5);
+    EXPECT_EQ(Values[0], 0);
+    EXPECT_EQ(Values[1], 1);
+    EXPECT_EQ(Values[2], 2);
+    EXPECT_EQ(Values[3], 3);
+  }
+
+  // One-dimensional, shift
+  {
+    array_1d Array({4}, {0,1,2,3});
+    Array.ResizeDefaultInit({-1,3});
+    auto &View = helper_1d::GetView(Array);
+    auto &Values = helper_1d::GetValues(Array);
+    EXPECT_THAT(View.Extents().Begin(), ElementsAre(-1));
+    EXPECT_THAT(View.Extents().End(), ElementsAre(3));
+    EXPECT_EQ(Values.Count(), 4);
+    EXPECT_EQ(Values[1], 0);
+    EXPECT_EQ(Values[2], 1);
+    EXPECT_EQ(Values[3], 2);
+  }
+
+  // Multidimensional, row major, change size in min-stride dimension
+  {
+    array_row Array({{1,2,3}}, {0,1,2,3,4,5});
+    Array.ResizeDefaultInit({{1,2,4}});
+    auto &View = helper_row::GetView(Array);
+    auto &Values = helper_row::GetValues(Array);
+    EXPECT_THAT(View.Extents().Begin(), ElementsAre(0,0,0));
+    EXPECT_THAT(View.Extents().End(), ElementsAre(1,2,4));
+    EXPECT_EQ(Values.Count(), 8);
+    EXPECT_EQ(Values[0], 0);
+    EXPECT_EQ(Values[1], 1);
+    EXPECT_EQ(Values[2], 2);
+    EXPECT_EQ(Values[4], 3);
+    EXPECT_EQ(Values[5], 4);
+    EXPECT_EQ(Values[6], 5);
+  }
+
+  // Move-only values
+  {
+    array_noncopyable Array({2});
+    Array(0) = noncopyable<int>(1);
+    Array(1) = noncopyable<int>(2);
+    Array.ResizeDefaultInit({3});
+    auto &View = helper_noncopyable::GetView(Array);
+    auto &Values = helper_noncopyable::GetValues(Array);
+    EXPECT_THAT(View.Extents().End(), ElementsAre(3));
+    EXPECT_EQ(Values.Count(), 3);
+    EXPECT_EQ(Values[0].Value(), 1);
+    EXPECT_EQ(Values[1].Value(), 2);
+  }
+
+}
+
+TEST_F(ArrayTests, ResizeUninitialized) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using array_1d = ovk::array<int>;
+  using array_col = ovk::array<double,3,ovk::array_layout::COLUMN_MAJOR>;
+  using helper_1d = ovk::core::test_helper<array_1d>;
+  using helper_col = ovk::core::test_helper<array_col>;
+
+  // One-dimensional
+  {
+    array_1d Array({4}, {0,1,2,3});
+    Array.ResizeUninitialized({-1,5});
+    auto &View = helper_1d::GetView(Array);
+    auto &Values = helper_1d::GetValues(Array);
+    EXPECT_THAT(View.Extents().Begin(), ElementsAre(-1));
+    EXPECT_THAT(View.Extents().End(), ElementsAre(5));
+    EXPECT_EQ(Values.Count(), 6);
+    EXPECT_EQ(View.Data(), Values.Data());
+  }
+
+  // Multidimensional, then fill
+  {
+    array_col Array;
+    Array.ResizeUninitialized({{1,2,3},{3,4,5}});
+    auto &View = helper_col::GetView(Array);
+    auto &Values = helper_col::GetValues(Array);
+    EXPECT_THAT(View.Extents().Begin(), ElementsAre(1,2,3));
+    EXPECT_THAT(View.Extents().End(), ElementsAre(3,4,5));
+    EXPECT_EQ(Values.Count(), 8);
+    Array.Fill(1.);
+    for (auto &Value : Values) EXPECT_EQ(Value, 1.);
+  }
+
+}
+
 TEST_F(ArrayTests, Clear) {
 
   if (TestComm().Rank() != 0) return;
@@ -20,6 +20,7 @@
 #include <ovk/core/Domain.hpp>
 #include <ovk/core/FieldOps.hpp>
 #include <ovk/core/Grid.hpp>
+#include <ovk/core/Optional.hpp>
 #include <ovk/core/Range.hpp>
 #include <ovk/core/ScalarOps.hpp>
 #include <ovk/core/Tuple.hpp>
@@ -955,6 +956,252 @@ TEST_F(AssemblerTests, OverlapPeriodic) {
 
 }
 
+TEST_F(AssemblerTests, OverlapQueryShipping) {
+
+  int NumProc = TestComm().Size();
+  // Avoid sizes that make decomposition too small
+  int AllowedSubsetSizes[] = {1, 2, 4, 6, 8, 12, 16, 18};
+  int SubsetSize = 1;
+  for (int Size : AllowedSubsetSizes) {
+    if (Size > NumProc) break;
+    SubsetSize = Size;
+  }
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < SubsetSize);
+
+  if (Comm) {
+
+    // Search by transferring fragments in one domain and by sending query points to the fragment
+    // owners in the others (for all fragments, or for batches moved off of overloaded ranks);
+    // results should be the same
+    auto AssembleWithThreshold = [&](double Threshold, double MaxLoadImbalance) -> ovk::domain {
+      ovk::domain Domain = WavyInWavy(2, Comm, 10, true);
+      Domain.CreateComponent<ovk::overlap_component>(3);
+      Domain.CreateComponent<ovk::connectivity_component>(4);
+      ovk::assembler Assembler = ovk::CreateAssembler(Domain.SharedContext());
+      Assembler.Bind(Domain, ovk::assembler::bindings()
+        .SetGeometryComponentID(1)
+        .SetStateComponentID(2)
+        .SetOverlapComponentID(3)
+        .SetConnectivityComponentID(4)
+      );
+      {
+        auto OptionsEditHandle = Assembler.EditOptions();
+        ovk::assembler::options &Options = *OptionsEditHandle;
+        Options.SetOverlappable({2,1}, true);
+        Options.SetOverlappable({1,2}, true);
+        Options.SetOverlapQueryShippingThreshold(ovk::ALL_GRIDS, Threshold);
+        Options.SetOverlapSearchMaxLoadImbalance(MaxLoadImbalance);
+      }
+      Assembler.Assemble();
+      return Domain;
+    };
+
+    ovk::domain TransferDomain = AssembleWithThreshold(1.e10, 1.e10);
+
+    auto &TransferOverlapComponent = TransferDomain.Component<ovk::overlap_component>(3);
+
+    for (double MaxLoadImbalance : {1.e10, 1.}) {
+
+      double Threshold = MaxLoadImbalance > 1. ? 0. : 1.e10;
+      ovk::domain ShipDomain = AssembleWithThreshold(Threshold, MaxLoadImbalance);
+
+      auto &ShipOverlapComponent = ShipDomain.Component<ovk::overlap_component>(3);
+
+      for (int MGridID : {1,2}) {
+        int NGridID = 3-MGridID;
+        if (TransferDomain.GridIsLocal(MGridID)) {
+          const ovk::overlap_m &TransferOverlapM = TransferOverlapComponent.OverlapM({MGridID,
+            NGridID});
+          const ovk::overlap_m &ShipOverlapM = ShipOverlapComponent.OverlapM({MGridID,NGridID});
+          EXPECT_EQ(ShipOverlapM.Size(), TransferOverlapM.Size());
+          EXPECT_THAT(ShipOverlapM.Cells(), ElementsAreArray(TransferOverlapM.Cells()));
+          ovk::array<Matcher<double>,2> ExpectedCoords({{ovk::MAX_DIMS,TransferOverlapM.Size()}});
+          for (long long iOverlapping = 0; iOverlapping < TransferOverlapM.Size(); ++iOverlapping) {
+            for (int iDim = 0; iDim < ovk::MAX_DIMS; ++iDim) {
+              ExpectedCoords(iDim,iOverlapping) = DoubleNear(TransferOverlapM.Coords()(iDim,
+                iOverlapping), 1.e-12);
+            }
+          }
+          EXPECT_THAT(ShipOverlapM.Coords(), ElementsAreArray(ExpectedCoords));
+          EXPECT_THAT(ShipOverlapM.Destinations(), ElementsAreArray(
+            TransferOverlapM.Destinations()));
+          EXPECT_THAT(ShipOverlapM.DestinationRanks(), ElementsAreArray(
+            TransferOverlapM.DestinationRanks()));
+        }
+        if (TransferDomain.GridIsLocal(NGridID)) {
+          const ovk::overlap_n &TransferOverlapN = TransferOverlapComponent.OverlapN({MGridID,
+            NGridID});
+          const ovk::overlap_n &ShipOverlapN = ShipOverlapComponent.OverlapN({MGridID,NGridID});
+          EXPECT_EQ(ShipOverlapN.Size(), TransferOverlapN.Size());
+          EXPECT_THAT(ShipOverlapN.Mask(), ElementsAreArray(TransferOverlapN.Mask()));
+          EXPECT_THAT(ShipOverlapN.Points(), ElementsAreArray(TransferOverlapN.Points()));
+          EXPECT_THAT(ShipOverlapN.Sources(), ElementsAreArray(TransferOverlapN.Sources()));
+          EXPECT_THAT(ShipOverlapN.SourceRanks(), ElementsAreArray(TransferOverlapN.SourceRanks()));
+        }
+      }
+
+    }
+
+  }
+
+}
+
+TEST_F(AssemblerTests, RepeatedAssembly) {
+
+  int NumProc = TestComm().Size();
+  // Avoid sizes that make decomposition too small
+  int AllowedSubsetSizes[] = {1, 2, 4, 6, 8, 12, 16, 18};
+  int SubsetSize = 1;
+  for (int Size : AllowedSubsetSizes) {
+    if (Size > NumProc) break;
+    SubsetSize = Size;
+  }
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < SubsetSize);
+
+  if (Comm) {
+
+    auto CreateDomain = [&]() -> ovk::domain {
+      ovk::domain Domain = WavyInWavy(2, Comm, 10, true);
+      Domain.CreateComponent<ovk::overlap_component>(3);
+      Domain.CreateComponent<ovk::connectivity_component>(4);
+      return Domain;
+    };
+
+    auto CreateBoundAssembler = [&](ovk::domain &Domain) -> ovk::assembler {
+      ovk::assembler Assembler = ovk::CreateAssembler(Domain.SharedContext());
+      Assembler.Bind(Domain, ovk::assembler::bindings()
+        .SetGeometryComponentID(1)
+        .SetStateComponentID(2)
+        .SetOverlapComponentID(3)
+        .SetConnectivityComponentID(4)
+      );
+      {
+        auto OptionsEditHandle = Assembler.EditOptions();
+        ovk::assembler::options &Options = *OptionsEditHandle;
+        Options.SetOverlappable({2,1}, true);
+        Options.SetOverlappable({1,2}, true);
+      }
+      return Assembler;
+    };
+
+    ovk::domain ReferenceDomain = CreateDomain();
+    ovk::assembler ReferenceAssembler = CreateBoundAssembler(ReferenceDomain);
+    ReferenceAssembler.Assemble();
+
+    // Reassemble with unchanged geometry (reuses cached fragments), then after touching the
+    // coordinates of one grid (invalidates that grid's cached fragments)
+    ovk::domain Domain = CreateDomain();
+    ovk::assembler Assembler = CreateBoundAssembler(Domain);
+    Assembler.Assemble();
+    Assembler.Assemble();
+    {
+      auto GeometryComponentEditHandle = Domain.EditComponent<ovk::geometry_component>(1);
+      ovk::geometry_component &GeometryComponent = *GeometryComponentEditHandle;
+      if (Domain.GridIsLocal(1)) {
+        auto GeometryEditHandle = GeometryComponent.EditGeometry(1);
+        ovk::geometry &Geometry = *GeometryEditHandle;
+        auto CoordsEditHandle = Geometry.EditCoords();
+      }
+    }
+    Assembler.Assemble();
+
+    auto &ReferenceOverlapComponent = ReferenceDomain.Component<ovk::overlap_component>(3);
+    auto &OverlapComponent = Domain.Component<ovk::overlap_component>(3);
+
+    for (int MGridID : {1,2}) {
+      int NGridID = 3-MGridID;
+      if (Domain.GridIsLocal(MGridID)) {
+        const ovk::overlap_m &ReferenceOverlapM = ReferenceOverlapComponent.OverlapM({MGridID,
+          NGridID});
+        const ovk::overlap_m &OverlapM = OverlapComponent.OverlapM({MGridID,NGridID});
+        EXPECT_EQ(OverlapM.Size(), ReferenceOverlapM.Size());
+        EXPECT_THAT(OverlapM.Cells(), ElementsAreArray(ReferenceOverlapM.Cells()));
+        EXPECT_THAT(OverlapM.Coords(), ElementsAreArray(ReferenceOverlapM.Coords()));
+        EXPECT_THAT(OverlapM.Destinations(), ElementsAreArray(ReferenceOverlapM.Destinations()));
+      }
+      if (Domain.GridIsLocal(NGridID)) {
+        const ovk::overlap_n &ReferenceOverlapN = ReferenceOverlapComponent.OverlapN({MGridID,
+          NGridID});
+        const ovk::overlap_n &OverlapN = OverlapComponent.OverlapN({MGridID,NGridID});
+        EXPECT_EQ(OverlapN.Size(), ReferenceOverlapN.Size());
+        EXPECT_THAT(OverlapN.Mask(), ElementsAreArray(ReferenceOverlapN.Mask()));
+        EXPECT_THAT(OverlapN.Points(), ElementsAreArray(ReferenceOverlapN.Points()));
+        EXPECT_THAT(OverlapN.Sources(), ElementsAreArray(ReferenceOverlapN.Sources()));
+      }
+    }
+
+  }
+
+}
+
+TEST_F(AssemblerTests, OptionsForAddedGrid) {
+
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 2);
+
+  if (Comm) {
+
+    ovk::domain Domain = WavyInWavy(2, Comm, 10, false);
+    Domain.CreateComponent<ovk::overlap_component>(3);
+    Domain.CreateComponent<ovk::connectivity_component>(4);
+
+    ovk::assembler Assembler = ovk::CreateAssembler(Domain.SharedContext());
+    Assembler.Bind(Domain, ovk::assembler::bindings()
+      .SetGeometryComponentID(1)
+      .SetStateComponentID(2)
+      .SetOverlapComponentID(3)
+      .SetConnectivityComponentID(4)
+    );
+
+    {
+      auto OptionsEditHandle = Assembler.EditOptions();
+      ovk::assembler::options &Options = *OptionsEditHandle;
+      Options.SetOverlappable({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, true);
+      Options.SetCutBoundaryHoles({1,ovk::ALL_GRIDS}, true);
+      Options.SetFringeSize(ovk::ALL_GRIDS, 2);
+    }
+
+    bool GridIsLocal = Comm.Rank() == 0;
+    ovk::comm GridComm = ovk::CreateSubsetComm(Comm, GridIsLocal);
+    ovk::optional<ovk::grid::params> MaybeGridParams;
+    if (GridIsLocal) {
+      GridComm = ovk::CreateCartComm(GridComm, 2, {1,1,1}, {false,false,false});
+      MaybeGridParams = Domain.MakeGridParams()
+        .SetName("Added")
+        .SetComm(GridComm)
+        .SetGlobalRange({{4,4,1}})
+        .SetLocalRange({{4,4,1}});
+    }
+    Domain.CreateGrid(3, std::move(MaybeGridParams));
+
+    // ALL_GRIDS only covers the grids that existed when the options were set
+    const ovk::assembler::options &Options = Assembler.Options();
+    EXPECT_TRUE(Options.Overlappable({1,2}));
+    EXPECT_TRUE(Options.Overlappable({2,1}));
+    EXPECT_FALSE(Options.Overlappable({1,3}));
+    EXPECT_FALSE(Options.Overlappable({3,2}));
+    EXPECT_TRUE(Options.CutBoundaryHoles({1,2}));
+    EXPECT_FALSE(Options.CutBoundaryHoles({1,3}));
+    EXPECT_EQ(Options.FringeSize(1), 2);
+    EXPECT_EQ(Options.FringeSize(2), 2);
+    EXPECT_EQ(Options.FringeSize(3), 0);
+
+    {
+      auto OptionsEditHandle = Assembler.EditOptions();
+      ovk::assembler::options &Options = *OptionsEditHandle;
+      Options.SetOverlappable({ovk::ALL_GRIDS,3}, true);
+      Options.SetFringeSize(ovk::ALL_GRIDS, 1);
+    }
+
+    EXPECT_TRUE(Options.Overlappable({1,3}));
+    EXPECT_TRUE(Options.Overlappable({2,3}));
+    EXPECT_FALSE(Options.Overlappable({3,1}));
+    EXPECT_FALSE(Options.Overlappable({3,3}));
+    EXPECT_EQ(Options.FringeSize(3), 1);
+
+  }
+
+}
+
 // TEST_F(AssemblerTests, BoundaryHoleCutting2D) {
 
 //   // Cylinder in box case
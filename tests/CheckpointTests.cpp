@@ -0,0 +1,295 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/extras/Checkpoint.hpp>
+
+#include "tests/MPITest.hpp"
+#include "tests/fixtures/WavyInWavy.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Assembler.hpp>
+#include <ovk/core/Comm.hpp>
+#include <ovk/core/ConnectivityComponent.hpp>
+#include <ovk/core/ConnectivityM.hpp>
+#include <ovk/core/ConnectivityN.hpp>
+#include <ovk/core/Domain.hpp>
+#include <ovk/core/Error.hpp>
+#include <ovk/core/Field.hpp>
+#include <ovk/core/Grid.hpp>
+#include <ovk/core/OverlapComponent.hpp>
+#include <ovk/core/OverlapM.hpp>
+#include <ovk/core/OverlapN.hpp>
+#include <ovk/core/State.hpp>
+#include <ovk/core/StateComponent.hpp>
+
+#include <mpi.h>
+
+#include <cstdio>
+
+using testing::ElementsAreArray;
+using testing::Matcher;
+using testing::DoubleEq;
+using testing::DoubleNear;
+
+class CheckpointTests : public tests::mpi_test {};
+
+using tests::WavyInWavy;
+
+namespace {
+
+ovk::domain AssembledWavyInWavy(ovk::comm_view Comm) {
+
+  ovk::domain Domain = WavyInWavy(2, Comm, 10, true);
+
+  Domain.CreateComponent<ovk::overlap_component>(3);
+  Domain.CreateComponent<ovk::connectivity_component>(4);
+
+  ovk::assembler Assembler = ovk::CreateAssembler(Domain.SharedContext());
+
+  Assembler.Bind(Domain, ovk::assembler::bindings()
+    .SetGeometryComponentID(1)
+    .SetStateComponentID(2)
+    .SetOverlapComponentID(3)
+    .SetConnectivityComponentID(4)
+  );
+
+  {
+    auto OptionsEditHandle = Assembler.EditOptions();
+    ovk::assembler::options &Options = *OptionsEditHandle;
+    Options.SetOverlappable({2,1}, true);
+    Options.SetOverlappable({1,2}, true);
+    Options.SetInferBoundaries(ovk::ALL_GRIDS, true);
+    Options.SetConnectionType({1,2}, ovk::connection_type::LINEAR);
+    Options.SetConnectionType({2,1}, ovk::connection_type::NEAREST);
+    Options.SetFringeSize(ovk::ALL_GRIDS, 1);
+    Options.SetDisjointConnections({ovk::ALL_GRIDS,ovk::ALL_GRIDS}, false);
+  }
+
+  Assembler.Assemble();
+
+  return Domain;
+
+}
+
+ovk::domain EmptyWavyInWavy(ovk::comm_view Comm) {
+
+  ovk::domain Domain = WavyInWavy(2, Comm, 10, true);
+
+  Domain.CreateComponent<ovk::overlap_component>(3);
+  Domain.CreateComponent<ovk::connectivity_component>(4);
+
+  return Domain;
+
+}
+
+template <typename T, int Rank> ovk::array<Matcher<double>,Rank> MatchDoubles(const ovk::array<T,
+  Rank> &Values, bool Exact) {
+
+  ovk::array<Matcher<double>,Rank> Matchers(Values.Extents());
+  for (long long iValue = 0; iValue < Values.Count(); ++iValue) {
+    if (Exact) {
+      Matchers[iValue] = DoubleEq(Values[iValue]);
+    } else {
+      Matchers[iValue] = DoubleNear(Values[iValue], 1.e-10);
+    }
+  }
+
+  return Matchers;
+
+}
+
+// Assembling on a different decomposition can change coordinates and coefficients by roundoff, and
+// destination/source ranks of connectivities are not restored when the decomposition changes
+void ExpectSameAssembly(const ovk::domain &Domain, const ovk::domain &ExpectedDomain, bool
+  SameDecomp) {
+
+  auto &StateComponent = Domain.Component<ovk::state_component>(2);
+  auto &ExpectedStateComponent = ExpectedDomain.Component<ovk::state_component>(2);
+
+  for (int GridID : Domain.LocalGridIDs()) {
+    const ovk::range &LocalRange = Domain.Grid(GridID).LocalRange();
+    ASSERT_EQ(LocalRange, ExpectedDomain.Grid(GridID).LocalRange());
+    auto &Flags = StateComponent.State(GridID).Flags();
+    auto &ExpectedFlags = ExpectedStateComponent.State(GridID).Flags();
+    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        EXPECT_EQ(int(Flags(i,j,0)), int(ExpectedFlags(i,j,0)));
+      }
+    }
+  }
+
+  auto &OverlapComponent = Domain.Component<ovk::overlap_component>(3);
+  auto &ExpectedOverlapComponent = ExpectedDomain.Component<ovk::overlap_component>(3);
+
+  EXPECT_EQ(OverlapComponent.OverlapIDs().Count(), ExpectedOverlapComponent.OverlapIDs().Count());
+  for (auto &OverlapID : ExpectedOverlapComponent.OverlapIDs()) {
+    EXPECT_TRUE(OverlapComponent.OverlapExists(OverlapID));
+  }
+
+  for (auto &OverlapID : ExpectedOverlapComponent.LocalOverlapMIDs()) {
+    const ovk::overlap_m &OverlapM = OverlapComponent.OverlapM(OverlapID);
+    const ovk::overlap_m &ExpectedOverlapM = ExpectedOverlapComponent.OverlapM(OverlapID);
+    EXPECT_EQ(OverlapM.Size(), ExpectedOverlapM.Size());
+    EXPECT_THAT(OverlapM.Cells(), ElementsAreArray(ExpectedOverlapM.Cells()));
+    EXPECT_THAT(OverlapM.Coords(), ElementsAreArray(MatchDoubles(ExpectedOverlapM.Coords(),
+      SameDecomp)));
+    EXPECT_THAT(OverlapM.Destinations(), ElementsAreArray(ExpectedOverlapM.Destinations()));
+    EXPECT_THAT(OverlapM.DestinationRanks(), ElementsAreArray(
+      ExpectedOverlapM.DestinationRanks()));
+  }
+
+  for (auto &OverlapID : ExpectedOverlapComponent.LocalOverlapNIDs()) {
+    const ovk::overlap_n &OverlapN = OverlapComponent.OverlapN(OverlapID);
+    const ovk::overlap_n &ExpectedOverlapN = ExpectedOverlapComponent.OverlapN(OverlapID);
+    EXPECT_EQ(OverlapN.Size(), ExpectedOverlapN.Size());
+    EXPECT_THAT(OverlapN.Points(), ElementsAreArray(ExpectedOverlapN.Points()));
+    EXPECT_THAT(OverlapN.Sources(), ElementsAreArray(ExpectedOverlapN.Sources()));
+    EXPECT_THAT(OverlapN.SourceRanks(), ElementsAreArray(ExpectedOverlapN.SourceRanks()));
+  }
+
+  auto &ConnectivityComponent = Domain.Component<ovk::connectivity_component>(4);
+  auto &ExpectedConnectivityComponent = ExpectedDomain.Component<ovk::connectivity_component>(4);
+
+  EXPECT_EQ(ConnectivityComponent.ConnectivityIDs().Count(),
+    ExpectedConnectivityComponent.ConnectivityIDs().Count());
+  for (auto &ConnectivityID : ExpectedConnectivityComponent.ConnectivityIDs()) {
+    EXPECT_TRUE(ConnectivityComponent.ConnectivityExists(ConnectivityID));
+  }
+
+  for (auto &ConnectivityID : ExpectedConnectivityComponent.LocalConnectivityMIDs()) {
+    const ovk::connectivity_m &ConnectivityM = ConnectivityComponent.ConnectivityM(
+      ConnectivityID);
+    const ovk::connectivity_m &ExpectedConnectivityM = ExpectedConnectivityComponent.ConnectivityM(
+      ConnectivityID);
+    EXPECT_EQ(ConnectivityM.Size(), ExpectedConnectivityM.Size());
+    EXPECT_EQ(ConnectivityM.MaxStencilSize(), ExpectedConnectivityM.MaxStencilSize());
+    EXPECT_THAT(ConnectivityM.Extents(), ElementsAreArray(ExpectedConnectivityM.Extents()));
+    EXPECT_THAT(ConnectivityM.Coords(), ElementsAreArray(MatchDoubles(
+      ExpectedConnectivityM.Coords(), SameDecomp)));
+    EXPECT_THAT(ConnectivityM.InterpCoefs(), ElementsAreArray(MatchDoubles(
+      ExpectedConnectivityM.InterpCoefs(), SameDecomp)));
+    EXPECT_THAT(ConnectivityM.Destinations(), ElementsAreArray(
+      ExpectedConnectivityM.Destinations()));
+    if (SameDecomp) {
+      EXPECT_THAT(ConnectivityM.DestinationRanks(), ElementsAreArray(
+        ExpectedConnectivityM.DestinationRanks()));
+    }
+  }
+
+  for (auto &ConnectivityID : ExpectedConnectivityComponent.LocalConnectivityNIDs()) {
+    const ovk::connectivity_n &ConnectivityN = ConnectivityComponent.ConnectivityN(
+      ConnectivityID);
+    const ovk::connectivity_n &ExpectedConnectivityN = ExpectedConnectivityComponent.ConnectivityN(
+      ConnectivityID);
+    EXPECT_EQ(ConnectivityN.Size(), ExpectedConnectivityN.Size());
+    EXPECT_THAT(ConnectivityN.Points(), ElementsAreArray(ExpectedConnectivityN.Points()));
+    EXPECT_THAT(ConnectivityN.Sources(), ElementsAreArray(ExpectedConnectivityN.Sources()));
+    if (SameDecomp) {
+      EXPECT_THAT(ConnectivityN.SourceRanks(), ElementsAreArray(
+        ExpectedConnectivityN.SourceRanks()));
+    }
+  }
+
+}
+
+}
+
+TEST_F(CheckpointTests, SameDecomp) {
+
+  ASSERT_GE(TestComm().Size(), 4);
+
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 4);
+
+  if (Comm) {
+
+    ovk::domain AssembledDomain = AssembledWavyInWavy(Comm);
+
+    ovk::ExportCheckpoint(AssembledDomain, 2, 3, 4, "CheckpointTests_SameDecomp.ckpt",
+      MPI_INFO_NULL);
+
+    ovk::domain Domain = EmptyWavyInWavy(Comm);
+
+    ovk::ImportCheckpoint(Domain, 2, 3, 4, "CheckpointTests_SameDecomp.ckpt", MPI_INFO_NULL);
+
+    ExpectSameAssembly(Domain, AssembledDomain, true);
+
+    MPI_Barrier(Comm);
+    if (Comm.Rank() == 0) std::remove("CheckpointTests_SameDecomp.ckpt");
+
+  }
+
+}
+
+TEST_F(CheckpointTests, Redistribute) {
+
+  ASSERT_GE(TestComm().Size(), 8);
+
+  // Write on 8 ranks, read on 2 and 6
+  ovk::comm WriteComm = CreateSubsetComm(TestComm(), TestComm().Rank() < 8);
+
+  if (WriteComm) {
+    ovk::domain AssembledDomain = AssembledWavyInWavy(WriteComm);
+    ovk::ExportCheckpoint(AssembledDomain, 2, 3, 4, "CheckpointTests_Redistribute.ckpt",
+      MPI_INFO_NULL);
+  }
+
+  MPI_Barrier(TestComm());
+
+  for (int ReadSize : {2, 6}) {
+
+    ovk::comm ReadComm = CreateSubsetComm(TestComm(), TestComm().Rank() < ReadSize);
+
+    if (ReadComm) {
+      ovk::domain AssembledDomain = AssembledWavyInWavy(ReadComm);
+      ovk::domain Domain = EmptyWavyInWavy(ReadComm);
+      ovk::ImportCheckpoint(Domain, 2, 3, 4, "CheckpointTests_Redistribute.ckpt", MPI_INFO_NULL);
+      ExpectSameAssembly(Domain, AssembledDomain, false);
+    }
+
+  }
+
+  MPI_Barrier(TestComm());
+  if (TestComm().Rank() == 0) std::remove("CheckpointTests_Redistribute.ckpt");
+
+}
+
+TEST_F(CheckpointTests, InvalidFile) {
+
+  ASSERT_GE(TestComm().Size(), 2);
+
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 2);
+
+  if (Comm) {
+
+    ovk::domain Domain = EmptyWavyInWavy(Comm);
+
+    ovk::captured_error Error;
+    ovk::ImportCheckpoint(Domain, 2, 3, 4, "CheckpointTests_DoesNotExist.ckpt", MPI_INFO_NULL,
+      Error);
+    EXPECT_EQ(Error.Code(), ovk::error_code::FILE_OPEN);
+
+    // Valid prefix claiming a header far longer than the file
+    if (Comm.Rank() == 0) {
+      std::FILE *File = std::fopen("CheckpointTests_Truncated.ckpt", "wb");
+      const char Magic[8] = {'O', 'V', 'K', 'C', 'K', 'P', 'T', '\0'};
+      const int Prefix[3] = {0x01020304, 1, 1 << 26};
+      std::fwrite(Magic, 1, sizeof(Magic), File);
+      std::fwrite(Prefix, sizeof(int), 3, File);
+      std::fclose(File);
+    }
+    MPI_Barrier(Comm);
+
+    Error.Reset();
+    ovk::ImportCheckpoint(Domain, 2, 3, 4, "CheckpointTests_Truncated.ckpt", MPI_INFO_NULL,
+      Error);
+    EXPECT_EQ(Error.Code(), ovk::error_code::FILE_READ);
+
+    MPI_Barrier(Comm);
+    if (Comm.Rank() == 0) std::remove("CheckpointTests_Truncated.ckpt");
+
+  }
+
+}
@@ -0,0 +1,226 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/CommunicationOps.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/ArrayView.hpp>
+#include <ovk/core/Comm.hpp>
+#include <ovk/core/Map.hpp>
+
+#include <mpi.h>
+
+#include <utility>
+
+class CommunicationOpsTests : public tests::mpi_test {};
+
+namespace {
+
+// Rank Size-1 holds off on starting until every other rank has started and checked a few times,
+// so none of them should see the signal as done early. Repeats to test reuse
+void TestSignal(ovk::comm_view Comm, ovk::core::signal_algorithm Algorithm) {
+
+  int Rank = Comm.Rank();
+  int Size = Comm.Size();
+  int LastRank = Size-1;
+
+  ovk::core::signal Signal(Comm, Algorithm);
+
+  for (int iRound = 0; iRound < 3; ++iRound) {
+    if (Rank != LastRank) {
+      Signal.Start();
+      for (int iCheck = 0; iCheck < 10; ++iCheck) {
+        EXPECT_FALSE(Signal.Check());
+      }
+      int Dummy = iRound;
+      MPI_Send(&Dummy, 1, MPI_INT, LastRank, 0, Comm);
+    } else {
+      for (int OtherRank = 0; OtherRank < LastRank; ++OtherRank) {
+        int Dummy;
+        MPI_Recv(&Dummy, 1, MPI_INT, OtherRank, 0, Comm, MPI_STATUS_IGNORE);
+        EXPECT_EQ(Dummy, iRound);
+      }
+      Signal.Start();
+    }
+    while (!Signal.Check()) {}
+  }
+
+}
+
+}
+
+TEST_F(CommunicationOpsTests, SignalTree) {
+
+  ASSERT_GE(TestComm().Size(), 13);
+
+  for (int Size : {1, 2, 5, 8, 13}) {
+    ovk::comm Comm = ovk::CreateSubsetComm(TestComm(), TestComm().Rank() < Size);
+    if (Comm) {
+      TestSignal(Comm, ovk::core::signal_algorithm::TREE);
+    }
+  }
+
+  TestSignal(TestComm(), ovk::core::signal_algorithm::TREE);
+
+}
+
+#ifdef OVK_HAVE_MPI_IBARRIER
+TEST_F(CommunicationOpsTests, SignalIbarrier) {
+
+  ASSERT_GE(TestComm().Size(), 5);
+
+  ovk::comm CommOfSize5 = ovk::CreateSubsetComm(TestComm(), TestComm().Rank() < 5);
+  if (CommOfSize5) {
+    TestSignal(CommOfSize5, ovk::core::signal_algorithm::IBARRIER);
+  }
+
+  TestSignal(TestComm(), ovk::core::signal_algorithm::IBARRIER);
+
+}
+#endif
+
+TEST_F(CommunicationOpsTests, DynamicHandshake) {
+
+  ASSERT_GE(TestComm().Size(), 4);
+
+  int Rank = TestComm().Rank();
+  int Size = TestComm().Size();
+
+  // Each rank sends to the next two ranks (cyclically)
+  ovk::array<int> SendToRanks({2});
+  SendToRanks(0) = (Rank+1) % Size;
+  SendToRanks(1) = (Rank+2) % Size;
+
+  ovk::array<int> RecvFromRanks = ovk::core::DynamicHandshake(TestComm(), SendToRanks);
+
+  EXPECT_THAT(RecvFromRanks, testing::UnorderedElementsAre((Rank+Size-1) % Size, (Rank+Size-2) %
+    Size));
+
+}
+
+TEST_F(CommunicationOpsTests, DuplicateComms) {
+
+  ASSERT_GE(TestComm().Size(), 8);
+
+  // Overlapping subsets of different sizes
+  ovk::array<ovk::comm> Comms;
+  for (int Size : {2, 5, 8}) {
+    ovk::comm Comm = ovk::CreateSubsetComm(TestComm(), TestComm().Rank() < Size);
+    if (Comm) Comms.Append(std::move(Comm));
+  }
+
+  ovk::array<ovk::comm_view> CommViews;
+  for (auto &Comm : Comms) {
+    CommViews.Append(Comm);
+  }
+  CommViews.Append(TestComm());
+
+  ovk::array<ovk::comm> DuplicatedComms = ovk::core::DuplicateComms(CommViews);
+
+  ASSERT_EQ(DuplicatedComms.Count(), CommViews.Count());
+  for (long long iComm = 0; iComm < CommViews.Count(); ++iComm) {
+    const ovk::comm &DuplicatedComm = DuplicatedComms(iComm);
+    ASSERT_TRUE(static_cast<bool>(DuplicatedComm));
+    int Result;
+    MPI_Comm_compare(DuplicatedComm, CommViews(iComm), &Result);
+    EXPECT_EQ(Result, MPI_CONGRUENT);
+  }
+
+}
+
+TEST_F(CommunicationOpsTests, MessageAggregator) {
+
+  ASSERT_GE(TestComm().Size(), 4);
+
+  int Rank = TestComm().Rank();
+  int Size = TestComm().Size();
+
+  // Each rank sends to the next three ranks (cyclically), except that ranks 0 mod 4 send nothing
+  // and ranks 3 mod 4 receive nothing. Some destinations get no records
+  auto Sends = [Size](int SendRank, int RecvRank) -> bool {
+    int Offset = (RecvRank - SendRank + Size) % Size;
+    return SendRank % 4 != 0 && RecvRank % 4 != 3 && Offset >= 1 && Offset <= 3;
+  };
+  auto NumRecords = [](int SendRank, int RecvRank) -> int {
+    return (SendRank + RecvRank) % 3;
+  };
+
+  // Two aggregators on the same comm with different tags, exchanging one after the other
+  for (int Tag : {0, 1}) {
+    ovk::core::message_aggregator<long long> Messages(TestComm(), Tag);
+    for (int OtherRank = 0; OtherRank < Size; ++OtherRank) {
+      if (Sends(Rank, OtherRank)) {
+        Messages.AddDestination(OtherRank);
+        for (int iRecord = 0; iRecord < NumRecords(Rank, OtherRank); ++iRecord) {
+          Messages.Append(OtherRank, 100*(Tag*Size+Rank) + iRecord);
+        }
+      }
+      if (Sends(OtherRank, Rank)) {
+        Messages.AddSource(OtherRank);
+      }
+    }
+    Messages.Exchange();
+    for (int OtherRank = 0; OtherRank < Size; ++OtherRank) {
+      if (Sends(OtherRank, Rank)) {
+        ovk::array_view<const long long> Records = Messages.Received(OtherRank);
+        ASSERT_EQ(Records.Count(), NumRecords(OtherRank, Rank));
+        for (int iRecord = 0; iRecord < NumRecords(OtherRank, Rank); ++iRecord) {
+          EXPECT_EQ(Records(iRecord), 100*(Tag*Size+OtherRank) + iRecord);
+        }
+      }
+    }
+  }
+
+}
+
+TEST_F(CommunicationOpsTests, SparseExchange) {
+
+  ASSERT_GE(TestComm().Size(), 4);
+
+  int Rank = TestComm().Rank();
+  int Size = TestComm().Size();
+
+  // Rank r sends to the next r mod 3 ranks (cyclically), so some ranks send nothing and sends
+  // aren't matched by sends in the other direction. Some of the sent arrays are empty
+  auto Sends = [Size](int SendRank, int RecvRank) -> bool {
+    int Offset = (RecvRank - SendRank + Size) % Size;
+    return Offset >= 1 && Offset <= SendRank % 3;
+  };
+  auto NumValues = [](int SendRank, int RecvRank) -> int {
+    return (SendRank + 2*RecvRank) % 4;
+  };
+
+  // Repeated calls on the same comm with nothing in between
+  for (int iRound = 0; iRound < 3; ++iRound) {
+    ovk::map<int,ovk::array<long long>> SendData;
+    for (int OtherRank = 0; OtherRank < Size; ++OtherRank) {
+      if (Sends(Rank, OtherRank)) {
+        ovk::array<long long> &Values = SendData.Insert(OtherRank);
+        for (int iValue = 0; iValue < NumValues(Rank, OtherRank); ++iValue) {
+          Values.Append(100*(iRound*Size+Rank) + iValue);
+        }
+      }
+    }
+    ovk::map<int,ovk::array<long long>> RecvData = ovk::core::SparseExchange(TestComm(),
+      SendData);
+    int NumSources = 0;
+    for (int OtherRank = 0; OtherRank < Size; ++OtherRank) {
+      if (Sends(OtherRank, Rank)) {
+        ++NumSources;
+        ASSERT_TRUE(RecvData.Contains(OtherRank));
+        const ovk::array<long long> &Values = RecvData(OtherRank);
+        ASSERT_EQ(Values.Count(), NumValues(OtherRank, Rank));
+        for (int iValue = 0; iValue < NumValues(OtherRank, Rank); ++iValue) {
+          EXPECT_EQ(Values(iValue), 100*(iRound*Size+OtherRank) + iValue);
+        }
+      }
+    }
+    EXPECT_EQ(RecvData.Count(), NumSources);
+  }
+
+}
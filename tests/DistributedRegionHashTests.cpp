@@ -0,0 +1,170 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/DistributedRegionHash.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/ArrayView.hpp>
+#include <ovk/core/Box.hpp>
+#include <ovk/core/Comm.hpp>
+#include <ovk/core/Elem.hpp>
+#include <ovk/core/HashSet.hpp>
+#include <ovk/core/Map.hpp>
+#include <ovk/core/Tuple.hpp>
+
+#include <mpi.h>
+
+#include <random>
+
+class DistributedRegionHashTests : public tests::mpi_test {};
+
+namespace {
+
+using hash = ovk::core::distributed_region_hash<ovk::box>;
+using retrieved_bins = ovk::core::distributed_region_hash_retrieved_bins<ovk::box>;
+
+struct global_region {
+  ovk::box Box;
+  int Rank;
+};
+
+// Small 2D boxes bunched up towards the lower x end of the domain, with a different number on each
+// rank (including none on some ranks). Every rank generates the regions of every other rank, so
+// that results can be checked locally
+ovk::array<global_region> SkewedRegions(int NumRanks) {
+
+  ovk::array<global_region> Regions;
+
+  for (int Rank = 0; Rank < NumRanks; ++Rank) {
+    int NumRegions = Rank % 3 == 0 ? 0 : 100*(Rank % 4 + 1);
+    std::mt19937 Generator(Rank);
+    std::uniform_real_distribution<double> Distribution(0., 1.);
+    for (int iRegion = 0; iRegion < NumRegions; ++iRegion) {
+      double U = Distribution(Generator);
+      double V = Distribution(Generator);
+      ovk::tuple<double> Center = {U*U*U, 0.2*V, 0.};
+      ovk::box Box = ovk::MakeEmptyBox(2);
+      for (int iDim = 0; iDim < 2; ++iDim) {
+        Box.Begin(iDim) = Center(iDim) - 0.005;
+        Box.End(iDim) = Center(iDim) + 0.005;
+      }
+      Regions.Append({Box, Rank});
+    }
+  }
+
+  return Regions;
+
+}
+
+ovk::tuple<double> BoxCenter(const ovk::box &Box) {
+
+  return {0.5*(Box.Begin(0)+Box.End(0)), 0.5*(Box.Begin(1)+Box.End(1)), 0.};
+
+}
+
+bool BoxContainsPoint(const ovk::box &Box, const ovk::tuple<double> &Point) {
+
+  return Point(0) >= Box.Begin(0) && Point(0) <= Box.End(0) && Point(1) >= Box.Begin(1) &&
+    Point(1) <= Box.End(1);
+
+}
+
+hash CreateHash(ovk::comm_view Comm, ovk::array_view<const global_region> GlobalRegions) {
+
+  ovk::array<ovk::box> LocalRegions;
+  for (auto &Region : GlobalRegions) {
+    if (Region.Rank == Comm.Rank()) {
+      LocalRegions.Append(Region.Box);
+    }
+  }
+
+  return {2, Comm, LocalRegions};
+
+}
+
+}
+
+TEST_F(DistributedRegionHashTests, PartitionBalance) {
+
+  ASSERT_GE(TestComm().Size(), 12);
+
+  for (int Size : {3, 5, 7, 12}) {
+    ovk::comm Comm = ovk::CreateSubsetComm(TestComm(), TestComm().Rank() < Size);
+    if (Comm) {
+      ovk::array<global_region> GlobalRegions = SkewedRegions(Size);
+      hash Hash = CreateHash(Comm, GlobalRegions);
+      ovk::array<int> NumRegionsForRank({Size}, 0);
+      for (auto &Region : GlobalRegions) {
+        ovk::elem<int,2> BinID = Hash.MapToBin(BoxCenter(Region.Box));
+        ASSERT_GE(BinID(0), 0);
+        ASSERT_LT(BinID(0), Size);
+        ++NumRegionsForRank(BinID(0));
+      }
+      // Splitting the extents evenly would put most of the regions on the lowest few ranks
+      double AvgNumRegions = double(GlobalRegions.Count())/double(Size);
+      for (int Rank = 0; Rank < Size; ++Rank) {
+        EXPECT_GT(NumRegionsForRank(Rank), 0);
+        EXPECT_LE(double(NumRegionsForRank(Rank)), 2.*AvgNumRegions);
+      }
+    }
+  }
+
+}
+
+TEST_F(DistributedRegionHashTests, RetrieveBins) {
+
+  ASSERT_GE(TestComm().Size(), 12);
+
+  for (int Size : {3, 5, 7, 12}) {
+    ovk::comm Comm = ovk::CreateSubsetComm(TestComm(), TestComm().Rank() < Size);
+    if (Comm) {
+      ovk::array<global_region> GlobalRegions = SkewedRegions(Size);
+      hash Hash = CreateHash(Comm, GlobalRegions);
+      // Query the region centers plus some points spread over the whole domain, dividing them
+      // unevenly among ranks
+      ovk::array<ovk::tuple<double>> Points;
+      for (long long iRegion = 0; iRegion < GlobalRegions.Count(); ++iRegion) {
+        if (iRegion % (Size+1) == Comm.Rank()) {
+          Points.Append(BoxCenter(GlobalRegions(iRegion).Box));
+        }
+      }
+      for (int iPoint = 0; iPoint < 10*Comm.Rank(); ++iPoint) {
+        Points.Append({double(iPoint)/double(10*Comm.Rank()), 0.1, 0.});
+      }
+      ovk::array<ovk::elem<int,2>> PointBinIDs;
+      ovk::hash_set<ovk::elem<int,2>> UniqueBinIDs;
+      for (auto &Point : Points) {
+        ovk::elem<int,2> BinID = Hash.MapToBin(Point);
+        PointBinIDs.Append(BinID);
+        UniqueBinIDs.Insert(BinID);
+      }
+      ovk::array<ovk::elem<int,2>> BinIDs(UniqueBinIDs);
+      ovk::map<int,retrieved_bins> RetrievedBins = Hash.RetrieveBins(BinIDs);
+      for (long long iPoint = 0; iPoint < Points.Count(); ++iPoint) {
+        const ovk::tuple<double> &Point = Points(iPoint);
+        const ovk::elem<int,2> &BinID = PointBinIDs(iPoint);
+        ASSERT_TRUE(RetrievedBins.Contains(BinID(0)));
+        const retrieved_bins &Bins = RetrievedBins(BinID(0));
+        // Every region containing the point must be in its bin, along with the rank it came from
+        for (auto &Region : GlobalRegions) {
+          if (!BoxContainsPoint(Region.Box, Point)) continue;
+          bool Found = false;
+          for (int iRegion : Bins.BinRegionIndices(BinID(1))) {
+            const auto &RegionData = Bins.RegionData(iRegion);
+            if (RegionData.Region() == Region.Box) {
+              EXPECT_EQ(RegionData.Rank(), Region.Rank);
+              Found = true;
+            }
+          }
+          EXPECT_TRUE(Found);
+        }
+      }
+    }
+  }
+
+}
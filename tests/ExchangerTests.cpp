@@ -17,7 +17,10 @@
 #include <ovk/core/ConnectivityN.hpp>
 #include <ovk/core/Domain.hpp>
 #include <ovk/core/Field.hpp>
+#include <ovk/core/ForEach.hpp>
 #include <ovk/core/Grid.hpp>
+#include <ovk/core/Indexer.hpp>
+#include <ovk/core/Math.hpp>
 #include <ovk/core/Range.hpp>
 #include <ovk/core/Tuple.hpp>
 
@@ -33,6 +36,442 @@ class ExchangerTests : public tests::mpi_test {};
 using tests::Interface2DManualConnectivity;
 using tests::Interface3DManualConnectivity;
 
+namespace {
+
+// Copies full connectivity into compact storage
+void MakeCompact(ovk::connectivity_m &ConnectivityM, ovk::interp_coefs_storage InterpCoefsStorage) {
+
+  ovk::range_indexer_c<long long> GlobalIndexer(ConnectivityM.Grid().GlobalRange());
+
+  long long NumDonors = ConnectivityM.Size();
+  int StencilSize = ConnectivityM.MaxStencilSize();
+
+  ovk::array<long long> LowerCorners({NumDonors});
+  ovk::array<long long> DestinationIndices({NumDonors});
+  for (long long iDonor = 0; iDonor < NumDonors; ++iDonor) {
+    LowerCorners(iDonor) = GlobalIndexer.ToIndex(ConnectivityM.DonorLowerCorner(iDonor));
+    DestinationIndices(iDonor) = ConnectivityM.DestinationIndex(iDonor);
+  }
+  ovk::array<double,2> Coords = ConnectivityM.Coords();
+  ovk::array<double,3> InterpCoefs = ConnectivityM.InterpCoefs();
+
+  ConnectivityM.ResizeCompact(NumDonors, StencilSize, InterpCoefsStorage);
+  EXPECT_TRUE(ConnectivityM.Compact());
+
+  *ConnectivityM.EditLowerCorners() = LowerCorners;
+  *ConnectivityM.EditCoords() = Coords;
+  if (InterpCoefsStorage == ovk::interp_coefs_storage::FLOAT) {
+    auto FloatInterpCoefsEditHandle = ConnectivityM.EditFloatInterpCoefs();
+    ovk::array<float,3> &FloatInterpCoefs = *FloatInterpCoefsEditHandle;
+    for (long long iValue = 0; iValue < InterpCoefs.Count(); ++iValue) {
+      FloatInterpCoefs[iValue] = float(InterpCoefs[iValue]);
+    }
+  }
+  *ConnectivityM.EditDestinationIndices() = DestinationIndices;
+
+  for (long long iDonor = 0; iDonor < NumDonors; ++iDonor) {
+    for (int iDim = 0; iDim < ovk::MAX_DIMS; ++iDim) {
+      for (int iPoint = 0; iPoint < StencilSize; ++iPoint) {
+        double Coef = ConnectivityM.DonorInterpCoef(iDim,iPoint,iDonor);
+        if (InterpCoefsStorage == ovk::interp_coefs_storage::FLOAT) {
+          EXPECT_EQ(Coef, double(float(InterpCoefs(iDim,iPoint,iDonor))));
+        } else {
+          EXPECT_NEAR(Coef, InterpCoefs(iDim,iPoint,iDonor), 1.e-12);
+        }
+      }
+    }
+  }
+
+}
+
+void MakeCompact(ovk::connectivity_n &ConnectivityN) {
+
+  ovk::range_indexer_c<long long> SourceGlobalIndexer(ConnectivityN.SourceGridInfo().
+    GlobalRange());
+
+  long long NumReceivers = ConnectivityN.Size();
+
+  ovk::array<long long> PointIndices({NumReceivers});
+  ovk::array<long long> SourceIndices({NumReceivers});
+  for (long long iReceiver = 0; iReceiver < NumReceivers; ++iReceiver) {
+    PointIndices(iReceiver) = ConnectivityN.PointIndex(iReceiver);
+    SourceIndices(iReceiver) = SourceGlobalIndexer.ToIndex(ConnectivityN.Source(iReceiver));
+  }
+
+  ConnectivityN.ResizeCompact(NumReceivers);
+  EXPECT_TRUE(ConnectivityN.Compact());
+
+  *ConnectivityN.EditPointIndices() = PointIndices;
+  *ConnectivityN.EditSourceIndices() = SourceIndices;
+
+}
+
+// Field, donor, and receiver values on either side of the interface in
+// Interface2DManualConnectivity; the field is U*V, with U and V the point indices along a single
+// combined grid
+struct interface_2d_values {
+  ovk::field<double> LowerField, UpperField;
+  ovk::array<double> LowerDonors, UpperDonors;
+  ovk::array<double> LowerReceivers, UpperReceivers;
+};
+
+// Values before the exchange (receiver points zeroed)
+interface_2d_values InitialInterface2DValues(const ovk::domain &Domain) {
+
+  interface_2d_values Values;
+
+  ovk::tuple<int> LowerSize = Domain.GridInfo(1).GlobalRange().Size();
+
+  if (Domain.GridIsLocal(1)) {
+    const ovk::range &LocalRange = Domain.Grid(1).LocalRange();
+    Values.LowerField.Resize(LocalRange, 0.);
+    for (int j = LocalRange.Begin(1); j < ovk::Min(LocalRange.End(1),LowerSize(1)-1); ++j) {
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        double U = double(i);
+        double V = double(j);
+        Values.LowerField(i,j,0) = U*V;
+      }
+    }
+    if (LocalRange.End(1) == LowerSize(1)) {
+      Values.LowerDonors.Resize({LocalRange.Size(0)}, 0.);
+      Values.LowerReceivers.Resize({LocalRange.Size(0)}, 0.);
+    }
+  }
+
+  if (Domain.GridIsLocal(2)) {
+    const ovk::range &LocalRange = Domain.Grid(2).LocalRange();
+    Values.UpperField.Resize(LocalRange, 0.);
+    for (int j = ovk::Max(LocalRange.Begin(1), 1); j < LocalRange.End(1); ++j) {
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        double U = double(i);
+        double V = double(LowerSize(1)-2+j);
+        Values.UpperField(i,j,0) = U*V;
+      }
+    }
+    if (LocalRange.Begin(1) == 0) {
+      Values.UpperDonors.Resize({LocalRange.Size(0)}, 0.);
+      Values.UpperReceivers.Resize({LocalRange.Size(0)}, 0.);
+    }
+  }
+
+  return Values;
+
+}
+
+// Values after exchanging with the fixture's connectivity (stencil size 1)
+interface_2d_values ExpectedInterface2DValues(const ovk::domain &Domain) {
+
+  interface_2d_values Values;
+
+  ovk::tuple<int> LowerSize = Domain.GridInfo(1).GlobalRange().Size();
+
+  if (Domain.GridIsLocal(1)) {
+    const ovk::range &LocalRange = Domain.Grid(1).LocalRange();
+    Values.LowerField.Resize(LocalRange);
+    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        double U = double(i);
+        double V = double(j);
+        Values.LowerField(i,j,0) = U*V;
+      }
+    }
+    if (LocalRange.End(1) == LowerSize(1)) {
+      Values.LowerDonors.Resize({LocalRange.Size(0)});
+      Values.LowerReceivers.Resize({LocalRange.Size(0)});
+      long long iDonorOrReceiver = 0;
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        double U = double(i);
+        Values.LowerDonors(iDonorOrReceiver) = U*double(LowerSize(1)-2);
+        Values.LowerReceivers(iDonorOrReceiver) = U*double(LowerSize(1)-1);
+        ++iDonorOrReceiver;
+      }
+    }
+  }
+
+  if (Domain.GridIsLocal(2)) {
+    const ovk::range &LocalRange = Domain.Grid(2).LocalRange();
+    Values.UpperField.Resize(LocalRange);
+    for (int j = LocalRange.Begin(1); j < LocalRange.End(1); ++j) {
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        double U = double(i);
+        double V = double(LowerSize(1)-2+j);
+        Values.UpperField(i,j,0) = U*V;
+      }
+    }
+    if (LocalRange.Begin(1) == 0) {
+      Values.UpperDonors.Resize({LocalRange.Size(0)});
+      Values.UpperReceivers.Resize({LocalRange.Size(0)});
+      long long iDonorOrReceiver = 0;
+      for (int i = LocalRange.Begin(0); i < LocalRange.End(0); ++i) {
+        double U = double(i);
+        Values.UpperDonors(iDonorOrReceiver) = U*double(LowerSize(1)-1);
+        Values.UpperReceivers(iDonorOrReceiver) = U*double(LowerSize(1)-2);
+        ++iDonorOrReceiver;
+      }
+    }
+  }
+
+  return Values;
+
+}
+
+// Collects, sends, receives, and disperses across the interface using the domain's current
+// connectivity; with a tiled layout the field values are copied into tiled storage for the
+// exchange and copied back afterwards
+void ExchangeInterface2D(const ovk::domain &Domain, interface_2d_values &Values,
+  ovk::array_layout Layout=ovk::array_layout::COLUMN_MAJOR) {
+
+  bool LowerIsLocal = Domain.GridIsLocal(1);
+  bool UpperIsLocal = Domain.GridIsLocal(2);
+
+  bool Tiled = Layout == ovk::array_layout::TILED;
+
+  auto ToTiled = [](const ovk::field<double> &Field) -> ovk::tiled_field<double> {
+    ovk::tiled_field<double> TiledField(Field.Extents());
+    ovk::core::ForEach(Field.Extents(), [&](const ovk::tuple<int> &Point) {
+      TiledField(Point) = Field(Point);
+    });
+    return TiledField;
+  };
+
+  auto FromTiled = [](const ovk::tiled_field<double> &TiledField, ovk::field<double> &Field) {
+    ovk::core::ForEach(Field.Extents(), [&](const ovk::tuple<int> &Point) {
+      Field(Point) = TiledField(Point);
+    });
+  };
+
+  ovk::tiled_field<double> LowerTiledField, UpperTiledField;
+  if (Tiled && LowerIsLocal) LowerTiledField = ToTiled(Values.LowerField);
+  if (Tiled && UpperIsLocal) UpperTiledField = ToTiled(Values.UpperField);
+
+  double *LowerFieldData = Tiled ? LowerTiledField.Data() : Values.LowerField.Data();
+  double *UpperFieldData = Tiled ? UpperTiledField.Data() : Values.UpperField.Data();
+
+  ovk::exchanger Exchanger = ovk::CreateExchanger(Domain.SharedContext());
+
+  Exchanger.Bind(Domain, ovk::exchanger::bindings()
+    .SetConnectivityComponentID(4)
+  );
+
+  if (LowerIsLocal) {
+    const ovk::range &LocalRange = Domain.Grid(1).LocalRange();
+    Exchanger.CreateCollect({1,2}, 1, ovk::collect_op::INTERPOLATE, ovk::data_type::DOUBLE, 1,
+      LocalRange, Layout);
+    Exchanger.CreateSend({1,2}, 1, ovk::data_type::DOUBLE, 1, 1);
+    Exchanger.CreateReceive({2,1}, 1, ovk::data_type::DOUBLE, 1, 1);
+    Exchanger.CreateDisperse({2,1}, 1, ovk::disperse_op::OVERWRITE, ovk::data_type::DOUBLE, 1,
+      LocalRange, Layout);
+  }
+
+  if (UpperIsLocal) {
+    const ovk::range &LocalRange = Domain.Grid(2).LocalRange();
+    Exchanger.CreateCollect({2,1}, 1, ovk::collect_op::INTERPOLATE, ovk::data_type::DOUBLE, 1,
+      LocalRange, Layout);
+    Exchanger.CreateSend({2,1}, 1, ovk::data_type::DOUBLE, 1, 1);
+    Exchanger.CreateReceive({1,2}, 1, ovk::data_type::DOUBLE, 1, 1);
+    Exchanger.CreateDisperse({1,2}, 1, ovk::disperse_op::OVERWRITE, ovk::data_type::DOUBLE, 1,
+      LocalRange, Layout);
+  }
+
+  if (LowerIsLocal) {
+    const double *FieldValues = LowerFieldData;
+    double *DonorValues = Values.LowerDonors.Data();
+    Exchanger.Collect({1,2}, 1, &FieldValues, &DonorValues);
+  }
+
+  if (UpperIsLocal) {
+    const double *FieldValues = UpperFieldData;
+    double *DonorValues = Values.UpperDonors.Data();
+    Exchanger.Collect({2,1}, 1, &FieldValues, &DonorValues);
+  }
+
+  ovk::array<ovk::request> Requests;
+
+  if (LowerIsLocal) {
+    double *ReceiverValues = Values.LowerReceivers.Data();
+    ovk::request Request = Exchanger.Receive({2,1}, 1, &ReceiverValues);
+    Requests.Append(std::move(Request));
+  }
+
+  if (UpperIsLocal) {
+    double *ReceiverValues = Values.UpperReceivers.Data();
+    ovk::request Request = Exchanger.Receive({1,2}, 1, &ReceiverValues);
+    Requests.Append(std::move(Request));
+  }
+
+  if (LowerIsLocal) {
+    const double *DonorValues = Values.LowerDonors.Data();
+    ovk::request Request = Exchanger.Send({1,2}, 1, &DonorValues);
+    Requests.Append(std::move(Request));
+  }
+
+  if (UpperIsLocal) {
+    const double *DonorValues = Values.UpperDonors.Data();
+    ovk::request Request = Exchanger.Send({2,1}, 1, &DonorValues);
+    Requests.Append(std::move(Request));
+  }
+
+  ovk::WaitAll(Requests);
+
+  if (LowerIsLocal) {
+    const double *ReceiverValues = Values.LowerReceivers.Data();
+    double *FieldValues = LowerFieldData;
+    Exchanger.Disperse({2,1}, 1, &ReceiverValues, &FieldValues);
+  }
+
+  if (UpperIsLocal) {
+    const double *ReceiverValues = Values.UpperReceivers.Data();
+    double *FieldValues = UpperFieldData;
+    Exchanger.Disperse({1,2}, 1, &ReceiverValues, &FieldValues);
+  }
+
+  if (Tiled && LowerIsLocal) FromTiled(LowerTiledField, Values.LowerField);
+  if (Tiled && UpperIsLocal) FromTiled(UpperTiledField, Values.UpperField);
+
+}
+
+void ExpectInterface2DValuesEqual(const interface_2d_values &Values, const interface_2d_values
+  &ExpectedValues) {
+
+  EXPECT_THAT(Values.LowerDonors, ElementsAreArray(ExpectedValues.LowerDonors));
+  EXPECT_THAT(Values.UpperDonors, ElementsAreArray(ExpectedValues.UpperDonors));
+  EXPECT_THAT(Values.LowerReceivers, ElementsAreArray(ExpectedValues.LowerReceivers));
+  EXPECT_THAT(Values.UpperReceivers, ElementsAreArray(ExpectedValues.UpperReceivers));
+  EXPECT_THAT(Values.LowerField, ElementsAreArray(ExpectedValues.LowerField));
+  EXPECT_THAT(Values.UpperField, ElementsAreArray(ExpectedValues.UpperField));
+
+}
+
+template <typename ArrayType> void ExpectValuesNear(const ArrayType &Values, const ArrayType
+  &ExpectedValues, double Tolerance) {
+  ASSERT_EQ(Values.Count(), ExpectedValues.Count());
+  for (long long iValue = 0; iValue < Values.Count(); ++iValue) {
+    EXPECT_NEAR(Values[iValue], ExpectedValues[iValue], Tolerance);
+  }
+}
+
+void ExpectInterface2DValuesNear(const interface_2d_values &Values, const interface_2d_values
+  &ExpectedValues, double Tolerance) {
+
+  ExpectValuesNear(Values.LowerDonors, ExpectedValues.LowerDonors, Tolerance);
+  ExpectValuesNear(Values.UpperDonors, ExpectedValues.UpperDonors, Tolerance);
+  ExpectValuesNear(Values.LowerReceivers, ExpectedValues.LowerReceivers, Tolerance);
+  ExpectValuesNear(Values.UpperReceivers, ExpectedValues.UpperReceivers, Tolerance);
+  ExpectValuesNear(Values.LowerField, ExpectedValues.LowerField, Tolerance);
+  ExpectValuesNear(Values.UpperField, ExpectedValues.UpperField, Tolerance);
+
+}
+
+// Wide stencil for the donor at i along the interface: first point along i (clamped to the donor
+// rank's local range) and the interpolation coords inside the stencil
+int WideStencilBeginI(int i, int StencilSize, const ovk::range &LocalRange) {
+  return ovk::Min(ovk::Max(i-(StencilSize-1)/2, LocalRange.Begin(0)), LocalRange.End(0)-
+    StencilSize);
+}
+ovk::elem<double,2> WideStencilCoords(int i) {
+  return {0.1 + 0.8*double(i % 7)/6., 0.35};
+}
+
+// Replaces the fixture's donors with StencilSize^2 stencils and Lagrange coefficients for a
+// varying position inside each stencil. Collect only sends to ranks whose own donors overlap the
+// sender, so the stencils are kept inside the donor rank's local range
+void WidenInterface2DStencils(ovk::domain &Domain, int StencilSize) {
+
+  ovk::tuple<int> LowerSize = Domain.GridInfo(1).GlobalRange().Size();
+
+  auto ConnectivityComponentEditHandle = Domain.EditComponent<ovk::connectivity_component>(4);
+  ovk::connectivity_component &ConnectivityComponent = *ConnectivityComponentEditHandle;
+
+  auto WidenStencils = [StencilSize](ovk::connectivity_m &ConnectivityM, int DonorRowBegin) {
+    const ovk::range &LocalRange = ConnectivityM.Grid().LocalRange();
+    long long NumDonors = ConnectivityM.Size();
+    ovk::array<int,2> Destinations = ConnectivityM.Destinations();
+    ovk::array<int> DestinationRanks = ConnectivityM.DestinationRanks();
+    ovk::array<int,3> OldExtents = ConnectivityM.Extents();
+    ConnectivityM.Resize(NumDonors, StencilSize);
+    auto ExtentsEditHandle = ConnectivityM.EditExtents();
+    auto CoordsEditHandle = ConnectivityM.EditCoords();
+    auto InterpCoefsEditHandle = ConnectivityM.EditInterpCoefs();
+    auto DestinationsEditHandle = ConnectivityM.EditDestinations();
+    auto DestinationRanksEditHandle = ConnectivityM.EditDestinationRanks();
+    ovk::array<int,3> &Extents = *ExtentsEditHandle;
+    ovk::array<double,2> &Coords = *CoordsEditHandle;
+    ovk::array<double,3> &InterpCoefs = *InterpCoefsEditHandle;
+    for (long long iDonor = 0; iDonor < NumDonors; ++iDonor) {
+      int i = OldExtents(0,0,iDonor);
+      Extents(0,0,iDonor) = WideStencilBeginI(i, StencilSize, LocalRange);
+      Extents(0,1,iDonor) = DonorRowBegin;
+      Extents(0,2,iDonor) = 0;
+      Extents(1,0,iDonor) = Extents(0,0,iDonor)+StencilSize;
+      Extents(1,1,iDonor) = Extents(0,1,iDonor)+StencilSize;
+      Extents(1,2,iDonor) = 1;
+      ovk::elem<double,2> StencilCoords = WideStencilCoords(i);
+      Coords(0,iDonor) = StencilCoords(0);
+      Coords(1,iDonor) = StencilCoords(1);
+      Coords(2,iDonor) = 0.;
+      for (int iDim = 0; iDim < 2; ++iDim) {
+        double Coefs[4];
+        ovk::core::LagrangeInterpCoefs(StencilSize, Coords(iDim,iDonor), Coefs);
+        for (int iPoint = 0; iPoint < StencilSize; ++iPoint) {
+          InterpCoefs(iDim,iPoint,iDonor) = Coefs[iPoint];
+        }
+      }
+      InterpCoefs(2,0,iDonor) = 1.;
+      for (int iPoint = 1; iPoint < StencilSize; ++iPoint) {
+        InterpCoefs(2,iPoint,iDonor) = 0.;
+      }
+    }
+    *DestinationsEditHandle = Destinations;
+    *DestinationRanksEditHandle = DestinationRanks;
+  };
+
+  // Stencils stay clear of the receiver rows
+  if (Domain.GridIsLocal(1)) {
+    const ovk::range &LocalRange = Domain.Grid(1).LocalRange();
+    int DonorRowEnd = ovk::Min(LocalRange.End(1), LowerSize(1)-1);
+    WidenStencils(*ConnectivityComponent.EditConnectivityM({1,2}), DonorRowEnd-StencilSize);
+  }
+  if (Domain.GridIsLocal(2)) {
+    const ovk::range &LocalRange = Domain.Grid(2).LocalRange();
+    WidenStencils(*ConnectivityComponent.EditConnectivityM({2,1}), ovk::Max(LocalRange.Begin(1),
+      1));
+  }
+
+}
+
+// Fixture's interface with StencilSize^2 donor stencils
+ovk::domain Interface2DWideStencils(ovk::comm_view Comm, const ovk::tuple<int> &Size, int
+  StencilSize) {
+
+  ovk::domain Domain = Interface2DManualConnectivity(Comm, {{-1.,-1.,0.}, {1.,1.,0.}}, Size,
+    {false, false, false}, ovk::periodic_storage::UNIQUE);
+
+  WidenInterface2DStencils(Domain, StencilSize);
+
+  return Domain;
+
+}
+
+// Lower grid's donors store single precision coefficients; upper grid's donors compute them from
+// the coords
+void MakeInterface2DCompact(ovk::domain &Domain) {
+
+  auto ConnectivityComponentEditHandle = Domain.EditComponent<ovk::connectivity_component>(4);
+  ovk::connectivity_component &ConnectivityComponent = *ConnectivityComponentEditHandle;
+  if (Domain.GridIsLocal(1)) {
+    MakeCompact(*ConnectivityComponent.EditConnectivityM({1,2}), ovk::interp_coefs_storage::FLOAT);
+    MakeCompact(*ConnectivityComponent.EditConnectivityN({2,1}));
+  }
+  if (Domain.GridIsLocal(2)) {
+    MakeCompact(*ConnectivityComponent.EditConnectivityM({2,1}),
+      ovk::interp_coefs_storage::LAGRANGE);
+    MakeCompact(*ConnectivityComponent.EditConnectivityN({1,2}));
+  }
+
+}
+
+}
+
 TEST_F(ExchangerTests, Exchange2D) {
 
   ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 16);
@@ -257,6 +696,122 @@ TEST_F(ExchangerTests, Exchange2D) {
 
 }
 
+TEST_F(ExchangerTests, Compact2D) {
+
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 16);
+
+  if (Comm) {
+
+    ovk::tuple<int> Size = {32,32,1};
+
+    ovk::domain Domain = Interface2DManualConnectivity(Comm, {{-1.,-1.,0.}, {1.,1.,0.}}, Size,
+      {false, false, false}, ovk::periodic_storage::UNIQUE);
+
+    MakeInterface2DCompact(Domain);
+
+    interface_2d_values Values = InitialInterface2DValues(Domain);
+    interface_2d_values ExpectedValues = ExpectedInterface2DValues(Domain);
+
+    ExchangeInterface2D(Domain, Values);
+
+    ExpectInterface2DValuesEqual(Values, ExpectedValues);
+
+  }
+
+}
+
+TEST_F(ExchangerTests, CompactWideStencils2D) {
+
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 16);
+
+  if (Comm) {
+
+    ovk::tuple<int> Size = {32,32,1};
+
+    for (int StencilSize : {2, 4}) {
+
+      ovk::domain Domain = Interface2DWideStencils(Comm, Size, StencilSize);
+
+      interface_2d_values FullValues = InitialInterface2DValues(Domain);
+      ExchangeInterface2D(Domain, FullValues);
+
+      // Lagrange interpolation reproduces the bilinear field exactly; cubic stencils are centered
+      // on the second point
+      ovk::tuple<int> LowerSize = Domain.GridInfo(1).GlobalRange().Size();
+      auto ExpectDonorValues = [&](const ovk::array<double> &DonorValues, const ovk::elem<int,2>
+        &ConnectivityID, double OffsetV) {
+        const ovk::connectivity_m &ConnectivityM = Domain.Component<ovk::connectivity_component>(4).
+          ConnectivityM(ConnectivityID);
+        const ovk::array<int,3> &Extents = ConnectivityM.Extents();
+        const ovk::array<double,2> &Coords = ConnectivityM.Coords();
+        double Offset = double((StencilSize-1)/2);
+        for (long long iDonor = 0; iDonor < ConnectivityM.Size(); ++iDonor) {
+          double U = double(Extents(0,0,iDonor)) + Offset + Coords(0,iDonor);
+          double V = OffsetV + double(Extents(0,1,iDonor)) + Offset + Coords(1,iDonor);
+          EXPECT_NEAR(DonorValues(iDonor), U*V, 1.e-9);
+        }
+      };
+      if (Domain.GridIsLocal(1)) {
+        ExpectDonorValues(FullValues.LowerDonors, {1,2}, 0.);
+      }
+      if (Domain.GridIsLocal(2)) {
+        ExpectDonorValues(FullValues.UpperDonors, {2,1}, double(LowerSize(1)-2));
+      }
+
+      MakeInterface2DCompact(Domain);
+
+      interface_2d_values CompactValues = InitialInterface2DValues(Domain);
+      ExchangeInterface2D(Domain, CompactValues);
+
+      // Single precision coefficients on the lower grid; values are at most ~1000
+      ExpectInterface2DValuesNear(CompactValues, FullValues, 1.e-3);
+
+    }
+
+  }
+
+}
+
+TEST_F(ExchangerTests, Tiled2D) {
+
+  ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 16);
+
+  if (Comm) {
+
+    ovk::tuple<int> Size = {32,32,1};
+
+    // Fixture's connectivity
+    {
+      ovk::domain Domain = Interface2DManualConnectivity(Comm, {{-1.,-1.,0.}, {1.,1.,0.}}, Size,
+        {false, false, false}, ovk::periodic_storage::UNIQUE);
+
+      interface_2d_values Values = InitialInterface2DValues(Domain);
+      ExchangeInterface2D(Domain, Values, ovk::array_layout::TILED);
+
+      ExpectInterface2DValuesEqual(Values, ExpectedInterface2DValues(Domain));
+    }
+
+    // Wide stencils start one point before the donor along i, so most of them straddle a tile
+    // boundary; 4x4 stencils on the upper grid also straddle one along j
+    for (int StencilSize : {2, 4}) {
+
+      ovk::domain Domain = Interface2DWideStencils(Comm, Size, StencilSize);
+
+      interface_2d_values ColumnMajorValues = InitialInterface2DValues(Domain);
+      ExchangeInterface2D(Domain, ColumnMajorValues);
+
+      interface_2d_values TiledValues = InitialInterface2DValues(Domain);
+      ExchangeInterface2D(Domain, TiledValues, ovk::array_layout::TILED);
+
+      // Vertices are visited in a different order, so sums can differ in the last bits
+      ExpectInterface2DValuesNear(TiledValues, ColumnMajorValues, 1.e-10);
+
+    }
+
+  }
+
+}
+
 TEST_F(ExchangerTests, Exchange3D) {
 
   ovk::comm Comm = CreateSubsetComm(TestComm(), TestComm().Rank() < 64);
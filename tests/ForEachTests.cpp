@@ -10,6 +10,7 @@
 
 #include <ovk/core/Comm.hpp>
 #include <ovk/core/Elem.hpp>
+#include <ovk/core/Indexer.hpp>
 #include <ovk/core/Interval.hpp>
 #include <ovk/core/Vector.hpp>
 
@@ -116,4 +117,110 @@ TEST_F(ForEachTests, ForEachTupleInInterval) {
     EXPECT_THAT(Tuples[5], ElementsAre(1,3,5));
   }
 
+  // Multidimensional, tiled, tuple
+  {
+    ovk::interval<int,2> Interval({0,0}, {6,2});
+    ovk::core::vector<ovk::elem<int,2>> Tuples;
+    ovk::core::ForEach<ovk::array_layout::TILED>(Interval, [&](const ovk::elem<int,2> &Tuple) {
+      Tuples.Append(Tuple);
+    });
+    EXPECT_EQ(Tuples.Count(), 12);
+    EXPECT_THAT(Tuples[0], ElementsAre(0,0));
+    EXPECT_THAT(Tuples[3], ElementsAre(3,0));
+    EXPECT_THAT(Tuples[4], ElementsAre(0,1));
+    EXPECT_THAT(Tuples[7], ElementsAre(3,1));
+    EXPECT_THAT(Tuples[8], ElementsAre(4,0));
+    EXPECT_THAT(Tuples[9], ElementsAre(5,0));
+    EXPECT_THAT(Tuples[10], ElementsAre(4,1));
+    EXPECT_THAT(Tuples[11], ElementsAre(5,1));
+  }
+
+  // Multidimensional, tiled, tuple elements
+  {
+    ovk::interval<int,2> Interval({0,0}, {6,2});
+    ovk::core::vector<ovk::elem<int,2>> Tuples;
+    ovk::core::ForEach<ovk::array_layout::TILED>(Interval, [&](int i, int j) {
+      Tuples.Append(ovk::elem<int,2>(i,j));
+    });
+    EXPECT_EQ(Tuples.Count(), 12);
+    EXPECT_THAT(Tuples[3], ElementsAre(3,0));
+    EXPECT_THAT(Tuples[4], ElementsAre(0,1));
+    EXPECT_THAT(Tuples[8], ElementsAre(4,0));
+    EXPECT_THAT(Tuples[11], ElementsAre(5,1));
+  }
+
+}
+
+TEST_F(ForEachTests, ForEachInRange) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using indexer_row = ovk::indexer<long long, int, 3, ovk::array_layout::ROW_MAJOR>;
+  using indexer_col = ovk::indexer<long long, int, 3, ovk::array_layout::COLUMN_MAJOR>;
+  using indexer_tiled = ovk::indexer<long long, int, 3, ovk::array_layout::TILED>;
+
+  // Row major
+  {
+    indexer_row Indexer({{0,0,0}, {4,3,2}});
+    ovk::interval<int,3> Interval({1,1,0}, {3,3,2});
+    ovk::core::vector<ovk::elem<int,3>> Tuples;
+    ovk::core::vector<long long> Indices;
+    ovk::core::ForEachInRange(Interval, Indexer, [&](const ovk::elem<int,3> &Tuple, long long
+      Index) {
+      Tuples.Append(Tuple);
+      Indices.Append(Index);
+    });
+    EXPECT_EQ(Tuples.Count(), 8);
+    EXPECT_THAT(Tuples[0], ElementsAre(1,1,0));
+    EXPECT_THAT(Tuples[1], ElementsAre(1,1,1));
+    EXPECT_THAT(Tuples[2], ElementsAre(1,2,0));
+    EXPECT_THAT(Tuples[7], ElementsAre(2,2,1));
+    EXPECT_THAT(Indices, ElementsAre(8,9,10,11,14,15,16,17));
+  }
+
+  // Column major
+  {
+    indexer_col Indexer({{0,0,0}, {4,3,2}});
+    ovk::interval<int,3> Interval({1,1,0}, {3,3,2});
+    ovk::core::vector<ovk::elem<int,3>> Tuples;
+    ovk::core::vector<long long> Indices;
+    ovk::core::ForEachInRange(Interval, Indexer, [&](const ovk::elem<int,3> &Tuple, long long
+      Index) {
+      Tuples.Append(Tuple);
+      Indices.Append(Index);
+    });
+    EXPECT_EQ(Tuples.Count(), 8);
+    EXPECT_THAT(Tuples[0], ElementsAre(1,1,0));
+    EXPECT_THAT(Tuples[1], ElementsAre(2,1,0));
+    EXPECT_THAT(Tuples[2], ElementsAre(1,2,0));
+    EXPECT_THAT(Tuples[7], ElementsAre(2,2,1));
+    EXPECT_THAT(Indices, ElementsAre(5,6,9,10,17,18,21,22));
+  }
+
+  // Tiled
+  {
+    indexer_tiled Indexer({{0,0,0}, {6,5,3}});
+    ovk::interval<int,3> Interval({2,1,0}, {6,5,3});
+    long long NumTuples = 0;
+    bool Matches = true;
+    ovk::core::ForEachInRange(Interval, Indexer, [&](const ovk::elem<int,3> &Tuple, long long
+      Index) {
+      Matches = Matches && Index == Indexer.ToIndex(Tuple);
+      ++NumTuples;
+    });
+    EXPECT_EQ(NumTuples, Interval.Count());
+    EXPECT_TRUE(Matches);
+  }
+
+  // Empty
+  {
+    indexer_col Indexer({{0,0,0}, {4,3,2}});
+    ovk::interval<int,3> Interval({1,1,0}, {3,1,2});
+    long long NumTuples = 0;
+    ovk::core::ForEachInRange(Interval, Indexer, [&](const ovk::elem<int,3> &, long long) {
+      ++NumTuples;
+    });
+    EXPECT_EQ(NumTuples, 0);
+  }
+
 }
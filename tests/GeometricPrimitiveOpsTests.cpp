@@ -8,6 +8,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <ovk/core/Array.hpp>
 #include <ovk/core/ArrayView.hpp>
 #include <ovk/core/Comm.hpp>
 #include <ovk/core/Elem.hpp>
@@ -1096,6 +1097,277 @@ TEST_F(GeometricPrimitiveOpsTests, IsoHex64NodeInverse) {
 
 }
 
+TEST_F(GeometricPrimitiveOpsTests, IsoLine4NodeInverseBatch) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::IsoLine4NodeInverse;
+  using ovk::core::IsoLine4NodeInverseBatch;
+
+  // Enough points to fill more than one batch, each with a differently-stretched line segment
+
+  constexpr int NumPoints = 11;
+
+  auto CoordFunc = [](int iPoint, double U) -> double {
+    double X = 2.+U;
+    return X + 0.02*double(iPoint)*X*X*X;
+  };
+
+  ovk::array<double,2> NodeCoords({{4,NumPoints}});
+  ovk::array<double> Coords({NumPoints});
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    for (int i = 0; i < 4; ++i) {
+      NodeCoords(i,iPoint) = CoordFunc(iPoint, double(i)-1.);
+    }
+    Coords(iPoint) = CoordFunc(iPoint, 0.1*double(iPoint)-0.2);
+  }
+
+  ovk::array<double> LocalCoords({NumPoints});
+  ovk::array<bool> Converged({NumPoints});
+  IsoLine4NodeInverseBatch(NodeCoords, Coords, LocalCoords, Converged);
+
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    double PointNodeCoords[4];
+    for (int i = 0; i < 4; ++i) {
+      PointNodeCoords[i] = NodeCoords(i,iPoint);
+    }
+    auto MaybeLocalCoord = IsoLine4NodeInverse(PointNodeCoords, Coords(iPoint));
+    ASSERT_TRUE(MaybeLocalCoord.Present());
+    EXPECT_TRUE(Converged(iPoint));
+    EXPECT_NEAR(LocalCoords(iPoint), *MaybeLocalCoord, 1.e-12);
+  }
+
+}
+
+TEST_F(GeometricPrimitiveOpsTests, IsoQuad4NodeNonUniformInverseBatch) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::IsoQuad4NodeNonUniformInverse;
+  using ovk::core::IsoQuad4NodeNonUniformInverseBatch;
+
+  constexpr int NumPoints = 11;
+
+  auto CoordFunc = [](int iPoint, double U, double V) -> ovk::elem<double,2> {
+    double X = 1.+U;
+    double Y = 2.+V;
+    double Skew = 0.05*double(iPoint);
+    return {2.*X+Y+Skew*X*Y, X+2.*Y-Skew*X*Y};
+  };
+
+  ovk::array<double,3> NodeCoords({{2,4,NumPoints}});
+  ovk::array<double,2> Coords({{2,NumPoints}});
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    int iNode = 0;
+    for (int j = 0; j < 2; ++j) {
+      for (int i = 0; i < 2; ++i) {
+        ovk::elem<double,2> NodeCoord = CoordFunc(iPoint, double(i), double(j));
+        for (int iDim = 0; iDim < 2; ++iDim) {
+          NodeCoords(iDim,iNode,iPoint) = NodeCoord(iDim);
+        }
+        ++iNode;
+      }
+    }
+    ovk::elem<double,2> PointCoord = CoordFunc(iPoint, 0.1*double(iPoint), 0.9-0.05*double(iPoint));
+    for (int iDim = 0; iDim < 2; ++iDim) {
+      Coords(iDim,iPoint) = PointCoord(iDim);
+    }
+  }
+
+  ovk::array<double,2> LocalCoords({{2,NumPoints}});
+  ovk::array<bool> Converged({NumPoints});
+  IsoQuad4NodeNonUniformInverseBatch(NodeCoords, Coords, LocalCoords, Converged);
+
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    ovk::elem<double,2> PointNodeCoords[4];
+    for (int iNode = 0; iNode < 4; ++iNode) {
+      PointNodeCoords[iNode] = {NodeCoords(0,iNode,iPoint), NodeCoords(1,iNode,iPoint)};
+    }
+    auto MaybeLocalCoords = IsoQuad4NodeNonUniformInverse(PointNodeCoords, {Coords(0,iPoint),
+      Coords(1,iPoint)});
+    ASSERT_TRUE(MaybeLocalCoords.Present());
+    EXPECT_TRUE(Converged(iPoint));
+    EXPECT_NEAR(LocalCoords(0,iPoint), (*MaybeLocalCoords)(0), 1.e-12);
+    EXPECT_NEAR(LocalCoords(1,iPoint), (*MaybeLocalCoords)(1), 1.e-12);
+  }
+
+}
+
+TEST_F(GeometricPrimitiveOpsTests, IsoQuad16NodeInverseBatch) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::IsoQuad16NodeInverse;
+  using ovk::core::IsoQuad16NodeInverseBatch;
+
+  constexpr int NumPoints = 11;
+
+  auto CoordFunc = [](int iPoint, double U, double V) -> ovk::elem<double,2> {
+    double X = 2.+U;
+    double Y = 3.+V;
+    double Warp = 0.01*double(iPoint);
+    return {2.*X+Y+Warp*X*X*Y, X+2.*Y+Warp*X*Y*Y};
+  };
+
+  ovk::array<double,3> NodeCoords({{2,16,NumPoints}});
+  ovk::array<double,2> Coords({{2,NumPoints}});
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    int iNode = 0;
+    for (int j = 0; j < 4; ++j) {
+      for (int i = 0; i < 4; ++i) {
+        ovk::elem<double,2> NodeCoord = CoordFunc(iPoint, double(i)-1., double(j)-1.);
+        for (int iDim = 0; iDim < 2; ++iDim) {
+          NodeCoords(iDim,iNode,iPoint) = NodeCoord(iDim);
+        }
+        ++iNode;
+      }
+    }
+    ovk::elem<double,2> PointCoord = CoordFunc(iPoint, 0.1*double(iPoint), 0.9-0.05*double(iPoint));
+    for (int iDim = 0; iDim < 2; ++iDim) {
+      Coords(iDim,iPoint) = PointCoord(iDim);
+    }
+  }
+
+  ovk::array<double,2> LocalCoords({{2,NumPoints}});
+  ovk::array<bool> Converged({NumPoints});
+  IsoQuad16NodeInverseBatch(NodeCoords, Coords, LocalCoords, Converged);
+
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    ovk::elem<double,2> PointNodeCoords[16];
+    for (int iNode = 0; iNode < 16; ++iNode) {
+      PointNodeCoords[iNode] = {NodeCoords(0,iNode,iPoint), NodeCoords(1,iNode,iPoint)};
+    }
+    auto MaybeLocalCoords = IsoQuad16NodeInverse(PointNodeCoords, {Coords(0,iPoint),
+      Coords(1,iPoint)});
+    ASSERT_TRUE(MaybeLocalCoords.Present());
+    EXPECT_TRUE(Converged(iPoint));
+    EXPECT_NEAR(LocalCoords(0,iPoint), (*MaybeLocalCoords)(0), 1.e-12);
+    EXPECT_NEAR(LocalCoords(1,iPoint), (*MaybeLocalCoords)(1), 1.e-12);
+  }
+
+}
+
+TEST_F(GeometricPrimitiveOpsTests, IsoHex8NodeNonUniformInverseBatch) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::IsoHex8NodeNonUniformInverse;
+  using ovk::core::IsoHex8NodeNonUniformInverseBatch;
+
+  constexpr int NumPoints = 11;
+
+  auto CoordFunc = [](int iPoint, double U, double V, double W) -> ovk::elem<double,3> {
+    double X = 1.+U;
+    double Y = 2.+V;
+    double Z = 3.+W;
+    double Skew = 0.02*double(iPoint);
+    return {2.*X+Y+Z+Skew*X*Y*Z, X+2.*Y+Z-Skew*X*Y, X+Y+2.*Z+Skew*Y*Z};
+  };
+
+  ovk::array<double,3> NodeCoords({{3,8,NumPoints}});
+  ovk::array<double,2> Coords({{3,NumPoints}});
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    int iNode = 0;
+    for (int k = 0; k < 2; ++k) {
+      for (int j = 0; j < 2; ++j) {
+        for (int i = 0; i < 2; ++i) {
+          ovk::elem<double,3> NodeCoord = CoordFunc(iPoint, double(i), double(j), double(k));
+          for (int iDim = 0; iDim < 3; ++iDim) {
+            NodeCoords(iDim,iNode,iPoint) = NodeCoord(iDim);
+          }
+          ++iNode;
+        }
+      }
+    }
+    ovk::elem<double,3> PointCoord = CoordFunc(iPoint, 0.1*double(iPoint), 0.9-0.05*double(iPoint),
+      0.5);
+    for (int iDim = 0; iDim < 3; ++iDim) {
+      Coords(iDim,iPoint) = PointCoord(iDim);
+    }
+  }
+
+  ovk::array<double,2> LocalCoords({{3,NumPoints}});
+  ovk::array<bool> Converged({NumPoints});
+  IsoHex8NodeNonUniformInverseBatch(NodeCoords, Coords, LocalCoords, Converged);
+
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    ovk::elem<double,3> PointNodeCoords[8];
+    for (int iNode = 0; iNode < 8; ++iNode) {
+      PointNodeCoords[iNode] = {NodeCoords(0,iNode,iPoint), NodeCoords(1,iNode,iPoint),
+        NodeCoords(2,iNode,iPoint)};
+    }
+    auto MaybeLocalCoords = IsoHex8NodeNonUniformInverse(PointNodeCoords, {Coords(0,iPoint),
+      Coords(1,iPoint), Coords(2,iPoint)});
+    ASSERT_TRUE(MaybeLocalCoords.Present());
+    EXPECT_TRUE(Converged(iPoint));
+    for (int iDim = 0; iDim < 3; ++iDim) {
+      EXPECT_NEAR(LocalCoords(iDim,iPoint), (*MaybeLocalCoords)(iDim), 1.e-12);
+    }
+  }
+
+}
+
+TEST_F(GeometricPrimitiveOpsTests, IsoHex64NodeInverseBatch) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::IsoHex64NodeInverse;
+  using ovk::core::IsoHex64NodeInverseBatch;
+
+  constexpr int NumPoints = 11;
+
+  auto CoordFunc = [](int iPoint, double U, double V, double W) -> ovk::elem<double,3> {
+    double X = 2.+U;
+    double Y = 3.+V;
+    double Z = 4.+W;
+    double Warp = 0.005*double(iPoint);
+    return {2.*X+Y+Z+Warp*X*X*Z, X+2.*Y+Z+Warp*Y*Y*X, X+Y+2.*Z+Warp*Z*Z*Y};
+  };
+
+  ovk::array<double,3> NodeCoords({{3,64,NumPoints}});
+  ovk::array<double,2> Coords({{3,NumPoints}});
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    int iNode = 0;
+    for (int k = 0; k < 4; ++k) {
+      for (int j = 0; j < 4; ++j) {
+        for (int i = 0; i < 4; ++i) {
+          ovk::elem<double,3> NodeCoord = CoordFunc(iPoint, double(i)-1., double(j)-1.,
+            double(k)-1.);
+          for (int iDim = 0; iDim < 3; ++iDim) {
+            NodeCoords(iDim,iNode,iPoint) = NodeCoord(iDim);
+          }
+          ++iNode;
+        }
+      }
+    }
+    ovk::elem<double,3> PointCoord = CoordFunc(iPoint, 0.1*double(iPoint), 0.9-0.05*double(iPoint),
+      0.5);
+    for (int iDim = 0; iDim < 3; ++iDim) {
+      Coords(iDim,iPoint) = PointCoord(iDim);
+    }
+  }
+
+  ovk::array<double,2> LocalCoords({{3,NumPoints}});
+  ovk::array<bool> Converged({NumPoints});
+  IsoHex64NodeInverseBatch(NodeCoords, Coords, LocalCoords, Converged);
+
+  for (int iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    ovk::elem<double,3> PointNodeCoords[64];
+    for (int iNode = 0; iNode < 64; ++iNode) {
+      PointNodeCoords[iNode] = {NodeCoords(0,iNode,iPoint), NodeCoords(1,iNode,iPoint),
+        NodeCoords(2,iNode,iPoint)};
+    }
+    auto MaybeLocalCoords = IsoHex64NodeInverse(PointNodeCoords, {Coords(0,iPoint),
+      Coords(1,iPoint), Coords(2,iPoint)});
+    ASSERT_TRUE(MaybeLocalCoords.Present());
+    EXPECT_TRUE(Converged(iPoint));
+    for (int iDim = 0; iDim < 3; ++iDim) {
+      EXPECT_NEAR(LocalCoords(iDim,iPoint), (*MaybeLocalCoords)(iDim), 1.e-12);
+    }
+  }
+
+}
+
 TEST_F(GeometricPrimitiveOpsTests, OverlapsLine) {
 
   if (TestComm().Rank() != 0) return;
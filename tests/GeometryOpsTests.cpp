@@ -0,0 +1,272 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/GeometryOps.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Elem.hpp>
+#include <ovk/core/Field.hpp>
+#include <ovk/core/GeometryBase.hpp>
+#include <ovk/core/Optional.hpp>
+#include <ovk/core/Range.hpp>
+#include <ovk/core/Tuple.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+
+class GeometryOpsTests : public tests::mpi_test {};
+
+using testing::DoubleNear;
+
+TEST_F(GeometryOpsTests, CoordsInCellRectilinear) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::CoordsInCell;
+  using ovk::geometry_type;
+
+  auto XFunc = [](double U) -> double { return U + 0.1*U*U; };
+  auto YFunc = [](double V) -> double { return 2.*V + 0.05*V*V*V; };
+  auto ZFunc = [](double W) -> double { return -1. + 0.5*W + 0.02*W*W; };
+
+  // 2D, compared against curvilinear
+  {
+    ovk::range NodeRange = {{0,0,0}, {7,6,1}};
+    ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange, 0.);
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+        XCoords(i,j,0) = XFunc(double(i));
+        YCoords(i,j,0) = YFunc(double(j));
+      }
+    }
+    ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+    const ovk::tuple<double> LocalCoords[] = {{0.,0.,0.}, {1.,1.,0.}, {0.25,0.75,0.},
+      {0.5,0.1,0.}};
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1)-1; ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0)-1; ++i) {
+        ovk::tuple<int> Cell = {i,j,0};
+        for (auto &Local : LocalCoords) {
+          ovk::tuple<double> PointCoords = {XFunc(double(i)+Local(0)), YFunc(double(j)+Local(1)),
+            0.};
+          auto MaybeRectilinear = CoordsInCell<geometry_type::RECTILINEAR,2>(Coords, Cell,
+            PointCoords);
+          auto MaybeCurvilinear = CoordsInCell<geometry_type::CURVILINEAR,2>(Coords, Cell,
+            PointCoords);
+          ASSERT_TRUE(MaybeRectilinear.Present());
+          ASSERT_TRUE(MaybeCurvilinear.Present());
+          EXPECT_THAT((*MaybeRectilinear)(0), DoubleNear((*MaybeCurvilinear)(0), 1.e-10));
+          EXPECT_THAT((*MaybeRectilinear)(1), DoubleNear((*MaybeCurvilinear)(1), 1.e-10));
+          EXPECT_EQ((*MaybeRectilinear)(2), 0.);
+        }
+      }
+    }
+  }
+
+  // 3D, compared against curvilinear
+  {
+    ovk::range NodeRange = {{0,0,0}, {5,5,5}};
+    ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange);
+    for (int k = NodeRange.Begin(2); k < NodeRange.End(2); ++k) {
+      for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+        for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+          XCoords(i,j,k) = XFunc(double(i));
+          YCoords(i,j,k) = YFunc(double(j));
+          ZCoords(i,j,k) = ZFunc(double(k));
+        }
+      }
+    }
+    ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+    ovk::tuple<int> Cell = {1,2,3};
+    ovk::tuple<double> PointCoords = {XFunc(1.3), YFunc(2.6), ZFunc(3.1)};
+    auto MaybeRectilinear = CoordsInCell<geometry_type::RECTILINEAR,3>(Coords, Cell, PointCoords);
+    auto MaybeCurvilinear = CoordsInCell<geometry_type::CURVILINEAR,3>(Coords, Cell, PointCoords);
+    ASSERT_TRUE(MaybeRectilinear.Present());
+    ASSERT_TRUE(MaybeCurvilinear.Present());
+    for (int iDim = 0; iDim < 3; ++iDim) {
+      EXPECT_THAT((*MaybeRectilinear)(iDim), DoubleNear((*MaybeCurvilinear)(iDim), 1.e-10));
+    }
+  }
+
+  // Grid too small for cubic stencil
+  {
+    ovk::range NodeRange = {{0,0,0}, {2,3,1}};
+    ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange, 0.);
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+        XCoords(i,j,0) = XFunc(double(i));
+        YCoords(i,j,0) = YFunc(double(j));
+      }
+    }
+    ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+    ovk::tuple<int> Cell = {0,1,0};
+    ovk::tuple<double> PointCoords = {
+      0.75*XFunc(0.) + 0.25*XFunc(1.),
+      0.5*YFunc(1.) + 0.5*YFunc(2.),
+      0.
+    };
+    auto MaybeLocalCoords = CoordsInCell<geometry_type::RECTILINEAR,2>(Coords, Cell, PointCoords);
+    ASSERT_TRUE(MaybeLocalCoords.Present());
+    EXPECT_THAT((*MaybeLocalCoords)(0), DoubleNear(0.25, 1.e-12));
+    EXPECT_THAT((*MaybeLocalCoords)(1), DoubleNear(0.5, 1.e-12));
+  }
+
+}
+
+TEST_F(GeometryOpsTests, CoordsInCellOrientedRectilinear) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::CoordsInCell;
+  using ovk::geometry_type;
+
+  auto UFunc = [](double U) -> double { return U + 0.1*U*U; };
+  auto VFunc = [](double V) -> double { return 2.*V + 0.05*V*V*V; };
+
+  double Angle = 0.4;
+  double Cos = std::cos(Angle);
+  double Sin = std::sin(Angle);
+
+  auto XFunc = [&](double U, double V) -> double { return 1. + Cos*UFunc(U) - Sin*VFunc(V); };
+  auto YFunc = [&](double U, double V) -> double { return -2. + Sin*UFunc(U) + Cos*VFunc(V); };
+
+  ovk::range NodeRange = {{0,0,0}, {6,6,1}};
+  ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange, 0.);
+  for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+    for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+      XCoords(i,j,0) = XFunc(double(i), double(j));
+      YCoords(i,j,0) = YFunc(double(i), double(j));
+    }
+  }
+  ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+
+  for (int j = NodeRange.Begin(1); j < NodeRange.End(1)-1; ++j) {
+    for (int i = NodeRange.Begin(0); i < NodeRange.End(0)-1; ++i) {
+      ovk::tuple<int> Cell = {i,j,0};
+      double U = double(i)+0.3;
+      double V = double(j)+0.8;
+      ovk::tuple<double> PointCoords = {XFunc(U, V), YFunc(U, V), 0.};
+      auto MaybeOriented = CoordsInCell<geometry_type::ORIENTED_RECTILINEAR,2>(Coords, Cell,
+        PointCoords);
+      auto MaybeCurvilinear = CoordsInCell<geometry_type::CURVILINEAR,2>(Coords, Cell,
+        PointCoords);
+      ASSERT_TRUE(MaybeOriented.Present());
+      ASSERT_TRUE(MaybeCurvilinear.Present());
+      EXPECT_THAT((*MaybeOriented)(0), DoubleNear((*MaybeCurvilinear)(0), 1.e-10));
+      EXPECT_THAT((*MaybeOriented)(1), DoubleNear((*MaybeCurvilinear)(1), 1.e-10));
+      EXPECT_THAT((*MaybeOriented)(0), DoubleNear(0.3, 1.e-10));
+      EXPECT_THAT((*MaybeOriented)(1), DoubleNear(0.8, 1.e-10));
+    }
+  }
+
+}
+
+namespace {
+
+double WavyX(double U, double V, double W) { return U + 0.1*std::sin(0.5*V) + 0.05*W*W; }
+double WavyY(double U, double V, double W) { return 2.*V + 0.1*std::sin(0.7*U) - 0.05*W; }
+double WavyZ(double U, double V, double W) { return W + 0.1*std::cos(0.3*U+0.4*V); }
+
+// Compares CoordsInCells against CoordsInCell for every cell in a wavy grid (including the ones
+// along the boundary, whose stencils must be shifted inward) and for one point searched in
+// several candidate cells
+template <int NumDims> void CheckCoordsInCellsCurvilinear(bool UseBatches) {
+
+  using ovk::core::CoordsInCell;
+  using ovk::core::CoordsInCells;
+  using ovk::geometry_type;
+
+  ovk::range NodeRange = {{0,0,0}, {7,6,NumDims == 3 ? 5 : 1}};
+  ovk::range CellRange = {{0,0,0}, {6,5,NumDims == 3 ? 4 : 1}};
+
+  auto PointAt = [](double U, double V, double W) -> ovk::tuple<double> {
+    return {WavyX(U, V, W), WavyY(U, V, W), NumDims == 3 ? WavyZ(U, V, W) : 0.};
+  };
+
+  ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange);
+  for (int k = NodeRange.Begin(2); k < NodeRange.End(2); ++k) {
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+        ovk::tuple<double> Node = PointAt(double(i), double(j), double(k));
+        XCoords(i,j,k) = Node(0);
+        YCoords(i,j,k) = Node(1);
+        ZCoords(i,j,k) = Node(2);
+      }
+    }
+  }
+  ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+
+  const ovk::tuple<double> Local = {0.3, 0.6, NumDims == 3 ? 0.8 : 0.};
+
+  ovk::array<ovk::tuple<int>> Cells;
+  ovk::array<ovk::tuple<double>> PointCoords;
+  for (int k = CellRange.Begin(2); k < CellRange.End(2); ++k) {
+    for (int j = CellRange.Begin(1); j < CellRange.End(1); ++j) {
+      for (int i = CellRange.Begin(0); i < CellRange.End(0); ++i) {
+        Cells.Append({i,j,k});
+        PointCoords.Append(PointAt(double(i)+Local(0), double(j)+Local(1), double(k)+Local(2)));
+      }
+    }
+  }
+
+  ovk::array<ovk::optional<ovk::tuple<double>>> MaybeLocalCoords({Cells.Count()});
+  CoordsInCells<geometry_type::CURVILINEAR,NumDims>(Coords, Cells, PointCoords, MaybeLocalCoords,
+    UseBatches);
+  for (long long iCell = 0; iCell < Cells.Count(); ++iCell) {
+    auto MaybeExpected = CoordsInCell<geometry_type::CURVILINEAR,NumDims>(Coords, Cells(iCell),
+      PointCoords(iCell));
+    ASSERT_TRUE(MaybeExpected.Present());
+    ASSERT_TRUE(MaybeLocalCoords(iCell).Present());
+    for (int iDim = 0; iDim < NumDims; ++iDim) {
+      EXPECT_THAT((*MaybeLocalCoords(iCell))(iDim), DoubleNear((*MaybeExpected)(iDim), 1.e-10));
+      // Cubic interpolation of the wavy mapping isn't exact
+      EXPECT_THAT((*MaybeLocalCoords(iCell))(iDim), DoubleNear(Local(iDim), 1.e-3));
+    }
+  }
+
+  ovk::tuple<double> SinglePointCoords = PointAt(2.5, 2.5, NumDims == 3 ? 1.5 : 0.);
+  ovk::array<ovk::tuple<int>> CandidateCells;
+  for (int k = NumDims == 3 ? 1 : 0; k < (NumDims == 3 ? 3 : 1); ++k) {
+    for (int j = 1; j < 4; ++j) {
+      for (int i = 1; i < 4; ++i) {
+        CandidateCells.Append({i,j,k});
+      }
+    }
+  }
+
+  ovk::array<ovk::optional<ovk::tuple<double>>> MaybeCandidateLocalCoords({
+    CandidateCells.Count()});
+  CoordsInCells<geometry_type::CURVILINEAR,NumDims>(Coords, CandidateCells, SinglePointCoords,
+    MaybeCandidateLocalCoords, UseBatches);
+  for (long long iCell = 0; iCell < CandidateCells.Count(); ++iCell) {
+    auto MaybeExpected = CoordsInCell<geometry_type::CURVILINEAR,NumDims>(Coords,
+      CandidateCells(iCell), SinglePointCoords);
+    ASSERT_EQ(MaybeCandidateLocalCoords(iCell).Present(), MaybeExpected.Present());
+    if (MaybeExpected) {
+      for (int iDim = 0; iDim < NumDims; ++iDim) {
+        EXPECT_THAT((*MaybeCandidateLocalCoords(iCell))(iDim), DoubleNear((*MaybeExpected)(iDim),
+          1.e-10));
+      }
+    }
+  }
+
+}
+
+}
+
+TEST_F(GeometryOpsTests, CoordsInCellsCurvilinear) {
+
+  if (TestComm().Rank() != 0) return;
+
+  // Run both paths regardless of whether batching is enabled by default in this build
+  CheckCoordsInCellsCurvilinear<2>(false);
+  CheckCoordsInCellsCurvilinear<2>(true);
+  CheckCoordsInCellsCurvilinear<3>(false);
+  CheckCoordsInCellsCurvilinear<3>(true);
+
+}
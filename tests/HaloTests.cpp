@@ -15,6 +15,7 @@
 #include <ovk/core/Comm.hpp>
 #include <ovk/core/Context.hpp>
 #include <ovk/core/Field.hpp>
+#include <ovk/core/ForEach.hpp>
 #include <ovk/core/Range.hpp>
 #include <ovk/core/Tuple.hpp>
 
@@ -145,6 +146,23 @@ TEST_F(HaloTests, Exchange) {
     return AfterData;
   };
 
+  auto ToTiled = [](const ovk::field<int> &Data) -> ovk::tiled_field<int> {
+    ovk::tiled_field<int> TiledData(Data.Extents());
+    ovk::core::ForEach(Data.Extents(), [&](const ovk::tuple<int> &Point) {
+      TiledData(Point) = Data(Point);
+    });
+    return TiledData;
+  };
+
+  auto MatchesTiled = [](const ovk::tiled_field<int> &TiledData, const ovk::field<int> &Data) ->
+    bool {
+    bool Matches = true;
+    ovk::core::ForEach(Data.Extents(), [&](const ovk::tuple<int> &Point) {
+      Matches = Matches && TiledData(Point) == Data(Point);
+    });
+    return Matches;
+  };
+
   auto Context = std::make_shared<ovk::context>(ovk::CreateContext(ovk::context::params()
     .SetComm(TestComm())
     .SetStatusLoggingThreshold(0)
@@ -262,6 +280,59 @@ TEST_F(HaloTests, Exchange) {
     EXPECT_THAT(Data, ElementsAreArray(ExpectedData));
   }
 
+  // Serial, periodic, duplicated, tiled
+  if (CommOfSize1) {
+    ovk::comm_view Comm = CommOfSize1;
+    ovk::cart Cart = CreateCart(2, true, true);
+    ovk::range LocalRange = Cart.Range();
+    ovk::range ExtendedRange = AddHalo(Cart, LocalRange);
+    ovk::map<int,ovk::core::decomp_info> Neighbors = CreateNeighbors(Cart, Comm, LocalRange,
+      ExtendedRange);
+    ovk::core::halo Halo(Context, Cart, ovk::DuplicateComm(Comm), LocalRange, ExtendedRange,
+      Neighbors);
+    ovk::tiled_field<int> Data = ToTiled(CreateBeforeDataInt(Cart, LocalRange, ExtendedRange));
+    Halo.Exchange(Data);
+    ovk::field<int> ExpectedData = CreateAfterDataInt(Cart, ExtendedRange);
+    EXPECT_TRUE(MatchesTiled(Data, ExpectedData));
+  }
+
+  // Parallel, periodic, unique, tiled (column-major exchange on the same halo beforehand)
+  if (CommOfSize4) {
+    ovk::cart Cart = CreateCart(2, true, false);
+    ovk::comm Comm = ovk::CreateCartComm(CommOfSize4, 2, {2,2,1}, Cart.Periodic());
+    ovk::range LocalRange = CartesianDecomp(Cart.Dimension(), Cart.Range(), Comm);
+    ovk::range ExtendedRange = AddHalo(Cart, LocalRange);
+    ovk::map<int,ovk::core::decomp_info> Neighbors = CreateNeighbors(Cart, Comm, LocalRange,
+      ExtendedRange);
+    ovk::core::halo Halo(Context, Cart, ovk::DuplicateComm(Comm), LocalRange, ExtendedRange,
+      Neighbors);
+    ovk::field<int> ExpectedData = CreateAfterDataInt(Cart, ExtendedRange);
+    ovk::field<int> ColumnMajorData = CreateBeforeDataInt(Cart, LocalRange, ExtendedRange);
+    ovk::tiled_field<int> Data = ToTiled(ColumnMajorData);
+    Halo.Exchange(ColumnMajorData);
+    EXPECT_THAT(ColumnMajorData, ElementsAreArray(ExpectedData));
+    Halo.Exchange(Data);
+    EXPECT_TRUE(MatchesTiled(Data, ExpectedData));
+  }
+
+  // Parallel, periodic, unique, tiled, 3D; local ranges and halos don't line up with tiles
+  if (CommOfSize4) {
+    ovk::cart Cart = CreateCart(3, true, false);
+    ovk::comm Comm = ovk::CreateCartComm(CommOfSize4, 3, {2,2,1}, Cart.Periodic());
+    ovk::range LocalRange = CartesianDecomp(Cart.Dimension(), Cart.Range(), Comm);
+    ovk::range ExtendedRange = AddHalo(Cart, LocalRange);
+    ovk::map<int,ovk::core::decomp_info> Neighbors = CreateNeighbors(Cart, Comm, LocalRange,
+      ExtendedRange);
+    ovk::core::halo Halo(Context, Cart, ovk::DuplicateComm(Comm), LocalRange, ExtendedRange,
+      Neighbors);
+    ovk::field<int> ColumnMajorData = CreateBeforeDataInt(Cart, LocalRange, ExtendedRange);
+    ovk::tiled_field<int> Data = ToTiled(ColumnMajorData);
+    Halo.Exchange(Data);
+    Halo.Exchange(ColumnMajorData);
+    EXPECT_THAT(ColumnMajorData, ElementsAreArray(CreateAfterDataInt(Cart, ExtendedRange)));
+    EXPECT_TRUE(MatchesTiled(Data, ColumnMajorData));
+  }
+
   // Serial, multiple simultaneous exchanges
   if (CommOfSize1) {
     ovk::comm_view Comm = CommOfSize1;
@@ -0,0 +1,257 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/HashMap.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Elem.hpp>
+#include <ovk/core/Map.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class HashMapTests : public tests::mpi_test {};
+
+using testing::UnorderedElementsAre;
+using testing::Pair;
+
+namespace {
+template <typename KeyType, typename ValueType> std::vector<std::pair<KeyType,ValueType>>
+  GetEntries(const ovk::hash_map<KeyType,ValueType> &Map) {
+  std::vector<std::pair<KeyType,ValueType>> Entries;
+  for (auto &Entry : Map) {
+    Entries.emplace_back(Entry.Key(), Entry.Value());
+  }
+  return Entries;
+}
+}
+
+TEST_F(HashMapTests, Meta) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,double>;
+
+  EXPECT_TRUE((std::is_same<typename hash_map::key_type, int>::value));
+  EXPECT_TRUE((std::is_same<typename hash_map::value_type, double>::value));
+  EXPECT_TRUE((std::is_same<typename hash_map::hash_type, ovk::hash<int>>::value));
+  EXPECT_TRUE((std::is_same<typename hash_map::key_set_type, ovk::hash_set<int>>::value));
+  EXPECT_TRUE((std::is_same<typename hash_map::index_type, long long>::value));
+  EXPECT_TRUE((std::is_same<typename hash_map::entry, ovk::map_entry<int,double>>::value));
+  EXPECT_TRUE((std::is_same<typename hash_map::iterator::pointer, ovk::map_entry<int,double> *>::
+    value));
+
+}
+
+TEST_F(HashMapTests, Create) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,int>;
+
+  // Default
+  {
+    hash_map Map;
+    EXPECT_EQ(Map.Count(), 0);
+  }
+
+  // Initializer list
+  {
+    hash_map Map = {{2, 1}, {3, 2}};
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(2, 1), Pair(3, 2)));
+  }
+
+  // Iterators
+  {
+    std::array<hash_map::entry,3> SourceEntries = {{{2, 1}, {3, 2}, {2, 3}}};
+    hash_map Map(SourceEntries.begin(), SourceEntries.end());
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(2, 3), Pair(3, 2)));
+  }
+
+}
+
+TEST_F(HashMapTests, Insert) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,int>;
+  using hash_map_array = ovk::hash_map<int,ovk::array<int>>;
+
+  // Key and value
+  {
+    hash_map Map;
+    int &Value = Map.Insert(2, 1);
+    EXPECT_EQ(Value, 1);
+    Map.Insert(3, 2);
+    Map.Insert(2, 4);
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(2, 4), Pair(3, 2)));
+  }
+
+  // Entry
+  {
+    hash_map Map;
+    Map.Insert(hash_map::entry(5, 6));
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(5, 6)));
+  }
+
+  // Default-constructed and non-contiguous values
+  {
+    hash_map_array Map;
+    ovk::array<int> &Values = Map.Insert(1);
+    EXPECT_EQ(Values.Count(), 0);
+    Map.Insert(2, ovk::array<int>({3}, 7));
+    EXPECT_EQ(Map(2).Count(), 3);
+    EXPECT_EQ(Map(2)(0), 7);
+  }
+
+  // Enough to force several rehashes
+  {
+    hash_map Map;
+    for (int Key = 0; Key < 1000; ++Key) {
+      Map.Insert(Key, 2*Key);
+    }
+    EXPECT_EQ(Map.Count(), 1000);
+    for (int Key = 0; Key < 1000; ++Key) {
+      EXPECT_EQ(Map(Key), 2*Key);
+    }
+  }
+
+}
+
+TEST_F(HashMapTests, Erase) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,int>;
+
+  // Key
+  {
+    hash_map Map = {{1, 2}, {2, 3}, {3, 4}};
+    Map.Erase(1);
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(2, 3), Pair(3, 4)));
+    EXPECT_EQ(Map(3), 4);
+    Map.Erase(5);
+    EXPECT_EQ(Map.Count(), 2);
+  }
+
+  // Iterator
+  {
+    hash_map Map = {{1, 2}, {2, 3}, {3, 4}};
+    Map.Erase(Map.Find(2));
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(1, 2), Pair(3, 4)));
+  }
+
+  // Interleaved with inserts; entries must stay in sync with keys
+  {
+    hash_map Map;
+    ovk::map<int,int> ReferenceMap;
+    for (int Value = 0; Value < 2000; ++Value) {
+      int Key = (Value*7919) % 1543;
+      if (Value % 3 == 2) {
+        Map.Erase(Key);
+        ReferenceMap.Erase(Key);
+      } else {
+        Map.Insert(Key, Value);
+        ReferenceMap.Insert(Key, Value);
+      }
+    }
+    ASSERT_EQ(Map.Count(), ReferenceMap.Count());
+    for (auto &Entry : ReferenceMap) {
+      ASSERT_TRUE(Map.Contains(Entry.Key()));
+      EXPECT_EQ(Map(Entry.Key()), Entry.Value());
+    }
+  }
+
+}
+
+TEST_F(HashMapTests, EraseIf) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,int>;
+
+  // Entry predicate
+  {
+    hash_map Map = {{1, 2}, {2, 3}, {3, 4}, {4, 5}};
+    Map.EraseIf([](const hash_map::entry &Entry) -> bool { return Entry.Value() % 2 == 0; });
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(2, 3), Pair(4, 5)));
+  }
+
+  // Key predicate
+  {
+    hash_map Map = {{1, 2}, {2, 3}, {3, 4}, {4, 5}};
+    Map.EraseIf([](int Key) -> bool { return Key > 2; });
+    EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(1, 2), Pair(2, 3)));
+  }
+
+}
+
+TEST_F(HashMapTests, Fetch) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,int>;
+
+  hash_map Map = {{1, 2}};
+
+  // Existing entries are left alone
+  EXPECT_EQ(Map.Fetch(1, 5), 2);
+  EXPECT_EQ(Map.Fetch(2, 5), 5);
+  ++Map.Fetch(3);
+  ++Map.Fetch(3);
+
+  EXPECT_THAT(GetEntries(Map), UnorderedElementsAre(Pair(1, 2), Pair(2, 5), Pair(3, 2)));
+
+}
+
+TEST_F(HashMapTests, Find) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<int,int>;
+
+  hash_map Map = {{1, 2}, {2, 3}};
+
+  auto Iter = Map.Find(2);
+  ASSERT_TRUE(Iter != Map.End());
+  EXPECT_EQ(Iter->Key(), 2);
+  EXPECT_EQ(Iter->Value(), 3);
+  EXPECT_TRUE(Map.Find(3) == Map.End());
+  EXPECT_TRUE(Map.Contains(1));
+  EXPECT_FALSE(Map.Contains(3));
+
+  Map.Clear();
+  EXPECT_TRUE(Map.Empty());
+  EXPECT_TRUE(Map.Find(1) == Map.End());
+
+}
+
+TEST_F(HashMapTests, Elem) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_map = ovk::hash_map<ovk::elem<int,2>,int>;
+
+  hash_map Map;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      Map.Insert({i,j}, 20*i+j);
+    }
+  }
+
+  EXPECT_EQ(Map.Count(), 400);
+  EXPECT_EQ(Map({3,17}), 77);
+  EXPECT_EQ(Map({17,3}), 343);
+  EXPECT_FALSE(Map.Contains({20,0}));
+
+}
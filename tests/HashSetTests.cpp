@@ -0,0 +1,247 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/HashSet.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Elem.hpp>
+#include <ovk/core/ElemSet.hpp>
+#include <ovk/core/Set.hpp>
+
+#include <mpi.h>
+
+#include <array>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class HashSetTests : public tests::mpi_test {};
+
+using testing::UnorderedElementsAre;
+
+namespace {
+template <typename T> std::vector<T> GetValues(const ovk::hash_set<T> &Set) {
+  return {Set.Begin(), Set.End()};
+}
+}
+
+TEST_F(HashSetTests, Meta) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  EXPECT_TRUE((std::is_same<typename hash_set::value_type, int>::value));
+  EXPECT_TRUE((std::is_same<typename hash_set::hash_type, ovk::hash<int>>::value));
+  EXPECT_TRUE((std::is_same<typename hash_set::key_equal_type, std::equal_to<int>>::value));
+  EXPECT_TRUE((std::is_same<typename hash_set::index_type, long long>::value));
+  EXPECT_TRUE((std::is_same<typename hash_set::iterator::pointer, const int *>::value));
+  EXPECT_TRUE((std::is_same<typename hash_set::const_iterator::pointer, const int *>::value));
+
+}
+
+TEST_F(HashSetTests, Create) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  // Default
+  {
+    hash_set Set;
+    EXPECT_EQ(Set.Count(), 0);
+    EXPECT_TRUE(Set.Begin() == Set.End());
+  }
+
+  // Initializer list
+  {
+    hash_set Set = {3, 2, 3};
+    EXPECT_EQ(Set.Count(), 2);
+    EXPECT_THAT(GetValues(Set), UnorderedElementsAre(2, 3));
+  }
+
+  // Iterators
+  {
+    std::array<int,4> SourceValues = {{5, 2, 5, 3}};
+    hash_set Set(SourceValues.begin(), SourceValues.end());
+    EXPECT_EQ(Set.Count(), 3);
+    EXPECT_THAT(GetValues(Set), UnorderedElementsAre(2, 3, 5));
+  }
+
+}
+
+TEST_F(HashSetTests, Insert) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  hash_set Set;
+  Set.Insert(3);
+  Set.Insert(-1);
+  Set.Insert(3);
+  Set.Insert(100);
+
+  EXPECT_EQ(Set.Count(), 3);
+  EXPECT_THAT(GetValues(Set), UnorderedElementsAre(-1, 3, 100));
+
+  // Enough to force several rehashes
+  for (int Value = 0; Value < 1000; ++Value) {
+    Set.Insert(Value);
+  }
+
+  EXPECT_EQ(Set.Count(), 1001);
+  for (int Value = -1; Value < 1000; ++Value) {
+    EXPECT_TRUE(Set.Contains(Value));
+  }
+  EXPECT_TRUE(Set.Contains(100));
+  EXPECT_FALSE(Set.Contains(1000));
+
+}
+
+TEST_F(HashSetTests, Erase) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  // Value
+  {
+    hash_set Set = {1, 2, 3};
+    Set.Erase(2);
+    EXPECT_THAT(GetValues(Set), UnorderedElementsAre(1, 3));
+    Set.Erase(4);
+    EXPECT_THAT(GetValues(Set), UnorderedElementsAre(1, 3));
+  }
+
+  // Iterator
+  {
+    hash_set Set = {1, 2, 3};
+    auto Iter = Set.Erase(Set.Find(1));
+    EXPECT_EQ(Iter-Set.Begin(), 0);
+    EXPECT_THAT(GetValues(Set), UnorderedElementsAre(2, 3));
+  }
+
+  // Interleaved with inserts; exercises probe sequence repair
+  {
+    hash_set Set;
+    ovk::set<int> ReferenceSet;
+    for (int Value = 0; Value < 2000; ++Value) {
+      int Key = (Value*7919) % 1543;
+      if (Value % 3 == 2) {
+        Set.Erase(Key);
+        ReferenceSet.Erase(Key);
+      } else {
+        Set.Insert(Key);
+        ReferenceSet.Insert(Key);
+      }
+    }
+    EXPECT_EQ(Set.Count(), ReferenceSet.Count());
+    for (int Key = 0; Key < 1543; ++Key) {
+      EXPECT_EQ(Set.Contains(Key), ReferenceSet.Contains(Key));
+    }
+  }
+
+}
+
+TEST_F(HashSetTests, EraseIf) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  hash_set Set = {1, 2, 3, 4, 5, 6};
+  Set.EraseIf([](int Value) -> bool { return Value % 2 == 0; });
+
+  EXPECT_THAT(GetValues(Set), UnorderedElementsAre(1, 3, 5));
+  EXPECT_FALSE(Set.Contains(2));
+  EXPECT_FALSE(Set.Contains(4));
+  EXPECT_FALSE(Set.Contains(6));
+
+}
+
+TEST_F(HashSetTests, Clear) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  hash_set Set = {1, 2};
+  Set.Clear();
+
+  EXPECT_EQ(Set.Count(), 0);
+  EXPECT_TRUE(Set.Empty());
+  EXPECT_FALSE(Set.Contains(1));
+
+  Set.Insert(2);
+  EXPECT_THAT(GetValues(Set), UnorderedElementsAre(2));
+
+}
+
+TEST_F(HashSetTests, Find) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  hash_set Set = {1, 2};
+
+  auto Iter = Set.Find(2);
+  ASSERT_TRUE(Iter != Set.End());
+  EXPECT_EQ(*Iter, 2);
+  EXPECT_TRUE(Set.Find(3) == Set.End());
+
+  hash_set EmptySet;
+  EXPECT_TRUE(EmptySet.Find(1) == EmptySet.End());
+
+}
+
+TEST_F(HashSetTests, Elem) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<ovk::elem<int,2>>;
+
+  hash_set Set;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      Set.Insert({i,j});
+      Set.Insert({i,j});
+    }
+  }
+
+  EXPECT_EQ(Set.Count(), 400);
+  EXPECT_TRUE(Set.Contains({3,17}));
+  EXPECT_TRUE(Set.Contains({17,3}));
+  EXPECT_FALSE(Set.Contains({20,0}));
+
+  // Can be used to build an ordered set afterwards
+  ovk::elem_set<int,2> OrderedSet(Set.Begin(), Set.End());
+  EXPECT_EQ(OrderedSet.Count(), 400);
+  EXPECT_EQ(OrderedSet[0], (ovk::elem<int,2>(0,0)));
+  EXPECT_EQ(OrderedSet[1], (ovk::elem<int,2>(0,1)));
+  EXPECT_EQ(OrderedSet[399], (ovk::elem<int,2>(19,19)));
+
+}
+
+TEST_F(HashSetTests, ArrayTraits) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using hash_set = ovk::hash_set<int>;
+
+  EXPECT_TRUE(ovk::core::IsArray<hash_set>());
+  EXPECT_TRUE((std::is_same<ovk::core::array_value_type<hash_set>, int>::value));
+  EXPECT_EQ(ovk::core::ArrayRank<hash_set>(), 1);
+
+  hash_set Set = {1, 2};
+  EXPECT_THAT(ovk::core::ArrayExtents(Set).Begin(), testing::ElementsAre(0));
+  EXPECT_THAT(ovk::core::ArrayExtents(Set).End(), testing::ElementsAre(2));
+  EXPECT_EQ(ovk::core::ArrayData(Set), Set.Data());
+
+}
@@ -170,6 +170,7 @@ TEST_F(IndexerTests, TupleToIndex) {
 
   using indexer_row = ovk::indexer<long long, int, 3, ovk::array_layout::ROW_MAJOR>;
   using indexer_col = ovk::indexer<long long, int, 3, ovk::array_layout::COLUMN_MAJOR>;
+  using indexer_tiled = ovk::indexer<long long, int, 3, ovk::array_layout::TILED>;
 
   // Row major, iterator
   {
@@ -215,6 +216,35 @@ TEST_F(IndexerTests, TupleToIndex) {
     EXPECT_EQ(Index, 43);
   }
 
+  // Tiled, iterator
+  {
+    indexer_tiled Indexer({{0,0,0}, {6,5,3}});
+    ovk::elem<int,3> Tuple = {5,4,1};
+    long long Index = Indexer.ToIndex(Tuple.Data());
+    EXPECT_EQ(Index, 87);
+  }
+
+  // Tiled, array
+  {
+    indexer_tiled Indexer({{0,0,0}, {6,5,3}});
+    long long Index = Indexer.ToIndex(ovk::elem<int,3>(5,4,1));
+    EXPECT_EQ(Index, 87);
+  }
+
+  // Tiled, separate
+  {
+    indexer_tiled Indexer({{0,0,0}, {6,5,3}});
+    long long Index = Indexer.ToIndex(5,4,1);
+    EXPECT_EQ(Index, 87);
+  }
+
+  // Tiled, within a single tile (same as column major)
+  {
+    indexer_tiled Indexer({{1,1,1}, {4,5,6}});
+    long long Index = Indexer.ToIndex(2,3,4);
+    EXPECT_EQ(Index, 43);
+  }
+
 }
 
 TEST_F(IndexerTests, IndexToTuple) {
@@ -223,6 +253,7 @@ TEST_F(IndexerTests, IndexToTuple) {
 
   using indexer_row = ovk::indexer<long long, int, 3, ovk::array_layout::ROW_MAJOR>;
   using indexer_col = ovk::indexer<long long, int, 3, ovk::array_layout::COLUMN_MAJOR>;
+  using indexer_tiled = ovk::indexer<long long, int, 3, ovk::array_layout::TILED>;
 
   // Row major
   {
@@ -238,4 +269,24 @@ TEST_F(IndexerTests, IndexToTuple) {
     EXPECT_THAT(Tuple, ElementsAre(2,3,4));
   }
 
+  // Tiled
+  {
+    indexer_tiled Indexer({{0,0,0}, {6,5,3}});
+    ovk::elem<int,3> Tuple = Indexer.ToTuple(87);
+    EXPECT_THAT(Tuple, ElementsAre(5,4,1));
+  }
+
+  // Tiled, round trip over partial tiles
+  {
+    ovk::interval<int,3> Interval({-1,2,0}, {8,7,6});
+    indexer_tiled Indexer(Interval);
+    long long NumPoints = Interval.Count();
+    bool Valid = true;
+    for (long long iPoint = 0; iPoint < NumPoints; ++iPoint) {
+      ovk::elem<int,3> Tuple = Indexer.ToTuple(iPoint);
+      Valid = Valid && Interval.Contains(Tuple) && Indexer.ToIndex(Tuple) == iPoint;
+    }
+    EXPECT_TRUE(Valid);
+  }
+
 }
@@ -470,6 +470,25 @@ TEST_F(MapTests, Create) {
     EXPECT_EQ(Entries(1).Value(), 2);
   }
 
+  // Iterators, unsorted with duplicates (later entries take precedence)
+  {
+    std::array<map::entry,5> SourceEntries = {{{4, 1}, {2, 2}, {3, 3}, {2, 4}, {4, 5}}};
+    map Map(SourceEntries.begin(), SourceEntries.end());
+    auto &Keys = helper::GetKeys(Map);
+    auto &Entries = helper::GetEntries(Map);
+    EXPECT_EQ(Keys.Count(), 3);
+    EXPECT_EQ(Keys[0], 2);
+    EXPECT_EQ(Keys[1], 3);
+    EXPECT_EQ(Keys[2], 4);
+    EXPECT_EQ(Entries.Count(), 3);
+    EXPECT_EQ(Entries(0).Key(), 2);
+    EXPECT_EQ(Entries(0).Value(), 4);
+    EXPECT_EQ(Entries(1).Key(), 3);
+    EXPECT_EQ(Entries(1).Value(), 3);
+    EXPECT_EQ(Entries(2).Key(), 4);
+    EXPECT_EQ(Entries(2).Value(), 5);
+  }
+
   // Non-default-constructible, default
   {
     map_nondefaultconstructible Map;
@@ -251,3 +251,36 @@ TEST_F(MathTests, LagrangeInterpCubic) {
   }
 
 }
+
+TEST_F(MathTests, LagrangeInterpCoefs) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::LagrangeInterpCoefs;
+
+  // Constant
+  {
+    double Coefs[1] = {0.};
+    LagrangeInterpCoefs(1, 0.3, Coefs);
+    EXPECT_EQ(Coefs[0], 1.);
+  }
+
+  // Linear
+  {
+    double Coefs[2] = {0., 0.};
+    LagrangeInterpCoefs(2, 0.25, Coefs);
+    EXPECT_NEAR(Coefs[0], 0.75, 1.e-12);
+    EXPECT_NEAR(Coefs[1], 0.25, 1.e-12);
+  }
+
+  // Cubic
+  {
+    double Coefs[4] = {0., 0., 0., 0.};
+    LagrangeInterpCoefs(4, -0.5, Coefs);
+    EXPECT_NEAR(Coefs[0], 0.3125, 1.e-12);
+    EXPECT_NEAR(Coefs[1], 0.9375, 1.e-12);
+    EXPECT_NEAR(Coefs[2], -0.3125, 1.e-12);
+    EXPECT_NEAR(Coefs[3], 0.0625, 1.e-12);
+  }
+
+}
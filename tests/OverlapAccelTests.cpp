@@ -0,0 +1,251 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/OverlapAccel.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <ovk/core/Array.hpp>
+#include <ovk/core/Elem.hpp>
+#include <ovk/core/Field.hpp>
+#include <ovk/core/GeometryBase.hpp>
+#include <ovk/core/Optional.hpp>
+#include <ovk/core/Range.hpp>
+#include <ovk/core/Tuple.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+
+class OverlapAccelTests : public tests::mpi_test {};
+
+using testing::DoubleNear;
+
+TEST_F(OverlapAccelTests, FindCellRectilinear) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::overlap_accel;
+  using ovk::geometry_type;
+
+  auto UFunc = [](double U) -> double { return U + 0.1*U*U; };
+  auto VFunc = [](double V) -> double { return 2.*V + 0.05*V*V*V; };
+
+  auto FindCells = [&](double Angle) {
+
+    double Cos = std::cos(Angle);
+    double Sin = std::sin(Angle);
+
+    auto XFunc = [&](double U, double V) -> double { return Cos*UFunc(U) - Sin*VFunc(V); };
+    auto YFunc = [&](double U, double V) -> double { return Sin*UFunc(U) + Cos*VFunc(V); };
+
+    ovk::range NodeRange = {{0,0,0}, {12,10,1}};
+    ovk::range CellRange = {{0,0,0}, {11,9,1}};
+
+    ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange, 0.);
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+        XCoords(i,j,0) = XFunc(double(i), double(j));
+        YCoords(i,j,0) = YFunc(double(i), double(j));
+      }
+    }
+    ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+
+    // Cut a hole in the mask
+    ovk::field<bool> CellMask(CellRange, true);
+    CellMask.Fill({{4,3,0}, {7,5,1}}, false);
+
+    geometry_type OrientedType = Angle == 0. ? geometry_type::RECTILINEAR :
+      geometry_type::ORIENTED_RECTILINEAR;
+
+    overlap_accel RectilinearAccel(OrientedType, 2, CellRange, Coords, CellMask, 1.e-12, 1, 0.25,
+      0.5, 0.5);
+    overlap_accel CurvilinearAccel(geometry_type::CURVILINEAR, 2, CellRange, Coords, CellMask,
+      1.e-12, 1, 0.25, 0.5, 0.5);
+
+    for (int jPoint = -2; jPoint < 4*CellRange.End(1)+2; ++jPoint) {
+      for (int iPoint = -2; iPoint < 4*CellRange.End(0)+2; ++iPoint) {
+        double U = 0.25*double(iPoint) + 0.1;
+        double V = 0.25*double(jPoint) + 0.1;
+        ovk::tuple<double> PointCoords = {XFunc(U, V), YFunc(U, V), 0.};
+        ovk::optional<ovk::tuple<int>> MaybeRectilinearCell, MaybeCurvilinearCell;
+        ovk::optional<ovk::tuple<double>> MaybeRectilinearCellCoords, MaybeCurvilinearCellCoords;
+        RectilinearAccel.FindCell(PointCoords, 1.e-12, MaybeRectilinearCell,
+          MaybeRectilinearCellCoords);
+        CurvilinearAccel.FindCell(PointCoords, 1.e-12, MaybeCurvilinearCell,
+          MaybeCurvilinearCellCoords);
+        ASSERT_EQ(MaybeRectilinearCell.Present(), MaybeCurvilinearCell.Present());
+        if (MaybeRectilinearCell) {
+          EXPECT_EQ(*MaybeRectilinearCell, *MaybeCurvilinearCell);
+          EXPECT_THAT((*MaybeRectilinearCellCoords)(0), DoubleNear((*MaybeCurvilinearCellCoords)(0),
+            1.e-10));
+          EXPECT_THAT((*MaybeRectilinearCellCoords)(1), DoubleNear((*MaybeCurvilinearCellCoords)(1),
+            1.e-10));
+        }
+      }
+    }
+
+  };
+
+  FindCells(0.);
+  FindCells(0.4);
+
+}
+
+TEST_F(OverlapAccelTests, FindCellUniform) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::overlap_accel;
+  using ovk::geometry_type;
+
+  auto FindCells = [&](double Angle) {
+
+    double Cos = std::cos(Angle);
+    double Sin = std::sin(Angle);
+
+    auto XFunc = [&](double U, double V) -> double { return -1. + 0.1*(Cos*U - Sin*2.*V); };
+    auto YFunc = [&](double U, double V) -> double { return 3. + 0.1*(Sin*U + Cos*2.*V); };
+
+    ovk::range NodeRange = {{0,0,0}, {12,10,1}};
+    ovk::range CellRange = {{0,0,0}, {11,9,1}};
+
+    ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange, 0.);
+    for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+      for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+        XCoords(i,j,0) = XFunc(double(i), double(j));
+        YCoords(i,j,0) = YFunc(double(i), double(j));
+      }
+    }
+    ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+
+    // Cut a hole in the mask
+    ovk::field<bool> CellMask(CellRange, true);
+    CellMask.Fill({{4,3,0}, {7,5,1}}, false);
+
+    geometry_type OrientedType = Angle == 0. ? geometry_type::UNIFORM :
+      geometry_type::ORIENTED_UNIFORM;
+
+    overlap_accel UniformAccel(OrientedType, 2, CellRange, Coords, CellMask, 1.e-12, 1, 0.25, 0.5,
+      0.5);
+    overlap_accel CurvilinearAccel(geometry_type::CURVILINEAR, 2, CellRange, Coords, CellMask,
+      1.e-12, 1, 0.25, 0.5, 0.5);
+
+    for (int jPoint = -2; jPoint < 4*CellRange.End(1)+2; ++jPoint) {
+      for (int iPoint = -2; iPoint < 4*CellRange.End(0)+2; ++iPoint) {
+        double U = 0.25*double(iPoint) + 0.1;
+        double V = 0.25*double(jPoint) + 0.1;
+        ovk::tuple<double> PointCoords = {XFunc(U, V), YFunc(U, V), 0.};
+        ovk::optional<ovk::tuple<int>> MaybeUniformCell, MaybeCurvilinearCell;
+        ovk::optional<ovk::tuple<double>> MaybeUniformCellCoords, MaybeCurvilinearCellCoords;
+        UniformAccel.FindCell(PointCoords, 1.e-12, MaybeUniformCell, MaybeUniformCellCoords);
+        CurvilinearAccel.FindCell(PointCoords, 1.e-12, MaybeCurvilinearCell,
+          MaybeCurvilinearCellCoords);
+        ASSERT_EQ(MaybeUniformCell.Present(), MaybeCurvilinearCell.Present());
+        if (MaybeUniformCell) {
+          EXPECT_EQ(*MaybeUniformCell, *MaybeCurvilinearCell);
+          EXPECT_THAT((*MaybeUniformCellCoords)(0), DoubleNear((*MaybeCurvilinearCellCoords)(0),
+            1.e-10));
+          EXPECT_THAT((*MaybeUniformCellCoords)(1), DoubleNear((*MaybeCurvilinearCellCoords)(1),
+            1.e-10));
+        }
+      }
+    }
+
+    // Points on nodes and cell faces belong to more than one cell, so just check that one of them
+    // is found
+    for (int jPoint = -1; jPoint <= CellRange.End(1)+1; ++jPoint) {
+      for (int iPoint = -1; iPoint <= CellRange.End(0)+1; ++iPoint) {
+        double U = double(iPoint);
+        double V = double(jPoint);
+        ovk::tuple<double> PointCoords = {XFunc(U, V), YFunc(U, V), 0.};
+        ovk::optional<ovk::tuple<int>> MaybeUniformCell, MaybeCurvilinearCell;
+        ovk::optional<ovk::tuple<double>> MaybeUniformCellCoords, MaybeCurvilinearCellCoords;
+        UniformAccel.FindCell(PointCoords, 1.e-12, MaybeUniformCell, MaybeUniformCellCoords);
+        CurvilinearAccel.FindCell(PointCoords, 1.e-12, MaybeCurvilinearCell,
+          MaybeCurvilinearCellCoords);
+        ASSERT_EQ(MaybeUniformCell.Present(), MaybeCurvilinearCell.Present());
+        if (MaybeUniformCell) {
+          for (int iDim = 0; iDim < 2; ++iDim) {
+            EXPECT_GE((*MaybeUniformCellCoords)(iDim), -1.e-10);
+            EXPECT_LE((*MaybeUniformCellCoords)(iDim), 1.+1.e-10);
+          }
+        }
+      }
+    }
+
+  };
+
+  FindCells(0.);
+  FindCells(0.4);
+
+}
+
+TEST_F(OverlapAccelTests, FindCellsCurvilinear) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using ovk::core::overlap_accel;
+  using ovk::geometry_type;
+
+  auto XFunc = [](double U, double V) -> double { return U + 0.2*std::sin(0.5*V); };
+  auto YFunc = [](double U, double V) -> double { return 2.*V + 0.2*std::sin(0.7*U); };
+
+  ovk::range NodeRange = {{0,0,0}, {12,10,1}};
+  ovk::range CellRange = {{0,0,0}, {11,9,1}};
+
+  ovk::field<double> XCoords(NodeRange), YCoords(NodeRange), ZCoords(NodeRange, 0.);
+  for (int j = NodeRange.Begin(1); j < NodeRange.End(1); ++j) {
+    for (int i = NodeRange.Begin(0); i < NodeRange.End(0); ++i) {
+      XCoords(i,j,0) = XFunc(double(i), double(j));
+      YCoords(i,j,0) = YFunc(double(i), double(j));
+    }
+  }
+  ovk::elem<ovk::field_view<const double>,3> Coords = {XCoords, YCoords, ZCoords};
+
+  // Cut a hole in the mask
+  ovk::field<bool> CellMask(CellRange, true);
+  CellMask.Fill({{4,3,0}, {7,5,1}}, false);
+
+  overlap_accel Accel(geometry_type::CURVILINEAR, 2, CellRange, Coords, CellMask, 1.e-12, 1, 0.25,
+    0.5, 0.5);
+
+  // Points inside, outside, on nodes, and in the hole, with a different tolerance for some
+  ovk::array<ovk::tuple<double>> PointCoords;
+  ovk::array<double> Tolerances;
+  for (int jPoint = -2; jPoint < 4*CellRange.End(1)+2; ++jPoint) {
+    for (int iPoint = -2; iPoint < 4*CellRange.End(0)+2; ++iPoint) {
+      double U = 0.25*double(iPoint) + (iPoint % 4 == 0 ? 0. : 0.1);
+      double V = 0.25*double(jPoint) + 0.1;
+      PointCoords.Append({XFunc(U, V), YFunc(U, V), 0.});
+      Tolerances.Append(iPoint % 3 == 0 ? 0.1 : 1.e-12);
+    }
+  }
+
+  long long NumPoints = PointCoords.Count();
+
+  ovk::array<ovk::optional<ovk::tuple<int>>> MaybeCells({NumPoints});
+  ovk::array<ovk::optional<ovk::tuple<double>>> MaybeCellCoords({NumPoints});
+  Accel.FindCells(PointCoords, Tolerances, MaybeCells, MaybeCellCoords);
+
+  long long NumFound = 0;
+  for (long long iPoint = 0; iPoint < NumPoints; ++iPoint) {
+    ovk::optional<ovk::tuple<int>> MaybeCell;
+    ovk::optional<ovk::tuple<double>> MaybeSingleCellCoords;
+    Accel.FindCell(PointCoords(iPoint), Tolerances(iPoint), MaybeCell, MaybeSingleCellCoords);
+    ASSERT_EQ(MaybeCells(iPoint).Present(), MaybeCell.Present());
+    if (MaybeCell) {
+      EXPECT_EQ(*MaybeCells(iPoint), *MaybeCell);
+      EXPECT_THAT((*MaybeCellCoords(iPoint))(0), DoubleNear((*MaybeSingleCellCoords)(0), 1.e-10));
+      EXPECT_THAT((*MaybeCellCoords(iPoint))(1), DoubleNear((*MaybeSingleCellCoords)(1), 1.e-10));
+      ++NumFound;
+    }
+  }
+
+  EXPECT_GT(NumFound, 0);
+  EXPECT_LT(NumFound, NumPoints);
+
+}
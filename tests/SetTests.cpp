@@ -77,6 +77,14 @@ TEST_F(SetTests, Create) {
     EXPECT_EQ(Values(1), 3);
   }
 
+  // Iterators, unsorted with duplicates
+  {
+    std::array<int,6> SourceValues = {{5, 3, 2, 5, 4, 3}};
+    set Set(SourceValues.begin(), SourceValues.end());
+    auto &Values = helper::GetValues(Set);
+    EXPECT_THAT(Values, ElementsAre(2, 3, 4, 5));
+  }
+
 }
 
 TEST_F(SetTests, Copy) {
@@ -189,6 +197,16 @@ TEST_F(SetTests, Assign) {
     EXPECT_EQ(Values(1), 3);
   }
 
+  // Iterators into the set itself, Assign
+  {
+    set Set = {1, 2, 3};
+    Set.Assign(Set.Begin()+1, Set.End());
+    auto &Values = helper::GetValues(Set);
+    EXPECT_EQ(Values.Count(), 2);
+    EXPECT_EQ(Values(0), 2);
+    EXPECT_EQ(Values(1), 3);
+  }
+
 }
 
 TEST_F(SetTests, Reserve) {
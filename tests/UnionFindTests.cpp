@@ -0,0 +1,195 @@
+// Copyright (c) 2020 Matthew J. Smith and Overkit contributors
+// License: MIT (http://opensource.org/licenses/MIT)
+
+#include <ovk/core/UnionFind.hpp>
+
+#include "tests/MPITest.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <mpi.h>
+
+#include <vector>
+
+class UnionFindTests : public tests::mpi_test {};
+
+using testing::ElementsAre;
+
+TEST_F(UnionFindTests, Insert) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using union_find = ovk::core::union_find;
+
+  union_find UnionFind;
+  EXPECT_EQ(UnionFind.Count(), 0);
+  EXPECT_EQ(UnionFind.Find(0), -1);
+
+  // Out of order, in both directions, and with duplicates
+  UnionFind.Insert(5);
+  UnionFind.Insert(3);
+  UnionFind.Insert(10);
+  UnionFind.Insert(-2);
+  UnionFind.Insert(3);
+  UnionFind.Insert(100);
+
+  EXPECT_EQ(UnionFind.Count(), 5);
+  std::vector<int> Elements(UnionFind.Begin(), UnionFind.End());
+  EXPECT_THAT(Elements, ElementsAre(-2, 3, 5, 10, 100));
+
+  EXPECT_EQ(UnionFind.Find(-2), -2);
+  EXPECT_EQ(UnionFind.Find(3), 3);
+  EXPECT_EQ(UnionFind.Find(5), 5);
+  EXPECT_EQ(UnionFind.Find(10), 10);
+  EXPECT_EQ(UnionFind.Find(100), 100);
+  EXPECT_EQ(UnionFind.Find(4), -1);
+  EXPECT_EQ(UnionFind.Find(-3), -1);
+  EXPECT_EQ(UnionFind.Find(101), -1);
+
+}
+
+TEST_F(UnionFindTests, Union) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using union_find = ovk::core::union_find;
+
+  union_find UnionFind;
+  for (int Element = 0; Element < 8; ++Element) {
+    UnionFind.Insert(Element);
+  }
+
+  int Root = UnionFind.Union(1, 2);
+  EXPECT_TRUE(Root == 1 || Root == 2);
+  EXPECT_EQ(UnionFind.Find(1), UnionFind.Find(2));
+
+  UnionFind.Union(3, 4);
+  UnionFind.Union(2, 4);
+  UnionFind.Union(6, 7);
+
+  EXPECT_EQ(UnionFind.Find(1), UnionFind.Find(3));
+  EXPECT_EQ(UnionFind.Find(2), UnionFind.Find(4));
+  EXPECT_NE(UnionFind.Find(1), UnionFind.Find(0));
+  EXPECT_NE(UnionFind.Find(1), UnionFind.Find(6));
+  EXPECT_EQ(UnionFind.Find(6), UnionFind.Find(7));
+  EXPECT_EQ(UnionFind.Find(5), 5);
+
+  // Union with elements not in any set
+  EXPECT_EQ(UnionFind.Union(5, 20), 5);
+  EXPECT_EQ(UnionFind.Union(20, 0), 0);
+  EXPECT_EQ(UnionFind.Union(20, 21), -1);
+
+}
+
+TEST_F(UnionFindTests, Relabel) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using union_find = ovk::core::union_find;
+
+  union_find UnionFind;
+  for (int Element = 9; Element >= 0; --Element) {
+    UnionFind.Insert(Element);
+  }
+
+  // Chain that would make the largest element the root without relabeling
+  UnionFind.Union(9, 7);
+  UnionFind.Union(9, 5);
+  UnionFind.Union(8, 6);
+  UnionFind.Union(6, 4);
+  UnionFind.Union(4, 9);
+  UnionFind.Union(3, 1);
+
+  UnionFind.Relabel();
+
+  EXPECT_EQ(UnionFind.Find(0), 0);
+  EXPECT_EQ(UnionFind.Find(1), 1);
+  EXPECT_EQ(UnionFind.Find(2), 2);
+  EXPECT_EQ(UnionFind.Find(3), 1);
+  EXPECT_EQ(UnionFind.Find(4), 4);
+  EXPECT_EQ(UnionFind.Find(5), 4);
+  EXPECT_EQ(UnionFind.Find(6), 4);
+  EXPECT_EQ(UnionFind.Find(7), 4);
+  EXPECT_EQ(UnionFind.Find(8), 4);
+  EXPECT_EQ(UnionFind.Find(9), 4);
+
+  // Should still work after relabeling
+  UnionFind.Union(2, 9);
+  UnionFind.Relabel();
+
+  EXPECT_EQ(UnionFind.Find(9), 2);
+  EXPECT_EQ(UnionFind.Find(4), 2);
+  EXPECT_EQ(UnionFind.Find(3), 1);
+
+}
+
+TEST_F(UnionFindTests, Large) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using union_find = ovk::core::union_find;
+
+  constexpr int N = 100000;
+
+  union_find UnionFind;
+  UnionFind.Reserve(N);
+  for (int Element = 0; Element < N; ++Element) {
+    UnionFind.Insert(Element);
+  }
+
+  // Join elements with the same remainder mod 3
+  for (int Element = 3; Element < N; ++Element) {
+    UnionFind.Union(Element, Element-3);
+  }
+
+  UnionFind.Relabel();
+
+  for (int Element = 0; Element < N; ++Element) {
+    ASSERT_EQ(UnionFind.Find(Element), Element % 3);
+  }
+
+}
+
+TEST_F(UnionFindTests, Sparse) {
+
+  if (TestComm().Rank() != 0) return;
+
+  using union_find = ovk::core::union_find;
+
+  // Span is far larger than the element count, so lookups go through the hash map
+  constexpr int N = 1000;
+  constexpr int Spacing = 1 << 20;
+
+  union_find UnionFind;
+  UnionFind.Insert(0);
+  UnionFind.Insert(1);
+  for (int iElement = 1; iElement < N; ++iElement) {
+    UnionFind.Insert(iElement*Spacing);
+    UnionFind.Insert(-iElement*Spacing);
+  }
+  UnionFind.Insert(1);
+
+  EXPECT_EQ(UnionFind.Count(), 2*N);
+  EXPECT_EQ(UnionFind.Find(1), 1);
+  EXPECT_EQ(UnionFind.Find(2), -1);
+  EXPECT_EQ(UnionFind.Find(Spacing+1), -1);
+
+  // Join each element with its negation
+  for (int iElement = 1; iElement < N; ++iElement) {
+    UnionFind.Union(iElement*Spacing, -iElement*Spacing);
+  }
+  UnionFind.Union(0, 1);
+
+  UnionFind.Relabel();
+
+  EXPECT_EQ(UnionFind.Find(1), 0);
+  for (int iElement = 1; iElement < N; ++iElement) {
+    ASSERT_EQ(UnionFind.Find(iElement*Spacing), -iElement*Spacing);
+  }
+
+  std::vector<int> Elements(UnionFind.Begin(), UnionFind.End());
+  EXPECT_EQ(Elements.front(), -(N-1)*Spacing);
+  EXPECT_EQ(Elements.back(), (N-1)*Spacing);
+
+}